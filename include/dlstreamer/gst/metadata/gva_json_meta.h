@@ -23,11 +23,13 @@ G_BEGIN_DECLS
 typedef struct _GstGVAJSONMeta GstGVAJSONMeta;
 
 /**
- * @brief This struct represents JSON metadata and contains instance of parent GstMeta and message
+ * @brief This struct represents JSON metadata and contains instance of parent GstMeta and message. Message is
+ * C-string, unless it is binary message (e.g. CBOR) set with set_binary_message()
  */
 struct _GstGVAJSONMeta {
     GstMeta meta;   /**< parent GstMeta */
-    gchar *message; /**< C-string message */
+    gchar *message; /**< C-string message, or binary message followed by terminating zero */
+    gsize size;     /**< size of binary message in bytes, 0 if message is C-string */
 };
 
 /**
@@ -92,6 +94,15 @@ gchar *get_json_message(GstGVAJSONMeta *meta);
  */
 void set_json_message(GstGVAJSONMeta *meta, const gchar *message);
 
+/**
+ * @brief This function sets message field of _GstGVAJSONMeta to copy of binary data, which may contain zero bytes
+ * @param meta _GstGVAJSONMeta* to set message
+ * @param data binary message
+ * @param size size of binary message in bytes
+ * @return void
+ */
+void set_binary_message(GstGVAJSONMeta *meta, gconstpointer data, gsize size);
+
 G_END_DECLS
 
 #endif /* __GVA_JSON_META_H__ */
@@ -0,0 +1,167 @@
+# ==============================================================================
+# Copyright (C) 2026 Intel Corporation
+#
+# SPDX-License-Identifier: MIT
+# ==============================================================================
+
+## @file cbor_metadata.py
+#  @brief This file contains decoder of binary messages produced by gvametaconvert format=cbor. Messages follow
+#  src/monolithic/gst/elements/gvametaconvert/cbor_metadata.cddl schema. Decoder depends on the standard library only
+#  and can be used as a tool converting a file written by gvametapublish file-format=cbor-sequence to JSON Lines:
+#
+#      python3 cbor_metadata.py metadata.cbor > metadata.jsonl
+
+import array
+import json
+import struct
+import sys
+
+_BREAK = object()
+
+# Element type of raw tensor data by tensor precision, any other precision is float32
+_TENSOR_DATA_TYPES = {"U8": "B", "I64": "q"}
+
+
+class _Decoder:
+    def __init__(self, data):
+        self._data = memoryview(data)
+        self.offset = 0
+
+    def _take(self, size):
+        if self.offset + size > len(self._data):
+            raise ValueError("Truncated CBOR data item at offset {}".format(self.offset))
+        chunk = self._data[self.offset:self.offset + size]
+        self.offset += size
+        return chunk
+
+    def _argument(self, info):
+        if info < 24:
+            return info
+        if info == 24:
+            return self._take(1)[0]
+        if info == 25:
+            return struct.unpack(">H", self._take(2))[0]
+        if info == 26:
+            return struct.unpack(">I", self._take(4))[0]
+        if info == 27:
+            return struct.unpack(">Q", self._take(8))[0]
+        if info == 31:
+            return None  # indefinite length
+        raise ValueError("Malformed CBOR argument {} at offset {}".format(info, self.offset))
+
+    def _string(self, major, length):
+        if length is not None:
+            return bytes(self._take(length))
+        chunks = []
+        while True:
+            chunk = self.decode(allow_break=True)
+            if chunk is _BREAK:
+                return b"".join(chunks)
+            chunks.append(chunk if major == 2 else chunk.encode("utf-8"))
+
+    def decode(self, allow_break=False):
+        initial = self._take(1)[0]
+        major, info = initial >> 5, initial & 0x1f
+        if major == 7:
+            if info == 31:
+                if not allow_break:
+                    raise ValueError("Unexpected CBOR break at offset {}".format(self.offset - 1))
+                return _BREAK
+            if info == 25:
+                return struct.unpack(">e", self._take(2))[0]
+            if info == 26:
+                return struct.unpack(">f", self._take(4))[0]
+            if info == 27:
+                return struct.unpack(">d", self._take(8))[0]
+            return {20: False, 21: True, 22: None, 23: None}.get(info, self._argument(info))
+
+        argument = self._argument(info)
+        if major == 0:
+            return argument
+        if major == 1:
+            return -1 - argument
+        if major == 2:
+            return self._string(major, argument)
+        if major == 3:
+            return self._string(major, argument).decode("utf-8")
+        if major == 4:
+            items = []
+            while argument is None or len(items) < argument:
+                item = self.decode(allow_break=argument is None)
+                if item is _BREAK:
+                    break
+                items.append(item)
+            return items
+        if major == 5:
+            members = {}
+            count = 0
+            while argument is None or count < argument:
+                key = self.decode(allow_break=argument is None)
+                if key is _BREAK:
+                    break
+                value = self.decode()
+                # The first of duplicated keys is the one JSON message contains
+                members.setdefault(key, value)
+                count += 1
+            return members
+        # major == 6, tag content is returned as is
+        return self.decode()
+
+
+def decode(data):
+    """Decodes single CBOR message into dict"""
+    decoder = _Decoder(data)
+    message = decoder.decode()
+    if decoder.offset != len(data):
+        raise ValueError("Extra data after CBOR message at offset {}".format(decoder.offset))
+    return message
+
+
+def decode_sequence(data):
+    """Yields messages of CBOR sequence, e.g. file written by gvametapublish file-format=cbor-sequence"""
+    decoder = _Decoder(data)
+    while decoder.offset < len(data):
+        yield decoder.decode()
+
+
+def tensor_data(tensor, byteorder=sys.byteorder):
+    """Returns raw data of tensor dict as array of values of tensor precision"""
+    values = array.array(_TENSOR_DATA_TYPES.get(tensor.get("precision"), "f"))
+    raw = tensor.get("data", b"")
+    values.frombytes(raw[:len(raw) - len(raw) % values.itemsize])
+    if byteorder != sys.byteorder:
+        values.byteswap()
+    return values
+
+
+def to_json_compatible(message, byteorder=sys.byteorder):
+    """Replaces raw tensor data with lists of numbers, as in JSON message of gvametaconvert format=json"""
+    if isinstance(message, list):
+        return [to_json_compatible(item, byteorder) for item in message]
+    if not isinstance(message, dict):
+        return message
+    converted = {}
+    for key, value in message.items():
+        if key == "data" and isinstance(value, bytes):
+            converted[key] = tensor_data(message, byteorder).tolist()
+        else:
+            converted[key] = to_json_compatible(value, byteorder)
+    return converted
+
+
+def main(argv):
+    if len(argv) > 2:
+        print("Usage: {} [CBOR_SEQUENCE_FILE]".format(argv[0]), file=sys.stderr)
+        return 1
+    if len(argv) == 2:
+        with open(argv[1], "rb") as file:
+            data = file.read()
+    else:
+        data = sys.stdin.buffer.read()
+    for message in decode_sequence(data):
+        print(json.dumps(to_json_compatible(message), sort_keys=True))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -381,12 +381,21 @@ class GVAJSONMetaStr(str):
 class GVAJSONMeta(ctypes.Structure):
     _fields_ = [('_meta_flags', ctypes.c_int),
                 ('_info', ctypes.c_void_p),
-                ('_message', ctypes.c_char_p)
+                ('_message', ctypes.c_char_p),
+                ('_size', ctypes.c_size_t)
                 ]
 
     def get_message(self):
         return GVAJSONMetaStr(self, self._message.decode('utf-8'))
 
+    def is_binary(self):
+        return self._size != 0
+
+    def get_binary_message(self):
+        # c_char_p field reads up to the first zero byte, binary message is read by its size
+        message = ctypes.cast(ctypes.addressof(self) + GVAJSONMeta._message.offset, ctypes.POINTER(ctypes.c_void_p))
+        return ctypes.string_at(message.contents.value, self._size)
+
     @classmethod
     def remove_json_meta(cls, buffer, meta):
         return libgst.gst_buffer_remove_meta(hash(buffer), ctypes.byref(meta))
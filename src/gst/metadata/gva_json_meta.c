@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
@@ -27,6 +27,7 @@ gboolean gst_gva_json_meta_init(GstMeta *meta, gpointer params, GstBuffer *buffe
 
     GstGVAJSONMeta *json_meta = (GstGVAJSONMeta *)meta;
     json_meta->message = 0;
+    json_meta->size = 0;
     return TRUE;
 }
 
@@ -41,9 +42,10 @@ gboolean gst_gva_json_meta_transform(GstBuffer *dest_buf, GstMeta *src_meta, Gst
     GstGVAJSONMeta *dst = GST_GVA_JSON_META_ADD(dest_buf);
     GstGVAJSONMeta *src = (GstGVAJSONMeta *)src_meta;
 
-    if (dst->message)
-        g_free(dst->message);
-    dst->message = g_strdup(src->message);
+    if (src->size)
+        set_binary_message(dst, src->message, src->size);
+    else
+        set_json_message(dst, src->message);
     return TRUE;
 }
 
@@ -55,6 +57,7 @@ void gst_gva_json_meta_free(GstMeta *meta, GstBuffer *buffer) {
         g_free(json_meta->message);
         json_meta->message = NULL;
     }
+    json_meta->size = 0;
 }
 
 DLS_EXPORT const GstMetaInfo *gst_gva_json_meta_get_info(void) {
@@ -78,3 +81,12 @@ void set_json_message(GstGVAJSONMeta *meta, const gchar *message) {
     gst_gva_json_meta_free((GstMeta *)meta, NULL);
     meta->message = g_strdup(message);
 }
+
+void set_binary_message(GstGVAJSONMeta *meta, gconstpointer data, gsize size) {
+    gst_gva_json_meta_free((GstMeta *)meta, NULL);
+    // Terminating zero keeps consumers reading message as C-string within bounds
+    meta->message = (gchar *)g_malloc(size + 1);
+    memcpy(meta->message, data, size);
+    meta->message[size] = '\0';
+    meta->size = size;
+}
@@ -0,0 +1,260 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "inference_queue_tracer.h"
+#include "queue_counters.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+using namespace std;
+
+#define ELEMENT_DESCRIPTION "Inference queue tracer to sample queue depths and stall times of inference elements"
+GST_DEBUG_CATEGORY_STATIC(inference_queue_tracer_debug);
+#define GST_CAT_DEFAULT inference_queue_tracer_debug
+G_DEFINE_TYPE(InferenceQueueTracer, inference_queue_tracer, GST_TYPE_TRACER);
+
+static GstTracerRecord *tr_queue;
+static const gchar *queue_stats_property = "queue-stats";
+static const gint default_interval = 1000;
+static const double ns_to_ms = 1000000.0;
+#define UNUSED(x) (void)(x)
+
+static guint64 read_counter(const GstStructure *stats, const gchar *name) {
+    guint64 value = 0;
+    gst_structure_get_uint64(stats, name, &value);
+    return value;
+}
+
+static QueueCounters read_counters(const GstStructure *stats) {
+    QueueCounters counters;
+    counters.batches = read_counter(stats, "batches");
+    counters.batched_frames = read_counter(stats, "batched-frames");
+    counters.free_request_wait = read_counter(stats, "free-request-wait");
+    counters.admission_wait = read_counter(stats, "admission-wait");
+    counters.downstream_wait = read_counter(stats, "downstream-wait");
+    return counters;
+}
+
+/**
+ * Reads queue-stats of inference elements every interval in own thread, so stalled pipelines are sampled as well.
+ * Elements are held by weak references and dropped from sampling once destroyed. The thread is started when the
+ * first inference element is created.
+ */
+class QueueSampler {
+  public:
+    explicit QueueSampler(chrono::milliseconds interval) : _interval(interval) {
+    }
+
+    ~QueueSampler() {
+        {
+            lock_guard<mutex> guard(_mutex);
+            _stop = true;
+        }
+        _cv.notify_all();
+        if (_thread.joinable())
+            _thread.join();
+    }
+
+    void add(GstElement *element) {
+        auto entry = make_unique<Entry>();
+        g_weak_ref_init(&entry->element, element);
+        lock_guard<mutex> guard(_mutex);
+        _entries.push_back(std::move(entry));
+        if (!_thread.joinable())
+            _thread = thread(&QueueSampler::run, this);
+    }
+
+  private:
+    struct Entry {
+        GWeakRef element;
+        QueueCounters last;
+
+        ~Entry() {
+            g_weak_ref_clear(&element);
+        }
+    };
+
+    void run() {
+        unique_lock<mutex> lock(_mutex);
+        auto last_sample = chrono::steady_clock::now();
+        auto next_sample = last_sample + _interval;
+        while (!_cv.wait_until(lock, next_sample, [this] { return _stop; })) {
+            const auto now = chrono::steady_clock::now();
+            const double interval_ms = chrono::duration<double, milli>(now - last_sample).count();
+            last_sample = now;
+            // keep the period, intervals missed e.g. while the process was suspended are skipped
+            next_sample += _interval;
+            if (next_sample <= now)
+                next_sample = now + _interval;
+
+            // element-new hook must not wait for sampling, entries are removed only by this thread
+            vector<Entry *> entries;
+            for (auto &entry : _entries)
+                entries.push_back(entry.get());
+            lock.unlock();
+            vector<Entry *> destroyed;
+            for (Entry *entry : entries) {
+                if (!sample(*entry, interval_ms))
+                    destroyed.push_back(entry);
+            }
+            lock.lock();
+            _entries.remove_if([&](const unique_ptr<Entry> &entry) {
+                return find(destroyed.begin(), destroyed.end(), entry.get()) != destroyed.end();
+            });
+        }
+    }
+
+    // Returns false if the element was destroyed
+    static bool sample(Entry &entry, double interval_ms) {
+        GstElement *element = static_cast<GstElement *>(g_weak_ref_get(&entry.element));
+        if (!element)
+            return false;
+
+        GstStructure *stats = nullptr;
+        g_object_get(element, queue_stats_property, &stats, NULL);
+        if (stats) { // NULL until the element acquires inference instance
+            guint nireq = 0, batch_size = 0, requests_in_flight = 0, reorder_depth = 0, frames_in_flight = 0;
+            gst_structure_get_uint(stats, "nireq", &nireq);
+            gst_structure_get_uint(stats, "batch-size", &batch_size);
+            gst_structure_get_uint(stats, "requests-in-flight", &requests_in_flight);
+            gst_structure_get_uint(stats, "reorder-depth", &reorder_depth);
+            gst_structure_get_uint(stats, "frames-in-flight", &frames_in_flight);
+            const QueueCounters counters = read_counters(stats);
+            gst_structure_free(stats);
+
+            const QueueCounters delta = counters.since(entry.last);
+            const double batch_fill = delta.batches && batch_size
+                                          ? static_cast<double>(delta.batched_frames) / (delta.batches * batch_size)
+                                          : 0.0;
+            const double free_request_wait = delta.free_request_wait / ns_to_ms;
+            const double admission_wait = delta.admission_wait / ns_to_ms;
+            const double downstream_wait = delta.downstream_wait / ns_to_ms;
+
+            gchar *name = gst_element_get_name(element);
+            gst_tracer_record_log(tr_queue, name, interval_ms, nireq, requests_in_flight, batch_fill, reorder_depth,
+                                  frames_in_flight, free_request_wait, admission_wait, downstream_wait);
+            g_free(name);
+            entry.last = counters;
+        }
+        gst_object_unref(element);
+        return true;
+    }
+
+    const chrono::milliseconds _interval;
+    mutex _mutex;
+    condition_variable _cv;
+    bool _stop = false;
+    list<unique_ptr<Entry>> _entries;
+    thread _thread;
+};
+
+static void on_element_new(InferenceQueueTracer *iqt, guint64 ts, GstElement *elem) {
+    UNUSED(ts);
+    // Inference elements are recognized by the property, the tracer doesn't link them
+    GParamSpec *pspec = g_object_class_find_property(G_OBJECT_GET_CLASS(elem), queue_stats_property);
+    if (!pspec || pspec->value_type != GST_TYPE_STRUCTURE || !(pspec->flags & G_PARAM_READABLE) || !iqt->sampler)
+        return;
+    GST_INFO_OBJECT(iqt, "Sampling inference queue of %s every %d ms", GST_ELEMENT_NAME(elem), iqt->interval);
+    static_cast<QueueSampler *>(iqt->sampler)->add(elem);
+}
+
+static void inference_queue_tracer_constructed(GObject *object) {
+    InferenceQueueTracer *iqt = INFERENCE_QUEUE_TRACER(object);
+    gchar *params, *tmp;
+    GstStructure *params_struct = NULL;
+    g_object_get(iqt, "params", &params, NULL);
+    if (params) {
+        tmp = g_strdup_printf("inference_queue_tracer,%s", params);
+        params_struct = gst_structure_from_string(tmp, NULL);
+        g_free(tmp);
+        if (params_struct) {
+            gint interval = default_interval;
+            if (gst_structure_get_int(params_struct, "interval", &interval)) {
+                if (interval > 0)
+                    iqt->interval = interval;
+                else
+                    GST_WARNING_OBJECT(iqt, "Invalid interval %d, using %d ms", interval, default_interval);
+            }
+            GST_INFO_OBJECT(iqt, "interval set to %d ms", iqt->interval);
+            gst_structure_free(params_struct);
+        }
+        g_free(params);
+    }
+
+    iqt->sampler = new QueueSampler(chrono::milliseconds(iqt->interval));
+}
+
+static void inference_queue_tracer_finalize(GObject *object) {
+    InferenceQueueTracer *iqt = INFERENCE_QUEUE_TRACER(object);
+
+    delete static_cast<QueueSampler *>(iqt->sampler);
+    iqt->sampler = nullptr;
+
+    G_OBJECT_CLASS(inference_queue_tracer_parent_class)->finalize(object);
+}
+
+static void inference_queue_tracer_class_init(InferenceQueueTracerClass *klass) {
+    GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
+    gobject_class->constructed = inference_queue_tracer_constructed;
+    gobject_class->finalize = inference_queue_tracer_finalize;
+    tr_queue = gst_tracer_record_new(
+        "inference_queue_tracer.class", "name", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_STRING, "description", G_TYPE_STRING, "Element Name",
+                          NULL),
+        "interval", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING, "Interval ms",
+                          NULL),
+        "nireq", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_UINT, "description", G_TYPE_STRING,
+                          "Number of inference requests", NULL),
+        "requests_in_flight", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_UINT, "description", G_TYPE_STRING,
+                          "Inference requests running at sampling time", NULL),
+        "batch_fill", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "Average ratio of frames to batch-size in batches started within the interval", NULL),
+        "reorder_depth", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_UINT, "description", G_TYPE_STRING,
+                          "Frames of the element waiting in output reorder buffer at sampling time", NULL),
+        "frames_in_flight", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_UINT, "description", G_TYPE_STRING,
+                          "Frames of all elements sharing inference instance at sampling time", NULL),
+        "free_request_wait", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "Time in ms threads were blocked waiting for a free inference request within the interval",
+                          NULL),
+        "admission_wait", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "Time in ms frames waited for admission to inference within the interval", NULL),
+        "downstream_wait", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "Time in ms spent in pushing frames downstream within the interval, including a blocked push",
+                          NULL),
+        NULL);
+    GST_DEBUG_CATEGORY_INIT(inference_queue_tracer_debug, "inference_queue_tracer", 0, "inference queue tracer");
+}
+
+static void inference_queue_tracer_init(InferenceQueueTracer *iqt) {
+    iqt->interval = default_interval;
+    iqt->sampler = nullptr;
+
+    gst_tracing_register_hook(GST_TRACER(iqt), "element-new", G_CALLBACK(on_element_new));
+}
+
+static gboolean plugin_init(GstPlugin *plugin) {
+    if (!gst_tracer_register(plugin, "inference_queue_tracer", inference_queue_tracer_get_type()))
+        return false;
+    return true;
+}
+
+GST_PLUGIN_DEFINE(GST_VERSION_MAJOR, GST_VERSION_MINOR, inference_queue_tracer, ELEMENT_DESCRIPTION, plugin_init,
+                  PLUGIN_VERSION, PLUGIN_LICENSE, PACKAGE_NAME, GST_PACKAGE_ORIGIN)
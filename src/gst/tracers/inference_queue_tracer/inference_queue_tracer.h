@@ -0,0 +1,37 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <gst/gst.h>
+#include <gst/gsttracer.h>
+
+G_BEGIN_DECLS
+
+#define INFERENCE_QUEUE_TRACER_TYPE (inference_queue_tracer_get_type())
+#define INFERENCE_QUEUE_TRACER(obj)                                                                                    \
+    (G_TYPE_CHECK_INSTANCE_CAST((obj), INFERENCE_QUEUE_TRACER_TYPE, InferenceQueueTracer))
+#define INFERENCE_QUEUE_TRACER_CLASS(klass)                                                                            \
+    (G_TYPE_CHECK_CLASS_CAST((klass), INFERENCE_QUEUE_TRACER_TYPE, InferenceQueueTracerClass))
+#define IS_INFERENCE_QUEUE_TRACER(obj) (G_TYPE_CHECK_INSTANCE_TYPE((obj), INFERENCE_QUEUE_TRACER_TYPE))
+#define IS_INFERENCE_QUEUE_TRACER_CLASS(klass) (G_TYPE_CHECK_CLASS_TYPE((klass), INFERENCE_QUEUE_TRACER_TYPE))
+#define INFERENCE_QUEUE_TRACER_CAST(obj) ((InferenceQueueTracer *)(obj))
+
+struct InferenceQueueTracer {
+    GstTracer parent;
+
+    /*< private >*/
+    gint interval;    // sampling interval in ms
+    gpointer sampler; // Sampling thread and inference elements (void* to avoid C++ in header)
+};
+
+struct InferenceQueueTracerClass {
+    GstTracerClass parent_class;
+};
+
+G_GNUC_INTERNAL GType inference_queue_tracer_get_type(void);
+
+G_END_DECLS
@@ -0,0 +1,37 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+// Difference of a cumulative counter from its previous sample, 0 if the counter went back
+inline uint64_t counter_delta(uint64_t current, uint64_t previous) {
+    return current > previous ? current - previous : 0;
+}
+
+/**
+ * Cumulative counters of queue-stats, reported as differences between consecutive samples. A counter goes back when
+ * inference instance or element's stream is created again, e.g. after restart. Each counter is clamped separately,
+ * so a counter read at a different moment than the others does not reset them.
+ */
+struct QueueCounters {
+    uint64_t batches = 0;
+    uint64_t batched_frames = 0;
+    uint64_t free_request_wait = 0;
+    uint64_t admission_wait = 0;
+    uint64_t downstream_wait = 0;
+
+    QueueCounters since(const QueueCounters &previous) const {
+        QueueCounters delta;
+        delta.batches = counter_delta(batches, previous.batches);
+        delta.batched_frames = counter_delta(batched_frames, previous.batched_frames);
+        delta.free_request_wait = counter_delta(free_request_wait, previous.free_request_wait);
+        delta.admission_wait = counter_delta(admission_wait, previous.admission_wait);
+        delta.downstream_wait = counter_delta(downstream_wait, previous.downstream_wait);
+        return delta;
+    }
+};
@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include "thread_shards.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <limits>
+
+inline void atomic_store_min(std::atomic<uint64_t> &min, uint64_t value) {
+    uint64_t current = min.load(std::memory_order_relaxed);
+    while (value < current && !min.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+inline void atomic_store_max(std::atomic<uint64_t> &max, uint64_t value) {
+    uint64_t current = max.load(std::memory_order_relaxed);
+    while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+/**
+ * HDR (high dynamic range) histogram of latencies in nanoseconds. Values below 128 ns have own buckets, each
+ * further power of two range is split into 64 buckets, so any value is stored with relative error below 1.6%.
+ * Values above MAX_VALUE (~18 minutes) are counted in the last bucket. Exact count, sum, min and max are kept
+ * besides the buckets.
+ */
+class LatencyHistogram {
+  public:
+    static constexpr unsigned SUB_BUCKET_BITS = 7;
+    static constexpr uint64_t SUB_BUCKET_COUNT = 1ull << SUB_BUCKET_BITS;
+    static constexpr uint64_t SUB_BUCKET_HALF = SUB_BUCKET_COUNT / 2;
+    static constexpr uint64_t MAX_VALUE = (1ull << 40) - 1;
+    static constexpr size_t BUCKET_COUNT =
+        SUB_BUCKET_COUNT + (std::bit_width(MAX_VALUE) - SUB_BUCKET_BITS) * SUB_BUCKET_HALF;
+
+    static size_t bucket_index(uint64_t value) {
+        value = std::min(value, MAX_VALUE);
+        if (value < SUB_BUCKET_COUNT)
+            return value;
+        // value >> shift is in [SUB_BUCKET_HALF, SUB_BUCKET_COUNT)
+        const unsigned shift = std::bit_width(value) - SUB_BUCKET_BITS;
+        return SUB_BUCKET_COUNT + (shift - 1) * SUB_BUCKET_HALF + ((value >> shift) - SUB_BUCKET_HALF);
+    }
+
+    static uint64_t bucket_lowest_value(size_t index) {
+        if (index < SUB_BUCKET_COUNT)
+            return index;
+        const size_t shift = (index - SUB_BUCKET_COUNT) / SUB_BUCKET_HALF + 1;
+        return (SUB_BUCKET_HALF + (index - SUB_BUCKET_COUNT) % SUB_BUCKET_HALF) << shift;
+    }
+
+    static uint64_t bucket_highest_value(size_t index) {
+        if (index < SUB_BUCKET_COUNT)
+            return index;
+        const size_t shift = (index - SUB_BUCKET_COUNT) / SUB_BUCKET_HALF + 1;
+        return bucket_lowest_value(index) + (1ull << shift) - 1;
+    }
+
+    void record(uint64_t value) {
+        _counts[bucket_index(value)]++;
+        _count++;
+        _sum += value;
+        _min = std::min(_min, value);
+        _max = std::max(_max, value);
+    }
+
+    void add(const LatencyHistogram &other) {
+        for (size_t i = 0; i < BUCKET_COUNT; i++)
+            _counts[i] += other._counts[i];
+        _count += other._count;
+        _sum += other._sum;
+        _min = std::min(_min, other._min);
+        _max = std::max(_max, other._max);
+    }
+
+    uint64_t count() const {
+        return _count;
+    }
+
+    uint64_t bucket_count(size_t index) const {
+        return _counts[index];
+    }
+
+    uint64_t min() const {
+        return _count ? _min : 0;
+    }
+
+    uint64_t max() const {
+        return _max;
+    }
+
+    double mean() const {
+        return _count ? static_cast<double>(_sum) / _count : 0.0;
+    }
+
+    /**
+     * Returns highest value equivalent to the value at percentile, as HDR histograms do, limited to exact max
+     * @param percentile in range [0, 100]
+     */
+    uint64_t value_at_percentile(double percentile) const {
+        if (!_count)
+            return 0;
+        const double clamped = std::clamp(percentile, 0.0, 100.0);
+        const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(clamped / 100.0 * _count + 0.5));
+        uint64_t accumulated = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; i++) {
+            accumulated += _counts[i];
+            if (accumulated >= rank)
+                return std::min(bucket_highest_value(i), _max);
+        }
+        return _max;
+    }
+
+  private:
+    friend class ConcurrentLatencyHistogram;
+
+    std::array<uint64_t, BUCKET_COUNT> _counts{};
+    uint64_t _count = 0;
+    uint64_t _sum = 0;
+    uint64_t _min = std::numeric_limits<uint64_t>::max();
+    uint64_t _max = 0;
+};
+
+/**
+ * Records latencies from many streaming threads without locks. Each recording thread gets own shard of atomic
+ * counters on first use, collect() drains all shards into LatencyHistogram.
+ */
+class ConcurrentLatencyHistogram {
+  public:
+    void record(uint64_t value) {
+        Shard &shard = _shards.local();
+        shard.counts[LatencyHistogram::bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+        shard.count.fetch_add(1, std::memory_order_relaxed);
+        shard.sum.fetch_add(value, std::memory_order_relaxed);
+        atomic_store_min(shard.min, value);
+        atomic_store_max(shard.max, value);
+    }
+
+    /**
+     * Moves values recorded by all threads since previous call to the histogram
+     */
+    LatencyHistogram collect() {
+        LatencyHistogram histogram;
+        _shards.for_each([&](Shard &shard) {
+            for (size_t i = 0; i < LatencyHistogram::BUCKET_COUNT; i++)
+                histogram._counts[i] += shard.counts[i].exchange(0, std::memory_order_relaxed);
+            histogram._count += shard.count.exchange(0, std::memory_order_relaxed);
+            histogram._sum += shard.sum.exchange(0, std::memory_order_relaxed);
+            histogram._min = std::min(
+                histogram._min, shard.min.exchange(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed));
+            histogram._max = std::max(histogram._max, shard.max.exchange(0, std::memory_order_relaxed));
+        });
+        return histogram;
+    }
+
+  private:
+    struct alignas(64) Shard {
+        std::array<std::atomic<uint32_t>, LatencyHistogram::BUCKET_COUNT> counts{};
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> sum{0};
+        std::atomic<uint64_t> min{std::numeric_limits<uint64_t>::max()};
+        std::atomic<uint64_t> max{0};
+    };
+
+    ThreadShards<Shard> _shards;
+};
@@ -5,7 +5,11 @@
  ******************************************************************************/
 
 #include "latency_tracer.h"
+#include "latency_histogram.h"
 #include "latency_tracer_meta.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <tuple>
@@ -35,105 +39,149 @@ enum class ElementType {
     PROCESSING // Element with both sink and source pads
 };
 
-// Structure to track statistics per source-sink branch
-struct BranchStats {
+// Latency statistics of an element or a branch. Frames are recorded without locks: running totals are atomic and
+// latencies are put into per-thread histograms, which are merged once per interval by the thread closing it.
+struct LatencyDistribution {
+    string type; // "element" or "branch"
     string pipeline_name;
     string source_name;
-    string sink_name;
-    gdouble total_latency;
-    gdouble min;
-    gdouble max;
-    guint frame_count;
-    gdouble interval_total;
-    gdouble interval_min;
-    gdouble interval_max;
-    guint interval_frame_count;
-    GstClockTime interval_init_time;
-    GstClockTime first_frame_init_ts;
-    mutex mtx;
+    string name;
+
+    ConcurrentLatencyHistogram recorder;
+    atomic<guint> frame_count{0};
+    atomic<guint64> total_ns{0};
+    atomic<guint64> min_ns{G_MAXUINT64};
+    atomic<guint64> max_ns{0};
+    atomic<GstClockTime> interval_init_time{0};
+
+    mutex total_mtx; // taken at interval boundaries and by histogram dump only
+    LatencyHistogram total;
+
+    // Records frame latency, returns number of frames recorded so far
+    guint record(guint64 latency_ns) {
+        recorder.record(latency_ns);
+        total_ns.fetch_add(latency_ns, memory_order_relaxed);
+        atomic_store_min(min_ns, latency_ns);
+        atomic_store_max(max_ns, latency_ns);
+        return frame_count.fetch_add(1, memory_order_relaxed) + 1;
+    }
+
+    gdouble avg_ms(guint count) const {
+        return (gdouble)total_ns.load(memory_order_relaxed) / count / ns_to_ms;
+    }
+
+    gdouble min_ms() const {
+        return (gdouble)min_ns.load(memory_order_relaxed) / ns_to_ms;
+    }
+
+    gdouble max_ms() const {
+        return (gdouble)max_ns.load(memory_order_relaxed) / ns_to_ms;
+    }
+
+    // If ts ends the interval, one of calling threads gets histogram of the interval and its start time
+    bool close_interval(GstClockTime ts, gint interval, GstClockTime &interval_begin, LatencyHistogram &histogram) {
+        interval_begin = interval_init_time.load(memory_order_relaxed);
+        if ((gdouble)GST_CLOCK_DIFF(interval_begin, ts) / ns_to_ms < interval)
+            return false;
+        if (!interval_init_time.compare_exchange_strong(interval_begin, ts, memory_order_relaxed))
+            return false;
+        histogram = recorder.collect();
+        lock_guard<mutex> guard(total_mtx);
+        total.add(histogram);
+        return true;
+    }
 
-    BranchStats() {
-        total_latency = 0.0;
-        min = G_MAXDOUBLE; // Initialize to max value so first frame sets it
-        max = 0.0;
-        frame_count = 0;
-        interval_total = 0.0;
-        interval_min = G_MAXDOUBLE;
-        interval_max = 0.0;
-        interval_frame_count = 0;
-        interval_init_time = 0;
-        first_frame_init_ts = 0;
-        pipeline_name = "";
+    // Histogram of all frames recorded so far
+    LatencyHistogram snapshot() {
+        lock_guard<mutex> guard(total_mtx);
+        total.add(recorder.collect());
+        return total;
     }
+};
+
+static gdouble percentile_ms(const LatencyHistogram &histogram, gdouble percentile) {
+    return (gdouble)histogram.value_at_percentile(percentile) / ns_to_ms;
+}
+
+// Distributions are owned by stats of elements and branches, entries of destroyed stats are dropped from dumps
+struct LatencyHistograms {
+    mutex mtx;
+    vector<weak_ptr<LatencyDistribution>> distributions;
 
-    void reset_interval(GstClockTime now) {
-        interval_total = 0.0;
-        interval_min = G_MAXDOUBLE;
-        interval_max = 0.0;
-        interval_init_time = now;
-        interval_frame_count = 0;
+    // Called under mtx
+    void remove_destroyed() {
+        distributions.erase(remove_if(distributions.begin(), distributions.end(),
+                                      [](const weak_ptr<LatencyDistribution> &entry) { return entry.expired(); }),
+                            distributions.end());
     }
+};
+
+static shared_ptr<LatencyDistribution> register_distribution(LatencyTracer *lt, const string &type,
+                                                             const string &pipeline_name, const string &source_name,
+                                                             const string &name, GstClockTime ts) {
+    auto distribution = make_shared<LatencyDistribution>();
+    distribution->type = type;
+    distribution->pipeline_name = pipeline_name;
+    distribution->source_name = source_name;
+    distribution->name = name;
+    distribution->interval_init_time = ts;
+    auto *histograms = static_cast<LatencyHistograms *>(lt->histograms);
+    lock_guard<mutex> guard(histograms->mtx);
+    histograms->remove_destroyed();
+    histograms->distributions.push_back(distribution);
+    return distribution;
+}
+
+// Structure to track statistics per source-sink branch
+struct BranchStats {
+    string pipeline_name;
+    string source_name;
+    string sink_name;
+    GstClockTime first_frame_init_ts = 0;
+    shared_ptr<LatencyDistribution> latency;
 
     void cal_log_pipeline_latency(guint64 ts, guint64 init_ts, gint interval) {
-        // Local copies for logging outside the lock
-        gdouble frame_latency, avg, local_min, local_max, pipeline_latency, fps;
-        guint local_count;
-
-        {
-            lock_guard<mutex> guard(mtx);
-            frame_count += 1;
-            frame_latency = (gdouble)GST_CLOCK_DIFF(init_ts, ts) / ns_to_ms;
-            gdouble pipeline_latency_ns = (gdouble)GST_CLOCK_DIFF(first_frame_init_ts, ts) / frame_count;
-            pipeline_latency = pipeline_latency_ns / ns_to_ms;
-            total_latency += frame_latency;
-            avg = total_latency / frame_count;
-            fps = 0;
-            if (pipeline_latency > 0)
-                fps = ms_to_s / pipeline_latency;
-
-            if (frame_latency < min)
-                min = frame_latency;
-            if (frame_latency > max)
-                max = frame_latency;
-
-            // Copy values for logging
-            local_min = min;
-            local_max = max;
-            local_count = frame_count;
-        } // Lock released here
-
-        // Log outside the lock to minimize lock duration
+        const guint64 latency_ns = MAX(GST_CLOCK_DIFF(init_ts, ts), 0);
+        const guint frame_count = latency->record(latency_ns);
+        const gdouble frame_latency = (gdouble)latency_ns / ns_to_ms;
+        const gdouble avg = latency->avg_ms(frame_count);
+        const gdouble min = latency->min_ms();
+        const gdouble max = latency->max_ms();
+        gdouble pipeline_latency_ns = (gdouble)GST_CLOCK_DIFF(first_frame_init_ts, ts) / frame_count;
+        gdouble pipeline_latency = pipeline_latency_ns / ns_to_ms;
+        gdouble fps = 0;
+        if (pipeline_latency > 0)
+            fps = ms_to_s / pipeline_latency;
+
         GST_TRACE("[Latency Tracer] Pipeline: %s, Source: %s -> Sink: %s - Frame: %u, Latency: %.2f ms, Avg: %.2f ms, "
                   "Min: %.2f ms, Max: %.2f ms, Pipeline Latency: %.2f ms, FPS: %.2f",
-                  pipeline_name.c_str(), source_name.c_str(), sink_name.c_str(), local_count, frame_latency, avg,
-                  local_min, local_max, pipeline_latency, fps);
+                  pipeline_name.c_str(), source_name.c_str(), sink_name.c_str(), frame_count, frame_latency, avg, min,
+                  max, pipeline_latency, fps);
 
         gst_tracer_record_log(tr_pipeline, pipeline_name.c_str(), source_name.c_str(), sink_name.c_str(), frame_latency,
-                              avg, local_min, local_max, pipeline_latency, fps, local_count);
-        cal_log_pipeline_interval(ts, frame_latency, interval);
-    }
-
-    void cal_log_pipeline_interval(guint64 ts, gdouble frame_latency, gint interval) {
-        interval_frame_count += 1;
-        interval_total += frame_latency;
-        if (frame_latency < interval_min)
-            interval_min = frame_latency;
-        if (frame_latency > interval_max)
-            interval_max = frame_latency;
-        gdouble ms = (gdouble)GST_CLOCK_DIFF(interval_init_time, ts) / ns_to_ms;
-        if (ms >= interval) {
-            gdouble pipeline_latency = ms / interval_frame_count;
-            gdouble fps = ms_to_s / pipeline_latency;
-            gdouble interval_avg = interval_total / interval_frame_count;
-            GST_TRACE(
-                "[Latency Tracer Interval] Pipeline: %s, Source: %s -> Sink: %s - Interval: %.2f ms, Avg: %.2f ms, "
-                "Min: %.2f ms, Max: %.2f ms",
-                pipeline_name.c_str(), source_name.c_str(), sink_name.c_str(), ms, interval_avg, interval_min,
-                interval_max);
-            gst_tracer_record_log(tr_pipeline_interval, pipeline_name.c_str(), source_name.c_str(), sink_name.c_str(),
-                                  ms, interval_avg, interval_min, interval_max, pipeline_latency, fps);
-            reset_interval(ts);
-        }
+                              avg, min, max, pipeline_latency, fps, frame_count);
+        cal_log_pipeline_interval(ts, interval);
+    }
+
+    void cal_log_pipeline_interval(guint64 ts, gint interval) {
+        GstClockTime interval_begin;
+        LatencyHistogram histogram;
+        if (!latency->close_interval(ts, interval, interval_begin, histogram) || !histogram.count())
+            return;
+        gdouble ms = (gdouble)GST_CLOCK_DIFF(interval_begin, ts) / ns_to_ms;
+        gdouble pipeline_latency = ms / histogram.count();
+        gdouble fps = ms_to_s / pipeline_latency;
+        gdouble interval_avg = histogram.mean() / ns_to_ms;
+        gdouble interval_min = (gdouble)histogram.min() / ns_to_ms;
+        gdouble interval_max = (gdouble)histogram.max() / ns_to_ms;
+        GST_TRACE("[Latency Tracer Interval] Pipeline: %s, Source: %s -> Sink: %s - Interval: %.2f ms, Avg: %.2f ms, "
+                  "Min: %.2f ms, Max: %.2f ms, P50: %.2f ms, P99: %.2f ms",
+                  pipeline_name.c_str(), source_name.c_str(), sink_name.c_str(), ms, interval_avg, interval_min,
+                  interval_max, percentile_ms(histogram, 50), percentile_ms(histogram, 99));
+        gst_tracer_record_log(tr_pipeline_interval, pipeline_name.c_str(), source_name.c_str(), sink_name.c_str(), ms,
+                              interval_avg, interval_min, interval_max, pipeline_latency, fps,
+                              percentile_ms(histogram, 50), percentile_ms(histogram, 95), percentile_ms(histogram, 99),
+                              percentile_ms(histogram, 99.9));
     }
 };
 
@@ -163,6 +211,10 @@ static inline BranchKey create_branch_key(GstElement *source, GstElement *sink,
     return std::make_tuple(source, sink, pipeline);
 }
 
+// Guards maps of branch stats, entries are added by streaming threads of all pipelines and removed when a pipeline
+// goes to NULL state. Entries are not moved by rehash, so stats of a branch are used without the mutex.
+static mutex branch_stats_mtx;
+
 // Type-safe accessors for C++ objects stored in C struct
 static unordered_map<BranchKey, BranchStats, BranchKeyHash> *get_branch_stats_map(LatencyTracer *lt) {
     if (!lt->branch_stats) {
@@ -242,6 +294,124 @@ static gboolean is_sink_element_cached(LatencyTracer *lt, GstElement *elem) {
     return get_cached_element_type(lt, elem) == ElementType::SINK;
 }
 
+static void append_json_string(GString *out, const string &value) {
+    g_string_append_c(out, '"');
+    for (char c : value) {
+        if (c == '"' || c == '\\')
+            g_string_append_c(out, '\\');
+        g_string_append_c(out, c);
+    }
+    g_string_append_c(out, '"');
+}
+
+static void append_csv_string(GString *out, const string &value) {
+    if (value.find_first_of(",\"\n") == string::npos) {
+        g_string_append(out, value.c_str());
+        return;
+    }
+    g_string_append_c(out, '"');
+    for (char c : value) {
+        if (c == '"')
+            g_string_append_c(out, '"');
+        g_string_append_c(out, c);
+    }
+    g_string_append_c(out, '"');
+}
+
+static void append_json_histogram(GString *out, const LatencyDistribution &distribution,
+                                  const LatencyHistogram &histogram) {
+    g_string_append(out, "{\"type\": ");
+    append_json_string(out, distribution.type);
+    g_string_append(out, ", \"pipeline\": ");
+    append_json_string(out, distribution.pipeline_name);
+    if (distribution.type == "branch") {
+        g_string_append(out, ", \"source\": ");
+        append_json_string(out, distribution.source_name);
+    }
+    g_string_append(out, ", \"name\": ");
+    append_json_string(out, distribution.name);
+    g_string_append_printf(out,
+                           ", \"count\": %" G_GUINT64_FORMAT ", \"min\": %" G_GUINT64_FORMAT
+                           ", \"max\": %" G_GUINT64_FORMAT ", \"mean\": %.1f, \"p50\": %" G_GUINT64_FORMAT
+                           ", \"p95\": %" G_GUINT64_FORMAT ", \"p99\": %" G_GUINT64_FORMAT
+                           ", \"p99_9\": %" G_GUINT64_FORMAT ", \"buckets\": [",
+                           histogram.count(), histogram.min(), histogram.max(), histogram.mean(),
+                           histogram.value_at_percentile(50), histogram.value_at_percentile(95),
+                           histogram.value_at_percentile(99), histogram.value_at_percentile(99.9));
+    bool first = true;
+    for (size_t i = 0; i < LatencyHistogram::BUCKET_COUNT; i++) {
+        if (!histogram.bucket_count(i))
+            continue;
+        g_string_append_printf(out, "%s[%" G_GUINT64_FORMAT ", %" G_GUINT64_FORMAT ", %" G_GUINT64_FORMAT "]",
+                               first ? "" : ", ", LatencyHistogram::bucket_lowest_value(i),
+                               LatencyHistogram::bucket_highest_value(i), histogram.bucket_count(i));
+        first = false;
+    }
+    g_string_append(out, "]}");
+}
+
+static void append_csv_histogram(GString *out, const LatencyDistribution &distribution,
+                                 const LatencyHistogram &histogram) {
+    for (size_t i = 0; i < LatencyHistogram::BUCKET_COUNT; i++) {
+        if (!histogram.bucket_count(i))
+            continue;
+        g_string_append_printf(out, "%s,", distribution.type.c_str());
+        append_csv_string(out, distribution.pipeline_name);
+        g_string_append_c(out, ',');
+        append_csv_string(out, distribution.source_name);
+        g_string_append_c(out, ',');
+        append_csv_string(out, distribution.name);
+        g_string_append_printf(out, ",%" G_GUINT64_FORMAT ",%" G_GUINT64_FORMAT ",%" G_GUINT64_FORMAT "\n",
+                               LatencyHistogram::bucket_lowest_value(i), LatencyHistogram::bucket_highest_value(i),
+                               histogram.bucket_count(i));
+    }
+}
+
+// Writes latency histograms of existing elements and branches recorded so far, values are in nanoseconds
+static void dump_histograms(LatencyTracer *lt) {
+    auto *histograms = static_cast<LatencyHistograms *>(lt->histograms);
+    lock_guard<mutex> guard(histograms->mtx);
+
+    GString *out = g_string_new(nullptr);
+    if (lt->histogram_format == LATENCY_TRACER_HISTOGRAM_CSV)
+        g_string_append(out, "type,pipeline,source,name,bucket_lowest_ns,bucket_highest_ns,count\n");
+    else
+        g_string_append(out, "{\"unit\": \"ns\", \"histograms\": [");
+    bool first = true;
+    for (const auto &entry : histograms->distributions) {
+        const shared_ptr<LatencyDistribution> distribution = entry.lock();
+        if (!distribution)
+            continue;
+        const LatencyHistogram histogram = distribution->snapshot();
+        if (lt->histogram_format == LATENCY_TRACER_HISTOGRAM_CSV) {
+            append_csv_histogram(out, *distribution, histogram);
+        } else {
+            g_string_append(out, first ? "\n  " : ",\n  ");
+            append_json_histogram(out, *distribution, histogram);
+        }
+        first = false;
+    }
+    histograms->remove_destroyed();
+    if (lt->histogram_format == LATENCY_TRACER_HISTOGRAM_JSON)
+        g_string_append(out, "\n]}\n");
+
+    GError *error = nullptr;
+    if (g_file_set_contents(lt->histogram_file, out->str, out->len, &error)) {
+        GST_INFO_OBJECT(lt, "Latency histograms written to %s", lt->histogram_file);
+    } else {
+        GST_WARNING_OBJECT(lt, "Couldn't write latency histograms: %s", error->message);
+        g_error_free(error);
+    }
+    g_string_free(out, TRUE);
+}
+
+// Pipeline posts EOS message once all its sinks got EOS
+static void on_element_post_message_pre(LatencyTracer *lt, guint64 ts, GstElement *elem, GstMessage *message) {
+    UNUSED(ts);
+    if (GST_MESSAGE_TYPE(message) == GST_MESSAGE_EOS && GST_IS_PIPELINE(elem))
+        dump_histograms(lt);
+}
+
 static void latency_tracer_constructed(GObject *object) {
     LatencyTracer *lt = LATENCY_TRACER(object);
     gchar *params, *tmp;
@@ -273,6 +443,19 @@ static void latency_tracer_constructed(GObject *object) {
         }
         gst_structure_get_int(params_struct, "interval", &lt->interval);
         GST_INFO_OBJECT(lt, "interval set to %d ms", lt->interval);
+
+        const gchar *histogram_file = gst_structure_get_string(params_struct, "histogram-file");
+        if (histogram_file) {
+            lt->histogram_file = g_strdup(histogram_file);
+            const gchar *histogram_format = gst_structure_get_string(params_struct, "histogram-format");
+            if (histogram_format && g_str_equal(histogram_format, "csv"))
+                lt->histogram_format = LATENCY_TRACER_HISTOGRAM_CSV;
+            else if (histogram_format && !g_str_equal(histogram_format, "json"))
+                GST_WARNING_OBJECT(lt, "Invalid histogram format %s, using json", histogram_format);
+            GST_INFO_OBJECT(lt, "latency histograms will be written to %s at EOS", lt->histogram_file);
+            gst_tracing_register_hook(GST_TRACER(lt), "element-post-message-pre",
+                                      G_CALLBACK(on_element_post_message_pre));
+        }
         gst_structure_free(params_struct);
     }
     g_free(params);
@@ -302,6 +485,10 @@ static void latency_tracer_finalize(GObject *object) {
         delete static_cast<unordered_map<GstElement *, GstElement *> *>(lt->topology_cache);
         lt->topology_cache = nullptr;
     }
+    delete static_cast<LatencyHistograms *>(lt->histograms);
+    lt->histograms = nullptr;
+    g_free(lt->histogram_file);
+    lt->histogram_file = nullptr;
 
     G_OBJECT_CLASS(latency_tracer_parent_class)->finalize(object);
 }
@@ -372,6 +559,18 @@ static void latency_tracer_class_init(LatencyTracerClass *klass) {
         "fps", GST_TYPE_STRUCTURE,
         gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
                           "pipeline fps within the interval(if frames dropped this may result in invalid value)", NULL),
+        "p50", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "50th percentile of interval frame latency in ms", NULL),
+        "p95", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "95th percentile of interval frame latency in ms", NULL),
+        "p99", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "99th percentile of interval frame latency in ms", NULL),
+        "p99_9", GST_TYPE_STRUCTURE,
+        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description", G_TYPE_STRING,
+                          "99.9th percentile of interval frame latency in ms", NULL),
         NULL);
     tr_element = gst_tracer_record_new("latency_tracer_element.class", "name", GST_TYPE_STRUCTURE,
                                        gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_STRING, "description",
@@ -411,6 +610,19 @@ static void latency_tracer_class_init(LatencyTracerClass *klass) {
                               "max", GST_TYPE_STRUCTURE,
                               gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description",
                                                 G_TYPE_STRING, "Max interval frame latency in ms", NULL),
+                              "p50", GST_TYPE_STRUCTURE,
+                              gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description",
+                                                G_TYPE_STRING, "50th percentile of interval frame latency in ms", NULL),
+                              "p95", GST_TYPE_STRUCTURE,
+                              gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description",
+                                                G_TYPE_STRING, "95th percentile of interval frame latency in ms", NULL),
+                              "p99", GST_TYPE_STRUCTURE,
+                              gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description",
+                                                G_TYPE_STRING, "99th percentile of interval frame latency in ms", NULL),
+                              "p99_9", GST_TYPE_STRUCTURE,
+                              gst_structure_new("value", "type", G_TYPE_GTYPE, G_TYPE_DOUBLE, "description",
+                                                G_TYPE_STRING, "99.9th percentile of interval frame latency in ms",
+                                                NULL),
                               NULL);
     GST_DEBUG_CATEGORY_INIT(latency_tracer_debug, "latency_tracer", 0, "latency tracer");
 }
@@ -433,21 +645,12 @@ static GstElement *get_real_pad_parent(GstPad *pad) {
 
 struct ElementStats {
     gboolean is_bin;
-    gdouble total;
-    gdouble min;
-    gdouble max;
-    guint frame_count;
     gchar *name;
-    gdouble interval_total;
-    gdouble interval_min;
-    gdouble interval_max;
-    guint interval_frame_count;
-    GstClockTime interval_init_time;
-    mutex mtx;
+    shared_ptr<LatencyDistribution> latency;
 
-    static void create(GstElement *elem, guint64 ts) {
+    static void create(LatencyTracer *lt, GstElement *elem, GstElement *pipeline, guint64 ts) {
         // This won't be converted to shared ptr because g_object_set_qdata_full destructor supports gpointer only
-        auto *stats = new ElementStats{elem, ts};
+        auto *stats = new ElementStats{lt, elem, pipeline, ts};
         g_object_set_qdata_full(reinterpret_cast<GObject *>(elem), data_string, stats,
                                 [](gpointer data) { delete static_cast<ElementStats *>(data); });
     }
@@ -458,64 +661,31 @@ struct ElementStats {
         return static_cast<ElementStats *>(g_object_get_qdata(G_OBJECT(elem), data_string));
     }
 
-    ElementStats(GstElement *elem, GstClockTime ts) {
+    ElementStats(LatencyTracer *lt, GstElement *elem, GstElement *pipeline, GstClockTime ts) {
         is_bin = GST_IS_BIN(elem);
-        total = 0.0;
-        min = G_MAXDOUBLE;
-        max = 0.0;
-        frame_count = 0;
         name = GST_ELEMENT_NAME(elem);
-        reset_interval(ts);
+        latency = register_distribution(lt, "element", GST_ELEMENT_NAME(pipeline), "", name, ts);
     }
 
-    void reset_interval(GstClockTime now) {
-        interval_total = 0.0;
-        interval_min = G_MAXDOUBLE;
-        interval_max = 0.0;
-        interval_init_time = now;
-        interval_frame_count = 0;
+    void cal_log_element_latency(guint64 src_ts, guint64 sink_ts, gint interval) {
+        const guint64 latency_ns = MAX(GST_CLOCK_DIFF(sink_ts, src_ts), 0);
+        const guint frame_count = latency->record(latency_ns);
+        const gdouble frame_latency = (gdouble)latency_ns / ns_to_ms;
+        gst_tracer_record_log(tr_element, name, frame_latency, latency->avg_ms(frame_count), latency->min_ms(),
+                              latency->max_ms(), frame_count, is_bin);
+        cal_log_interval(src_ts, interval);
     }
 
-    void cal_log_element_latency(guint64 src_ts, guint64 sink_ts, gint interval) {
-        // Local copies for logging outside the lock
-        gdouble frame_latency, avg, local_min, local_max;
-        guint local_count;
-
-        {
-            lock_guard<mutex> guard(mtx);
-            frame_count += 1;
-            frame_latency = (gdouble)GST_CLOCK_DIFF(sink_ts, src_ts) / ns_to_ms;
-            total += frame_latency;
-            avg = total / frame_count;
-            if (frame_latency < min)
-                min = frame_latency;
-            if (frame_latency > max)
-                max = frame_latency;
-
-            // Copy values for logging
-            local_min = min;
-            local_max = max;
-            local_count = frame_count;
-        } // Lock released here
-
-        // Log outside the lock to minimize lock duration
-        gst_tracer_record_log(tr_element, name, frame_latency, avg, local_min, local_max, local_count, is_bin);
-        cal_log_interval(frame_latency, src_ts, interval);
-    }
-
-    void cal_log_interval(gdouble frame_latency, guint64 src_ts, gint interval) {
-        interval_frame_count += 1;
-        interval_total += frame_latency;
-        if (frame_latency < interval_min)
-            interval_min = frame_latency;
-        if (frame_latency > interval_max)
-            interval_max = frame_latency;
-        gdouble ms = (gdouble)GST_CLOCK_DIFF(interval_init_time, src_ts) / ns_to_ms;
-        if (ms >= interval) {
-            gdouble interval_avg = interval_total / interval_frame_count;
-            gst_tracer_record_log(tr_element_interval, name, ms, interval_avg, interval_min, interval_max);
-            reset_interval(src_ts);
-        }
+    void cal_log_interval(guint64 src_ts, gint interval) {
+        GstClockTime interval_begin;
+        LatencyHistogram histogram;
+        if (!latency->close_interval(src_ts, interval, interval_begin, histogram) || !histogram.count())
+            return;
+        gdouble ms = (gdouble)GST_CLOCK_DIFF(interval_begin, src_ts) / ns_to_ms;
+        gst_tracer_record_log(tr_element_interval, name, ms, histogram.mean() / ns_to_ms,
+                              (gdouble)histogram.min() / ns_to_ms, (gdouble)histogram.max() / ns_to_ms,
+                              percentile_ms(histogram, 50), percentile_ms(histogram, 95), percentile_ms(histogram, 99),
+                              percentile_ms(histogram, 99.9));
     }
 };
 
@@ -797,24 +967,29 @@ static void do_push_buffer_pre(LatencyTracer *lt, guint64 ts, GstPad *pad, GstBu
             }
 
             BranchKey branch_key = create_branch_key(source, sink, pipeline);
-            auto *stats_map = get_branch_stats_map(lt);
-
-            // OPTIMIZATION: try_emplace constructs in-place (no copy), single map access
-            auto result = stats_map->try_emplace(branch_key);
-            BranchStats &branch = result.first->second;
-
-            // Initialize only if this is a newly inserted branch
-            if (result.second) {
-                branch.pipeline_name = GST_ELEMENT_NAME(pipeline);
-                branch.source_name = GST_ELEMENT_NAME(source);
-                branch.sink_name = GST_ELEMENT_NAME(sink);
-                branch.first_frame_init_ts = meta->init_ts;
-                branch.reset_interval(ts);
-                GST_INFO_OBJECT(lt, "Tracking new branch: %s, %s -> %s", branch.pipeline_name.c_str(),
-                                branch.source_name.c_str(), branch.sink_name.c_str());
+            BranchStats *branch;
+            {
+                lock_guard<mutex> guard(branch_stats_mtx);
+                auto *stats_map = get_branch_stats_map(lt);
+
+                // OPTIMIZATION: try_emplace constructs in-place (no copy), single map access
+                auto result = stats_map->try_emplace(branch_key);
+                branch = &result.first->second;
+
+                // Initialize only if this is a newly inserted branch
+                if (result.second) {
+                    branch->pipeline_name = GST_ELEMENT_NAME(pipeline);
+                    branch->source_name = GST_ELEMENT_NAME(source);
+                    branch->sink_name = GST_ELEMENT_NAME(sink);
+                    branch->first_frame_init_ts = meta->init_ts;
+                    branch->latency = register_distribution(lt, "branch", branch->pipeline_name,
+                                                            branch->source_name, branch->sink_name, ts);
+                    GST_INFO_OBJECT(lt, "Tracking new branch: %s, %s -> %s", branch->pipeline_name.c_str(),
+                                    branch->source_name.c_str(), branch->sink_name.c_str());
+                }
             }
 
-            branch.cal_log_pipeline_latency(ts, meta->init_ts, lt->interval);
+            branch->cal_log_pipeline_latency(ts, meta->init_ts, lt->interval);
         }
     }
 }
@@ -842,9 +1017,25 @@ static void do_push_buffer_list_pre(LatencyTracer *lt, guint64 ts, GstPad *pad,
         &args);
 }
 
+// Streaming threads of the pipeline are stopped in NULL state, its branches start over if it plays again
+static void remove_branch_stats(LatencyTracer *lt, GstElement *pipeline) {
+    lock_guard<mutex> guard(branch_stats_mtx);
+    if (!lt->branch_stats)
+        return;
+    auto *stats_map = get_branch_stats_map(lt);
+    for (auto it = stats_map->begin(); it != stats_map->end();) {
+        if (get<2>(it->first) == pipeline)
+            it = stats_map->erase(it);
+        else
+            ++it;
+    }
+}
+
 static void on_element_change_state_post(LatencyTracer *lt, guint64 ts, GstElement *elem, GstStateChange change,
                                          GstStateChangeReturn result) {
     UNUSED(result);
+    if (change == GST_STATE_CHANGE_READY_TO_NULL && GST_IS_PIPELINE(elem))
+        remove_branch_stats(lt, elem);
     // Track EVERY pipeline that transitions to PLAYING (not just lt->pipeline)
     if (GST_STATE_TRANSITION_NEXT(change) == GST_STATE_PLAYING && GST_IS_PIPELINE(elem)) {
         GST_INFO_OBJECT(lt, "Discovering elements in pipeline: %s", GST_ELEMENT_NAME(elem));
@@ -885,7 +1076,7 @@ static void on_element_change_state_post(LatencyTracer *lt, guint64 ts, GstEleme
                 (*type_cache)[element] = ElementType::PROCESSING;
                 // create ElementStats only once per each element (for non-source, non-sink elements)
                 if (!ElementStats::from_element(element)) {
-                    ElementStats::create(element, ts);
+                    ElementStats::create(lt, element, elem, ts);
                 }
             }
             g_value_unset(&gval);
@@ -926,6 +1117,9 @@ static void latency_tracer_init(LatencyTracer *lt) {
     lt->sinks_list = nullptr;
     lt->element_type_cache = nullptr;
     lt->topology_cache = nullptr;
+    lt->histograms = new LatencyHistograms();
+    lt->histogram_file = nullptr;
+    lt->histogram_format = LATENCY_TRACER_HISTOGRAM_JSON;
 
     GstTracer *tracer = GST_TRACER(lt);
     gst_tracing_register_hook(tracer, "element-new", G_CALLBACK(on_element_new));
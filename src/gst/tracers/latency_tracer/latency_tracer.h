@@ -23,6 +23,11 @@ typedef enum {
     LATENCY_TRACER_FLAG_ELEMENT = 1 << 1,
 } LatencyTracerFlags;
 
+typedef enum {
+    LATENCY_TRACER_HISTOGRAM_JSON,
+    LATENCY_TRACER_HISTOGRAM_CSV,
+} LatencyTracerHistogramFormat;
+
 struct LatencyTracer {
     GstTracer parent;
 
@@ -37,6 +42,11 @@ struct LatencyTracer {
     // Performance optimization caches
     gpointer element_type_cache; // Map<GstElement*, ElementType> - cache element types for O(1) lookup
     gpointer topology_cache;     // Map<GstElement*, GstElement*> - cache sink->source mappings for O(1) lookup
+
+    // Latency histograms of all elements and branches, dumped to histogram_file at EOS
+    gpointer histograms;
+    gchar *histogram_file;
+    LatencyTracerHistogramFormat histogram_format;
 };
 
 struct LatencyTracerClass {
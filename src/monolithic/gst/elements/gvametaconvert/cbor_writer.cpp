@@ -0,0 +1,55 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "cbor_writer.h"
+
+#include <cstring>
+
+void CborWriter::append_big_endian(uint64_t value, int size) {
+    for (int shift = (size - 1) * 8; shift >= 0; shift -= 8)
+        _out += static_cast<char>((value >> shift) & 0xff);
+}
+
+void CborWriter::head(uint8_t major, uint64_t argument) {
+    const uint8_t type = static_cast<uint8_t>(major << 5);
+    if (argument < 24) {
+        _out += static_cast<char>(type | argument);
+    } else if (argument <= UINT8_MAX) {
+        _out += static_cast<char>(type | 24);
+        append_big_endian(argument, 1);
+    } else if (argument <= UINT16_MAX) {
+        _out += static_cast<char>(type | 25);
+        append_big_endian(argument, 2);
+    } else if (argument <= UINT32_MAX) {
+        _out += static_cast<char>(type | 26);
+        append_big_endian(argument, 4);
+    } else {
+        _out += static_cast<char>(type | 27);
+        append_big_endian(argument, 8);
+    }
+}
+
+void CborWriter::key(const char *key) {
+    value(key, strlen(key));
+}
+
+void CborWriter::value(int64_t value) {
+    if (value >= 0)
+        head(MAJOR_UNSIGNED, static_cast<uint64_t>(value));
+    else
+        head(MAJOR_NEGATIVE, static_cast<uint64_t>(-(value + 1)));
+}
+
+void CborWriter::value(double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    _out += static_cast<char>(FLOAT64);
+    append_big_endian(bits, sizeof(bits));
+}
+
+void CborWriter::value(const char *value) {
+    this->value(value, strlen(value));
+}
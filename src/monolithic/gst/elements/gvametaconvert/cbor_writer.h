@@ -0,0 +1,111 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * Streaming CBOR (RFC 8949) writer with the interface of JsonWriter. Objects and arrays are written as
+ * indefinite-length maps and arrays, so members need not be counted in advance, and keys keep the order they are
+ * written in. Binary payloads are written as byte strings. Output buffer is reused across documents.
+ */
+class CborWriter {
+  public:
+    void reset() {
+        _out.clear();
+    }
+
+    const std::string &str() const {
+        return _out;
+    }
+
+    void begin_object() {
+        _out += static_cast<char>(INDEFINITE_MAP);
+    }
+    void end_object() {
+        _out += static_cast<char>(BREAK);
+    }
+    void begin_array() {
+        _out += static_cast<char>(INDEFINITE_ARRAY);
+    }
+    void end_array() {
+        _out += static_cast<char>(BREAK);
+    }
+
+    void key(const char *key, size_t length) {
+        value(key, length);
+    }
+    void key(const char *key);
+    void key(const std::string &key) {
+        value(key.data(), key.size());
+    }
+
+    void value(int64_t value);
+    void value(uint64_t value) {
+        head(MAJOR_UNSIGNED, value);
+    }
+    void value(int32_t value) {
+        this->value(static_cast<int64_t>(value));
+    }
+    void value(uint32_t value) {
+        head(MAJOR_UNSIGNED, value);
+    }
+    void value(double value);
+    void value(std::nullptr_t) {
+        _out += static_cast<char>(NULL_VALUE);
+    }
+    void value(const char *value, size_t length) {
+        head(MAJOR_TEXT, length);
+        _out.append(value, length);
+    }
+    void value(const char *value);
+    void value(const std::string &value) {
+        this->value(value.data(), value.size());
+    }
+
+    /**
+     * Writes byte string, raw payload is copied as is
+     */
+    void bytes(const void *data, size_t size) {
+        head(MAJOR_BYTES, size);
+        _out.append(static_cast<const char *>(data), size);
+    }
+
+    /**
+     * Writes already encoded CBOR data item
+     */
+    void fragment(const std::string &encoded) {
+        _out += encoded;
+    }
+
+    template <typename T>
+    void member(const char *key, const T &value) {
+        this->key(key);
+        this->value(value);
+    }
+
+  private:
+    enum : uint8_t {
+        MAJOR_UNSIGNED = 0,
+        MAJOR_NEGATIVE = 1,
+        MAJOR_BYTES = 2,
+        MAJOR_TEXT = 3,
+        INDEFINITE_ARRAY = 0x9f,
+        INDEFINITE_MAP = 0xbf,
+        NULL_VALUE = 0xf6,
+        FLOAT64 = 0xfb,
+        BREAK = 0xff,
+    };
+
+    // Writes initial byte of major type with argument in the shortest form
+    void head(uint8_t major, uint64_t argument);
+    void append_big_endian(uint64_t value, int size);
+
+    std::string _out;
+};
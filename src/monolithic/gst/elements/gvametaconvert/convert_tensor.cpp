@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
@@ -109,3 +109,117 @@ json convert_tensor(const GVA::Tensor &s_tensor) {
 
     return jobject;
 }
+
+namespace {
+
+template <typename Writer>
+void write_string_field(const GVA::Tensor &tensor, const char *fieldname, Writer &writer) {
+    const gchar *value = gst_structure_get_string(tensor.gst_structure(), fieldname);
+    if (value && *value)
+        writer.member(fieldname, value);
+}
+
+template <typename Writer>
+void write_gvaluearray(const GVA::Tensor &tensor, const char *fieldname, Writer &writer) {
+    GValueArray *valueArray = nullptr;
+    gst_structure_get_array(tensor.gst_structure(), fieldname, &valueArray);
+    if (!valueArray)
+        return;
+
+    if (valueArray->n_values) {
+        writer.key(fieldname);
+        writer.begin_array();
+        for (size_t i = 0; i < valueArray->n_values; ++i)
+            writer.value(g_value_get_string(valueArray->values + i));
+        writer.end_array();
+    }
+    g_value_array_free(valueArray);
+}
+
+template <typename T, typename JsonT>
+void write_data(const void *data, gsize size, JsonWriter &writer) {
+    const T *values = static_cast<const T *>(data);
+    const gsize count = size / sizeof(T);
+    if (!count)
+        return;
+
+    writer.key("data");
+    writer.begin_array();
+    for (gsize i = 0; i < count; ++i)
+        writer.value(static_cast<JsonT>(values[i]));
+    writer.end_array();
+}
+
+// Raw values are carried as is, in precision of the tensor
+template <typename T, typename JsonT>
+void write_data(const void *data, gsize size, CborWriter &writer) {
+    const gsize count = size / sizeof(T);
+    if (!count)
+        return;
+
+    writer.key("data");
+    writer.bytes(data, count * sizeof(T));
+}
+
+} // namespace
+
+template <typename Writer>
+void write_tensor(const GVA::Tensor &s_tensor, Writer &writer) {
+    // Members are written in key order, the order JSON object of convert_tensor() is dumped in
+    writer.begin_object();
+    if (s_tensor.has_field("confidence")) {
+        writer.member("confidence", s_tensor.confidence());
+    }
+
+    gsize data_size = 0;
+    const void *data = gva_get_tensor_data(s_tensor.gst_structure(), &data_size);
+    const GVA::Tensor::Precision precision = s_tensor.precision();
+    if (data) {
+        if (precision == GVA::Tensor::Precision::U8)
+            write_data<uint8_t, uint64_t>(data, data_size, writer);
+        else if (precision == GVA::Tensor::Precision::I64)
+            write_data<int64_t, int64_t>(data, data_size, writer);
+        else
+            write_data<float, double>(data, data_size, writer);
+    }
+
+    if (s_tensor.has_field("dims")) {
+        writer.key("dims");
+        const std::vector<guint> dims = s_tensor.dims();
+        if (dims.empty()) {
+            writer.value(nullptr);
+        } else {
+            writer.begin_array();
+            for (guint dim : dims)
+                writer.value(dim);
+            writer.end_array();
+        }
+    }
+    write_string_field(s_tensor, "format", writer);
+    if (!s_tensor.is_detection()) {
+        write_string_field(s_tensor, "label", writer);
+    }
+    if (s_tensor.has_field("label_id")) {
+        writer.member("label_id", s_tensor.get_int("label_id"));
+    }
+    write_string_field(s_tensor, "layer_name", writer);
+    std::string layout_value = s_tensor.layout_as_string();
+    if (!layout_value.empty()) {
+        writer.member("layout", layout_value);
+    }
+    write_string_field(s_tensor, "model_name", writer);
+    const gchar *name_value = gst_structure_get_name(s_tensor.gst_structure());
+    if (name_value && *name_value) {
+        writer.member("name", name_value);
+    }
+    write_gvaluearray(s_tensor, "point_connections", writer);
+    write_gvaluearray(s_tensor, "point_names", writer);
+    std::string precision_value = s_tensor.precision_as_string();
+    if (!precision_value.empty()) {
+        writer.member("precision", precision_value);
+    }
+    writer.end_object();
+}
+
+template void write_tensor<JsonWriter>(const GVA::Tensor &s_tensor, JsonWriter &writer);
+template void write_tensor<CborWriter>(const GVA::Tensor &s_tensor, CborWriter &writer);
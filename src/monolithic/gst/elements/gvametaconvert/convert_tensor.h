@@ -1,14 +1,23 @@
 /*******************************************************************************
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
 #pragma once
+#include "cbor_writer.h"
 #include "gva_utils.h"
+#include "json_writer.h"
 #include "tensor.h"
 #include <iomanip>
 #include <iostream>
 #include <nlohmann/json.hpp>
 
-nlohmann::json convert_tensor(const GVA::Tensor &s_tensor);
\ No newline at end of file
+nlohmann::json convert_tensor(const GVA::Tensor &s_tensor);
+
+/**
+ * Streams the same object convert_tensor() builds, without the intermediate document. Writer is JsonWriter or
+ * CborWriter, the latter gets tensor data as byte string of raw values instead of array of numbers.
+ */
+template <typename Writer>
+void write_tensor(const GVA::Tensor &s_tensor, Writer &writer);
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
@@ -55,6 +55,7 @@ GHashTable *get_converters() {
 
     g_hash_table_insert(converters, GINT_TO_POINTER(GST_GVA_METACONVERT_JSON), (gpointer)to_json);
     g_hash_table_insert(converters, GINT_TO_POINTER(GST_GVA_METACONVERT_DUMP_DETECTION), (gpointer)dump_detection);
+    g_hash_table_insert(converters, GINT_TO_POINTER(GST_GVA_METACONVERT_CBOR), (gpointer)to_cbor);
 
     return converters;
 }
\ No newline at end of file
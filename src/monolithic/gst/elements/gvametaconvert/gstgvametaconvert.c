@@ -62,6 +62,7 @@ static guint gst_interpret_signals[LAST_SIGNAL] = {0};
 
 #define FORMAT_JSON_NAME "json"
 #define FORMAT_DUMP_DETECTION_NAME "dump-detection"
+#define FORMAT_CBOR_NAME "cbor"
 
 enum {
     PROP_0,
@@ -82,6 +83,8 @@ static const gchar *format_type_to_string(GstGVAMetaconvertFormatType format) {
         return FORMAT_JSON_NAME;
     case GST_GVA_METACONVERT_DUMP_DETECTION:
         return FORMAT_DUMP_DETECTION_NAME;
+    case GST_GVA_METACONVERT_CBOR:
+        return FORMAT_CBOR_NAME;
     default:
         return UNKNOWN_VALUE_NAME;
     }
@@ -98,6 +101,7 @@ GType gst_gva_metaconvert_get_format(void) {
     static const GEnumValue format_types[] = {
         {GST_GVA_METACONVERT_JSON, "Conversion to GstGVAJSONMeta", FORMAT_JSON_NAME},
         {GST_GVA_METACONVERT_DUMP_DETECTION, "Dump detection to GST debug log", FORMAT_DUMP_DETECTION_NAME},
+        {GST_GVA_METACONVERT_CBOR, "Conversion to binary CBOR message in GstGVAJSONMeta", FORMAT_CBOR_NAME},
         {0, NULL, NULL}};
 
     if (!gva_metaconvert_format_type) {
@@ -153,7 +157,9 @@ static void gst_gva_meta_convert_class_init(GstGvaMetaConvertClass *klass) {
                                     g_param_spec_enum("format", "Format",
                                                       "Output format for conversion. Enum: (1) "
                                                       "json GstGVAJSONMeta representing inference results. For "
-                                                      "details on the schema please see the user guide.",
+                                                      "details on the schema please see the user guide. cbor "
+                                                      "encodes the same message as binary CBOR, with tensor data "
+                                                      "as raw bytes.",
                                                       GST_TYPE_GVA_METACONVERT_FORMAT, DEFAULT_FORMAT,
                                                       G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
@@ -221,6 +227,7 @@ static void gst_gva_meta_convert_cleanup(GstGvaMetaConvert *gvametaconvert) {
     gvametaconvert->source = NULL;
     g_free(gvametaconvert->tags);
     gvametaconvert->tags = NULL;
+    release_json_serializer(gvametaconvert);
     if (gvametaconvert->info) {
         gst_video_info_free(gvametaconvert->info);
         gvametaconvert->info = NULL;
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
@@ -32,6 +32,7 @@ typedef gboolean (*convert_function_type)(GstGvaMetaConvert *converter, GstBuffe
 typedef enum {
     GST_GVA_METACONVERT_JSON,
     GST_GVA_METACONVERT_DUMP_DETECTION,
+    GST_GVA_METACONVERT_CBOR,
 } GstGVAMetaconvertFormatType;
 
 struct _GstGvaMetaConvert {
@@ -51,6 +52,8 @@ struct _GstGvaMetaConvert {
     GstAudioInfo *audio_info;
 #endif
     gint json_indent;
+    /* JSON and CBOR serialization state reused across frames, owned by JSON converter */
+    gpointer json_serializer;
 };
 
 struct _GstGvaMetaConvertClass {
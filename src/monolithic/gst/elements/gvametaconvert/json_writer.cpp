@@ -0,0 +1,258 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "json_writer.h"
+
+#include <nlohmann/json.hpp>
+
+#include <cassert>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <string_view>
+
+namespace {
+
+std::string_view key_of(const std::string &keys, size_t begin, size_t length) {
+    return std::string_view(keys.data() + begin, length);
+}
+
+} // namespace
+
+JsonWriter::JsonWriter(int indent) : _indent(indent) {
+}
+
+void JsonWriter::reset(int indent) {
+    _out.clear();
+    _keys.clear();
+    _scopes.clear();
+    _members.clear();
+    _indent = indent;
+    _key_pending = false;
+}
+
+void JsonWriter::new_line(size_t depth) {
+    _out += '\n';
+    _out.append(depth * _indent, ' ');
+}
+
+void JsonWriter::begin_item() {
+    if (_scopes.empty())
+        return;
+
+    Scope &scope = _scopes.back();
+    if (scope.object) {
+        assert(_key_pending && "JSON object member is written without key");
+        _key_pending = false;
+        return;
+    }
+    if (scope.count++)
+        _out += ',';
+    if (_indent >= 0)
+        new_line(_scopes.size());
+}
+
+void JsonWriter::begin_scope(bool object, char bracket) {
+    begin_item();
+    _out += bracket;
+    _scopes.push_back({object, true, 0, _out.size(), _members.size(), _keys.size()});
+}
+
+void JsonWriter::end_scope(char bracket) {
+    assert(!_scopes.empty() && !_key_pending && "Unbalanced JSON scopes");
+
+    Scope &scope = _scopes.back();
+    if (scope.object && !scope.sorted) {
+        _members.back().text_end = _out.size();
+        reorder_members(scope);
+    }
+    if (scope.count && _indent >= 0)
+        new_line(_scopes.size() - 1);
+    _out += bracket;
+
+    _members.resize(scope.first_member);
+    _keys.resize(scope.keys_begin);
+    _scopes.pop_back();
+}
+
+void JsonWriter::begin_object() {
+    begin_scope(true, '{');
+}
+
+void JsonWriter::end_object() {
+    end_scope('}');
+}
+
+void JsonWriter::begin_array() {
+    begin_scope(false, '[');
+}
+
+void JsonWriter::end_array() {
+    end_scope(']');
+}
+
+void JsonWriter::key(const char *key, size_t length) {
+    assert(!_scopes.empty() && _scopes.back().object && !_key_pending && "JSON key is written outside of object");
+
+    Scope &scope = _scopes.back();
+    if (scope.count) {
+        Member &previous = _members.back();
+        previous.text_end = _out.size();
+        if (scope.sorted && key_of(_keys, previous.key_begin, previous.key_length) >= std::string_view(key, length))
+            scope.sorted = false;
+        _out += ',';
+    }
+    if (_indent >= 0)
+        new_line(_scopes.size());
+
+    _members.push_back({_keys.size(), length, _out.size(), 0});
+    _keys.append(key, length);
+    scope.count++;
+
+    append_escaped(key, length);
+    if (_indent >= 0)
+        _out.append(": ", 2);
+    else
+        _out += ':';
+    _key_pending = true;
+}
+
+void JsonWriter::key(const char *key) {
+    this->key(key, strlen(key));
+}
+
+void JsonWriter::reorder_members(Scope &scope) {
+    const size_t first = scope.first_member;
+    const size_t count = _members.size() - first;
+    auto less = [this](size_t a, size_t b) {
+        return key_of(_keys, _members[a].key_begin, _members[a].key_length) <
+               key_of(_keys, _members[b].key_begin, _members[b].key_length);
+    };
+
+    // Stable insertion sort, objects are small and the first of equal keys must stay first
+    _order.clear();
+    for (size_t i = first; i < first + count; ++i) {
+        size_t j = _order.size();
+        _order.push_back(i);
+        for (; j > 0 && less(i, _order[j - 1]); --j)
+            _order[j] = _order[j - 1];
+        _order[j] = i;
+    }
+
+    _reorder.assign(_out, scope.body_begin, std::string::npos);
+    _out.resize(scope.body_begin);
+    scope.count = 0;
+    for (size_t k = 0; k < _order.size(); ++k) {
+        const Member &member = _members[_order[k]];
+        if (k && !less(_order[k - 1], _order[k]))
+            continue; // duplicate key, the first written one is kept
+        if (scope.count++)
+            _out += ',';
+        if (_indent >= 0)
+            new_line(_scopes.size());
+        _out.append(_reorder, member.text_begin - scope.body_begin, member.text_end - member.text_begin);
+    }
+}
+
+void JsonWriter::value(int64_t value) {
+    begin_item();
+    char buffer[24];
+    _out.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), value).ptr);
+}
+
+void JsonWriter::value(uint64_t value) {
+    begin_item();
+    char buffer[24];
+    _out.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), value).ptr);
+}
+
+void JsonWriter::value(double value) {
+    begin_item();
+    if (!std::isfinite(value)) {
+        _out.append("null", 4);
+        return;
+    }
+    // Same shortest round-trip formatting nlohmann serializer uses for floating point numbers
+    char buffer[64];
+    _out.append(buffer, nlohmann::detail::to_chars(buffer, buffer + sizeof(buffer), value));
+}
+
+void JsonWriter::value(std::nullptr_t) {
+    begin_item();
+    _out.append("null", 4);
+}
+
+void JsonWriter::value(const char *value, size_t length) {
+    begin_item();
+    append_escaped(value, length);
+}
+
+void JsonWriter::value(const char *value) {
+    this->value(value, strlen(value));
+}
+
+void JsonWriter::fragment(const std::string &serialized) {
+    begin_item();
+    const size_t depth = _scopes.size();
+    if (_indent < 0 || depth == 0) {
+        _out += serialized;
+        return;
+    }
+    // Re-indent nested lines, new lines inside strings are always escaped
+    size_t line_begin = 0;
+    for (size_t eol = serialized.find('\n'); eol != std::string::npos; eol = serialized.find('\n', line_begin)) {
+        _out.append(serialized, line_begin, eol - line_begin);
+        new_line(depth);
+        line_begin = eol + 1;
+    }
+    _out.append(serialized, line_begin, std::string::npos);
+}
+
+void JsonWriter::append_escaped(const char *str, size_t length) {
+    const size_t begin = _out.size();
+    _out += '"';
+    for (size_t i = 0; i < length; ++i) {
+        const unsigned char c = static_cast<unsigned char>(str[i]);
+        if (c >= 0x80) {
+            // Multi-byte UTF-8 is validated by nlohmann serializer, including the exception it throws on invalid input
+            _out.resize(begin);
+            _out += nlohmann::json(std::string(str, length)).dump();
+            return;
+        }
+        switch (c) {
+        case '"':
+            _out.append("\\\"", 2);
+            break;
+        case '\\':
+            _out.append("\\\\", 2);
+            break;
+        case '\b':
+            _out.append("\\b", 2);
+            break;
+        case '\f':
+            _out.append("\\f", 2);
+            break;
+        case '\n':
+            _out.append("\\n", 2);
+            break;
+        case '\r':
+            _out.append("\\r", 2);
+            break;
+        case '\t':
+            _out.append("\\t", 2);
+            break;
+        default:
+            if (c < 0x20) {
+                static const char hex[] = "0123456789abcdef";
+                const char escaped[] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xf]};
+                _out.append(escaped, sizeof(escaped));
+            } else {
+                _out += static_cast<char>(c);
+            }
+        }
+    }
+    _out += '"';
+}
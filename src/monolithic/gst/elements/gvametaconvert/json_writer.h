@@ -0,0 +1,103 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Streaming JSON writer producing the same bytes as nlohmann::json::dump(indent) of the equivalent document, without
+ * building the document. Object keys are emitted in sorted order and on duplicate keys the first one written wins, as
+ * with std::map backed nlohmann::json objects. Keys written in sorted order cost nothing extra, otherwise members of
+ * the object are reordered once it is closed. Output buffer, key and reorder storage are reused across documents.
+ */
+class JsonWriter {
+  public:
+    explicit JsonWriter(int indent = -1);
+
+    /**
+     * Starts new document, keeps capacity of internal buffers
+     */
+    void reset(int indent);
+
+    const std::string &str() const {
+        return _out;
+    }
+
+    void begin_object();
+    void end_object();
+    void begin_array();
+    void end_array();
+
+    void key(const char *key, size_t length);
+    void key(const char *key);
+    void key(const std::string &key) {
+        this->key(key.data(), key.size());
+    }
+
+    void value(int64_t value);
+    void value(uint64_t value);
+    void value(int32_t value) {
+        this->value(static_cast<int64_t>(value));
+    }
+    void value(uint32_t value) {
+        this->value(static_cast<uint64_t>(value));
+    }
+    void value(double value);
+    void value(std::nullptr_t);
+    void value(const char *value, size_t length);
+    void value(const char *value);
+    void value(const std::string &value) {
+        this->value(value.data(), value.size());
+    }
+
+    /**
+     * Writes already serialized value, produced by nlohmann::json::dump(indent) with the indent of current document
+     */
+    void fragment(const std::string &serialized);
+
+    template <typename T>
+    void member(const char *key, const T &value) {
+        this->key(key);
+        this->value(value);
+    }
+
+  private:
+    struct Scope {
+        bool object;
+        bool sorted;
+        size_t count;
+        size_t body_begin;
+        size_t first_member;
+        size_t keys_begin;
+    };
+
+    struct Member {
+        size_t key_begin;
+        size_t key_length;
+        size_t text_begin;
+        size_t text_end;
+    };
+
+    void begin_scope(bool object, char bracket);
+    void end_scope(char bracket);
+    void begin_item();
+    void new_line(size_t depth);
+    void reorder_members(Scope &scope);
+    void append_escaped(const char *str, size_t length);
+
+    std::string _out;
+    std::string _keys;
+    std::string _reorder;
+    std::vector<Scope> _scopes;
+    std::vector<Member> _members;
+    std::vector<size_t> _order;
+    int _indent;
+    bool _key_pending = false;
+};
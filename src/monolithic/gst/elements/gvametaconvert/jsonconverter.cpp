@@ -12,16 +12,24 @@
 #ifdef AUDIO
 #include "audioconverter.h"
 #endif
+#include "cbor_writer.h"
 #include "convert_tensor.h"
 #include "g3d_radarprocess_meta.h"
 #include "gva_json_meta.h"
+#include "json_writer.h"
+#include "lru_cache.h"
 
 #include <gst/analytics/analytics.h>
 #include <gst/analytics/gstanalyticsclassificationmtd.h>
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
+#include <climits>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <optional>
+#include <type_traits>
 
 using json = nlohmann::json;
 
@@ -59,264 +67,424 @@ gchar *cut_microseconds(const gchar *input) {
 }
 
 /**
- * @return JSON object which contains parameters such as resolution, timestamp, source and tags.
+ * Frame members that only depend on element properties, serialized once and re-serialized when properties change.
+ * Parsed extra_params_json of detections are cached by their text. Fragments are JSON text with the indent of the
+ * element, or CBOR data items in binary mode.
  */
-json get_frame_data(GstGvaMetaConvert *converter, GstBuffer *buffer) {
-    assert(converter && buffer && "Expected valid pointers GstGvaMetaConvert and GstBuffer");
+class FrameFragments {
+  public:
+    void update(GstGvaMetaConvert *converter, bool binary) {
+        const int width = converter->info->width;
+        const int height = converter->info->height;
+        if (converter->json_indent != _indent || binary != _binary) {
+            _indent = converter->json_indent;
+            _binary = binary;
+            _extra_params = std::make_unique<LRUCache<std::string, std::string>>(EXTRA_PARAMS_CACHE_SIZE);
+            _width = _height = -1;
+            source.clear();
+            tags.clear();
+            _source_property.reset();
+            _tags_property.reset();
+        }
+        if (width != _width || height != _height) {
+            _width = width;
+            _height = height;
+            resolution = serialize(json::object({{"width", width}, {"height", height}}));
+        }
+        if (!same_property(_source_property, converter->source)) {
+            source = converter->source ? serialize(json(converter->source)) : std::string();
+            assign_property(_source_property, converter->source);
+        }
+        if (!same_property(_tags_property, converter->tags)) {
+            tags.clear();
+            if (converter->tags && json::accept(converter->tags))
+                tags = serialize(json::parse(converter->tags));
+            assign_property(_tags_property, converter->tags);
+        }
+    }
 
-    json res = json::object();
-    GstSegment converter_segment = converter->base_gvametaconvert.segment;
-    GstClockTime timestamp = gst_segment_to_stream_time(&converter_segment, GST_FORMAT_TIME, buffer->pts);
+    /**
+     * @return serialized extra_params_json, nullptr if it is not valid JSON
+     */
+    const std::string *extra_params(const gchar *json_str) {
+        const std::string key(json_str);
+        if (const std::string *cached = _extra_params->find(key))
+            return cached;
+
+        try {
+            _extra_params->put(key, serialize(json::parse(key)));
+        } catch (const std::exception &e) {
+            GST_WARNING("Failed to parse extra_params_json: %s", e.what());
+            // Do not add the field if parsing fails
+            return nullptr;
+        }
+        return _extra_params->find(key);
+    }
 
-    GstVideoTimeCodeMeta *tc_meta = gst_buffer_get_video_time_code_meta(buffer);
+    std::string resolution;
+    std::string source;
+    std::string tags;
 
-    if (converter->info)
-        res["resolution"] = json::object({{"width", converter->info->width}, {"height", converter->info->height}});
-    if (converter->source)
-        res["source"] = converter->source;
-    if (timestamp != G_MAXUINT64)
-        res["timestamp"] = timestamp;
-    if (converter->tags && json::accept(converter->tags))
-        res["tags"] = json::parse(converter->tags);
-    if (tc_meta) {
-        GstVideoTimeCode *vtc = gst_video_time_code_copy(&tc_meta->tc);
-        GDateTime *frame_date_time = gst_video_time_code_to_date_time(vtc);
-
-        // Format the datetime to ISO string with milliseconds
-        gchar *iso_string = NULL;
-        gchar *iso_string_millisec = NULL;
-        GDateTime *utc_datetime = NULL;
-
-        if (converter->timestamp_utc) {
-            utc_datetime = g_date_time_to_utc(frame_date_time); // Convert the GDateTime object to UTC
-            if (!utc_datetime)
-                GST_WARNING("Failed to convert datetime to UTC");
-            else {
-                g_date_time_unref(frame_date_time);
-                frame_date_time = utc_datetime;
-                // UTC mode: add 'Z' at the end
-                iso_string = g_date_time_format(frame_date_time, "%Y-%m-%dT%H:%M:%S.%fZ");
-            }
-        } else
-            // Non-UTC mode: include offset from UTC
-            iso_string = g_date_time_format(frame_date_time, "%Y-%m-%dT%H:%M:%S.%f:%z");
+  private:
+    static constexpr size_t EXTRA_PARAMS_CACHE_SIZE = 256;
 
-        if (iso_string == NULL)
-            GST_WARNING("Failed to format the datetime to ISO string");
-        else {
+    std::string serialize(const json &value) const {
+        if (!_binary)
+            return value.dump(_indent);
+        std::string encoded;
+        json::to_cbor(value, encoded);
+        return encoded;
+    }
 
-            if (!(converter->timestamp_microseconds)) {
-                iso_string_millisec = cut_microseconds(iso_string);
-                g_free(iso_string);
-                iso_string = iso_string_millisec;
-            }
+    static bool same_property(const std::optional<std::string> &cached, const gchar *value) {
+        return cached ? (value && *cached == value) : !value;
+    }
 
-            // Store the formatted timestamp in the result
-            res["system_timestamp"] = iso_string;
+    static void assign_property(std::optional<std::string> &cached, const gchar *value) {
+        if (value)
+            cached = value;
+        else
+            cached.reset();
+    }
 
-            // Free the allocated resources
-            g_free(iso_string);
-        }
+    int _indent = INT_MIN;
+    bool _binary = false;
+    int _width = -1;
+    int _height = -1;
+    std::optional<std::string> _source_property;
+    std::optional<std::string> _tags_property;
+    std::unique_ptr<LRUCache<std::string, std::string>> _extra_params;
+};
 
-        if (frame_date_time)
-            g_date_time_unref(frame_date_time);
+/**
+ * Per-element serialization state, the output buffers are reused across frames
+ */
+struct JsonSerializer {
+    JsonWriter json_writer;
+    CborWriter cbor_writer;
+    FrameFragments fragments;
+};
+
+JsonWriter &get_writer(JsonSerializer &serializer, GstGvaMetaConvert *converter) {
+    serializer.json_writer.reset(converter->json_indent);
+    return serializer.json_writer;
+}
 
-        if (vtc)
-            gst_video_time_code_free(vtc);
+CborWriter &get_writer(JsonSerializer &serializer, GstGvaMetaConvert *) {
+    serializer.cbor_writer.reset();
+    return serializer.cbor_writer;
+}
+
+void attach_message(GstGvaMetaConvert *converter, GVA::VideoFrame &video_frame, GstBuffer *, const JsonWriter &writer) {
+    video_frame.add_message(writer.str());
+    GST_INFO_OBJECT(converter, "JSON message: %s", writer.str().c_str());
+}
+
+void attach_message(GstGvaMetaConvert *converter, GVA::VideoFrame &, GstBuffer *buffer, const CborWriter &writer) {
+    GstGVAJSONMeta *json_meta = GST_GVA_JSON_META_ADD(buffer);
+    if (!json_meta) {
+        GST_ERROR_OBJECT(converter, "Failed to add GVA JSON meta for CBOR message");
+        return;
     }
-    return res;
+    set_binary_message(json_meta, writer.str().data(), writer.str().size());
+    GST_INFO_OBJECT(converter, "CBOR message: %zu bytes", writer.str().size());
 }
 
 /**
- * @return JSON array which contains ROIs attributes and their detection results.
- * Also contains ROIs classification results if any.
+ * @return system timestamp of frame time code in ISO format, to be freed with g_free(), NULL on failure
  */
-json convert_roi_detection(GstGvaMetaConvert *converter, GstBuffer *buffer) {
-    assert(converter && buffer && "Expected valid pointers GstGvaMetaConvert and GstBuffer");
+gchar *get_system_timestamp(GstGvaMetaConvert *converter, GstVideoTimeCodeMeta *tc_meta) {
+    GstVideoTimeCode *vtc = gst_video_time_code_copy(&tc_meta->tc);
+    GDateTime *frame_date_time = gst_video_time_code_to_date_time(vtc);
+
+    // Format the datetime to ISO string with milliseconds
+    gchar *iso_string = NULL;
+    gchar *iso_string_millisec = NULL;
+    GDateTime *utc_datetime = NULL;
+
+    if (converter->timestamp_utc) {
+        utc_datetime = g_date_time_to_utc(frame_date_time); // Convert the GDateTime object to UTC
+        if (!utc_datetime)
+            GST_WARNING("Failed to convert datetime to UTC");
+        else {
+            g_date_time_unref(frame_date_time);
+            frame_date_time = utc_datetime;
+            // UTC mode: add 'Z' at the end
+            iso_string = g_date_time_format(frame_date_time, "%Y-%m-%dT%H:%M:%S.%fZ");
+        }
+    } else
+        // Non-UTC mode: include offset from UTC
+        iso_string = g_date_time_format(frame_date_time, "%Y-%m-%dT%H:%M:%S.%f:%z");
+
+    if (iso_string == NULL)
+        GST_WARNING("Failed to format the datetime to ISO string");
+    else if (!(converter->timestamp_microseconds)) {
+        iso_string_millisec = cut_microseconds(iso_string);
+        g_free(iso_string);
+        iso_string = iso_string_millisec;
+    }
 
-    json res = json::array();
-    GVA::VideoFrame video_frame(buffer, converter->info);
-    for (GVA::RegionOfInterest &roi : video_frame.regions()) {
-        gint id = roi.object_id();
+    if (frame_date_time)
+        g_date_time_unref(frame_date_time);
 
-        json jobject = json::object();
+    if (vtc)
+        gst_video_time_code_free(vtc);
 
-        if (converter->add_tensor_data) {
-            jobject["tensors"] = json::array();
-        }
+    return iso_string;
+}
 
-        auto rect = roi.rect();
+/**
+ * Writes classification result as object with label, model name, confidence and label id
+ */
+template <typename Writer>
+void write_classification(Writer &writer, const gchar *label, const gchar *model_name, const GstStructure *s) {
+    double confidence;
+    int label_id;
+
+    writer.begin_object();
+    if (gst_structure_get(s, "confidence", G_TYPE_DOUBLE, &confidence, NULL)) {
+        writer.member("confidence", confidence);
+    }
+    if (label) {
+        writer.member("label", label);
+    }
+    if (gst_structure_get(s, "label_id", G_TYPE_INT, &label_id, NULL)) {
+        writer.member("label_id", label_id);
+    }
+    if (model_name) {
+        writer.key("model");
+        writer.begin_object();
+        writer.member("name", model_name);
+        writer.end_object();
+    }
+    writer.end_object();
+}
 
-        jobject.push_back({"x", rect.x});
-        jobject.push_back({"y", rect.y});
-        jobject.push_back({"w", rect.w});
-        jobject.push_back({"h", rect.h});
-        jobject.push_back({"region_id", roi.region_id()});
+/**
+ * Writes object which contains ROI attributes and its detection results. Also contains ROI classification
+ * results if any. Members are written in the order they were inserted into JSON document before, so the first of
+ * duplicated keys wins as it did.
+ */
+template <typename Writer>
+void write_roi_detection(GstGvaMetaConvert *converter, GVA::RegionOfInterest &roi, Writer &writer,
+                         FrameFragments &fragments) {
+    writer.begin_object();
 
-        gint parent_id = roi.parent_id();
-        if (parent_id >= 0) {
-            jobject.push_back({"parent_id", parent_id});
+    if (converter->add_tensor_data) {
+        writer.key("tensors");
+        writer.begin_array();
+        for (GList *l = roi.get_params(); l; l = g_list_next(l)) {
+            write_tensor(GVA::Tensor(GST_STRUCTURE(l->data)), writer);
         }
+        writer.end_array();
+    }
 
-        if (id != 0)
-            jobject.push_back({"id", id});
+    auto rect = roi.rect();
 
-        const std::string roi_type = roi.label();
+    writer.member("x", rect.x);
+    writer.member("y", rect.y);
+    writer.member("w", rect.w);
+    writer.member("h", rect.h);
+    writer.member("region_id", roi.region_id());
 
-        if (!roi_type.empty()) {
-            jobject.push_back({"roi_type", roi_type});
-        }
-        for (GList *l = roi.get_params(); l; l = g_list_next(l)) {
+    gint parent_id = roi.parent_id();
+    if (parent_id >= 0) {
+        writer.member("parent_id", parent_id);
+    }
 
-            GstStructure *s = GST_STRUCTURE(l->data);
-            const gchar *s_name = gst_structure_get_name(s);
-            if (strcmp(s_name, "detection") == 0) {
-                double xminval;
-                double xmaxval;
-                double yminval;
-                double ymaxval;
-                double confidence;
-                int label_id;
-                if (gst_structure_get(s, "x_min", G_TYPE_DOUBLE, &xminval, "x_max", G_TYPE_DOUBLE, &xmaxval, "y_min",
-                                      G_TYPE_DOUBLE, &yminval, "y_max", G_TYPE_DOUBLE, &ymaxval, NULL)) {
-                    json detection = json::object(
-                        {{"bounding_box",
-                          {{"x_min", xminval}, {"x_max", xmaxval}, {"y_min", yminval}, {"y_max", ymaxval}}}});
-
-                    if (gst_structure_get(s, "confidence", G_TYPE_DOUBLE, &confidence, NULL)) {
-                        detection.push_back({"confidence", confidence});
-                    }
+    gint id = roi.object_id();
+    if (id != 0)
+        writer.member("id", id);
 
-                    if (gst_structure_get(s, "label_id", G_TYPE_INT, &label_id, NULL)) {
-                        detection.push_back({"label_id", label_id});
-                    }
+    const std::string roi_type = roi.label();
 
-                    const std::string label = roi.label();
+    if (!roi_type.empty()) {
+        writer.member("roi_type", roi_type);
+    }
+    for (GList *l = roi.get_params(); l; l = g_list_next(l)) {
+
+        GstStructure *s = GST_STRUCTURE(l->data);
+        const gchar *s_name = gst_structure_get_name(s);
+        if (strcmp(s_name, "detection") == 0) {
+            double xminval;
+            double xmaxval;
+            double yminval;
+            double ymaxval;
+            double confidence;
+            int label_id;
+            if (gst_structure_get(s, "x_min", G_TYPE_DOUBLE, &xminval, "x_max", G_TYPE_DOUBLE, &xmaxval, "y_min",
+                                  G_TYPE_DOUBLE, &yminval, "y_max", G_TYPE_DOUBLE, &ymaxval, NULL)) {
+                writer.key("detection");
+                writer.begin_object();
+                writer.key("bounding_box");
+                writer.begin_object();
+                writer.member("x_max", xmaxval);
+                writer.member("x_min", xminval);
+                writer.member("y_max", ymaxval);
+                writer.member("y_min", yminval);
+                writer.end_object();
+
+                if (gst_structure_get(s, "confidence", G_TYPE_DOUBLE, &confidence, NULL)) {
+                    writer.member("confidence", confidence);
+                }
 
-                    if (!label.empty()) {
-                        detection.push_back({"label", label});
-                    }
-                    jobject.push_back(json::object_t::value_type("detection", detection));
-
-                    // Handle extra_params_json if present
-                    if (gst_structure_has_field(s, "extra_params_json")) {
-                        const GValue *val = gst_structure_get_value(s, "extra_params_json");
-                        if (G_VALUE_HOLDS_STRING(val)) {
-                            const gchar *json_str = g_value_get_string(val);
-                            if (json_str && strlen(json_str) > 0) {
-                                try {
-                                    jobject.push_back(
-                                        json::object_t::value_type("extra_params", nlohmann::json::parse(json_str)));
-                                } catch (const std::exception &e) {
-                                    GST_WARNING("Failed to parse extra_params_json: %s", e.what());
-                                    // Do not add the field if parsing fails
-                                }
-                            }
-                        }
-                    }
+                // roi.label() is the label of detection
+                if (!roi_type.empty()) {
+                    writer.member("label", roi_type);
                 }
-            } else {
-                char *label;
-                char *model_name;
-                if (gst_structure_get(s, "label", G_TYPE_STRING, &label, "model_name", G_TYPE_STRING, &model_name,
-                                      NULL)) {
-                    double confidence;
-                    int label_id;
-                    const gchar *attribute_name = gst_structure_has_field(s, "attribute_name")
-                                                      ? gst_structure_get_string(s, "attribute_name")
-                                                      : s_name;
-                    json classification = json::object({{"label", label}, {"model", {{"name", model_name}}}});
-
-                    if (gst_structure_get(s, "confidence", G_TYPE_DOUBLE, &confidence, NULL)) {
-                        classification.push_back({"confidence", confidence});
-                    }
 
-                    if (gst_structure_get(s, "label_id", G_TYPE_INT, &label_id, NULL)) {
-                        classification.push_back({"label_id", label_id});
+                if (gst_structure_get(s, "label_id", G_TYPE_INT, &label_id, NULL)) {
+                    writer.member("label_id", label_id);
+                }
+                writer.end_object();
+
+                // Handle extra_params_json if present
+                if (gst_structure_has_field(s, "extra_params_json")) {
+                    const GValue *val = gst_structure_get_value(s, "extra_params_json");
+                    if (G_VALUE_HOLDS_STRING(val)) {
+                        const gchar *json_str = g_value_get_string(val);
+                        if (json_str && strlen(json_str) > 0) {
+                            if (const std::string *extra_params = fragments.extra_params(json_str)) {
+                                writer.key("extra_params");
+                                writer.fragment(*extra_params);
+                            }
+                        }
                     }
-
-                    jobject.push_back(json::object_t::value_type(attribute_name, classification));
-                    g_free(label);
-                    g_free(model_name);
                 }
             }
-            if (converter->add_tensor_data) {
-                GVA::Tensor s_tensor = GVA::Tensor((GstStructure *)l->data);
-                jobject["tensors"].push_back(convert_tensor(s_tensor));
+        } else {
+            const gchar *label = gst_structure_get_string(s, "label");
+            const gchar *model_name = gst_structure_get_string(s, "model_name");
+            if (label && model_name) {
+                const gchar *attribute_name = gst_structure_has_field(s, "attribute_name")
+                                                  ? gst_structure_get_string(s, "attribute_name")
+                                                  : s_name;
+                writer.key(attribute_name ? attribute_name : s_name);
+                write_classification(writer, label, model_name, s);
             }
         }
-        if (!jobject.empty()) {
-            res.push_back(jobject);
-        }
     }
-    return res;
+    writer.end_object();
 }
 
 /**
- * @return JSON array which contains raw tensor metas from frame.
+ * Writes object which contains full-frame attributes and full-frame classification results from frame tensors
  */
-json convert_frame_tensors(GstGvaMetaConvert *converter, GstBuffer *buffer) {
-    assert(converter && buffer && "Expected valid pointers GstGvaMetaConvert and GstBuffer");
+template <typename Writer>
+void write_frame_classification(GstGvaMetaConvert *converter, const std::vector<GVA::Tensor> &tensors,
+                                Writer &writer) {
+    writer.begin_object();
+    if (converter->add_tensor_data) {
+        writer.key("tensors");
+        writer.begin_array();
+        for (const GVA::Tensor &tensor : tensors) {
+            write_tensor(tensor, writer);
+        }
+        writer.end_array();
+    }
+    writer.member("x", 0);
+    writer.member("y", 0);
+    writer.member("w", converter->info->width);
+    writer.member("h", converter->info->height);
 
-    GVA::VideoFrame video_frame(buffer, converter->info);
-    const std::vector<GVA::Tensor> tensors = video_frame.tensors();
-    json array = json::array();
-    for (auto &tensor : video_frame.tensors()) {
-        if (!tensor.has_field("type")) {
-            array.push_back(convert_tensor(tensor));
+    for (const GVA::Tensor &tensor : tensors) {
+        if (tensor.has_field("label") || tensor.has_field("label_id")) {
+            std::string label = tensor.label();
+            std::string model_name = tensor.model_name();
+            std::string attribute_name =
+                tensor.has_field("attribute_name") ? tensor.get_string("attribute_name") : tensor.name();
+
+            writer.key(attribute_name);
+            write_classification(writer, label.empty() ? nullptr : label.c_str(),
+                                 model_name.empty() ? nullptr : model_name.c_str(), tensor.gst_structure());
         }
     }
-    return array;
+    writer.end_object();
 }
 
 /**
- * @return JSON object which contains full-frame attributes and full-frame classification results from frame.
+ * Serializes video frame metadata into reusable buffer of the element, without building JSON document. Writer is
+ * JsonWriter for JSON message or CborWriter for binary message.
  */
-json convert_frame_classification(GstGvaMetaConvert *converter, GstBuffer *buffer) {
+template <typename Writer>
+void convert_video_frame(GstGvaMetaConvert *converter, GstBuffer *buffer) {
     assert(converter && buffer && "Expected valid pointers GstGvaMetaConvert and GstBuffer");
 
     GVA::VideoFrame video_frame(buffer, converter->info);
+    std::vector<GVA::RegionOfInterest> regions = video_frame.regions();
     const std::vector<GVA::Tensor> tensors = video_frame.tensors();
-    if (tensors.empty())
-        return json{};
 
-    json jobject = json::object();
+    /* objects section: ROIs and, if there are frame tensors, frame classification */
+    const size_t objects_count = regions.size() + (tensors.empty() ? 0 : 1);
+    /* tensors section */
+    size_t tensors_count = 0;
     if (converter->add_tensor_data) {
-        jobject["tensors"] = json::array();
+        tensors_count = std::count_if(tensors.begin(), tensors.end(),
+                                      [](const GVA::Tensor &tensor) { return !tensor.has_field("type"); });
     }
-    jobject.push_back({"x", 0});
-    jobject.push_back({"y", 0});
-    jobject.push_back({"w", converter->info->width});
-    jobject.push_back({"h", converter->info->height});
 
-    for (GVA::Tensor &tensor : video_frame.tensors()) {
-        if (tensor.has_field("label") || tensor.has_field("label_id")) {
-            std::string label = tensor.label();
-            std::string model_name = tensor.model_name();
-            json classification = json::object({});
-            if (!label.empty()) {
-                classification.push_back(json::object_t::value_type("label", label));
-            }
-            if (!model_name.empty()) {
-                classification.push_back(json::object_t::value_type("model", {{"name", model_name}}));
-            }
-            std::string attribute_name =
-                tensor.has_field("attribute_name") ? tensor.get_string("attribute_name") : tensor.name();
+    if (!objects_count && !tensors_count && !converter->add_empty_detection_results) {
+        GST_DEBUG_OBJECT(converter, "No detections found. Not posting message");
+        return;
+    }
 
-            if (tensor.has_field("confidence")) {
-                classification.push_back(json::object_t::value_type("confidence", tensor.confidence()));
-            }
-            if (tensor.has_field("label_id")) {
-                classification.push_back(json::object_t::value_type("label_id", tensor.get_int("label_id")));
-            }
+    if (!converter->json_serializer)
+        converter->json_serializer = new JsonSerializer();
+    JsonSerializer &serializer = *static_cast<JsonSerializer *>(converter->json_serializer);
+    FrameFragments &fragments = serializer.fragments;
+    Writer &writer = get_writer(serializer, converter);
+    fragments.update(converter, std::is_same_v<Writer, CborWriter>);
 
-            jobject.push_back(json::object_t::value_type(attribute_name, classification));
+    GstSegment converter_segment = converter->base_gvametaconvert.segment;
+    GstClockTime timestamp = gst_segment_to_stream_time(&converter_segment, GST_FORMAT_TIME, buffer->pts);
+    GstVideoTimeCodeMeta *tc_meta = gst_buffer_get_video_time_code_meta(buffer);
+
+    // Frame members are written in key order, the order JSON object is dumped in
+    writer.begin_object();
+    if (objects_count) {
+        writer.key("objects");
+        writer.begin_array();
+        for (GVA::RegionOfInterest &roi : regions) {
+            write_roi_detection(converter, roi, writer, fragments);
+        }
+        if (!tensors.empty()) {
+            write_frame_classification(converter, tensors, writer);
         }
-        if (converter->add_tensor_data) {
-            jobject["tensors"].push_back(convert_tensor(tensor));
+        writer.end_array();
+    }
+    writer.key("resolution");
+    writer.fragment(fragments.resolution);
+    if (converter->source) {
+        writer.key("source");
+        writer.fragment(fragments.source);
+    }
+    if (tc_meta) {
+        gchar *iso_string = get_system_timestamp(converter, tc_meta);
+        if (iso_string) {
+            writer.member("system_timestamp", iso_string);
+            g_free(iso_string);
+        }
+    }
+    if (!fragments.tags.empty()) {
+        writer.key("tags");
+        writer.fragment(fragments.tags);
+    }
+    if (tensors_count) {
+        writer.key("tensors");
+        writer.begin_array();
+        for (const GVA::Tensor &tensor : tensors) {
+            if (!tensor.has_field("type")) {
+                write_tensor(tensor, writer);
+            }
         }
+        writer.end_array();
+    }
+    if (timestamp != G_MAXUINT64) {
+        writer.member("timestamp", timestamp);
     }
-    return jobject;
+    writer.end_object();
+
+    attach_message(converter, video_frame, buffer, writer);
 }
 
 /**
@@ -476,6 +644,11 @@ json convert_radar_process_meta(GstGvaMetaConvert *converter, GstBuffer *buffer)
 
 } // namespace
 
+void release_json_serializer(GstGvaMetaConvert *converter) {
+    delete static_cast<JsonSerializer *>(converter->json_serializer);
+    converter->json_serializer = NULL;
+}
+
 gboolean to_json(GstGvaMetaConvert *converter, GstBuffer *buffer) {
     GST_DEBUG_CATEGORY_INIT(gst_json_converter_debug, "jsonconverter", 0, "JSON converter");
 
@@ -507,43 +680,7 @@ gboolean to_json(GstGvaMetaConvert *converter, GstBuffer *buffer) {
         }
 
         if (converter->info) {
-            json jframe = get_frame_data(converter, buffer);
-            /* objects section */
-            json jframe_objects;
-            json roi_detection = convert_roi_detection(converter, buffer);
-            if (!roi_detection.empty()) {
-                jframe_objects = roi_detection;
-            } /* roi_detection can contain multiple objects, while frame_classification - only one */
-            json frame_classification = convert_frame_classification(converter, buffer);
-            if (!frame_classification.empty()) {
-                jframe_objects.push_back(frame_classification);
-            }
-
-            /* tensors section */
-            json jframe_tensors;
-            if (converter->add_tensor_data) {
-                jframe_tensors = convert_frame_tensors(converter, buffer);
-            }
-
-            if (jframe_objects.empty() && jframe_tensors.empty()) {
-                if (!converter->add_empty_detection_results) {
-                    GST_DEBUG_OBJECT(converter, "No detections found. Not posting JSON message");
-                    return TRUE;
-                }
-            }
-
-            if (!jframe.is_null()) {
-                if (!jframe_objects.empty()) {
-                    jframe["objects"] = jframe_objects;
-                }
-                if (!jframe_tensors.empty()) {
-                    jframe["tensors"] = jframe_tensors;
-                }
-                std::string json_message = jframe.dump(converter->json_indent);
-                GVA::VideoFrame video_frame(buffer, converter->info);
-                video_frame.add_message(json_message);
-                GST_INFO_OBJECT(converter, "JSON message: %s", json_message.c_str());
-            }
+            convert_video_frame<JsonWriter>(converter, buffer);
         }
 #ifdef AUDIO
         else {
@@ -588,3 +725,45 @@ gboolean to_json(GstGvaMetaConvert *converter, GstBuffer *buffer) {
     }
     return TRUE;
 }
+
+gboolean to_cbor(GstGvaMetaConvert *converter, GstBuffer *buffer) {
+    GST_DEBUG_CATEGORY_INIT(gst_json_converter_debug, "jsonconverter", 0, "JSON converter");
+
+    if (!converter) {
+        GST_ERROR("Failed convert to cbor: GvaMetaConvert is null");
+        return FALSE;
+    }
+
+    if (!buffer) {
+        GST_ERROR_OBJECT(converter, "Failed convert to cbor: GstBuffer is null");
+        return FALSE;
+    }
+
+    try {
+        json radar_data = convert_radar_process_meta(converter, buffer);
+        if (!radar_data.empty()) {
+            std::string cbor_message;
+            json::to_cbor(radar_data, cbor_message);
+
+            GstGVAJSONMeta *json_meta = GST_GVA_JSON_META_ADD(buffer);
+            if (json_meta) {
+                set_binary_message(json_meta, cbor_message.data(), cbor_message.size());
+                GST_INFO_OBJECT(converter, "Radar CBOR message: %zu bytes", cbor_message.size());
+            } else {
+                GST_ERROR_OBJECT(converter, "Failed to add GVA JSON meta for radar data");
+            }
+            return TRUE;
+        }
+
+        if (converter->info) {
+            convert_video_frame<CborWriter>(converter, buffer);
+        } else {
+            GST_WARNING_OBJECT(converter, "CBOR format is supported for video and radar metadata only");
+            return FALSE;
+        }
+    } catch (const std::exception &e) {
+        GST_ERROR_OBJECT(converter, "%s", Utils::createNestedErrorMsg(e).c_str());
+        return FALSE;
+    }
+    return TRUE;
+}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
@@ -14,6 +14,12 @@ extern "C" {
 
 gboolean to_json(GstGvaMetaConvert *converter, GstBuffer *buffer);
 
+/* Same metadata as to_json(), encoded as CBOR binary message of GstGVAJSONMeta */
+gboolean to_cbor(GstGvaMetaConvert *converter, GstBuffer *buffer);
+
+/* Releases JSON serialization state allocated by to_json() */
+void release_json_serializer(GstGvaMetaConvert *converter);
+
 #ifdef __cplusplus
 } /* extern C */
 #endif /* __cplusplus */
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (C) 2021 Intel Corporation
+ * Copyright (C) 2021-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
@@ -17,6 +17,8 @@ const gchar *file_format_to_string(FileFormat format) {
         return FILE_FORMAT_JSON_NAME;
     case GVA_META_PUBLISH_JSON_LINES:
         return FILE_FORMAT_JSON_LINES_NAME;
+    case GVA_META_PUBLISH_CBOR_SEQUENCE:
+        return FILE_FORMAT_CBOR_SEQUENCE_NAME;
     default:
         return UNKNOWN_VALUE_NAME;
     }
@@ -29,6 +31,9 @@ GType gva_metapublish_file_format_get_type(void) {
          FILE_FORMAT_JSON_NAME},
         {GVA_META_PUBLISH_JSON_LINES, "each line is valid JSON with inference results per frame",
          FILE_FORMAT_JSON_LINES_NAME},
+        {GVA_META_PUBLISH_CBOR_SEQUENCE, "CBOR sequence (RFC 8742), concatenated binary messages of gvametaconvert "
+                                         "format=cbor, one per frame",
+         FILE_FORMAT_CBOR_SEQUENCE_NAME},
         {0, nullptr, nullptr}};
 
     if (!gva_metapublish_file_format_type) {
@@ -37,3 +42,32 @@ GType gva_metapublish_file_format_get_type(void) {
 
     return gva_metapublish_file_format_type;
 }
+
+GType gva_metapublish_drop_policy_get_type(void) {
+    static GType gva_metapublish_drop_policy_type = 0;
+    static const GEnumValue drop_policy_types[] = {
+        {GVA_META_PUBLISH_DROP_BLOCK, "streaming thread waits until queue has space", DROP_POLICY_BLOCK_NAME},
+        {GVA_META_PUBLISH_DROP_NEWEST, "message is dropped if queue is full", DROP_POLICY_NEWEST_NAME},
+        {0, nullptr, nullptr}};
+
+    if (!gva_metapublish_drop_policy_type) {
+        gva_metapublish_drop_policy_type = g_enum_register_static("GvaMetaPublishDropPolicy", drop_policy_types);
+    }
+
+    return gva_metapublish_drop_policy_type;
+}
+
+GType gva_metapublish_file_io_mode_get_type(void) {
+    static GType gva_metapublish_file_io_mode_type = 0;
+    static const GEnumValue file_io_mode_types[] = {
+        {GVA_META_PUBLISH_IO_BUFFERED, "buffered writes of each group of messages", FILE_IO_MODE_BUFFERED_NAME},
+        {GVA_META_PUBLISH_IO_MMAP, "append through memory mapping of the file, regular files on Linux only",
+         FILE_IO_MODE_MMAP_NAME},
+        {0, nullptr, nullptr}};
+
+    if (!gva_metapublish_file_io_mode_type) {
+        gva_metapublish_file_io_mode_type = g_enum_register_static("GvaMetaPublishFileIoMode", file_io_mode_types);
+    }
+
+    return gva_metapublish_file_io_mode_type;
+}
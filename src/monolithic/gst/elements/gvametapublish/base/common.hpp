@@ -6,17 +6,34 @@
 
 #pragma once
 
+#include "gvametapublish_export.h"
 #include <gst/gst.h>
 
 extern GstStaticPadTemplate gva_meta_publish_sink_template;
 extern GstStaticPadTemplate gva_meta_publish_src_template;
 
-typedef enum { GVA_META_PUBLISH_JSON = 1, GVA_META_PUBLISH_JSON_LINES = 2 } FileFormat;
+typedef enum {
+    GVA_META_PUBLISH_JSON = 1,
+    GVA_META_PUBLISH_JSON_LINES = 2,
+    GVA_META_PUBLISH_CBOR_SEQUENCE = 3
+} FileFormat;
+
+typedef enum { GVA_META_PUBLISH_DROP_BLOCK = 1, GVA_META_PUBLISH_DROP_NEWEST = 2 } DropPolicy;
+
+typedef enum { GVA_META_PUBLISH_IO_BUFFERED = 1, GVA_META_PUBLISH_IO_MMAP = 2 } FileIoMode;
 
 // File specific constants
 constexpr auto STDOUT = "stdout";
 constexpr auto DEFAULT_FILE_PATH = STDOUT;
 constexpr auto DEFAULT_FILE_FORMAT = GVA_META_PUBLISH_JSON;
+constexpr auto DEFAULT_QUEUE_SIZE = 1024u;
+constexpr auto DEFAULT_FLUSH_BYTES = 1024u * 1024u;
+constexpr auto DEFAULT_FLUSH_COUNT = 0u;
+constexpr auto DEFAULT_FLUSH_INTERVAL = 100u;
+constexpr auto DEFAULT_MAX_FILE_SIZE = 0u;
+constexpr auto DEFAULT_ROTATION_INTERVAL = 0u;
+constexpr auto DEFAULT_DROP_POLICY = GVA_META_PUBLISH_DROP_BLOCK;
+constexpr auto DEFAULT_FILE_IO_MODE = GVA_META_PUBLISH_IO_BUFFERED;
 
 // Enum value names
 constexpr auto UNKNOWN_VALUE_NAME = "unknown";
@@ -27,6 +44,13 @@ constexpr auto PUBLISH_METHOD_KAFKA_NAME = "kafka";
 
 constexpr auto FILE_FORMAT_JSON_NAME = "json";
 constexpr auto FILE_FORMAT_JSON_LINES_NAME = "json-lines";
+constexpr auto FILE_FORMAT_CBOR_SEQUENCE_NAME = "cbor-sequence";
+
+constexpr auto DROP_POLICY_BLOCK_NAME = "block";
+constexpr auto DROP_POLICY_NEWEST_NAME = "drop-newest";
+
+constexpr auto FILE_IO_MODE_BUFFERED_NAME = "buffered";
+constexpr auto FILE_IO_MODE_MMAP_NAME = "mmap";
 
 // Broker specific constants
 constexpr auto DEFAULT_ADDRESS = "";
@@ -39,8 +63,17 @@ constexpr auto DEFAULT_TOPIC = "";
 constexpr auto DEFAULT_SIGNAL_HANDOFFS = false;
 constexpr auto DEFAULT_MAX_CONNECT_ATTEMPTS = 1;
 constexpr auto DEFAULT_MAX_RECONNECT_INTERVAL = 30;
+constexpr auto DEFAULT_BATCH_SIZE = 1u;
+constexpr auto DEFAULT_BATCH_INTERVAL = 0u;
+constexpr auto DEFAULT_BATCH_FORMAT = GVA_META_PUBLISH_JSON_LINES;
 
 const gchar *file_format_to_string(FileFormat format);
 
-GType gva_metapublish_file_format_get_type(void);
+GVAMETAPUBLISH_EXPORTS GType gva_metapublish_file_format_get_type(void);
 #define GST_TYPE_GVA_METAPUBLISH_FILE_FORMAT (gva_metapublish_file_format_get_type())
+
+GType gva_metapublish_drop_policy_get_type(void);
+#define GST_TYPE_GVA_METAPUBLISH_DROP_POLICY (gva_metapublish_drop_policy_get_type())
+
+GType gva_metapublish_file_io_mode_get_type(void);
+#define GST_TYPE_GVA_METAPUBLISH_FILE_IO_MODE (gva_metapublish_file_io_mode_get_type())
@@ -70,7 +70,12 @@ class GvaMetaPublishBasePrivate {
         }
 
         GvaMetaPublishBaseClass *klass = GVA_META_PUBLISH_BASE_GET_CLASS(_base);
-        if (!klass->publish(GVA_META_PUBLISH_BASE(_base), std::string(json_meta->message))) {
+        // Binary messages may contain zero bytes and are passed by their size. Message is not copied here, publishers
+        // copy it directly to where they need it
+        const bool binary = json_meta->size != 0;
+        std::string_view message =
+            binary ? std::string_view(json_meta->message, json_meta->size) : std::string_view(json_meta->message);
+        if (!klass->publish(GVA_META_PUBLISH_BASE(_base), message, binary)) {
             GST_ELEMENT_ERROR(_base, RESOURCE, NOT_FOUND, ("Failed to publish message"), (NULL));
             return GST_FLOW_ERROR;
         }
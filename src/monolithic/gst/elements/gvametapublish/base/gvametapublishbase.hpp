@@ -9,7 +9,7 @@
 #include "gvametapublish_export.h"
 #include <gst/base/gstbasetransform.h>
 
-#include <string>
+#include <string_view>
 
 G_BEGIN_DECLS
 
@@ -32,7 +32,8 @@ struct GvaMetaPublishBaseClass {
     GstBaseTransformClass base;
 
     void (*handoff)(GstElement *element, GstBuffer *buf);
-    gboolean (*publish)(GvaMetaPublishBase *self, const std::string &message);
+    // binary is set for binary (e.g. CBOR) messages, otherwise message is JSON text
+    gboolean (*publish)(GvaMetaPublishBase *self, std::string_view message, bool binary);
 };
 
 GVAMETAPUBLISH_EXPORTS GType gva_meta_publish_base_get_type(void);
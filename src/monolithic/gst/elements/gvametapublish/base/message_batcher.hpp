@@ -0,0 +1,276 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include "common.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <string_view>
+#include <thread>
+
+/**
+ * Payload released by MessageBatcher. Data is allocated with malloc() and owned by the receiver, it can be handed
+ * over to a client which frees it, e.g. Kafka producer with MSG_FREE flag.
+ */
+struct BatchPayload {
+    char *data = nullptr;
+    size_t size = 0;
+    uint32_t messages = 0;
+};
+
+/**
+ * Coalesces messages of consecutive frames into one broker payload. The batch is ready once it holds max_messages
+ * messages or its first message waits for max_interval. With max_messages of 1 each message is a payload as is,
+ * otherwise text messages are framed according to format as JSON array or JSON Lines, and binary (CBOR) messages
+ * are concatenated into CBOR sequence whatever the format is. Framing is chosen by the first message of a batch, see
+ * fits() for a message of another framing. Messages are copied once, directly into the payload buffer.
+ */
+class MessageBatcher {
+  public:
+    MessageBatcher() = default;
+    MessageBatcher(const MessageBatcher &) = delete;
+    MessageBatcher &operator=(const MessageBatcher &) = delete;
+
+    ~MessageBatcher() {
+        free(_data);
+    }
+
+    void configure(FileFormat format, uint32_t max_messages, uint32_t max_interval_ms) {
+        _format = format;
+        _max_messages = max_messages ? max_messages : 1;
+        _max_interval = std::chrono::milliseconds(max_interval_ms);
+    }
+
+    bool batching() const {
+        return _max_messages > 1;
+    }
+
+    FileFormat format() const {
+        return _format;
+    }
+
+    bool empty() const {
+        return _messages == 0;
+    }
+
+    /**
+     * Framing of batch of text or binary messages, text messages are framed as JSON Lines if format is CBOR sequence
+     */
+    FileFormat framing(bool binary) const {
+        if (binary)
+            return GVA_META_PUBLISH_CBOR_SEQUENCE;
+        return _format == GVA_META_PUBLISH_CBOR_SEQUENCE ? GVA_META_PUBLISH_JSON_LINES : _format;
+    }
+
+    /**
+     * Checks if message can be appended to the batch without changing its framing
+     */
+    bool fits(bool binary) const {
+        return _messages == 0 || !batching() || framing(binary) == _framing;
+    }
+
+    /**
+     * Appends message to the batch
+     * @param binary message is binary (CBOR) and is not JSON text
+     * @return true if the batch is ready to be released
+     */
+    bool append(std::string_view message, bool binary = false) {
+        if (_messages == 0) {
+            _first_message = std::chrono::steady_clock::now();
+            _framing = framing(binary);
+        }
+        if (!batching()) {
+            put(message.data(), message.size());
+        } else {
+            switch (_framing) {
+            case GVA_META_PUBLISH_JSON:
+                put(_messages ? "," : "[", 1);
+                put(message.data(), message.size());
+                break;
+            case GVA_META_PUBLISH_JSON_LINES:
+                put(message.data(), message.size());
+                put("\n", 1);
+                break;
+            default:
+                put(message.data(), message.size());
+                break;
+            }
+        }
+        _messages++;
+        return _messages >= _max_messages || due(std::chrono::steady_clock::now());
+    }
+
+    /**
+     * Checks if the first message of not empty batch waits for max_interval or longer
+     */
+    bool due(std::chrono::steady_clock::time_point now) const {
+        return _messages && _max_interval.count() && now - _first_message >= _max_interval;
+    }
+
+    /**
+     * Time the not empty batch becomes due, if max_interval is set
+     */
+    std::chrono::steady_clock::time_point deadline() const {
+        return _first_message + _max_interval;
+    }
+
+    /**
+     * Releases the batch, caller takes ownership of the payload data and frees it with free()
+     */
+    BatchPayload release() {
+        if (batching() && _framing == GVA_META_PUBLISH_JSON && _messages)
+            put("]", 1);
+        BatchPayload payload{_data, _size, _messages};
+        _data = nullptr;
+        _size = _capacity = 0;
+        _messages = 0;
+        return payload;
+    }
+
+  private:
+    void put(const char *data, size_t size) {
+        if (_size + size > _capacity) {
+            // Buffer of the next batch starts at the size of previous one, so steady stream rarely reallocates
+            const size_t capacity = std::max({_size + size, _capacity * 2, _last_capacity});
+            char *grown = static_cast<char *>(realloc(_data, capacity));
+            if (!grown)
+                throw std::bad_alloc();
+            _data = grown;
+            _capacity = _last_capacity = capacity;
+        }
+        memcpy(_data + _size, data, size);
+        _size += size;
+    }
+
+    FileFormat _format = GVA_META_PUBLISH_JSON_LINES;
+    FileFormat _framing = GVA_META_PUBLISH_JSON_LINES;
+    uint32_t _max_messages = 1;
+    std::chrono::milliseconds _max_interval{0};
+
+    char *_data = nullptr;
+    size_t _size = 0;
+    size_t _capacity = 0;
+    size_t _last_capacity = 0;
+    uint32_t _messages = 0;
+    std::chrono::steady_clock::time_point _first_message;
+};
+
+/**
+ * Sends batches of MessageBatcher: the streaming thread sends a batch once it is full, own thread sends it once its
+ * first message waits for max_interval, so messages of a slow source are not held until the next message comes.
+ * Batches are sent under the mutex, one at a time in order of their messages.
+ */
+class BatchSender {
+  public:
+    // Takes ownership of the payload, returns false if it was not sent
+    using Send = std::function<bool(BatchPayload payload)>;
+
+    BatchSender(GstObject *owner, Send send) : _owner(owner), _send(std::move(send)) {
+    }
+
+    BatchSender(const BatchSender &) = delete;
+    BatchSender &operator=(const BatchSender &) = delete;
+
+    ~BatchSender() {
+        stop_thread();
+    }
+
+    void start(FileFormat format, uint32_t max_messages, uint32_t max_interval_ms) {
+        stop_thread();
+        std::lock_guard<std::mutex> lock(_mutex);
+        _batcher.configure(format, max_messages, max_interval_ms);
+        _framing_logged = false;
+        _stop = false;
+        if (_batcher.batching() && max_interval_ms)
+            _thread = std::thread(&BatchSender::run, this);
+    }
+
+    bool batching() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _batcher.batching();
+    }
+
+    /**
+     * Appends message to the batch and sends the batch once it is ready
+     * @param binary message is binary (CBOR) and is not JSON text
+     * @return false if the batch was not sent
+     */
+    bool append(std::string_view message, bool binary = false) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_framing_logged && _batcher.batching() && _batcher.framing(binary) != _batcher.format()) {
+            GST_WARNING_OBJECT(_owner, "%s messages are batched as %s instead of batch-format %s",
+                               binary ? "Binary" : "Text", file_format_to_string(_batcher.framing(binary)),
+                               file_format_to_string(_batcher.format()));
+            _framing_logged = true;
+        }
+        // text and binary messages are not mixed in one payload, batch of the other framing is sent as is
+        if (!_batcher.fits(binary) && !_send(_batcher.release()))
+            return false;
+        const bool first = _batcher.empty();
+        if (_batcher.append(message, binary))
+            return _send(_batcher.release());
+        // the thread waits for the deadline of the new batch
+        if (first)
+            _cv.notify_all();
+        return true;
+    }
+
+    /**
+     * Stops the thread and sends incomplete batch
+     * @return false if the batch was not sent
+     */
+    bool stop() {
+        stop_thread();
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _batcher.empty() || _send(_batcher.release());
+    }
+
+  private:
+    void stop_thread() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _cv.notify_all();
+        if (_thread.joinable())
+            _thread.join();
+    }
+
+    void run() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (!_stop) {
+            if (_batcher.empty()) {
+                _cv.wait(lock);
+                continue;
+            }
+            // batch released meanwhile by the streaming thread is replaced with a batch of a later deadline
+            const auto deadline = _batcher.deadline();
+            if (std::chrono::steady_clock::now() < deadline) {
+                _cv.wait_until(lock, deadline);
+                continue;
+            }
+            _send(_batcher.release());
+        }
+    }
+
+    GstObject *_owner;
+    const Send _send;
+    mutable std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _stop = false;
+    std::thread _thread;
+    MessageBatcher _batcher;
+    bool _framing_logged = false;
+};
@@ -0,0 +1,446 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "file_writer.hpp"
+
+#include <glib/gstdio.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+GST_DEBUG_CATEGORY_STATIC(gva_meta_publish_file_writer_debug_category);
+#define GST_CAT_DEFAULT gva_meta_publish_file_writer_debug_category
+
+namespace {
+
+constexpr auto JSON_RECORD_PREFIX = ",\n";
+constexpr auto JSON_LINES_RECORD_SUFFIX = "\n";
+
+// Longest time a sleeping side waits before re-checking the ring
+constexpr auto MAX_WAIT = std::chrono::milliseconds(100);
+constexpr auto RATE_WINDOW = std::chrono::seconds(1);
+
+#ifdef __linux__
+// File is grown and mapped in chunks of this size, and truncated to written size on close
+constexpr uint64_t MMAP_CHUNK_SIZE = 64ull * 1024 * 1024;
+#endif
+
+} // namespace
+
+/**
+ * Output file written with buffered writes or, on Linux, through memory mapping
+ */
+class OutputFile {
+  public:
+    OutputFile(GstObject *owner, const std::string &path) : _owner(owner), _path(path) {
+    }
+
+    ~OutputFile() {
+        close();
+    }
+
+    bool open(bool append, FileIoMode io_mode) {
+        if (_path == STDOUT) {
+            _file = stdout;
+            return true;
+        }
+        if (io_mode == GVA_META_PUBLISH_IO_MMAP && open_mapped(append))
+            return true;
+
+        if (!(_file = fopen(_path.c_str(), append ? "ab+" : "wb+")))
+            return false;
+        fseek(_file, 0, SEEK_END);
+        _size = ftell(_file) > 0 ? static_cast<uint64_t>(ftell(_file)) : 0;
+        return true;
+    }
+
+    bool write(const char *data, size_t size) {
+#ifdef __linux__
+        if (_fd >= 0) {
+            if (_size + size > _mapped_end && !remap(_size + size))
+                return false;
+            memcpy(_mapping + (_size - _mapping_offset), data, size);
+            _size += size;
+            return true;
+        }
+#endif
+        if (!_file || fwrite(data, 1, size, _file) != size)
+            return false;
+        _size += size;
+        return true;
+    }
+
+    bool flush() {
+        // Mapped pages are written back by the kernel
+        return !_file || fflush(_file) == 0;
+    }
+
+    bool close() {
+        bool ok = true;
+#ifdef __linux__
+        if (_fd >= 0) {
+            if (_mapping)
+                munmap(_mapping, _mapped_end - _mapping_offset);
+            _mapping = nullptr;
+            ok = ftruncate(_fd, static_cast<off_t>(_size)) == 0;
+            ok &= ::close(_fd) == 0;
+            _fd = -1;
+        }
+#endif
+        if (_file) {
+            ok &= fflush(_file) == 0;
+            // For any pathfile we initialized w/ fopen(), invoke corresponding fclose()
+            if (_file != stdout)
+                ok &= fclose(_file) == 0;
+            _file = nullptr;
+        }
+        return ok;
+    }
+
+    // Written bytes, including the content of file it was appended to
+    uint64_t size() const {
+        return _size;
+    }
+
+    bool is_regular() const {
+        return _path != STDOUT && g_file_test(_path.c_str(), G_FILE_TEST_IS_REGULAR);
+    }
+
+  private:
+#ifdef __linux__
+    bool open_mapped(bool append) {
+        _fd = ::open(_path.c_str(), O_RDWR | O_CREAT | (append ? 0 : O_TRUNC), 0644);
+        struct stat file_stat;
+        if (_fd < 0 || fstat(_fd, &file_stat) != 0 || !S_ISREG(file_stat.st_mode)) {
+            GST_WARNING_OBJECT(_owner, "Cannot map %s, falling back to buffered writes", _path.c_str());
+            if (_fd >= 0)
+                ::close(_fd);
+            _fd = -1;
+            return false;
+        }
+        _size = static_cast<uint64_t>(file_stat.st_size);
+        _mapping_offset = _mapped_end = _size;
+        return true;
+    }
+
+    bool remap(uint64_t required_size) {
+        if (_mapping)
+            munmap(_mapping, _mapped_end - _mapping_offset);
+        _mapping = nullptr;
+
+        // Mapping starts at page containing the end of written data
+        const uint64_t page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+        const uint64_t offset = _size / page_size * page_size;
+        const uint64_t end = (required_size + MMAP_CHUNK_SIZE - 1) / MMAP_CHUNK_SIZE * MMAP_CHUNK_SIZE;
+        if (ftruncate(_fd, static_cast<off_t>(end)) != 0) {
+            GST_ERROR_OBJECT(_owner, "Failed to grow %s: %s", _path.c_str(), strerror(errno));
+            return false;
+        }
+        void *mapping =
+            mmap(nullptr, end - offset, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, static_cast<off_t>(offset));
+        if (mapping == MAP_FAILED) {
+            GST_ERROR_OBJECT(_owner, "Failed to map %s: %s", _path.c_str(), strerror(errno));
+            return false;
+        }
+        _mapping = static_cast<char *>(mapping);
+        _mapping_offset = offset;
+        _mapped_end = end;
+        return true;
+    }
+
+    int _fd = -1;
+    char *_mapping = nullptr;
+    uint64_t _mapping_offset = 0;
+    uint64_t _mapped_end = 0;
+#else
+    bool open_mapped(bool) {
+        GST_WARNING_OBJECT(_owner, "Memory mapped output is not supported on this platform, using buffered writes");
+        return false;
+    }
+#endif
+
+    GstObject *_owner;
+    std::string _path;
+    FILE *_file = nullptr;
+    uint64_t _size = 0;
+};
+
+FileWriter::FileWriter(GstObject *owner) : _owner(owner) {
+    GST_DEBUG_CATEGORY_INIT(gva_meta_publish_file_writer_debug_category, "gvametapublishfilewriter", 0,
+                            "debug category for gvametapublishfile writer thread");
+}
+
+FileWriter::~FileWriter() {
+    if (_thread.joinable())
+        close();
+}
+
+bool FileWriter::open(const FileWriterSettings &settings) {
+    _settings = settings;
+    _ring = std::make_unique<MessageRing>(std::max<size_t>(settings.queue_size, 1));
+    _file_index = 0;
+    _stopping = false;
+    _failed = false;
+    _max_queue_depth = _written_messages = _written_bytes = _dropped_messages = _bytes_per_second = 0;
+    _rate_window_begin = std::chrono::steady_clock::now();
+    _rate_window_bytes = 0;
+    _batch.clear();
+    _batch_count = 0;
+
+    if (!open_file())
+        return false;
+    _thread = std::thread(&FileWriter::run, this);
+    return true;
+}
+
+bool FileWriter::push(std::string &message) {
+    if (_failed)
+        return false;
+
+    while (!_ring->push(message)) {
+        if (_settings.drop_policy == GVA_META_PUBLISH_DROP_NEWEST) {
+            if (_dropped_messages++ == 0)
+                GST_WARNING_OBJECT(_owner, "Writer queue is full, messages are dropped");
+            return true;
+        }
+        std::unique_lock<std::mutex> lock(_mutex);
+        _producer_waiting = true;
+        if (_ring->full() && !_failed)
+            _space_available.wait_for(lock, MAX_WAIT);
+        _producer_waiting = false;
+        if (_failed)
+            return false;
+    }
+
+    const uint64_t depth = _ring->size();
+    if (depth > _max_queue_depth.load(std::memory_order_relaxed))
+        _max_queue_depth.store(depth, std::memory_order_relaxed);
+    if (_writer_waiting) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _data_available.notify_one();
+    }
+    return true;
+}
+
+bool FileWriter::close() {
+    if (!_thread.joinable())
+        return false;
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+        _data_available.notify_one();
+    }
+    _thread.join();
+
+    const FileWriterStats summary = stats();
+    GST_INFO_OBJECT(_owner,
+                    "Writer stopped: %" G_GUINT64_FORMAT " messages, %" G_GUINT64_FORMAT " bytes written, "
+                    "%" G_GUINT64_FORMAT " dropped, max queue depth %" G_GUINT64_FORMAT,
+                    summary.written_messages, summary.written_bytes, summary.dropped_messages, summary.max_queue_depth);
+    return !_failed;
+}
+
+FileWriterStats FileWriter::stats() const {
+    FileWriterStats stats;
+    stats.queue_depth = _ring ? _ring->size() : 0;
+    stats.max_queue_depth = _max_queue_depth;
+    stats.written_messages = _written_messages;
+    stats.written_bytes = _written_bytes;
+    stats.dropped_messages = _dropped_messages;
+    stats.bytes_per_second = _bytes_per_second;
+    return stats;
+}
+
+void FileWriter::run() {
+    using clock = std::chrono::steady_clock;
+    const auto flush_interval = std::chrono::milliseconds(_settings.flush_interval);
+    std::string message;
+
+    while (!_failed) {
+        const bool popped = _ring->pop(message);
+        if (popped) {
+            if (_producer_waiting) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _space_available.notify_one();
+            }
+            if (_batch.empty())
+                _batch_begin = clock::now();
+            append_record(message);
+            _batch_count++;
+        }
+
+        const auto now = clock::now();
+        const bool drained = !popped && _ring->empty();
+        if (!_batch.empty()) {
+            // Group is also written once it reaches max file size, so the file is rotated close to the limit
+            const bool full = (_settings.flush_bytes && _batch.size() >= _settings.flush_bytes) ||
+                              (_settings.flush_count && _batch_count >= _settings.flush_count) ||
+                              (_settings.max_file_size && _file->size() + _batch.size() >= _settings.max_file_size);
+            const bool due = _settings.flush_interval ? now - _batch_begin >= flush_interval : drained;
+            if ((full || due || (drained && _stopping)) && !commit())
+                break;
+        }
+        if (_batch.empty() && rotation_due() && !rotate())
+            break;
+        update_rate(now);
+
+        if (!drained)
+            continue;
+        // Producer queues its last messages before stopping is set, so they are seen by the check after it
+        if (_stopping && _ring->empty())
+            break;
+
+        // Sleep until the next message or until pending group is due
+        std::unique_lock<std::mutex> lock(_mutex);
+        _writer_waiting = true;
+        if (_ring->empty() && !_stopping) {
+            auto timeout = MAX_WAIT;
+            if (!_batch.empty()) {
+                const auto due = _batch_begin + flush_interval;
+                timeout = std::min(timeout, std::chrono::ceil<std::chrono::milliseconds>(due - now));
+            }
+            _data_available.wait_for(lock, timeout);
+        }
+        _writer_waiting = false;
+    }
+
+    if (!_failed && !_batch.empty())
+        commit();
+    if (!close_file())
+        _failed = true;
+    if (_failed) {
+        // Wake up producer blocked on full queue, it reports the failure
+        std::lock_guard<std::mutex> lock(_mutex);
+        _space_available.notify_one();
+    }
+}
+
+void FileWriter::append_record(const std::string &message) {
+    const bool first = _records_in_file++ == 0;
+    switch (_settings.file_format) {
+    case GVA_META_PUBLISH_JSON:
+        // File is an array of JSON objects, separated with comma and line feed. Output to stdout is not an array
+        if (!first && _settings.file_path != STDOUT)
+            _batch += JSON_RECORD_PREFIX;
+        _batch += message;
+        break;
+    case GVA_META_PUBLISH_JSON_LINES:
+        _batch += message;
+        _batch += JSON_LINES_RECORD_SUFFIX;
+        break;
+    default:
+        // CBOR sequence is concatenation of data items
+        _batch += message;
+        break;
+    }
+}
+
+bool FileWriter::commit() {
+    if (!_file->write(_batch.data(), _batch.size()) || !_file->flush()) {
+        GST_ERROR_OBJECT(_owner, "Error writing inference to file %s.", _settings.file_path.c_str());
+        _failed = true;
+        return false;
+    }
+    _written_bytes += _batch.size();
+    _written_messages += _batch_count;
+    _batch.clear();
+    _batch_count = 0;
+    return true;
+}
+
+bool FileWriter::open_file() {
+    const bool json_array = _settings.file_format == GVA_META_PUBLISH_JSON;
+    _file = std::make_unique<OutputFile>(_owner, _settings.file_path);
+    // JSON file is rewritten, JSON Lines and CBOR sequence are appended to the file
+    if (!_file->open(!json_array, _settings.io_mode)) {
+        _file.reset();
+        return false;
+    }
+    _records_in_file = 0;
+    _file_opened = std::chrono::steady_clock::now();
+    if (json_array && _settings.file_path != STDOUT) {
+        // File will be an array of JSON objects. Start the array with '['
+        if (!_file->write("[", 1))
+            return false;
+    }
+    return true;
+}
+
+bool FileWriter::close_file() {
+    if (!_file)
+        return false;
+    bool ok = true;
+    if (_settings.file_format == GVA_META_PUBLISH_JSON && _settings.file_path != STDOUT)
+        ok &= _file->write("]", 1);
+    // CBOR sequence is concatenation of data items only, nothing is appended to it
+    if (_settings.file_format != GVA_META_PUBLISH_CBOR_SEQUENCE)
+        ok &= _file->write("\n", 1);
+    ok &= _file->close();
+    _file.reset();
+    return ok;
+}
+
+bool FileWriter::rotation_due() const {
+    // File without records is not rotated, its header alone may exceed max file size
+    if (!_records_in_file)
+        return false;
+    if (_settings.max_file_size && _file->size() >= _settings.max_file_size)
+        return true;
+    return _settings.rotation_interval &&
+           std::chrono::steady_clock::now() - _file_opened >= std::chrono::seconds(_settings.rotation_interval);
+}
+
+bool FileWriter::rotate() {
+    if (!_file->is_regular()) {
+        GST_WARNING_OBJECT(_owner, "%s is not a regular file, rotation is disabled", _settings.file_path.c_str());
+        _settings.max_file_size = 0;
+        _settings.rotation_interval = 0;
+        return true;
+    }
+    if (!close_file()) {
+        GST_ERROR_OBJECT(_owner, "Error finalizing file %s.", _settings.file_path.c_str());
+        _failed = true;
+        return false;
+    }
+
+    // Rotated files get increasing suffix, existing files are not overwritten
+    std::string rotated_path;
+    do {
+        rotated_path = _settings.file_path + "." + std::to_string(++_file_index);
+    } while (g_file_test(rotated_path.c_str(), G_FILE_TEST_EXISTS));
+    if (g_rename(_settings.file_path.c_str(), rotated_path.c_str()) != 0)
+        GST_WARNING_OBJECT(_owner, "Failed to rename %s to %s", _settings.file_path.c_str(), rotated_path.c_str());
+    else
+        GST_INFO_OBJECT(_owner, "Rotated %s to %s", _settings.file_path.c_str(), rotated_path.c_str());
+
+    if (!open_file()) {
+        GST_ERROR_OBJECT(_owner, "Error opening file %s.", _settings.file_path.c_str());
+        _failed = true;
+        return false;
+    }
+    return true;
+}
+
+void FileWriter::update_rate(std::chrono::steady_clock::time_point now) {
+    const auto elapsed = now - _rate_window_begin;
+    if (elapsed < RATE_WINDOW)
+        return;
+    const uint64_t written = _written_bytes;
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    _bytes_per_second = static_cast<uint64_t>((written - _rate_window_bytes) / seconds);
+    _rate_window_begin = now;
+    _rate_window_bytes = written;
+}
@@ -0,0 +1,166 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <common.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Bounded single-producer single-consumer ring of messages. Push and pop do not take locks, messages are moved in
+ * and out of preallocated slots.
+ */
+class MessageRing {
+  public:
+    explicit MessageRing(size_t capacity) : _slots(capacity + 1) {
+    }
+
+    bool push(std::string &message) {
+        const size_t tail = _tail.load(std::memory_order_relaxed);
+        const size_t next = advance(tail);
+        if (next == _head.load(std::memory_order_acquire))
+            return false;
+        _slots[tail] = std::move(message);
+        _tail.store(next, std::memory_order_seq_cst);
+        return true;
+    }
+
+    bool pop(std::string &message) {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        if (head == _tail.load(std::memory_order_acquire))
+            return false;
+        message.swap(_slots[head]);
+        _head.store(advance(head), std::memory_order_seq_cst);
+        return true;
+    }
+
+    size_t size() const {
+        const size_t head = _head.load(std::memory_order_acquire);
+        const size_t tail = _tail.load(std::memory_order_acquire);
+        return tail >= head ? tail - head : tail + _slots.size() - head;
+    }
+
+    bool empty() const {
+        return _head.load(std::memory_order_seq_cst) == _tail.load(std::memory_order_seq_cst);
+    }
+
+    bool full() const {
+        return advance(_tail.load(std::memory_order_seq_cst)) == _head.load(std::memory_order_seq_cst);
+    }
+
+  private:
+    size_t advance(size_t index) const {
+        return index + 1 == _slots.size() ? 0 : index + 1;
+    }
+
+    std::vector<std::string> _slots;
+    alignas(64) std::atomic<size_t> _head{0};
+    alignas(64) std::atomic<size_t> _tail{0};
+};
+
+struct FileWriterSettings {
+    std::string file_path;
+    FileFormat file_format = GVA_META_PUBLISH_JSON;
+    size_t queue_size = DEFAULT_QUEUE_SIZE;
+    uint64_t flush_bytes = DEFAULT_FLUSH_BYTES;
+    uint32_t flush_count = DEFAULT_FLUSH_COUNT;
+    uint32_t flush_interval = DEFAULT_FLUSH_INTERVAL;       // milliseconds
+    uint64_t max_file_size = DEFAULT_MAX_FILE_SIZE;         // bytes, 0 disables size based rotation
+    uint32_t rotation_interval = DEFAULT_ROTATION_INTERVAL; // seconds, 0 disables time based rotation
+    DropPolicy drop_policy = DEFAULT_DROP_POLICY;
+    FileIoMode io_mode = DEFAULT_FILE_IO_MODE;
+};
+
+struct FileWriterStats {
+    uint64_t queue_depth = 0;
+    uint64_t max_queue_depth = 0;
+    uint64_t written_messages = 0;
+    uint64_t written_bytes = 0;
+    uint64_t dropped_messages = 0;
+    uint64_t bytes_per_second = 0;
+};
+
+class OutputFile;
+
+/**
+ * Writes messages to file on background thread. Messages are queued by the streaming thread and written in groups,
+ * once the group reaches flush_bytes or flush_count, or its first message waits for flush_interval. With zero
+ * flush_interval the group is written as soon as the queue is drained. Files are rotated by size or time between
+ * groups, rotated file gets next free numeric suffix.
+ */
+class FileWriter {
+  public:
+    explicit FileWriter(GstObject *owner);
+    ~FileWriter();
+
+    /**
+     * Opens the first file and starts writer thread
+     */
+    bool open(const FileWriterSettings &settings);
+
+    /**
+     * Queues message, blocks or drops it if queue is full, according to drop policy
+     * @return false if writer failed to write previous messages
+     */
+    bool push(std::string &message);
+
+    /**
+     * Writes all queued messages, finalizes the file and stops writer thread
+     */
+    bool close();
+
+    FileWriterStats stats() const;
+
+  private:
+    void run();
+    void append_record(const std::string &message);
+    bool commit();
+    bool open_file();
+    bool close_file();
+    bool rotate();
+    bool rotation_due() const;
+    void update_rate(std::chrono::steady_clock::time_point now);
+
+    GstObject *_owner;
+    FileWriterSettings _settings;
+    std::unique_ptr<MessageRing> _ring;
+    std::unique_ptr<OutputFile> _file;
+    std::thread _thread;
+
+    // Writer thread state
+    std::string _batch;
+    uint64_t _batch_count = 0;
+    std::chrono::steady_clock::time_point _batch_begin;
+    uint64_t _records_in_file = 0;
+    uint64_t _file_index = 0;
+    std::chrono::steady_clock::time_point _file_opened;
+    std::chrono::steady_clock::time_point _rate_window_begin;
+    uint64_t _rate_window_bytes = 0;
+
+    // Sleeping sides of the ring are woken up under the mutex, the other side never takes it
+    std::mutex _mutex;
+    std::condition_variable _data_available;
+    std::condition_variable _space_available;
+    std::atomic<bool> _writer_waiting{false};
+    std::atomic<bool> _producer_waiting{false};
+    std::atomic<bool> _stopping{false};
+    std::atomic<bool> _failed{false};
+
+    std::atomic<uint64_t> _max_queue_depth{0};
+    std::atomic<uint64_t> _written_messages{0};
+    std::atomic<uint64_t> _written_bytes{0};
+    std::atomic<uint64_t> _dropped_messages{0};
+    std::atomic<uint64_t> _bytes_per_second{0};
+};
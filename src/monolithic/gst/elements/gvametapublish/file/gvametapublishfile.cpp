@@ -1,123 +1,61 @@
 /*******************************************************************************
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
 #include "gvametapublishfile.hpp"
+#include "file_writer.hpp"
 
 #include <common.hpp>
 
-#include <stdio.h>
 #include <string>
-
-#ifdef _MSC_VER
-// MSVC alternative for gcc ftello
-#define ftello _ftelli64
-#endif
+#include <string_view>
 
 GST_DEBUG_CATEGORY_STATIC(gva_meta_publish_file_debug_category);
 #define GST_CAT_DEFAULT gva_meta_publish_file_debug_category
 
-namespace {
-
-constexpr auto JSON_RECORD_PREFIX = ",\n";
-constexpr auto JSON_LINES_RECORD_SUFFIX = "\n";
-
-} // namespace
-
 /* Properties */
 enum {
     PROP_0,
     PROP_FILE_PATH,
     PROP_FILE_FORMAT,
+    PROP_QUEUE_SIZE,
+    PROP_FLUSH_BYTES,
+    PROP_FLUSH_COUNT,
+    PROP_FLUSH_INTERVAL,
+    PROP_MAX_FILE_SIZE,
+    PROP_ROTATION_INTERVAL,
+    PROP_DROP_POLICY,
+    PROP_IO_MODE,
+    PROP_QUEUE_DEPTH,
+    PROP_MAX_QUEUE_DEPTH,
+    PROP_BYTES_PER_SECOND,
+    PROP_DROPPED_MESSAGES,
 };
 
 class GvaMetaPublishFilePrivate {
-  private:
-    void write_message_prefix() {
-        // Add comma and line feed before the record when producing a JSON
-        if (_file_format == GVA_META_PUBLISH_JSON) {
-            if (ftello(_output_file) > 2) {
-                // a prior record was written, precede this message with record separator
-                fputs(JSON_RECORD_PREFIX, _output_file);
-            }
-        }
-    }
-
-    void write_message_suffix() {
-        // Add line feed after each record when producing a JSON Lines file/FIFO
-        if (_file_format == GVA_META_PUBLISH_JSON_LINES) {
-            fputs(JSON_LINES_RECORD_SUFFIX, _output_file);
-        }
-    }
-
-    bool write_message(const std::string &message) {
-        if (!_output_file)
-            return false;
-        write_message_prefix();
-        fputs(message.c_str(), _output_file);
-        write_message_suffix();
-        fflush(_output_file);
-        return true;
-    }
-
-    bool finalize_file() {
-        if (!_output_file) {
-            return false;
-        }
-        if (_file_format == GVA_META_PUBLISH_JSON && ftello(_output_file) > 0) {
-            fputs("]", _output_file);
-        }
-        fputs("\n", _output_file);
-        // For any pathfile we initialized w/ fopen(), invoke corresponding fclose()
-        if (_file_path != STDOUT) {
-            if (fclose(_output_file) != 0) {
-                return false;
-            }
-        }
-        return true;
-    }
-
-    bool initialize_file() {
-        if (_file_path == STDOUT) {
-            _output_file = stdout;
-            return true;
-        }
-        if (_file_format == GVA_META_PUBLISH_JSON) {
-            if (!(_output_file = fopen(_file_path.c_str(), "w+"))) {
-                return false;
-            }
-            // File will be an array of JSON objects. Start the array with '['
-            fputs("[", _output_file);
-        } else { // GVA_META_PUBLISH_JSON_LINES
-            if (!(_output_file = fopen(_file_path.c_str(), "a+"))) {
-                return false;
-            }
-        }
-        return true;
-    }
-
   public:
-    GvaMetaPublishFilePrivate(GvaMetaPublishBase *base) : _base(base) {
+    GvaMetaPublishFilePrivate(GvaMetaPublishBase *base) : _base(base), _writer(GST_OBJECT(base)) {
     }
 
     ~GvaMetaPublishFilePrivate() = default;
 
     gboolean start() {
-        if (_file_path.empty()) {
+        if (_settings.file_path.empty()) {
             GST_ELEMENT_ERROR(_base, RESOURCE, NOT_FOUND, ("file_path cannot be NULL."), (NULL));
             return false;
         }
-        if (!initialize_file()) {
-            GST_ELEMENT_ERROR(_base, RESOURCE, NOT_FOUND, ("Error opening file %s.", _file_path.c_str()), (nullptr));
+        if (!_writer.open(_settings)) {
+            GST_ELEMENT_ERROR(_base, RESOURCE, NOT_FOUND, ("Error opening file %s.", _settings.file_path.c_str()),
+                              (nullptr));
             return false;
         }
         return true;
     }
 
     gboolean stop() {
-        if (!finalize_file()) {
+        if (!_writer.close()) {
             GST_ERROR_OBJECT(_base, "Error finalizing file.");
             return false;
         }
@@ -125,13 +63,15 @@ class GvaMetaPublishFilePrivate {
         return true;
     }
 
-    gboolean publish(const std::string &message) {
-        if (!write_message(message)) {
+    gboolean publish(std::string_view message) {
+        // Message is written by writer thread, its copy is handed over to it
+        std::string queued(message);
+        if (!_writer.push(queued)) {
             GST_ERROR_OBJECT(_base, "Error writing inference to file.");
             return false;
         }
 
-        GST_DEBUG_OBJECT(_base, "Message was written successfully.");
+        GST_DEBUG_OBJECT(_base, "Message was queued for writing.");
 
         return true;
     }
@@ -139,10 +79,46 @@ class GvaMetaPublishFilePrivate {
     bool get_property(guint prop_id, GValue *value) {
         switch (prop_id) {
         case PROP_FILE_PATH:
-            g_value_set_string(value, _file_path.c_str());
+            g_value_set_string(value, _settings.file_path.c_str());
             break;
         case PROP_FILE_FORMAT:
-            g_value_set_enum(value, _file_format);
+            g_value_set_enum(value, _settings.file_format);
+            break;
+        case PROP_QUEUE_SIZE:
+            g_value_set_uint(value, _settings.queue_size);
+            break;
+        case PROP_FLUSH_BYTES:
+            g_value_set_uint64(value, _settings.flush_bytes);
+            break;
+        case PROP_FLUSH_COUNT:
+            g_value_set_uint(value, _settings.flush_count);
+            break;
+        case PROP_FLUSH_INTERVAL:
+            g_value_set_uint(value, _settings.flush_interval);
+            break;
+        case PROP_MAX_FILE_SIZE:
+            g_value_set_uint64(value, _settings.max_file_size);
+            break;
+        case PROP_ROTATION_INTERVAL:
+            g_value_set_uint(value, _settings.rotation_interval);
+            break;
+        case PROP_DROP_POLICY:
+            g_value_set_enum(value, _settings.drop_policy);
+            break;
+        case PROP_IO_MODE:
+            g_value_set_enum(value, _settings.io_mode);
+            break;
+        case PROP_QUEUE_DEPTH:
+            g_value_set_uint64(value, _writer.stats().queue_depth);
+            break;
+        case PROP_MAX_QUEUE_DEPTH:
+            g_value_set_uint64(value, _writer.stats().max_queue_depth);
+            break;
+        case PROP_BYTES_PER_SECOND:
+            g_value_set_uint64(value, _writer.stats().bytes_per_second);
+            break;
+        case PROP_DROPPED_MESSAGES:
+            g_value_set_uint64(value, _writer.stats().dropped_messages);
             break;
         default:
             return false;
@@ -153,10 +129,34 @@ class GvaMetaPublishFilePrivate {
     bool set_property(guint prop_id, const GValue *value) {
         switch (prop_id) {
         case PROP_FILE_PATH:
-            _file_path = g_value_get_string(value);
+            _settings.file_path = g_value_get_string(value);
             break;
         case PROP_FILE_FORMAT:
-            _file_format = static_cast<FileFormat>(g_value_get_enum(value));
+            _settings.file_format = static_cast<FileFormat>(g_value_get_enum(value));
+            break;
+        case PROP_QUEUE_SIZE:
+            _settings.queue_size = g_value_get_uint(value);
+            break;
+        case PROP_FLUSH_BYTES:
+            _settings.flush_bytes = g_value_get_uint64(value);
+            break;
+        case PROP_FLUSH_COUNT:
+            _settings.flush_count = g_value_get_uint(value);
+            break;
+        case PROP_FLUSH_INTERVAL:
+            _settings.flush_interval = g_value_get_uint(value);
+            break;
+        case PROP_MAX_FILE_SIZE:
+            _settings.max_file_size = g_value_get_uint64(value);
+            break;
+        case PROP_ROTATION_INTERVAL:
+            _settings.rotation_interval = g_value_get_uint(value);
+            break;
+        case PROP_DROP_POLICY:
+            _settings.drop_policy = static_cast<DropPolicy>(g_value_get_enum(value));
+            break;
+        case PROP_IO_MODE:
+            _settings.io_mode = static_cast<FileIoMode>(g_value_get_enum(value));
             break;
         default:
             return false;
@@ -167,9 +167,8 @@ class GvaMetaPublishFilePrivate {
   private:
     GvaMetaPublishBase *_base;
 
-    std::string _file_path;
-    FileFormat _file_format = GVA_META_PUBLISH_JSON;
-    FILE *_output_file = nullptr;
+    FileWriterSettings _settings;
+    FileWriter _writer;
 };
 
 G_DEFINE_TYPE_EXTENDED(GvaMetaPublishFile, gva_meta_publish_file, GST_TYPE_GVA_META_PUBLISH_BASE, 0,
@@ -221,7 +220,8 @@ static void gva_meta_publish_file_class_init(GvaMetaPublishFileClass *klass) {
     base_transform_class->start = [](GstBaseTransform *base) { return GVA_META_PUBLISH_FILE(base)->impl->start(); };
     base_transform_class->stop = [](GstBaseTransform *base) { return GVA_META_PUBLISH_FILE(base)->impl->stop(); };
 
-    base_metapublish_class->publish = [](GvaMetaPublishBase *base, const std::string &message) {
+    // File format is set by file-format property for both text and binary messages
+    base_metapublish_class->publish = [](GvaMetaPublishBase *base, std::string_view message, bool /*binary*/) {
         return GVA_META_PUBLISH_FILE(base)->impl->publish(message);
     };
 
@@ -237,4 +237,58 @@ static void gva_meta_publish_file_class_init(GvaMetaPublishFileClass *klass) {
         gobject_class, PROP_FILE_FORMAT,
         g_param_spec_enum("file-format", "File Format", "Structure of JSON objects in the file",
                           GST_TYPE_GVA_METAPUBLISH_FILE_FORMAT, DEFAULT_FILE_FORMAT, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_QUEUE_SIZE,
+                                    g_param_spec_uint("queue-size", "Queue Size",
+                                                      "Maximum number of messages waiting for writer thread",
+                                                      1, G_MAXINT, DEFAULT_QUEUE_SIZE, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_FLUSH_BYTES,
+                                    g_param_spec_uint64("flush-bytes", "Flush Bytes",
+                                                        "Write queued messages once they take this many bytes "
+                                                        "(0 - no size limit)",
+                                                        0, G_MAXUINT64, DEFAULT_FLUSH_BYTES, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_FLUSH_COUNT,
+                                    g_param_spec_uint("flush-count", "Flush Count",
+                                                      "Write queued messages once there are this many of them "
+                                                      "(0 - no count limit)",
+                                                      0, G_MAXUINT, DEFAULT_FLUSH_COUNT, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_FLUSH_INTERVAL,
+                                    g_param_spec_uint("flush-interval", "Flush Interval",
+                                                      "Write queued messages once the oldest of them waits this many "
+                                                      "milliseconds (0 - as soon as writer thread drains the queue)",
+                                                      0, G_MAXUINT, DEFAULT_FLUSH_INTERVAL, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_MAX_FILE_SIZE,
+                                    g_param_spec_uint64("max-file-size", "Max File Size",
+                                                        "Rotate the file once it reaches this many bytes, rotated "
+                                                        "file gets next free numeric suffix (0 - no rotation)",
+                                                        0, G_MAXUINT64, DEFAULT_MAX_FILE_SIZE, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_ROTATION_INTERVAL,
+                                    g_param_spec_uint("rotation-interval", "Rotation Interval",
+                                                      "Rotate the file after this many seconds (0 - no rotation)", 0,
+                                                      G_MAXUINT, DEFAULT_ROTATION_INTERVAL, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_DROP_POLICY,
+        g_param_spec_enum("drop-policy", "Drop Policy", "Behavior when writer queue is full",
+                          GST_TYPE_GVA_METAPUBLISH_DROP_POLICY, DEFAULT_DROP_POLICY, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_IO_MODE,
+                                    g_param_spec_enum("io-mode", "IO Mode", "How writer thread writes to the file",
+                                                      GST_TYPE_GVA_METAPUBLISH_FILE_IO_MODE, DEFAULT_FILE_IO_MODE,
+                                                      prm_flags));
+
+    auto stats_flags = static_cast<GParamFlags>(G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+    g_object_class_install_property(gobject_class, PROP_QUEUE_DEPTH,
+                                    g_param_spec_uint64("queue-depth", "Queue Depth",
+                                                        "Number of messages waiting for writer thread", 0,
+                                                        G_MAXUINT64, 0, stats_flags));
+    g_object_class_install_property(gobject_class, PROP_MAX_QUEUE_DEPTH,
+                                    g_param_spec_uint64("max-queue-depth", "Max Queue Depth",
+                                                        "Highest number of messages waiting for writer thread", 0,
+                                                        G_MAXUINT64, 0, stats_flags));
+    g_object_class_install_property(gobject_class, PROP_BYTES_PER_SECOND,
+                                    g_param_spec_uint64("bytes-per-second", "Bytes Per Second",
+                                                        "Bytes written to the file during the last second", 0,
+                                                        G_MAXUINT64, 0, stats_flags));
+    g_object_class_install_property(gobject_class, PROP_DROPPED_MESSAGES,
+                                    g_param_spec_uint64("dropped-messages", "Dropped Messages",
+                                                        "Number of messages dropped because writer queue was full", 0,
+                                                        G_MAXUINT64, 0, stats_flags));
 }
@@ -47,6 +47,23 @@ enum {
     PROP_PASSWORD,
     PROP_JSON_CONFIG_FILE,
     PROP_SIGNAL_HANDOFFS,
+    PROP_QUEUE_SIZE,
+    PROP_FLUSH_BYTES,
+    PROP_FLUSH_COUNT,
+    PROP_FLUSH_INTERVAL,
+    PROP_MAX_FILE_SIZE,
+    PROP_ROTATION_INTERVAL,
+    PROP_DROP_POLICY,
+    PROP_IO_MODE,
+    PROP_QUEUE_DEPTH,
+    PROP_MAX_QUEUE_DEPTH,
+    PROP_BYTES_PER_SECOND,
+    PROP_DROPPED_MESSAGES,
+    PROP_BATCH_SIZE,
+    PROP_BATCH_INTERVAL,
+    PROP_BATCH_FORMAT,
+    PROP_DELIVERED_MESSAGES,
+    PROP_FAILED_MESSAGES,
 };
 
 class GvaMetaPublishPrivate {
@@ -101,6 +118,39 @@ class GvaMetaPublishPrivate {
         case PROP_JSON_CONFIG_FILE: // Handle JSON configuration file property
             _json_config_file = g_value_get_string(value);
             break;
+        case PROP_QUEUE_SIZE:
+            _queue_size = g_value_get_uint(value);
+            break;
+        case PROP_FLUSH_BYTES:
+            _flush_bytes = g_value_get_uint64(value);
+            break;
+        case PROP_FLUSH_COUNT:
+            _flush_count = g_value_get_uint(value);
+            break;
+        case PROP_FLUSH_INTERVAL:
+            _flush_interval = g_value_get_uint(value);
+            break;
+        case PROP_MAX_FILE_SIZE:
+            _max_file_size = g_value_get_uint64(value);
+            break;
+        case PROP_ROTATION_INTERVAL:
+            _rotation_interval = g_value_get_uint(value);
+            break;
+        case PROP_DROP_POLICY:
+            _drop_policy = static_cast<DropPolicy>(g_value_get_enum(value));
+            break;
+        case PROP_IO_MODE:
+            _io_mode = static_cast<FileIoMode>(g_value_get_enum(value));
+            break;
+        case PROP_BATCH_SIZE:
+            _batch_size = g_value_get_uint(value);
+            break;
+        case PROP_BATCH_INTERVAL:
+            _batch_interval = g_value_get_uint(value);
+            break;
+        case PROP_BATCH_FORMAT:
+            _batch_format = static_cast<FileFormat>(g_value_get_enum(value));
+            break;
         default:
             G_OBJECT_WARN_INVALID_PROPERTY_ID(G_OBJECT(_base), prop_id, pspec);
             break;
@@ -142,6 +192,57 @@ class GvaMetaPublishPrivate {
         case PROP_JSON_CONFIG_FILE: // Handle JSON configuration file property
             g_value_set_string(value, _json_config_file.c_str());
             break;
+        case PROP_QUEUE_SIZE:
+            g_value_set_uint(value, _queue_size);
+            break;
+        case PROP_FLUSH_BYTES:
+            g_value_set_uint64(value, _flush_bytes);
+            break;
+        case PROP_FLUSH_COUNT:
+            g_value_set_uint(value, _flush_count);
+            break;
+        case PROP_FLUSH_INTERVAL:
+            g_value_set_uint(value, _flush_interval);
+            break;
+        case PROP_MAX_FILE_SIZE:
+            g_value_set_uint64(value, _max_file_size);
+            break;
+        case PROP_ROTATION_INTERVAL:
+            g_value_set_uint(value, _rotation_interval);
+            break;
+        case PROP_DROP_POLICY:
+            g_value_set_enum(value, _drop_policy);
+            break;
+        case PROP_IO_MODE:
+            g_value_set_enum(value, _io_mode);
+            break;
+        case PROP_BATCH_SIZE:
+            g_value_set_uint(value, _batch_size);
+            break;
+        case PROP_BATCH_INTERVAL:
+            g_value_set_uint(value, _batch_interval);
+            break;
+        case PROP_BATCH_FORMAT:
+            g_value_set_enum(value, _batch_format);
+            break;
+        case PROP_DELIVERED_MESSAGES:
+        case PROP_FAILED_MESSAGES:
+            // Delivery statistics are kept by broker elements
+            if (_metapublish && _method != GVA_META_PUBLISH_FILE)
+                g_object_get_property(G_OBJECT(_metapublish), g_param_spec_get_name(pspec), value);
+            else
+                g_value_set_uint64(value, 0);
+            break;
+        case PROP_QUEUE_DEPTH:
+        case PROP_MAX_QUEUE_DEPTH:
+        case PROP_BYTES_PER_SECOND:
+        case PROP_DROPPED_MESSAGES:
+            // Writer statistics are kept by file element, zero for other methods or before it is created
+            if (_metapublish && _method == GVA_META_PUBLISH_FILE)
+                g_object_get_property(G_OBJECT(_metapublish), g_param_spec_get_name(pspec), value);
+            else
+                g_value_set_uint64(value, 0);
+            break;
         default:
             G_OBJECT_WARN_INVALID_PROPERTY_ID(G_OBJECT(_base), prop_id, pspec);
             break;
@@ -163,20 +264,25 @@ class GvaMetaPublishPrivate {
         switch (_method) {
         case GVA_META_PUBLISH_FILE:
             if ((_metapublish = gst_element_factory_make("gvametapublishfile", nullptr)))
-                g_object_set(_metapublish, "file-format", _file_format, "file-path", _file_path.c_str(), nullptr);
+                g_object_set(_metapublish, "file-format", _file_format, "file-path", _file_path.c_str(), "queue-size",
+                             _queue_size, "flush-bytes", _flush_bytes, "flush-count", _flush_count, "flush-interval",
+                             _flush_interval, "max-file-size", _max_file_size, "rotation-interval",
+                             _rotation_interval, "drop-policy", _drop_policy, "io-mode", _io_mode, nullptr);
             break;
         case GVA_META_PUBLISH_MQTT:
             if ((_metapublish = gst_element_factory_make("gvametapublishmqtt", nullptr))) {
                 g_object_set(_metapublish, "address", _address.c_str(), "client-id", _mqtt_client_id.c_str(), "topic",
                              _topic.c_str(), "max-connect-attempts", _max_connect_attempts, "max-reconnect-interval",
                              _max_reconnect_interval, "username", _username.c_str(), "password", _password.c_str(),
-                             "mqtt-config", _json_config_file.c_str(), nullptr);
+                             "mqtt-config", _json_config_file.c_str(), "batch-size", _batch_size, "batch-interval",
+                             _batch_interval, "batch-format", _batch_format, nullptr);
             }
             break;
         case GVA_META_PUBLISH_KAFKA:
             if ((_metapublish = gst_element_factory_make("gvametapublishkafka", nullptr)))
                 g_object_set(_metapublish, "address", _address.c_str(), "topic", _topic.c_str(), "max-connect-attempts",
-                             _max_connect_attempts, "max-reconnect-interval", _max_reconnect_interval, nullptr);
+                             _max_connect_attempts, "max-reconnect-interval", _max_reconnect_interval, "batch-size",
+                             _batch_size, "batch-interval", _batch_interval, "batch-format", _batch_format, nullptr);
             break;
         default:
             GST_ERROR_OBJECT(_base, "Unknown publish method %d (%s)", _method, method_type_to_string(_method));
@@ -229,6 +335,17 @@ class GvaMetaPublishPrivate {
     std::string _password;
     std::string _json_config_file;
     bool _signal_handoffs = false;
+    uint32_t _queue_size = DEFAULT_QUEUE_SIZE;
+    uint64_t _flush_bytes = DEFAULT_FLUSH_BYTES;
+    uint32_t _flush_count = DEFAULT_FLUSH_COUNT;
+    uint32_t _flush_interval = DEFAULT_FLUSH_INTERVAL;
+    uint64_t _max_file_size = DEFAULT_MAX_FILE_SIZE;
+    uint32_t _rotation_interval = DEFAULT_ROTATION_INTERVAL;
+    DropPolicy _drop_policy = DEFAULT_DROP_POLICY;
+    FileIoMode _io_mode = DEFAULT_FILE_IO_MODE;
+    uint32_t _batch_size = DEFAULT_BATCH_SIZE;
+    uint32_t _batch_interval = DEFAULT_BATCH_INTERVAL;
+    FileFormat _batch_format = DEFAULT_BATCH_FORMAT;
 };
 
 G_DEFINE_TYPE_EXTENDED(GvaMetaPublish, gva_meta_publish, GST_TYPE_BIN, 0, G_ADD_PRIVATE(GvaMetaPublish);
@@ -354,4 +471,91 @@ static void gva_meta_publish_class_init(GvaMetaPublishClass *klass) {
     g_object_class_install_property(gobject_class, PROP_JSON_CONFIG_FILE,
                                     g_param_spec_string("mqtt-config", "Config", "[method= mqtt] MQTT config file",
                                                         DEFAULT_MQTTCONFIG_FILE, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_QUEUE_SIZE,
+                                    g_param_spec_uint("queue-size", "Queue Size",
+                                                      "[method= file] Maximum number of messages waiting for writer "
+                                                      "thread",
+                                                      1, G_MAXINT, DEFAULT_QUEUE_SIZE, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_FLUSH_BYTES,
+                                    g_param_spec_uint64("flush-bytes", "Flush Bytes",
+                                                        "[method= file] Write queued messages once they take this "
+                                                        "many bytes (0 - no size limit)",
+                                                        0, G_MAXUINT64, DEFAULT_FLUSH_BYTES, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_FLUSH_COUNT,
+                                    g_param_spec_uint("flush-count", "Flush Count",
+                                                      "[method= file] Write queued messages once there are this many "
+                                                      "of them (0 - no count limit)",
+                                                      0, G_MAXUINT, DEFAULT_FLUSH_COUNT, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_FLUSH_INTERVAL,
+                                    g_param_spec_uint("flush-interval", "Flush Interval",
+                                                      "[method= file] Write queued messages once the oldest of them "
+                                                      "waits this many milliseconds (0 - as soon as writer thread "
+                                                      "drains the queue)",
+                                                      0, G_MAXUINT, DEFAULT_FLUSH_INTERVAL, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_MAX_FILE_SIZE,
+                                    g_param_spec_uint64("max-file-size", "Max File Size",
+                                                        "[method= file] Rotate the file once it reaches this many "
+                                                        "bytes, rotated file gets next free numeric suffix "
+                                                        "(0 - no rotation)",
+                                                        0, G_MAXUINT64, DEFAULT_MAX_FILE_SIZE, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_ROTATION_INTERVAL,
+                                    g_param_spec_uint("rotation-interval", "Rotation Interval",
+                                                      "[method= file] Rotate the file after this many seconds "
+                                                      "(0 - no rotation)",
+                                                      0, G_MAXUINT, DEFAULT_ROTATION_INTERVAL, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_DROP_POLICY,
+        g_param_spec_enum("drop-policy", "Drop Policy", "[method= file] Behavior when writer queue is full",
+                          GST_TYPE_GVA_METAPUBLISH_DROP_POLICY, DEFAULT_DROP_POLICY, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_IO_MODE,
+        g_param_spec_enum("io-mode", "IO Mode", "[method= file] How writer thread writes to the file",
+                          GST_TYPE_GVA_METAPUBLISH_FILE_IO_MODE, DEFAULT_FILE_IO_MODE, prm_flags));
+
+    auto stats_flags = static_cast<GParamFlags>(G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+    g_object_class_install_property(gobject_class, PROP_QUEUE_DEPTH,
+                                    g_param_spec_uint64("queue-depth", "Queue Depth",
+                                                        "[method= file] Number of messages waiting for writer thread",
+                                                        0, G_MAXUINT64, 0, stats_flags));
+    g_object_class_install_property(gobject_class, PROP_MAX_QUEUE_DEPTH,
+                                    g_param_spec_uint64("max-queue-depth", "Max Queue Depth",
+                                                        "[method= file] Highest number of messages waiting for "
+                                                        "writer thread",
+                                                        0, G_MAXUINT64, 0, stats_flags));
+    g_object_class_install_property(gobject_class, PROP_BYTES_PER_SECOND,
+                                    g_param_spec_uint64("bytes-per-second", "Bytes Per Second",
+                                                        "[method= file] Bytes written to the file during the last "
+                                                        "second",
+                                                        0, G_MAXUINT64, 0, stats_flags));
+    g_object_class_install_property(gobject_class, PROP_DROPPED_MESSAGES,
+                                    g_param_spec_uint64("dropped-messages", "Dropped Messages",
+                                                        "[method= file] Number of messages dropped because writer "
+                                                        "queue was full",
+                                                        0, G_MAXUINT64, 0, stats_flags));
+    g_object_class_install_property(gobject_class, PROP_BATCH_SIZE,
+                                    g_param_spec_uint("batch-size", "Batch Size",
+                                                      "[method= kafka | mqtt] Number of messages coalesced into one "
+                                                      "broker message (1 - each message is published as is)",
+                                                      1, G_MAXINT, DEFAULT_BATCH_SIZE, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_BATCH_INTERVAL,
+                                    g_param_spec_uint("batch-interval", "Batch Interval",
+                                                      "[method= kafka | mqtt] Publish incomplete batch once its first "
+                                                      "message waits this many milliseconds (0 - no time limit)",
+                                                      0, G_MAXUINT, DEFAULT_BATCH_INTERVAL, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_BATCH_FORMAT,
+        g_param_spec_enum("batch-format", "Batch Format",
+                          "[method= kafka | mqtt] Structure of batch of text messages: JSON array, JSON Lines or "
+                          "CBOR sequence. Binary messages are always batched as CBOR sequence",
+                          GST_TYPE_GVA_METAPUBLISH_FILE_FORMAT, DEFAULT_BATCH_FORMAT, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_DELIVERED_MESSAGES,
+                                    g_param_spec_uint64("delivered-messages", "Delivered Messages",
+                                                        "[method= kafka | mqtt] Number of messages acknowledged by "
+                                                        "the broker",
+                                                        0, G_MAXUINT64, 0, stats_flags));
+    g_object_class_install_property(gobject_class, PROP_FAILED_MESSAGES,
+                                    g_param_spec_uint64("failed-messages", "Failed Messages",
+                                                        "[method= kafka | mqtt] Number of messages which failed to be "
+                                                        "delivered",
+                                                        0, G_MAXUINT64, 0, stats_flags));
 }
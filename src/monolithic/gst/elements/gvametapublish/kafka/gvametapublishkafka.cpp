@@ -72,8 +72,8 @@ static void gva_meta_publish_kafka_class_init(GvaMetaPublishKafkaClass *klass) {
     base_transform_class->start = [](GstBaseTransform *base) { return GVA_META_PUBLISH_KAFKA(base)->impl->start(); };
     base_transform_class->stop = [](GstBaseTransform *base) { return GVA_META_PUBLISH_KAFKA(base)->impl->stop(); };
 
-    base_metapublish_class->publish = [](GvaMetaPublishBase *base, const std::string &message) {
-        return GVA_META_PUBLISH_KAFKA(base)->impl->publish(message);
+    base_metapublish_class->publish = [](GvaMetaPublishBase *base, std::string_view message, bool binary) {
+        return GVA_META_PUBLISH_KAFKA(base)->impl->publish(message, binary);
     };
 
     gst_element_class_set_static_metadata(GST_ELEMENT_CLASS(klass), "Kafka metadata publisher", "Metadata",
@@ -97,6 +97,32 @@ static void gva_meta_publish_kafka_class_init(GvaMetaPublishKafkaClass *klass) {
                           "Maximum time in seconds between reconnection attempts. Initial "
                           "interval is 1 second and will be doubled on each failure up to this maximum interval.",
                           1, 300, DEFAULT_MAX_RECONNECT_INTERVAL, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_BATCH_SIZE,
+                                    g_param_spec_uint("batch-size", "Batch Size",
+                                                      "Number of messages coalesced into one Kafka message "
+                                                      "(1 - each message is published as is)",
+                                                      1, G_MAXINT, DEFAULT_BATCH_SIZE, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_BATCH_INTERVAL,
+                                    g_param_spec_uint("batch-interval", "Batch Interval",
+                                                      "Publish incomplete batch once its first message waits this "
+                                                      "many milliseconds (0 - no time limit)",
+                                                      0, G_MAXUINT, DEFAULT_BATCH_INTERVAL, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_BATCH_FORMAT,
+        g_param_spec_enum("batch-format", "Batch Format",
+                          "Structure of batch of text messages: JSON array, JSON Lines or CBOR sequence. Binary "
+                          "messages are always batched as CBOR sequence",
+                          GST_TYPE_GVA_METAPUBLISH_FILE_FORMAT, DEFAULT_BATCH_FORMAT, prm_flags));
+
+    auto stats_flags = static_cast<GParamFlags>(G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+    g_object_class_install_property(gobject_class, PROP_DELIVERED_MESSAGES,
+                                    g_param_spec_uint64("delivered-messages", "Delivered Messages",
+                                                        "Number of messages acknowledged by the broker", 0,
+                                                        G_MAXUINT64, 0, stats_flags));
+    g_object_class_install_property(gobject_class, PROP_FAILED_MESSAGES,
+                                    g_param_spec_uint64("failed-messages", "Failed Messages",
+                                                        "Number of messages which failed to be delivered", 0,
+                                                        G_MAXUINT64, 0, stats_flags));
 }
 
 static gboolean plugin_init(GstPlugin *plugin) {
@@ -7,12 +7,15 @@
 #pragma once
 
 #include <gvametapublishbase.hpp>
+#include <message_batcher.hpp>
 
 #include <librdkafka/rdkafkacpp.h>
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace {
 constexpr auto MILLISEC_PER_SEC = 1000;
@@ -25,6 +28,11 @@ enum {
     PROP_TOPIC,
     PROP_MAX_CONNECT_ATTEMPTS,
     PROP_MAX_RECONNECT_INTERVAL,
+    PROP_BATCH_SIZE,
+    PROP_BATCH_INTERVAL,
+    PROP_BATCH_FORMAT,
+    PROP_DELIVERED_MESSAGES,
+    PROP_FAILED_MESSAGES,
 };
 
 template <typename ProducerFactory, typename TopicFactory>
@@ -75,16 +83,40 @@ class GvaMetaPublishKafkaImpl : public RdKafka::DeliveryReportCb, public RdKafka
         return true;
     }
 
+    bool produce(BatchPayload payload) {
+        // Producer takes ownership of the payload and frees it after delivery. Number of messages coalesced into the
+        // payload is passed as opaque and comes back with delivery report
+        if (_producer->produce(_kafka_topic.get(), RdKafka::Topic::PARTITION_UA, RdKafka::Producer::MSG_FREE,
+                               payload.data, payload.size, nullptr,
+                               reinterpret_cast<void *>(static_cast<uintptr_t>(payload.messages)))) {
+            // Payload stays owned by the caller if it was not accepted
+            free(payload.data);
+            _failed_messages += payload.messages;
+
+            std::string error;
+            _producer->fatal_error(error);
+            GST_ERROR_OBJECT(_base, "Failed to publish message: %s", error.c_str());
+            return false;
+        }
+        GST_DEBUG_OBJECT(_base, "Kafka message sent.");
+        return true;
+    }
+
   public:
-    GvaMetaPublishKafkaImpl(GvaMetaPublishBase *base) : _base(base) {
+    GvaMetaPublishKafkaImpl(GvaMetaPublishBase *base)
+        : _base(base), _sender(GST_OBJECT(base), [this](BatchPayload payload) { return produce(payload); }) {
     }
 
     ~GvaMetaPublishKafkaImpl() override = default;
 
     void dr_cb(RdKafka::Message &message) final {
+        const auto opaque = reinterpret_cast<uintptr_t>(message.msg_opaque());
+        const uint64_t messages = opaque ? opaque : 1;
         if (message.err() != RdKafka::ERR_NO_ERROR) {
+            _failed_messages += messages;
             GST_ERROR_OBJECT(_base, "Message failed to publish to Kafka. Error message: %s", message.errstr().c_str());
         } else {
+            _delivered_messages += messages;
             GST_DEBUG_OBJECT(_base, "Message successfully published to Kafka");
         }
     }
@@ -108,11 +140,14 @@ class GvaMetaPublishKafkaImpl : public RdKafka::DeliveryReportCb, public RdKafka
 
     gboolean start() {
         _connection_attempt = 1;
+        _delivered_messages = 0;
+        _failed_messages = 0;
 
         if (!init_kafka_producer()) {
             GST_ELEMENT_ERROR(_base, RESOURCE, NOT_FOUND, ("Failed to start"), ("Failed to initialize Kafka producer"));
             return false;
         }
+        _sender.start(_batch_format, _batch_size, _batch_interval);
 
         return true;
     }
@@ -121,6 +156,9 @@ class GvaMetaPublishKafkaImpl : public RdKafka::DeliveryReportCb, public RdKafka
         if (!_producer)
             return true;
 
+        // Messages of incomplete batch are sent before the producer is flushed
+        _sender.stop();
+
         if (_producer->flush(3 * MILLISEC_PER_SEC) != RdKafka::ERR_NO_ERROR) {
             GST_ERROR_OBJECT(_base, "Failed to flush kafka producer.");
             auto queue_size = _producer->outq_len();
@@ -130,27 +168,19 @@ class GvaMetaPublishKafkaImpl : public RdKafka::DeliveryReportCb, public RdKafka
         } else {
             GST_DEBUG_OBJECT(_base, "Successfully flushed Kafka producer.");
         }
+        GST_INFO_OBJECT(_base, "Kafka delivery reports: %" G_GUINT64_FORMAT " messages delivered, %" G_GUINT64_FORMAT
+                        " failed", _delivered_messages.load(), _failed_messages.load());
 
         return true;
     }
 
-    gboolean publish(const std::string &message) {
+    gboolean publish(std::string_view message, bool binary = false) {
         if (!_producer) {
             GST_ERROR_OBJECT(_base, "Producer handler is null. Cannot publish message.");
             return false;
         }
         _producer->poll(0);
-        if (_producer->produce(_kafka_topic.get(), RdKafka::Topic::PARTITION_UA, RdKafka::Producer::MSG_COPY,
-                               (void *)const_cast<char *>(message.c_str()), message.size(), nullptr, nullptr)) {
-
-            std::string error;
-            _producer->fatal_error(error);
-            GST_ERROR_OBJECT(_base, "Failed to publish message: %s", error.c_str());
-            return false;
-        }
-
-        GST_DEBUG_OBJECT(_base, "Kafka message sent.");
-        return true;
+        return _sender.append(message, binary);
     }
 
     bool get_property(guint prop_id, GValue *value) {
@@ -167,6 +197,21 @@ class GvaMetaPublishKafkaImpl : public RdKafka::DeliveryReportCb, public RdKafka
         case PROP_MAX_RECONNECT_INTERVAL:
             g_value_set_uint(value, _max_reconnect_interval);
             break;
+        case PROP_BATCH_SIZE:
+            g_value_set_uint(value, _batch_size);
+            break;
+        case PROP_BATCH_INTERVAL:
+            g_value_set_uint(value, _batch_interval);
+            break;
+        case PROP_BATCH_FORMAT:
+            g_value_set_enum(value, _batch_format);
+            break;
+        case PROP_DELIVERED_MESSAGES:
+            g_value_set_uint64(value, _delivered_messages);
+            break;
+        case PROP_FAILED_MESSAGES:
+            g_value_set_uint64(value, _failed_messages);
+            break;
         default:
             return false;
         }
@@ -187,6 +232,15 @@ class GvaMetaPublishKafkaImpl : public RdKafka::DeliveryReportCb, public RdKafka
         case PROP_MAX_RECONNECT_INTERVAL:
             _max_reconnect_interval = g_value_get_uint(value);
             break;
+        case PROP_BATCH_SIZE:
+            _batch_size = g_value_get_uint(value);
+            break;
+        case PROP_BATCH_INTERVAL:
+            _batch_interval = g_value_get_uint(value);
+            break;
+        case PROP_BATCH_FORMAT:
+            _batch_format = static_cast<FileFormat>(g_value_get_enum(value));
+            break;
         default:
             return false;
         }
@@ -200,8 +254,17 @@ class GvaMetaPublishKafkaImpl : public RdKafka::DeliveryReportCb, public RdKafka
     std::string _topic;
     uint32_t _max_connect_attempts = 0;
     uint32_t _max_reconnect_interval = 0;
+    uint32_t _batch_size = DEFAULT_BATCH_SIZE;
+    uint32_t _batch_interval = DEFAULT_BATCH_INTERVAL;
+    FileFormat _batch_format = DEFAULT_BATCH_FORMAT;
 
     std::unique_ptr<RdKafka::Producer> _producer;
     std::unique_ptr<RdKafka::Topic> _kafka_topic;
     uint32_t _connection_attempt = 0;
+
+    // Declared after the producer, so its thread is stopped before the producer is destroyed
+    BatchSender _sender;
+    // Updated by delivery report callback
+    std::atomic<uint64_t> _delivered_messages{0};
+    std::atomic<uint64_t> _failed_messages{0};
 };
@@ -17,13 +17,20 @@ using json = nlohmann::json;
 #include <MQTTAsync.h>
 #include <uuid/uuid.h>
 
+#include <atomic>
 #include <cstdint>
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <thread>
+#include <unordered_map>
 
 GST_DEBUG_CATEGORY_STATIC(gva_meta_publish_mqtt_debug_category);
 #define GST_CAT_DEFAULT gva_meta_publish_mqtt_debug_category
 
+// Include after GST_CAT_DEFAULT define
+#include <message_batcher.hpp>
+
 namespace {
 std::string generate_client_id() {
     uuid_t binuuid;
@@ -47,6 +54,11 @@ enum {
     PROP_USERNAME,
     PROP_PASSWORD,
     PROP_JSON_CONFIG_FILE,
+    PROP_BATCH_SIZE,
+    PROP_BATCH_INTERVAL,
+    PROP_BATCH_FORMAT,
+    PROP_DELIVERED_MESSAGES,
+    PROP_FAILED_MESSAGES,
 };
 
 class GvaMetaPublishMqttPrivate {
@@ -75,14 +87,27 @@ class GvaMetaPublishMqttPrivate {
     void on_delivery_complete(MQTTAsync_token /*token*/) {
     }
 
-    void on_send_success(MQTTAsync_successData * /*response*/) {
+    void on_send_success(MQTTAsync_successData *response) {
+        _delivered_messages += take_batch_messages(response ? response->token : 0);
         GST_DEBUG_OBJECT(_base, "Message successfully published to MQTT");
     }
 
-    void on_send_failure(MQTTAsync_failureData * /*response*/) {
+    void on_send_failure(MQTTAsync_failureData *response) {
+        _failed_messages += take_batch_messages(response ? response->token : 0);
         GST_ERROR_OBJECT(_base, "Message failed to publish to MQTT");
     }
 
+    // Number of messages coalesced into payload sent with the token, payloads of single message are not tracked
+    uint32_t take_batch_messages(MQTTAsync_token token) {
+        std::lock_guard<std::mutex> lock(_batch_tokens_mutex);
+        auto it = _batch_tokens.find(token);
+        if (it == _batch_tokens.end())
+            return 1;
+        const uint32_t messages = it->second;
+        _batch_tokens.erase(it);
+        return messages;
+    }
+
     void on_disconnect_success(MQTTAsync_successData * /*response*/) {
         GST_DEBUG_OBJECT(_base, "Successfully disconnected from MQTT.");
     }
@@ -109,7 +134,12 @@ class GvaMetaPublishMqttPrivate {
     }
 
   public:
-    GvaMetaPublishMqttPrivate(GvaMetaPublishBase *parent) : _base(parent) {
+    GvaMetaPublishMqttPrivate(GvaMetaPublishBase *parent)
+        : _base(parent), _sender(GST_OBJECT(parent), [this](BatchPayload payload) {
+              send(payload.data, payload.size, payload.messages);
+              free(payload.data);
+              return true;
+          }) {
         _connect_options = MQTTAsync_connectOptions_initializer;
         _connect_options.keepAliveInterval = 20;
         _connect_options.cleansession = 1;
@@ -213,6 +243,8 @@ class GvaMetaPublishMqttPrivate {
             _client_id = generate_client_id();
         _connection_attempt = 1;
         _sleep_time = 1;
+        _delivered_messages = 0;
+        _failed_messages = 0;
 
         if (_TLS) {
             const std::string prefix = "ssl://";
@@ -279,13 +311,24 @@ class GvaMetaPublishMqttPrivate {
             return false;
         }
         GST_DEBUG_OBJECT(_base, "Connect request sent to MQTT.");
+        _sender.start(_batch_format, _batch_size, _batch_interval);
         return true;
     }
 
-    gboolean publish(const std::string &message) {
+    gboolean publish(std::string_view message, bool binary) {
+        // Client copies the payload while sending, so single message is passed as is
+        if (!_sender.batching()) {
+            send(const_cast<char *>(message.data()), message.size(), 1);
+            return true;
+        }
+        _sender.append(message, binary);
+        return true;
+    }
+
+    void send(char *payload, size_t size, uint32_t messages) {
         MQTTAsync_message mqtt_message = MQTTAsync_message_initializer;
-        mqtt_message.payload = const_cast<char *>(message.c_str());
-        mqtt_message.payloadlen = safe_convert<int>(message.size());
+        mqtt_message.payload = payload;
+        mqtt_message.payloadlen = safe_convert<int>(size);
         mqtt_message.retained = FALSE;
 
         // TODO Validate message is JSON
@@ -306,16 +349,27 @@ class GvaMetaPublishMqttPrivate {
             static_cast<GvaMetaPublishMqttPrivate *>(context)->on_send_failure(response);
         };
 
+        // Token of batch is registered before its delivery callback can look it up
+        std::lock_guard<std::mutex> lock(_batch_tokens_mutex);
         auto c = MQTTAsync_sendMessage(_client, _topic.c_str(), &mqtt_message, &ro);
         if (c != MQTTASYNC_SUCCESS) {
+            _failed_messages += messages;
             GST_ERROR_OBJECT(_base, "Message was not accepted for publication. Error code %d.", c);
-            return true;
+            return;
         }
+        if (messages > 1)
+            _batch_tokens[ro.token] = messages;
         GST_DEBUG_OBJECT(_base, "MQTT message sent.");
-        return true;
     }
 
     gboolean stop() {
+        // Messages of incomplete batch are sent before disconnecting
+        _sender.stop();
+        GST_INFO_OBJECT(_base,
+                        "MQTT delivery reports: %" G_GUINT64_FORMAT " messages delivered, %" G_GUINT64_FORMAT
+                        " failed",
+                        _delivered_messages.load(), _failed_messages.load());
+
         if (!MQTTAsync_isConnected(_client)) {
             GST_DEBUG_OBJECT(_base, "MQTT client is not connected. Nothing to disconnect");
             return true;
@@ -356,6 +410,15 @@ class GvaMetaPublishMqttPrivate {
         case PROP_JSON_CONFIG_FILE: // Handle JSON configuration file property
             _json_config_file = g_value_get_string(value);
             break;
+        case PROP_BATCH_SIZE:
+            _batch_size = g_value_get_uint(value);
+            break;
+        case PROP_BATCH_INTERVAL:
+            _batch_interval = g_value_get_uint(value);
+            break;
+        case PROP_BATCH_FORMAT:
+            _batch_format = static_cast<FileFormat>(g_value_get_enum(value));
+            break;
         default:
             return false;
         }
@@ -389,6 +452,21 @@ class GvaMetaPublishMqttPrivate {
         case PROP_JSON_CONFIG_FILE: // Handle JSON configuration file property
             g_value_set_string(value, _json_config_file.c_str());
             break;
+        case PROP_BATCH_SIZE:
+            g_value_set_uint(value, _batch_size);
+            break;
+        case PROP_BATCH_INTERVAL:
+            g_value_set_uint(value, _batch_interval);
+            break;
+        case PROP_BATCH_FORMAT:
+            g_value_set_enum(value, _batch_format);
+            break;
+        case PROP_DELIVERED_MESSAGES:
+            g_value_set_uint64(value, _delivered_messages);
+            break;
+        case PROP_FAILED_MESSAGES:
+            g_value_set_uint64(value, _failed_messages);
+            break;
         default:
             return false;
         }
@@ -423,6 +501,18 @@ class GvaMetaPublishMqttPrivate {
     MQTTAsync_disconnectOptions _disconnect_options;
     uint32_t _connection_attempt;
     uint32_t _sleep_time;
+
+    uint32_t _batch_size = DEFAULT_BATCH_SIZE;
+    uint32_t _batch_interval = DEFAULT_BATCH_INTERVAL;
+    FileFormat _batch_format = DEFAULT_BATCH_FORMAT;
+    std::mutex _batch_tokens_mutex;
+    std::unordered_map<MQTTAsync_token, uint32_t> _batch_tokens;
+    // Updated by delivery callbacks
+    std::atomic<uint64_t> _delivered_messages{0};
+    std::atomic<uint64_t> _failed_messages{0};
+    // Batches are sent by the streaming thread and by the sender's thread once due, declared last so the thread is
+    // stopped before members it uses are destroyed
+    BatchSender _sender;
 };
 
 G_DEFINE_TYPE_EXTENDED(GvaMetaPublishMqtt, gva_meta_publish_mqtt, GST_TYPE_GVA_META_PUBLISH_BASE, 0,
@@ -505,8 +595,8 @@ static void gva_meta_publish_mqtt_class_init(GvaMetaPublishMqttClass *klass) {
     base_transform_class->start = [](GstBaseTransform *base) { return GVA_META_PUBLISH_MQTT(base)->impl->start(); };
     base_transform_class->stop = [](GstBaseTransform *base) { return GVA_META_PUBLISH_MQTT(base)->impl->stop(); };
 
-    base_metapublish_class->publish = [](GvaMetaPublishBase *base, const std::string &message) {
-        return GVA_META_PUBLISH_MQTT(base)->impl->publish(message);
+    base_metapublish_class->publish = [](GvaMetaPublishBase *base, std::string_view message, bool binary) {
+        return GVA_META_PUBLISH_MQTT(base)->impl->publish(message, binary);
     };
 
     gst_element_class_set_static_metadata(GST_ELEMENT_CLASS(klass), "Mqtt metadata publisher", "Metadata",
@@ -548,6 +638,32 @@ static void gva_meta_publish_mqtt_class_init(GvaMetaPublishMqttClass *klass) {
     g_object_class_install_property(gobject_class, PROP_JSON_CONFIG_FILE,
                                     g_param_spec_string("mqtt-config", "Config", "[method= mqtt] MQTT config file",
                                                         DEFAULT_MQTTCONFIG_FILE, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_BATCH_SIZE,
+                                    g_param_spec_uint("batch-size", "Batch Size",
+                                                      "Number of messages coalesced into one MQTT message "
+                                                      "(1 - each message is published as is)",
+                                                      1, G_MAXINT, DEFAULT_BATCH_SIZE, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_BATCH_INTERVAL,
+                                    g_param_spec_uint("batch-interval", "Batch Interval",
+                                                      "Publish incomplete batch once its first message waits this "
+                                                      "many milliseconds (0 - no time limit)",
+                                                      0, G_MAXUINT, DEFAULT_BATCH_INTERVAL, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_BATCH_FORMAT,
+        g_param_spec_enum("batch-format", "Batch Format",
+                          "Structure of batch of text messages: JSON array, JSON Lines or CBOR sequence. Binary "
+                          "messages are always batched as CBOR sequence",
+                          GST_TYPE_GVA_METAPUBLISH_FILE_FORMAT, DEFAULT_BATCH_FORMAT, prm_flags));
+
+    auto stats_flags = static_cast<GParamFlags>(G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+    g_object_class_install_property(gobject_class, PROP_DELIVERED_MESSAGES,
+                                    g_param_spec_uint64("delivered-messages", "Delivered Messages",
+                                                        "Number of messages acknowledged by the broker", 0,
+                                                        G_MAXUINT64, 0, stats_flags));
+    g_object_class_install_property(gobject_class, PROP_FAILED_MESSAGES,
+                                    g_param_spec_uint64("failed-messages", "Failed Messages",
+                                                        "Number of messages which failed to be delivered", 0,
+                                                        G_MAXUINT64, 0, stats_flags));
 
     // Override the state change function
     GstElementClass *element_class = GST_ELEMENT_CLASS(klass);
@@ -0,0 +1,158 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "deep_sort_kalman.h"
+
+#include <algorithm>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(_WIN32)
+#define KALMAN_BANK_MULTIVERSION __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define KALMAN_BANK_MULTIVERSION
+#endif
+
+namespace DeepSortWrapper {
+
+namespace {
+
+constexpr size_t ASPECT_RATIO = 2;
+constexpr size_t HEIGHT = 3;
+
+// Standard deviations of noise relative to box height, aspect ratio noise is constant
+constexpr float STD_WEIGHT_POSITION = 1.0f / 20.0f;
+constexpr float STD_WEIGHT_VELOCITY = 1.0f / 160.0f;
+constexpr float ASPECT_RATIO_POSITION_NOISE = 1e-2f;
+constexpr float ASPECT_RATIO_VELOCITY_NOISE = 1e-5f;
+constexpr float ASPECT_RATIO_MEASUREMENT_NOISE = 1e-1f;
+
+KALMAN_BANK_MULTIVERSION
+void predict_position(float *position, const float *velocity, const float *scheduled, size_t size) {
+    for (size_t k = 0; k < size; ++k)
+        position[k] += scheduled[k] * velocity[k];
+}
+
+/**
+ * @brief P = F P F' + Q of one coordinate, noise is (weight * height)^2 + constant
+ */
+KALMAN_BANK_MULTIVERSION
+void predict_covariance(float *position_var, float *covariance, float *velocity_var, const float *height,
+                        const float *scheduled, size_t size, float position_weight, float position_noise,
+                        float velocity_weight, float velocity_noise) {
+    for (size_t k = 0; k < size; ++k) {
+        const float s = scheduled[k];
+        const float position_std = position_weight * height[k];
+        const float velocity_std = velocity_weight * height[k];
+        const float velocity_var_k = velocity_var[k];
+        position_var[k] += s * (2.0f * covariance[k] + velocity_var_k + position_std * position_std + position_noise);
+        covariance[k] += s * velocity_var_k;
+        velocity_var[k] += s * (velocity_std * velocity_std + velocity_noise);
+    }
+}
+
+} // namespace
+
+size_t KalmanBank::add(const cv::Rect_<float> &bbox) {
+    size_t slot;
+    if (free_slots_.empty()) {
+        slot = scheduled_.size();
+        for (size_t c = 0; c < COORDINATES; ++c) {
+            position_[c].push_back(0.0f);
+            velocity_[c].push_back(0.0f);
+            position_var_[c].push_back(0.0f);
+            covariance_[c].push_back(0.0f);
+            velocity_var_[c].push_back(0.0f);
+        }
+        scheduled_.push_back(0.0f);
+    } else {
+        slot = free_slots_.back();
+        free_slots_.pop_back();
+    }
+
+    position_[0][slot] = bbox.x + bbox.width / 2.0f;
+    position_[1][slot] = bbox.y + bbox.height / 2.0f;
+    position_[ASPECT_RATIO][slot] = bbox.width / bbox.height;
+    position_[HEIGHT][slot] = bbox.height;
+
+    for (size_t c = 0; c < COORDINATES; ++c) {
+        velocity_[c][slot] = 0.0f;
+        covariance_[c][slot] = 0.0f;
+        position_var_[c][slot] = 2.0f * STD_WEIGHT_POSITION * bbox.height;
+        velocity_var_[c][slot] = 10.0f * STD_WEIGHT_VELOCITY * bbox.height;
+    }
+    position_var_[ASPECT_RATIO][slot] = 1e-2f;
+    velocity_var_[ASPECT_RATIO][slot] = 1e-5f;
+    return slot;
+}
+
+/**
+ * @brief Free slot is zeroed, so it stays finite when predicted with other filters
+ */
+void KalmanBank::remove(size_t slot) {
+    for (size_t c = 0; c < COORDINATES; ++c) {
+        position_[c][slot] = 0.0f;
+        velocity_[c][slot] = 0.0f;
+        position_var_[c][slot] = 0.0f;
+        covariance_[c][slot] = 0.0f;
+        velocity_var_[c][slot] = 0.0f;
+    }
+    scheduled_[slot] = 0.0f;
+    free_slots_.push_back(slot);
+}
+
+/**
+ * @brief Constant velocity prediction of scheduled filters, process noise depends on predicted height
+ */
+void KalmanBank::predict() {
+    const size_t size = scheduled_.size();
+    for (size_t c = 0; c < COORDINATES; ++c)
+        predict_position(position_[c].data(), velocity_[c].data(), scheduled_.data(), size);
+
+    for (size_t c = 0; c < COORDINATES; ++c) {
+        const bool aspect_ratio = c == ASPECT_RATIO;
+        const float position_weight = aspect_ratio ? 0.0f : STD_WEIGHT_POSITION;
+        const float position_noise = aspect_ratio ? ASPECT_RATIO_POSITION_NOISE : 0.0f;
+        const float velocity_weight = aspect_ratio ? 0.0f : STD_WEIGHT_VELOCITY;
+        const float velocity_noise = aspect_ratio ? ASPECT_RATIO_VELOCITY_NOISE : 0.0f;
+        predict_covariance(position_var_[c].data(), covariance_[c].data(), velocity_var_[c].data(),
+                           position_[HEIGHT].data(), scheduled_.data(), size, position_weight, position_noise,
+                           velocity_weight, velocity_noise);
+    }
+    std::fill(scheduled_.begin(), scheduled_.end(), 0.0f);
+}
+
+/**
+ * @brief Kalman correction with measured box, gain of each coordinate is computed from its 2x2 covariance block
+ */
+void KalmanBank::update(size_t slot, const cv::Rect_<float> &bbox) {
+    const float measurement[COORDINATES] = {bbox.x + bbox.width / 2.0f, bbox.y + bbox.height / 2.0f,
+                                            bbox.width / bbox.height, bbox.height};
+    const float position_std = STD_WEIGHT_POSITION * bbox.height;
+
+    for (size_t c = 0; c < COORDINATES; ++c) {
+        const float noise = c == ASPECT_RATIO ? ASPECT_RATIO_MEASUREMENT_NOISE : position_std * position_std;
+        float &position_var = position_var_[c][slot];
+        float &covariance = covariance_[c][slot];
+
+        const float innovation_var = position_var + noise;
+        const float position_gain = position_var / innovation_var;
+        const float velocity_gain = covariance / innovation_var;
+        const float residual = measurement[c] - position_[c][slot];
+
+        position_[c][slot] += position_gain * residual;
+        velocity_[c][slot] += velocity_gain * residual;
+        velocity_var_[c][slot] -= velocity_gain * covariance;
+        covariance -= position_gain * covariance;
+        position_var -= position_gain * position_var;
+    }
+}
+
+cv::Rect_<float> KalmanBank::bbox(size_t slot) const {
+    const float height = position_[HEIGHT][slot];
+    const float width = position_[ASPECT_RATIO][slot] * height;
+    return cv::Rect_<float>(position_[0][slot] - width / 2.0f, position_[1][slot] - height / 2.0f, width, height);
+}
+
+} // namespace DeepSortWrapper
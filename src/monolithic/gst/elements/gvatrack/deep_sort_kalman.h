@@ -0,0 +1,54 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <opencv2/core.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace DeepSortWrapper {
+
+/**
+ * Kalman filters of Deep SORT tracks stored as structure of arrays, so tracks of many streams are predicted in one
+ * vectorized loop.
+ *
+ * State of a filter is box center x, center y, aspect ratio and height with their velocities (constant velocity
+ * model), measurement is the box. Coordinates are independent in this model, so covariance is kept as 2x2 block of
+ * each coordinate: variance of the coordinate, its covariance with the velocity and variance of the velocity.
+ */
+class KalmanBank {
+  public:
+    static constexpr size_t COORDINATES = 4;
+
+    // Initiates filter from first detection of a track, returns its slot
+    size_t add(const cv::Rect_<float> &bbox);
+    void remove(size_t slot);
+
+    // Marks filter to be advanced by the next predict()
+    void schedule(size_t slot) {
+        scheduled_[slot] = 1.0f;
+    }
+    // Advances scheduled filters by one frame and clears schedule
+    void predict();
+    void update(size_t slot, const cv::Rect_<float> &bbox);
+
+    cv::Rect_<float> bbox(size_t slot) const;
+
+  private:
+    std::vector<float> position_[COORDINATES];
+    std::vector<float> velocity_[COORDINATES];
+    std::vector<float> position_var_[COORDINATES];
+    std::vector<float> covariance_[COORDINATES];
+    std::vector<float> velocity_var_[COORDINATES];
+
+    // 1 for filters scheduled for prediction, 0 otherwise
+    std::vector<float> scheduled_;
+    std::vector<size_t> free_slots_;
+};
+
+} // namespace DeepSortWrapper
@@ -11,118 +11,92 @@
 #include <cmath>
 #include <numeric>
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(_WIN32)
+#define DEEP_SORT_MULTIVERSION __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define DEEP_SORT_MULTIVERSION
+#endif
+
 namespace DeepSortWrapper {
 
-// Track implementation
+namespace {
+
+constexpr size_t SIMILARITY_LANES = 16;
 
 /**
- * @brief Constructs a new Track with initial detection data and Kalman filter state
+ * @brief For each of features_num features computes the highest dot product with gallery rows (at least 0)
+ * @details Partial sums are kept in separate lanes, so the dot product loop is vectorized without fast-math
  */
-Track::Track(const cv::Rect_<float> &bbox, int track_id, int n_init, int max_age, const std::vector<float> &feature)
-    : track_id_(track_id), hits_(1), age_(1), time_since_update_(0), state_(TrackState::Tentative), n_init_(n_init),
-      max_age_(max_age), nn_budget_(DEFAULT_NN_BUDGET) {
-    initiate(bbox);
-    add_feature(feature);
+DEEP_SORT_MULTIVERSION
+void max_similarities(const float *const *features, size_t features_num, const float *gallery, size_t gallery_rows,
+                      size_t dim, float *result) {
+    const size_t body = dim - dim % SIMILARITY_LANES;
+    for (size_t f = 0; f < features_num; ++f) {
+        const float *feature = features[f];
+        float best = 0.0f;
+        for (size_t g = 0; g < gallery_rows; ++g) {
+            const float *row = gallery + g * dim;
+            float lanes[SIMILARITY_LANES] = {};
+            for (size_t k = 0; k < body; k += SIMILARITY_LANES)
+                for (size_t l = 0; l < SIMILARITY_LANES; ++l)
+                    lanes[l] += feature[k + l] * row[k + l];
+
+            float dot = 0.0f;
+            for (size_t l = 0; l < SIMILARITY_LANES; ++l)
+                dot += lanes[l];
+            for (size_t k = body; k < dim; ++k)
+                dot += feature[k] * row[k];
+            best = std::max(best, dot);
+        }
+        result[f] = best;
+    }
 }
 
+} // namespace
+
+// FeatureGallery implementation
+
 /**
- * @brief Initialize Kalman filter state and covariance matrix from first detection bbox
+ * @brief Store feature in the oldest row once the budget is reached
  */
-void Track::initiate(const cv::Rect_<float> &bbox) {
-    // Initialize Kalman filter with 8-dimensional state space (x, y, aspect_ratio, height, vx, vy, va, vh)
-    mean_ = cv::Mat::zeros(8, 1, CV_32F);
-    mean_.at<float>(0) = bbox.x + bbox.width / 2.0f;  // center_x
-    mean_.at<float>(1) = bbox.y + bbox.height / 2.0f; // center_y
-    mean_.at<float>(2) = bbox.width / bbox.height;    // aspect_ratio
-    mean_.at<float>(3) = bbox.height;                 // height
-
-    // Initialize covariance matrix
-    covariance_ = cv::Mat::eye(8, 8, CV_32F);
-    float std_weight_position = 1.0f / 20.0f;
-    float std_weight_velocity = 1.0f / 160.0f;
-
-    covariance_.at<float>(0, 0) = 2.0f * std_weight_position * bbox.height;
-    covariance_.at<float>(1, 1) = 2.0f * std_weight_position * bbox.height;
-    covariance_.at<float>(2, 2) = 1e-2;
-    covariance_.at<float>(3, 3) = 2.0f * std_weight_position * bbox.height;
-    covariance_.at<float>(4, 4) = 10.0f * std_weight_velocity * bbox.height;
-    covariance_.at<float>(5, 5) = 10.0f * std_weight_velocity * bbox.height;
-    covariance_.at<float>(6, 6) = 1e-5;
-    covariance_.at<float>(7, 7) = 10.0f * std_weight_velocity * bbox.height;
+void FeatureGallery::add(const std::vector<float> &feature) {
+    if (feature.empty() || budget_ == 0)
+        return;
+
+    if (feature.size() != dim_) {
+        dim_ = feature.size();
+        data_.assign(budget_ * dim_, 0.0f);
+        size_ = 0;
+        next_row_ = 0;
+    }
+
+    std::copy(feature.begin(), feature.end(), data_.begin() + next_row_ * dim_);
+    next_row_ = (next_row_ + 1) % budget_;
+    size_ = std::min(size_ + 1, budget_);
 }
 
+// Track implementation
+
 /**
- * @brief Predict next state using Kalman filter motion model (constant velocity)
+ * @brief Constructs a new Track with initial detection data and Kalman filter state
  */
-void Track::predict() {
-    // OpenCV-based implementation
-    // State transition matrix
-    cv::Mat F = cv::Mat::eye(8, 8, CV_32F);
-    F.at<float>(0, 4) = 1.0f; // x += vx
-    F.at<float>(1, 5) = 1.0f; // y += vy
-    F.at<float>(2, 6) = 1.0f; // aspect_ratio += va
-    F.at<float>(3, 7) = 1.0f; // height += vh
-
-    // Predict state
-    mean_ = F * mean_;
-
-    // Process noise
-    cv::Mat Q = cv::Mat::eye(8, 8, CV_32F);
-    float std_weight_position = 1.0f / 20.0f;
-    float std_weight_velocity = 1.0f / 160.0f;
-    float height = mean_.at<float>(3);
-
-    Q.at<float>(0, 0) = std::pow(std_weight_position * height, 2);
-    Q.at<float>(1, 1) = std::pow(std_weight_position * height, 2);
-    Q.at<float>(2, 2) = 1e-2;
-    Q.at<float>(3, 3) = std::pow(std_weight_position * height, 2);
-    Q.at<float>(4, 4) = std::pow(std_weight_velocity * height, 2);
-    Q.at<float>(5, 5) = std::pow(std_weight_velocity * height, 2);
-    Q.at<float>(6, 6) = 1e-5;
-    Q.at<float>(7, 7) = std::pow(std_weight_velocity * height, 2);
-
-    // Update covariance
-    covariance_ = F * covariance_ * F.t() + Q;
+Track::Track(KalmanBank &kalman_bank, const cv::Rect_<float> &bbox, int track_id, int n_init, int max_age,
+             int nn_budget, const std::vector<float> &feature)
+    : kalman_bank_(kalman_bank), kalman_slot_(kalman_bank.add(bbox)), track_id_(track_id), hits_(1), age_(1),
+      time_since_update_(0), state_(TrackState::Tentative), n_init_(n_init), max_age_(max_age),
+      features_(std::max(nn_budget, 0)) {
+    add_feature(feature);
+}
+
+Track::~Track() {
+    kalman_bank_.remove(kalman_slot_);
 }
 
 /**
  * @brief Update track state with matched detection using Kalman filter correction step
  */
 void Track::update(const Detection &detection) {
-    predict();
-
-    // OpenCV-based implementation
-    // Measurement model (we observe x, y, aspect_ratio, height)
-    cv::Mat H = cv::Mat::zeros(4, 8, CV_32F);
-    H.at<float>(0, 0) = 1.0f; // observe x
-    H.at<float>(1, 1) = 1.0f; // observe y
-    H.at<float>(2, 2) = 1.0f; // observe aspect_ratio
-    H.at<float>(3, 3) = 1.0f; // observe height
-
-    // Measurement noise
-    cv::Mat R = cv::Mat::eye(4, 4, CV_32F);
-    float std_weight_position = 1.0f / 20.0f;
-    float height = detection.bbox.height;
-
-    R.at<float>(0, 0) = std::pow(std_weight_position * height, 2);
-    R.at<float>(1, 1) = std::pow(std_weight_position * height, 2);
-    R.at<float>(2, 2) = 1e-1;
-    R.at<float>(3, 3) = std::pow(std_weight_position * height, 2);
-
-    // Measurement vector
-    cv::Mat z = cv::Mat::zeros(4, 1, CV_32F);
-    z.at<float>(0) = detection.bbox.x + detection.bbox.width / 2.0f;
-    z.at<float>(1) = detection.bbox.y + detection.bbox.height / 2.0f;
-    z.at<float>(2) = detection.bbox.width / detection.bbox.height;
-    z.at<float>(3) = detection.bbox.height;
-
-    // Kalman update
-    cv::Mat S = H * covariance_ * H.t() + R;
-    cv::Mat K = covariance_ * H.t() * S.inv();
-    cv::Mat y = z - H * mean_;
-
-    mean_ = mean_ + K * y;
-    covariance_ = covariance_ - K * H * covariance_;
+    kalman_bank_.update(kalman_slot_, detection.bbox);
 
     add_feature(detection.feature);
 
@@ -154,24 +128,14 @@ void Track::mark_missed() {
  * @brief Convert Kalman filter state back to bounding box coordinates
  */
 cv::Rect_<float> Track::to_bbox() const {
-    // Original OpenCV-based implementation
-    float center_x = mean_.at<float>(0);
-    float center_y = mean_.at<float>(1);
-    float aspect_ratio = mean_.at<float>(2);
-    float height = mean_.at<float>(3);
-    float width = aspect_ratio * height;
-
-    return cv::Rect_<float>(center_x - width / 2.0f, center_y - height / 2.0f, width, height);
+    return kalman_bank_.bbox(kalman_slot_);
 }
 
 /**
  * @brief Add new feature vector to track's feature history (with budget limit)
  */
 void Track::add_feature(const std::vector<float> &feature) {
-    features_.push_back(feature);
-    if (features_.size() > static_cast<size_t>(nn_budget_)) {
-        features_.pop_front();
-    }
+    features_.add(feature);
 }
 
 // DeepSortTracker implementation
@@ -180,16 +144,27 @@ void Track::add_feature(const std::vector<float> &feature) {
  * @brief Initialize Deep SORT tracker with tracking parameters (features from gvainference)
  */
 DeepSortTracker::DeepSortTracker(float max_iou_distance, int max_age, int n_init, float max_cosine_distance,
-                                 int nn_budget, const std::string &dptrckcfg, dlstreamer::MemoryMapperPtr mapper)
-    : next_id_(1), max_iou_distance_(max_iou_distance), max_age_(max_age), n_init_(n_init),
+                                 int nn_budget, const std::string &dptrckcfg, dlstreamer::MemoryMapperPtr mapper,
+                                 std::shared_ptr<DeepSortTrackerService> service)
+    : service_(std::move(service)),
+      kalman_bank_(service_ ? service_->kalman_bank() : std::make_shared<KalmanBank>()), next_id_(1),
+      max_iou_distance_(max_iou_distance), max_age_(max_age), n_init_(n_init),
       max_cosine_distance_(max_cosine_distance), nn_budget_(nn_budget), dptrckcfg_(dptrckcfg),
       buffer_mapper_(std::move(mapper)) {
 
     parse_dps_trck_config();
+    if (service_)
+        service_->attach(*this);
     GST_INFO_OBJECT(this,
-                    "DeepSortTracker initialized with OpenCV KALMAN FILTER (features from gvainference): "
+                    "DeepSortTracker initialized with %s KALMAN FILTER BANK (features from gvainference): "
                     "max_iou_distance=%.3f, max_age=%d, n_init=%d, max_cosine_distance=%.3f, nn_budget=%d\n",
-                    max_iou_distance_, max_age_, n_init_, max_cosine_distance_, nn_budget_);
+                    service_ ? "SHARED" : "OWN", max_iou_distance_, max_age_, n_init_, max_cosine_distance_,
+                    nn_budget_);
+}
+
+DeepSortTracker::~DeepSortTracker() {
+    if (service_)
+        service_->detach(*this);
 }
 
 /**
@@ -200,26 +175,64 @@ void DeepSortTracker::track(dlstreamer::FramePtr buffer, GVA::VideoFrame &frame_
         throw std::invalid_argument("DeepSortTracker: buffer is nullptr");
     }
 
-    auto regions = frame_meta.regions();
+    regions_ = frame_meta.regions();
 
     // Convert GVA regions to detections (using FeatureExtractor or pre-extracted features)
-    std::vector<Detection> detections = convert_detections(regions);
+    detections_ = convert_detections(regions_);
+
+    track_detections();
+
+    regions_.clear();
+    detections_.clear();
+}
 
-    // Predict existing tracks
+void DeepSortTracker::track_detections() {
+    if (service_) {
+        service_->track(*this);
+        return;
+    }
+    match_tracks();
+    update_tracks();
+}
+
+void DeepSortTracker::stream_stopped() {
+    if (service_)
+        service_->deactivate(*this);
+}
+
+void DeepSortTracker::schedule_predictions() {
+    for (auto &track : tracks_) {
+        track->schedule_prediction();
+    }
+}
+
+/**
+ * @brief Associate detections to tracks, update matched tracks and assign object IDs to regions
+ */
+void DeepSortTracker::match_tracks() {
     for (auto &track : tracks_) {
         track->mark_missed();
     }
 
     // Associate detections to tracks
     std::vector<std::pair<int, int>> matches;
-    std::vector<int> unmatched_dets, unmatched_trks;
-    associate_detections_to_tracks(detections, matches, unmatched_dets, unmatched_trks);
+    std::vector<int> unmatched_trks;
+    associate_detections_to_tracks(detections_, matches, unmatched_dets_, unmatched_trks);
+
+    // Own tracker keeps the order of the original wrapper: tracks are associated by their last corrected boxes and
+    // only matched tracks are predicted, right before correction. Tracks of the service are predicted for the whole
+    // batch before association, as in reference Deep SORT, see DeepSortTrackerService::track().
+    if (!service_) {
+        for (const auto &match : matches)
+            tracks_[match.second]->schedule_prediction();
+        kalman_bank_->predict();
+    }
 
     //  Update matched tracks and assign object IDs to existing regions
     for (const auto &match : matches) {
-        tracks_[match.second]->update(detections[match.first]);
+        tracks_[match.second]->update(detections_[match.first]);
 
-        auto &detection = detections[match.first];
+        auto &detection = detections_[match.first];
         auto &track = tracks_[match.second];
         cv::Rect_<float> track_bbox = track->to_bbox();
         GST_DEBUG("{%s} Updating matched tracks: det-bbox[%d][%.1f,%.1f,%.1fx%.1f], trk-bbox[%d][%.1f,%.1f,%.1fx%.1f], "
@@ -230,20 +243,24 @@ void DeepSortTracker::track(dlstreamer::FramePtr buffer, GVA::VideoFrame &frame_
 
         // Assign tracking ID to the existing region only if track is confirmed
         // This follows Deep SORT convention where only confirmed tracks get persistent IDs
-        if (match.first < static_cast<int>(regions.size()) && tracks_[match.second]->is_confirmed()) {
-            regions[match.first].set_object_id(tracks_[match.second]->track_id());
+        if (match.first < static_cast<int>(regions_.size()) && tracks_[match.second]->is_confirmed()) {
+            regions_[match.first].set_object_id(tracks_[match.second]->track_id());
         }
     }
+}
 
-    // Create new tracks for unmatched detections
-    for (int det_idx : unmatched_dets) {
-        auto new_track = std::make_unique<Track>(detections[det_idx].bbox, next_id_++, n_init_, max_age_,
-                                                 detections[det_idx].feature);
+/**
+ * @brief Create tracks of unmatched detections and remove deleted tracks, slots of Kalman bank are taken and freed
+ */
+void DeepSortTracker::update_tracks() {
+    for (int det_idx : unmatched_dets_) {
+        auto new_track = std::make_unique<Track>(*kalman_bank_, detections_[det_idx].bbox, next_id_++, n_init_,
+                                                 max_age_, nn_budget_, detections_[det_idx].feature);
         int new_track_id = new_track->track_id();
         std::string track_state = new_track->state_str();
         GST_DEBUG("{%s} New track created: ID=%d, bbox[%.1f, %.1f, %.1f x %.1f], state=%s", __FUNCTION__, new_track_id,
-                  detections[det_idx].bbox.x, detections[det_idx].bbox.y, detections[det_idx].bbox.width,
-                  detections[det_idx].bbox.height, track_state.c_str());
+                  detections_[det_idx].bbox.x, detections_[det_idx].bbox.y, detections_[det_idx].bbox.width,
+                  detections_[det_idx].bbox.height, track_state.c_str());
         tracks_.push_back(std::move(new_track));
     }
 
@@ -287,7 +304,7 @@ std::vector<Detection> DeepSortTracker::convert_detections(const std::vector<GVA
                 // Extract feature data from tensor
                 feature_vector = tensor.data<float>();
 
-                if (!feature_vector.empty() && feature_vector.size() == DEFAULT_FEATURES_VECTOR_SIZE_128) {
+                if (!feature_vector.empty()) {
                     // L2 normalize the feature vector (standard for Deep SORT)
                     float norm = std::sqrt(
                         std::inner_product(feature_vector.begin(), feature_vector.end(), feature_vector.begin(), 0.0f));
@@ -302,11 +319,10 @@ std::vector<Detection> DeepSortTracker::convert_detections(const std::vector<GVA
             }
         }
 
-        // If no feature found, use zero vector (will disable appearance-based matching)
+        // If no feature found, use empty feature (will disable appearance-based matching)
         if (!found_feature) {
-            GST_WARNING("No feature tensor found for region %zu, using zero feature (motion-only tracking)", i);
-            feature_vector =
-                std::vector<float>(DEFAULT_FEATURES_VECTOR_SIZE_128, 0.0f); // Default 128-dimensional zero vector
+            GST_WARNING("No feature tensor found for region %zu, using empty feature (motion-only tracking)", i);
+            feature_vector.clear();
         }
 
         GST_DEBUG("{%s} Detection %zu (gvainference): bbox[%d,%d,%d,%d], confidence=%.3f, feature_size=%zu",
@@ -320,30 +336,27 @@ std::vector<Detection> DeepSortTracker::convert_detections(const std::vector<GVA
 }
 
 /**
- * @brief Associate current detections with existing tracks using IoU and feature distance
+ * @brief Build detections x tracks cost matrix, pairs which can not be matched are forbidden
  */
-void DeepSortTracker::associate_detections_to_tracks(const std::vector<Detection> &detections,
-                                                     std::vector<std::pair<int, int>> &matches,
-                                                     std::vector<int> &unmatched_dets,
-                                                     std::vector<int> &unmatched_trks) {
-    matches.clear();
-    unmatched_dets.clear();
-    unmatched_trks.clear();
-
-    if (tracks_.empty()) {
-        for (size_t i = 0; i < detections.size(); ++i) {
-            unmatched_dets.push_back(i);
-        }
-        return;
-    }
-
-    // Build cost matrix combining IoU and cosine distance
-    std::vector<std::vector<float>> cost_matrix(detections.size(), std::vector<float>(tracks_.size(), 1.0f));
-
-    for (size_t det_idx = 0; det_idx < detections.size(); ++det_idx) {
-        for (size_t trk_idx = 0; trk_idx < tracks_.size(); ++trk_idx) {
-
-            cv::Rect_<float> track_bbox = tracks_[trk_idx]->to_bbox();
+cv::Mat_<float> DeepSortTracker::build_cost_matrix(const std::vector<Detection> &detections) {
+    cv::Mat_<float> cost_matrix(detections.size(), tracks_.size(), LinearAssignmentSolver::FORBIDDEN);
+
+    // Detections passing IoU gate of the track, appearance is compared only for them
+    std::vector<int> gated_dets;
+    std::vector<float> gated_ious;
+    std::vector<float> gated_similarities;
+    std::vector<size_t> comparable; // positions in gated_dets of detections with features of gallery size
+    std::vector<const float *> comparable_features;
+    std::vector<float> comparable_similarities;
+    for (size_t trk_idx = 0; trk_idx < tracks_.size(); ++trk_idx) {
+        cv::Rect_<float> track_bbox = tracks_[trk_idx]->to_bbox();
+        const FeatureGallery &gallery = tracks_[trk_idx]->features();
+
+        gated_dets.clear();
+        gated_ious.clear();
+        comparable.clear();
+        comparable_features.clear();
+        for (size_t det_idx = 0; det_idx < detections.size(); ++det_idx) {
             float iou = calculate_iou(detections[det_idx].bbox, track_bbox);
 
             GST_DEBUG("{%s} Detection vs Track : det_bbox[%zu][%.1f, %.1f, %.1f, %.1f] vs track_bbox[%zu][%.1f, "
@@ -354,41 +367,74 @@ void DeepSortTracker::associate_detections_to_tracks(const std::vector<Detection
                       track_bbox.y, track_bbox.width, track_bbox.height, iou);
 
             // Reject matches with IoU below threshold (poor overlap)
-            if (iou < max_iou_distance_) {
-                cost_matrix[det_idx][trk_idx] = 1.0f; // No match
+            if (iou < max_iou_distance_)
                 continue;
-            }
-
-            // Calculate minimum cosine distance to track features
-            float min_cosine_dist = 1.0f;
-            const auto &track_features = tracks_[trk_idx]->features();
 
-            for (const auto &track_feature : track_features) {
-                float cosine_dist = calculate_cosine_distance(detections[det_idx].feature, track_feature);
-                min_cosine_dist = std::min(min_cosine_dist, cosine_dist);
+            const std::vector<float> &feature = detections[det_idx].feature;
+            if (gallery.size() > 0 && feature.size() == gallery.dim()) {
+                comparable.push_back(gated_dets.size());
+                comparable_features.push_back(feature.data());
             }
+            gated_dets.push_back(det_idx);
+            gated_ious.push_back(iou);
+        }
 
-            if (min_cosine_dist > max_cosine_distance_) {
-                cost_matrix[det_idx][trk_idx] = 1.0f; // No match
-            } else {
-                // Combine IoU and cosine distance
-                cost_matrix[det_idx][trk_idx] = 0.5f * (1.0f - iou) + 0.5f * min_cosine_dist;
-            }
+        // Features without counterpart in the gallery are not similar to the track
+        gated_similarities.assign(gated_dets.size(), 0.0f);
+        comparable_similarities.resize(comparable.size());
+        max_similarities(comparable_features.data(), comparable_features.size(), gallery.data(), gallery.size(),
+                         gallery.dim(), comparable_similarities.data());
+        for (size_t i = 0; i < comparable.size(); ++i)
+            gated_similarities[comparable[i]] = comparable_similarities[i];
+
+        for (size_t i = 0; i < gated_dets.size(); ++i) {
+            // Minimum cosine distance to track features
+            float min_cosine_dist = 1.0f - gated_similarities[i];
+            if (min_cosine_dist > max_cosine_distance_)
+                continue; // No match
+
+            // Combine IoU and cosine distance
+            float cost = 0.5f * (1.0f - gated_ious[i]) + 0.5f * min_cosine_dist;
+            if (cost < MAX_ASSIGNMENT_COST)
+                cost_matrix(gated_dets[i], trk_idx) = cost;
         }
     }
 
-    // Use Hungarian only when confident about assignments
-#if 0    
-    if (max_iou > threshold && feature_confidence > threshold) {
-        hungarian_assignment(cost_matrix, matches);
-    } else {
-        // Hungarian assignment (using greedy version for better ID consistency)
-        hungarian_assignment_greedy(cost_matrix, matches);
+    return cost_matrix;
+}
+
+/**
+ * @brief Associate current detections with existing tracks using IoU and feature distance
+ */
+void DeepSortTracker::associate_detections_to_tracks(const std::vector<Detection> &detections,
+                                                     std::vector<std::pair<int, int>> &matches,
+                                                     std::vector<int> &unmatched_dets,
+                                                     std::vector<int> &unmatched_trks) {
+    matches.clear();
+    unmatched_dets.clear();
+    unmatched_trks.clear();
+
+    if (tracks_.empty()) {
+        for (size_t i = 0; i < detections.size(); ++i) {
+            unmatched_dets.push_back(i);
+        }
+        return;
     }
-#endif
 
-    // Hungarian assignment (using greedy version for better ID consistency)
-    hungarian_assignment_greedy(cost_matrix, matches);
+    const cv::Mat_<float> cost_matrix = build_cost_matrix(detections);
+
+    // Optimal assignment (Jonker-Volgenant), warm started with track prices from previous frame
+    track_prices_.resize(tracks_.size());
+    for (size_t trk_idx = 0; trk_idx < tracks_.size(); ++trk_idx)
+        track_prices_[trk_idx] = tracks_[trk_idx]->association_price();
+    const std::vector<int> &assignment = assignment_solver_.solve(
+        cost_matrix.ptr<float>(), detections.size(), tracks_.size(), MAX_ASSIGNMENT_COST, track_prices_.data());
+    for (size_t trk_idx = 0; trk_idx < tracks_.size(); ++trk_idx)
+        tracks_[trk_idx]->set_association_price(track_prices_[trk_idx]);
+    for (size_t det_idx = 0; det_idx < assignment.size(); ++det_idx) {
+        if (assignment[det_idx] >= 0)
+            matches.emplace_back(det_idx, assignment[det_idx]);
+    }
 
     // Find unmatched detections and tracks
     std::vector<bool> matched_dets(detections.size(), false);
@@ -412,18 +458,6 @@ void DeepSortTracker::associate_detections_to_tracks(const std::vector<Detection
     }
 }
 
-/**
- * @brief Calculate cosine distance between two feature vectors (0=identical, 1=opposite)
- */
-float DeepSortTracker::calculate_cosine_distance(const std::vector<float> &feat1, const std::vector<float> &feat2) {
-    if (feat1.size() != feat2.size()) {
-        return 1.0f; // Maximum distance for mismatched features
-    }
-
-    float dot_product = std::inner_product(feat1.begin(), feat1.end(), feat2.begin(), 0.0f);
-    return 1.0f - dot_product; // Convert cosine similarity to distance
-}
-
 /**
  * @brief Calculate Intersection over Union (IoU) between two bounding boxes (0=no overlap, 1=perfect match)
  */
@@ -444,255 +478,6 @@ float DeepSortTracker::calculate_iou(const cv::Rect_<float> &bbox1, const cv::Re
     return iou;
 }
 
-/**
- * @brief Full Hungarian algorithm implementation for optimal assignment problem
- * @details Kuhn-Munkres algorithm that finds minimum cost perfect matching
- */
-void DeepSortTracker::hungarian_assignment(const std::vector<std::vector<float>> &cost_matrix,
-                                           std::vector<std::pair<int, int>> &assignments) {
-    assignments.clear();
-
-    if (cost_matrix.empty())
-        return;
-
-    size_t rows = cost_matrix.size();
-    size_t cols = cost_matrix[0].size();
-
-    // Create working matrix (copy of cost matrix)
-    std::vector<std::vector<float>> matrix(rows, std::vector<float>(cols));
-    for (size_t i = 0; i < rows; ++i) {
-        for (size_t j = 0; j < cols; ++j) {
-            matrix[i][j] = cost_matrix[i][j];
-        }
-    }
-
-    // Step 1: Subtract row minimums
-    for (size_t i = 0; i < rows; ++i) {
-        float row_min = *std::min_element(matrix[i].begin(), matrix[i].end());
-        for (size_t j = 0; j < cols; ++j) {
-            matrix[i][j] -= row_min;
-        }
-    }
-
-    // Step 2: Subtract column minimums
-    for (size_t j = 0; j < cols; ++j) {
-        float col_min = matrix[0][j];
-        for (size_t i = 1; i < rows; ++i) {
-            col_min = std::min(col_min, matrix[i][j]);
-        }
-        for (size_t i = 0; i < rows; ++i) {
-            matrix[i][j] -= col_min;
-        }
-    }
-
-    // Track assignments and coverage
-    std::vector<std::vector<int>> marks(rows, std::vector<int>(cols, 0)); // 0=none, 1=star, 2=prime
-    std::vector<bool> row_covered(rows, false);
-    std::vector<bool> col_covered(cols, false);
-
-    // Step 3: Cover all zeros with minimum number of lines
-    // First, find a zero and star it if no other star in same row/column
-    for (size_t i = 0; i < rows; ++i) {
-        for (size_t j = 0; j < cols; ++j) {
-            if (matrix[i][j] == 0.0f && !row_covered[i] && !col_covered[j]) {
-                marks[i][j] = 1; // Star this zero
-                row_covered[i] = true;
-                col_covered[j] = true;
-            }
-        }
-    }
-
-    // Reset coverage for next steps
-    std::fill(row_covered.begin(), row_covered.end(), false);
-    std::fill(col_covered.begin(), col_covered.end(), false);
-
-    // Cover all columns with starred zeros
-    for (size_t i = 0; i < rows; ++i) {
-        for (size_t j = 0; j < cols; ++j) {
-            if (marks[i][j] == 1) {
-                col_covered[j] = true;
-            }
-        }
-    }
-
-    // Main Hungarian algorithm loop
-    bool done = false;
-    while (!done) {
-        // Check if we have enough lines to cover all zeros
-        size_t covered_cols = 0;
-        for (size_t j = 0; j < cols; ++j) {
-            if (col_covered[j])
-                covered_cols++;
-        }
-
-        if (covered_cols >= std::min(rows, cols)) {
-            done = true;
-        } else {
-            // Find an uncovered zero and prime it
-            bool found_uncovered_zero = false;
-            size_t zero_row = 0, zero_col = 0;
-
-            for (size_t i = 0; i < rows && !found_uncovered_zero; ++i) {
-                for (size_t j = 0; j < cols && !found_uncovered_zero; ++j) {
-                    if (matrix[i][j] == 0.0f && !row_covered[i] && !col_covered[j]) {
-                        zero_row = i;
-                        zero_col = j;
-                        found_uncovered_zero = true;
-                        marks[i][j] = 2; // Prime this zero
-                    }
-                }
-            }
-
-            if (found_uncovered_zero) {
-                // Check if there's a starred zero in the same row
-                bool star_in_row = false;
-                size_t star_col = 0;
-                for (size_t j = 0; j < cols; ++j) {
-                    if (marks[zero_row][j] == 1) {
-                        star_in_row = true;
-                        star_col = j;
-                        break;
-                    }
-                }
-
-                if (star_in_row) {
-                    // Cover this row and uncover the starred column
-                    row_covered[zero_row] = true;
-                    col_covered[star_col] = false;
-                } else {
-                    // Construct alternating path and adjust stars
-                    std::vector<std::pair<size_t, size_t>> path;
-                    path.push_back({zero_row, zero_col});
-
-                    bool path_done = false;
-                    while (!path_done) {
-                        // Find starred zero in primed zero's column
-                        bool found_star = false;
-                        size_t star_row = 0;
-                        for (size_t i = 0; i < rows; ++i) {
-                            if (marks[i][path.back().second] == 1) {
-                                star_row = i;
-                                found_star = true;
-                                break;
-                            }
-                        }
-
-                        if (found_star) {
-                            path.push_back({star_row, path.back().second});
-
-                            // Find primed zero in starred zero's row
-                            for (size_t j = 0; j < cols; ++j) {
-                                if (marks[star_row][j] == 2) {
-                                    path.push_back({star_row, j});
-                                    break;
-                                }
-                            }
-                        } else {
-                            path_done = true;
-                        }
-                    }
-
-                    // Unstar each starred zero and star each primed zero in path
-                    for (size_t p = 0; p < path.size(); ++p) {
-                        if (p % 2 == 0) {
-                            marks[path[p].first][path[p].second] = 1; // Star
-                        } else {
-                            marks[path[p].first][path[p].second] = 0; // Unstar
-                        }
-                    }
-
-                    // Clear all primes and reset coverage
-                    for (size_t i = 0; i < rows; ++i) {
-                        for (size_t j = 0; j < cols; ++j) {
-                            if (marks[i][j] == 2)
-                                marks[i][j] = 0;
-                        }
-                    }
-                    std::fill(row_covered.begin(), row_covered.end(), false);
-                    std::fill(col_covered.begin(), col_covered.end(), false);
-
-                    // Cover columns with starred zeros
-                    for (size_t i = 0; i < rows; ++i) {
-                        for (size_t j = 0; j < cols; ++j) {
-                            if (marks[i][j] == 1) {
-                                col_covered[j] = true;
-                            }
-                        }
-                    }
-                }
-            } else {
-                // No uncovered zeros - add minimum uncovered value
-                float min_uncovered = std::numeric_limits<float>::max();
-                for (size_t i = 0; i < rows; ++i) {
-                    for (size_t j = 0; j < cols; ++j) {
-                        if (!row_covered[i] && !col_covered[j]) {
-                            min_uncovered = std::min(min_uncovered, matrix[i][j]);
-                        }
-                    }
-                }
-
-                // Subtract from uncovered, add to doubly covered
-                for (size_t i = 0; i < rows; ++i) {
-                    for (size_t j = 0; j < cols; ++j) {
-                        if (row_covered[i] && col_covered[j]) {
-                            matrix[i][j] += min_uncovered;
-                        } else if (!row_covered[i] && !col_covered[j]) {
-                            matrix[i][j] -= min_uncovered;
-                        }
-                    }
-                }
-            }
-        }
-    }
-
-    // Extract final assignments from starred positions
-    for (size_t i = 0; i < rows; ++i) {
-        for (size_t j = 0; j < cols; ++j) {
-            if (marks[i][j] == 1) {
-                // Apply cost threshold check like the greedy version
-                if (cost_matrix[i][j] < 0.5f) {
-                    assignments.emplace_back(i, j);
-                }
-            }
-        }
-    }
-}
-
-/**
- * @brief Simple greedy assignment algorithm
- */
-void DeepSortTracker::hungarian_assignment_greedy(const std::vector<std::vector<float>> &cost_matrix,
-                                                  std::vector<std::pair<int, int>> &assignments) {
-    assignments.clear();
-
-    std::vector<bool> det_assigned(cost_matrix.size(), false);
-    std::vector<bool> trk_assigned(cost_matrix.empty() ? 0 : cost_matrix[0].size(), false);
-
-    for (size_t det_idx = 0; det_idx < cost_matrix.size(); ++det_idx) {
-        if (det_assigned[det_idx])
-            continue;
-
-        float min_cost = 1.0f;
-        int best_trk = -1;
-
-        for (size_t trk_idx = 0; trk_idx < cost_matrix[det_idx].size(); ++trk_idx) {
-            if (trk_assigned[trk_idx])
-                continue;
-
-            if (cost_matrix[det_idx][trk_idx] < min_cost) {
-                min_cost = cost_matrix[det_idx][trk_idx];
-                best_trk = trk_idx;
-            }
-        }
-
-        if (best_trk >= 0 && min_cost < 0.5f) { // Threshold for assignment
-            assignments.emplace_back(det_idx, best_trk);
-            det_assigned[det_idx] = true;
-            trk_assigned[best_trk] = true;
-        }
-    }
-}
-
 /**
  * @brief Parse Deep SORT tracking configuration from key/value string
  */
@@ -726,6 +511,14 @@ void DeepSortTracker::parse_dps_trck_config() {
             nn_budget_ = std::stoi(iter->second);
             cfg.erase(iter);
         }
+        iter = cfg.find("batch_timeout");
+        if (iter != cfg.end()) {
+            const int batch_timeout = std::stoi(iter->second);
+            if (batch_timeout < 0)
+                throw std::out_of_range("negative batch timeout");
+            batch_timeout_ = std::chrono::milliseconds(batch_timeout);
+            cfg.erase(iter);
+        }
     } catch (...) {
         if (iter == cfg.end())
             std::throw_with_nested(
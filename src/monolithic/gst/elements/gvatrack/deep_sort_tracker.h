@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include "deep_sort_kalman.h"
 #include "itracker.h"
+#include "linear_assignment.h"
 #include <dlstreamer/base/memory_mapper.h>
 #include <dlstreamer/context.h>
 #include <gva_utils.h>
@@ -14,8 +16,12 @@
 #include <opencv2/opencv.hpp>
 #include <openvino/openvino.hpp>
 
-#include <deque>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -27,7 +33,8 @@ constexpr int DEFAULT_MAX_AGE = 30;                 // Maximum number of missed
 constexpr int DEFAULT_N_INIT = 3;                   // Number of consecutive hits required to confirm a track
 constexpr float DEFAULT_MAX_COSINE_DISTANCE = 0.2f; // Maximum cosine distance for appearance matching.
 constexpr int DEFAULT_NN_BUDGET = 100;
-constexpr int DEFAULT_FEATURES_VECTOR_SIZE_128 = 128;
+constexpr int DEFAULT_BATCH_TIMEOUT = 10; // Milliseconds a frame waits for other streams of tracker service
+constexpr float MAX_ASSIGNMENT_COST = 0.5f; // Detection and track of higher association cost are not matched
 
 // Track states
 enum class TrackState { Tentative = 1, Confirmed = 2, Deleted = 3 };
@@ -44,11 +51,47 @@ struct Detection {
     }
 };
 
-// Track structure for Deep SORT
+// Last nn_budget L2-normalized features of a track, stored as rows of one contiguous matrix used as a ring buffer
+class FeatureGallery {
+  public:
+    explicit FeatureGallery(size_t budget) : budget_(budget) {
+    }
+
+    // Empty features are skipped, feature of other size than stored ones restarts the gallery
+    void add(const std::vector<float> &feature);
+
+    size_t size() const {
+        return size_;
+    }
+    size_t dim() const {
+        return dim_;
+    }
+    const float *data() const {
+        return data_.data();
+    }
+
+  private:
+    size_t budget_;
+    size_t dim_ = 0;
+    size_t size_ = 0;
+    size_t next_row_ = 0;
+    std::vector<float> data_;
+};
+
+// Track structure for Deep SORT, its Kalman filter is kept in a slot of the bank
 class Track {
   public:
-    Track(const cv::Rect_<float> &bbox, int track_id, int n_init, int max_age, const std::vector<float> &feature);
+    Track(KalmanBank &kalman_bank, const cv::Rect_<float> &bbox, int track_id, int n_init, int max_age,
+          int nn_budget, const std::vector<float> &feature);
+    ~Track();
 
+    Track(const Track &) = delete;
+    Track &operator=(const Track &) = delete;
+
+    // Marks Kalman filter of the track to be advanced by next KalmanBank::predict()
+    void schedule_prediction() {
+        kalman_bank_.schedule(kalman_slot_);
+    }
     void update(const Detection &detection);
     void mark_missed();
     bool is_tentative() const {
@@ -71,10 +114,18 @@ class Track {
 
     // Feature management
     void add_feature(const std::vector<float> &feature);
-    const std::deque<std::vector<float>> &features() const {
+    const FeatureGallery &features() const {
         return features_;
     }
 
+    // Price of the track in last association, used as warm start of the next one
+    float association_price() const {
+        return association_price_;
+    }
+    void set_association_price(float price) {
+        association_price_ = price;
+    }
+
     std::string state_str() const {
         switch (state_) {
         case TrackState::Tentative:
@@ -89,9 +140,8 @@ class Track {
     }
 
   private:
-    // Kalman filter state - OpenCV implementation
-    cv::Mat mean_;
-    cv::Mat covariance_;
+    KalmanBank &kalman_bank_;
+    size_t kalman_slot_;
 
     int track_id_;
     int hits_;
@@ -102,13 +152,66 @@ class Track {
     // Parameters
     int n_init_;
     int max_age_;
-    int nn_budget_;
 
     // Feature storage for cosine distance calculation
-    std::deque<std::vector<float>> features_;
+    FeatureGallery features_;
 
-    void initiate(const cv::Rect_<float> &bbox);
-    void predict();
+    float association_price_ = 0.0f;
+};
+
+class DeepSortTracker;
+
+/**
+ * Tracker service shared by gvatrack elements with the same tracker-instance-id.
+ *
+ * Frames of attached streams are tracked in batches: Kalman filters of tracks of all streams in a batch are predicted
+ * in one pass over the shared bank, then association of each stream runs in parallel on streaming thread of its
+ * element. Tracks are created and removed after association of all streams in the batch is finished, as it changes
+ * the bank. Batch starts when each active stream submitted its frame or batch timeout of the first one passed.
+ *
+ * A stream is active from its first frame until EOS or flush. Streams which missed a batch by timeout are not waited
+ * for until their next frame, and streams running on a thread of a waiting frame (e.g. tee branches without queues)
+ * are never waited for, as they cannot submit a frame before the waiting one is tracked.
+ */
+class DeepSortTrackerService {
+  public:
+    // Returns service of the instance id, it is created on first request and destroyed with its last tracker
+    static std::shared_ptr<DeepSortTrackerService> get(const std::string &instance_id);
+
+    const std::shared_ptr<KalmanBank> &kalman_bank() const {
+        return kalman_bank_;
+    }
+
+    void attach(DeepSortTracker &tracker);
+    // Removes tracks of the tracker once running batch is finished
+    void detach(DeepSortTracker &tracker);
+    // Batches don't wait for the tracker until its next frame
+    void deactivate(DeepSortTracker &tracker);
+    // Tracks frame converted to detections by the tracker together with frames of other active streams
+    void track(DeepSortTracker &tracker);
+
+  private:
+    std::shared_ptr<KalmanBank> kalman_bank_ = std::make_shared<KalmanBank>();
+
+    struct Stream {
+        bool active = false;
+        std::thread::id thread; // thread of the last frame
+    };
+
+    // Whether no active stream is expected to join the collected batch
+    bool batch_complete() const;
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::unordered_map<DeepSortTracker *, Stream> streams_;
+
+    std::vector<DeepSortTracker *> collecting_; // streams waiting for the next batch
+    uint64_t batch_id_ = 0;
+    std::vector<DeepSortTracker *> batch_;
+    bool running_ = false;
+    bool predicted_ = false;
+    size_t matched_ = 0;  // streams of running batch which finished association
+    size_t finished_ = 0; // streams of running batch which finished tracking
 };
 
 // Deep SORT feature extractor using OpenVINO
@@ -136,13 +239,23 @@ class DeepSortTracker : public ITracker {
     DeepSortTracker(float max_iou_distance = DEFAULT_MAX_IOU_DISTANCE, int max_age = DEFAULT_MAX_AGE,
                     int n_init = DEFAULT_N_INIT, float max_cosine_distance = DEFAULT_MAX_COSINE_DISTANCE,
                     int nn_budget = DEFAULT_NN_BUDGET, const std::string &dptrckcfg = "",
-                    dlstreamer::MemoryMapperPtr mapper = nullptr);
+                    dlstreamer::MemoryMapperPtr mapper = nullptr,
+                    std::shared_ptr<DeepSortTrackerService> service = nullptr);
 
-    ~DeepSortTracker() override = default;
+    ~DeepSortTracker() override;
 
     void track(dlstreamer::FramePtr buffer, GVA::VideoFrame &frame_meta) override;
+    void stream_stopped() override;
 
   private:
+    friend class DeepSortTrackerService;
+    // Tracks detections without a frame
+    friend class DeepSortTrackerTest;
+
+    // Tracks of the service share its Kalman bank, otherwise the tracker owns one
+    std::shared_ptr<DeepSortTrackerService> service_;
+    std::shared_ptr<KalmanBank> kalman_bank_;
+
     // Deep SORT algorithm components
     std::vector<std::unique_ptr<Track>> tracks_;
     int next_id_;
@@ -153,25 +266,37 @@ class DeepSortTracker : public ITracker {
     int n_init_;
     float max_cosine_distance_;
     int nn_budget_;
+    std::chrono::milliseconds batch_timeout_{DEFAULT_BATCH_TIMEOUT};
     std::string dptrckcfg_;
 
     // Memory mapper for buffer access
     dlstreamer::MemoryMapperPtr buffer_mapper_;
 
+    // Optimal detections to tracks assignment
+    LinearAssignmentSolver assignment_solver_;
+    std::vector<float> track_prices_;
+
+    // Frame being tracked
+    std::vector<GVA::RegionOfInterest> regions_;
+    std::vector<Detection> detections_;
+    std::vector<int> unmatched_dets_;
+
+    // Tracks detections_ of the frame by the service or by own tracks
+    void track_detections();
+    // Tracking steps of a frame. The service schedules tracks of its batch and predicts them before match_tracks(),
+    // own tracks are predicted by match_tracks() once matched.
+    void schedule_predictions();
+    void match_tracks();
+    void update_tracks();
+
     // Helper methods
     std::vector<Detection> convert_detections(const std::vector<GVA::RegionOfInterest> &regions);
+    cv::Mat_<float> build_cost_matrix(const std::vector<Detection> &detections);
     void associate_detections_to_tracks(const std::vector<Detection> &detections,
                                         std::vector<std::pair<int, int>> &matches, std::vector<int> &unmatched_dets,
                                         std::vector<int> &unmatched_trks);
-    float calculate_cosine_distance(const std::vector<float> &feat1, const std::vector<float> &feat2);
     float calculate_iou(const cv::Rect_<float> &bbox1, const cv::Rect_<float> &bbox2);
 
-    // Hungarian algorithm for assignment
-    void hungarian_assignment(const std::vector<std::vector<float>> &cost_matrix,
-                              std::vector<std::pair<int, int>> &assignments);
-    void hungarian_assignment_greedy(const std::vector<std::vector<float>> &cost_matrix,
-                                     std::vector<std::pair<int, int>> &assignments);
-
     void parse_dps_trck_config();
 };
 
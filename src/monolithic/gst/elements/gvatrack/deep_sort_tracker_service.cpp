@@ -0,0 +1,145 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "deep_sort_tracker.h"
+
+#include <algorithm>
+#include <exception>
+#include <map>
+
+namespace DeepSortWrapper {
+
+std::shared_ptr<DeepSortTrackerService> DeepSortTrackerService::get(const std::string &instance_id) {
+    static std::mutex registry_mutex;
+    static std::map<std::string, std::weak_ptr<DeepSortTrackerService>> registry;
+
+    std::lock_guard<std::mutex> guard(registry_mutex);
+    auto &entry = registry[instance_id];
+    auto service = entry.lock();
+    if (!service) {
+        service = std::make_shared<DeepSortTrackerService>();
+        entry = service;
+    }
+    return service;
+}
+
+void DeepSortTrackerService::attach(DeepSortTracker &tracker) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    streams_.emplace(&tracker, Stream());
+}
+
+void DeepSortTrackerService::detach(DeepSortTracker &tracker) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [this] { return !running_; });
+    tracker.tracks_.clear();
+    streams_.erase(&tracker);
+    // Streams waiting for the next batch may be the only active ones now
+    condition_.notify_all();
+}
+
+void DeepSortTrackerService::deactivate(DeepSortTracker &tracker) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = streams_.find(&tracker);
+    if (it == streams_.end())
+        return;
+    it->second.active = false;
+    condition_.notify_all();
+}
+
+bool DeepSortTrackerService::batch_complete() const {
+    for (const auto &stream : streams_) {
+        if (!stream.second.active)
+            continue;
+        bool waiting = false;
+        for (DeepSortTracker *member : collecting_) {
+            // stream on the thread of a waiting frame can't submit its frame until the waiting one is tracked
+            if (member == stream.first || streams_.at(member).thread == stream.second.thread) {
+                waiting = true;
+                break;
+            }
+        }
+        if (!waiting)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Joins frame of the tracker to the next batch and tracks it with other frames of the batch
+ * @details Stream completing the batch (or the first one whose wait timed out) leads it and predicts Kalman filters
+ * of tracks of all streams in the batch. Frames arriving while a batch is running wait for the next one. Active
+ * streams missing in a batch led by timeout are not waited for until their next frame.
+ */
+void DeepSortTrackerService::track(DeepSortTracker &tracker) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [this] { return !running_; });
+
+    Stream &stream = streams_[&tracker];
+    stream.active = true;
+    stream.thread = std::this_thread::get_id();
+    collecting_.push_back(&tracker);
+    const uint64_t batch_id = batch_id_;
+    condition_.wait_for(lock, tracker.batch_timeout_, [&] { return batch_id_ != batch_id || batch_complete(); });
+
+    if (batch_id_ == batch_id) {
+        for (auto &other : streams_) {
+            if (std::find(collecting_.begin(), collecting_.end(), other.first) == collecting_.end())
+                other.second.active = false; // not waited for until its next frame
+        }
+
+        ++batch_id_;
+        batch_.swap(collecting_);
+        collecting_.clear();
+        running_ = true;
+        matched_ = 0;
+        finished_ = 0;
+
+        for (DeepSortTracker *member : batch_)
+            member->schedule_predictions();
+        kalman_bank_->predict();
+
+        predicted_ = true;
+        condition_.notify_all();
+    } else {
+        condition_.wait(lock, [this] { return predicted_; });
+    }
+
+    // Streams update only Kalman filters of their own tracks, so association runs in parallel
+    lock.unlock();
+    std::exception_ptr error;
+    try {
+        tracker.match_tracks();
+    } catch (...) {
+        error = std::current_exception();
+    }
+    lock.lock();
+
+    if (++matched_ == batch_.size())
+        condition_.notify_all();
+    else
+        condition_.wait(lock, [this] { return matched_ == batch_.size(); });
+
+    if (!error) {
+        try {
+            tracker.update_tracks();
+        } catch (...) {
+            error = std::current_exception();
+        }
+    }
+
+    if (++finished_ == batch_.size()) {
+        batch_.clear();
+        running_ = false;
+        predicted_ = false;
+        condition_.notify_all();
+    }
+    lock.unlock();
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+} // namespace DeepSortWrapper
@@ -41,6 +41,7 @@ enum {
     PROP_TRACKING_CONFIG,
     PROP_FEATURE_MODEL,
     PROP_DEEPSORT_TRCK_CFG,
+    PROP_TRACKER_INSTANCE_ID,
 };
 
 G_DEFINE_TYPE_WITH_CODE(GstGvaTrack, gst_gva_track, GST_TYPE_BASE_TRANSFORM,
@@ -137,6 +138,9 @@ void gst_gva_track_cleanup(GstGvaTrack *gva_track) {
     g_free(gva_track->feature_model);
     gva_track->feature_model = NULL;
 
+    g_free(gva_track->tracker_instance_id);
+    gva_track->tracker_instance_id = NULL;
+
     if (gva_track->info) {
         gst_video_info_free(gva_track->info);
         gva_track->info = NULL;
@@ -192,9 +196,19 @@ static void gst_gva_track_class_init(GstGvaTrackClass *klass) {
                                                         "Please see user guide for more details"
                                                         "Deep SORT tracker: max_iou_distance (default 0.7), "
                                                         "max_age (default 30 frames), n_init (default 3 frames), "
-                                                        "max_cosine_distance (default 0.2), nn_budget (default 100). "
+                                                        "max_cosine_distance (default 0.2), nn_budget (default 100), "
+                                                        "batch_timeout (default 10 ms, see tracker-instance-id). "
                                                         "Example: deepsort-trck-cfg=max_age=60,max_cosine_distance=0.3",
                                                         nullptr, kDefaultGParamFlags));
+    g_object_class_install_property(
+        gobject_class, PROP_TRACKER_INSTANCE_ID,
+        g_param_spec_string("tracker-instance-id", "Tracker Instance Id",
+                            "Identifier for sharing tracker service between gvatrack elements of deep-sort tracking "
+                            "type. Frames of elements with the same tracker-instance-id are tracked in batches: Kalman "
+                            "filters of all streams are predicted together and association of each stream runs in "
+                            "parallel. A frame waits up to batch_timeout of deepsort-trck-cfg (10 ms by default) for "
+                            "frames of other active streams to form a batch",
+                            "", kDefaultGParamFlags));
 }
 
 static void gst_gva_track_init(GstGvaTrack *gva_track) {
@@ -221,6 +235,10 @@ static void gst_gva_track_set_property(GObject *object, guint prop_id, const GVa
         g_free(gva_track->deepsort_trck_cfg);
         gva_track->deepsort_trck_cfg = g_value_dup_string(value);
         break;
+    case PROP_TRACKER_INSTANCE_ID:
+        g_free(gva_track->tracker_instance_id);
+        gva_track->tracker_instance_id = g_value_dup_string(value);
+        break;
     default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID(object, prop_id, pspec);
         break;
@@ -244,6 +262,9 @@ static void gst_gva_track_get_property(GObject *object, guint prop_id, GValue *v
     case PROP_DEEPSORT_TRCK_CFG:
         g_value_set_string(value, gva_track->deepsort_trck_cfg);
         break;
+    case PROP_TRACKER_INSTANCE_ID:
+        g_value_set_string(value, gva_track->tracker_instance_id);
+        break;
     default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID(object, prop_id, pspec);
         break;
@@ -349,6 +370,11 @@ static gboolean gst_gva_track_sink_event(GstBaseTransform *trans, GstEvent *even
 
     GST_DEBUG_OBJECT(gva_track, "sink_event %s", GST_EVENT_TYPE_NAME(event));
 
+    // trackers batching frames of several streams must not wait for this one
+    const GstEventType event_type = GST_EVENT_TYPE(event);
+    if (gva_track->tracker && (event_type == GST_EVENT_EOS || event_type == GST_EVENT_FLUSH_START))
+        gva_track->tracker->stream_stopped();
+
     return GST_BASE_TRANSFORM_CLASS(gst_gva_track_parent_class)->sink_event(trans, event);
 }
 
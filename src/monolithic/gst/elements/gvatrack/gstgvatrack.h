@@ -31,6 +31,7 @@ typedef struct _GstGvaTrack {
     gchar *tracking_config;
     gchar *feature_model;
     gchar *deepsort_trck_cfg;
+    gchar *tracker_instance_id;
 
     ITracker *tracker;
 } GstGvaTrack;
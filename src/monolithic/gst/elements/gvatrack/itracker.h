@@ -13,4 +13,7 @@ class ITracker {
   public:
     virtual ~ITracker() = default;
     virtual void track(dlstreamer::FramePtr buffer, GVA::VideoFrame &frame_meta) = 0;
+    // Called on EOS and flush, no frames are expected until the stream restarts
+    virtual void stream_stopped() {
+    }
 };
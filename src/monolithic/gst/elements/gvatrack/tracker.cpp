@@ -58,6 +58,21 @@ std::vector<vas::ot::DetectedObject> convertRoisToDetectedObjects(std::vector<GV
     return detected_objects;
 }
 
+vas::ImagePlanes imagePlanes(dls::Frame &frame) {
+    dlstreamer::ImageInfo y_info(frame.tensor(0)->info());
+    dlstreamer::ImageInfo uv_info(frame.tensor(1)->info());
+    vas::ImagePlanes planes;
+    planes.width = safe_convert<int32_t>(y_info.width());
+    planes.height = safe_convert<int32_t>(y_info.height());
+    planes.y = static_cast<const uint8_t *>(frame.tensor(0)->data());
+    planes.u = static_cast<const uint8_t *>(frame.tensor(1)->data());
+    if (frame.num_tensors() > 2)
+        planes.v = static_cast<const uint8_t *>(frame.tensor(2)->data());
+    planes.y_stride = safe_convert<int32_t>(y_info.width_stride());
+    planes.uv_stride = safe_convert<int32_t>(uv_info.width_stride());
+    return planes;
+}
+
 void append(GVA::VideoFrame &video_frame, const vas::ot::Object &tracked_object, const std::string &label) {
     auto roi = video_frame.add_region(tracked_object.rect.x, tracked_object.rect.y, tracked_object.rect.width,
                                       tracked_object.rect.height, label, 1.0);
@@ -97,6 +112,11 @@ class TrackerBackend {
         }
 
         dls::FramePtr sys_buf = _buf_mapper->map(buffer, dls::AccessMode::Read);
+        const auto format = static_cast<dls::ImageFormat>(sys_buf->format());
+        if (format == dls::ImageFormat::NV12 || format == dls::ImageFormat::I420) {
+            // Histograms are sampled from mapped planes directly, so padded or non-contiguous planes are not copied
+            return _object_tracker->Track(imagePlanes(*sys_buf), detected_objects);
+        }
         MappedMat cv_mat(sys_buf);
         return _object_tracker->Track(cv_mat.mat(), detected_objects);
     }
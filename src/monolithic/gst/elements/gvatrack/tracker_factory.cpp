@@ -40,6 +40,8 @@ bool TrackerFactory::RegisterAll() {
                                  dlstreamer::MemoryMapperPtr mapper, dlstreamer::ContextPtr context) -> ITracker * {
         const vas::ColorFormat color_fmt = gstVideoFmtToVasColorFmt(gva_track->info->finfo->format);
         const std::string cfg = gva_track->tracking_config ? gva_track->tracking_config : std::string();
+        if (gva_track->tracker_instance_id && *gva_track->tracker_instance_id)
+            GST_WARNING_OBJECT(gva_track, "tracker-instance-id is supported only by deep-sort tracking type, ignored");
         // cannot use smart pointers here
         return new VasWrapper::Tracker(gva_track->device, tracking_type, color_fmt, cfg, std::move(mapper),
                                        std::move(context));
@@ -58,11 +60,16 @@ bool TrackerFactory::RegisterAll() {
                                        dlstreamer::ContextPtr /*context*/) -> ITracker * {
         std::string dptrckcfg = gva_track->deepsort_trck_cfg ? gva_track->deepsort_trck_cfg : "";
 
+        // Trackers of the same instance id are batched by shared service
+        std::shared_ptr<DeepSortWrapper::DeepSortTrackerService> service;
+        if (gva_track->tracker_instance_id && *gva_track->tracker_instance_id)
+            service = DeepSortWrapper::DeepSortTrackerService::get(gva_track->tracker_instance_id);
+
         // Create Deep SORT tracker with external feature extraction model via gvainference
-        return new DeepSortWrapper::DeepSortTracker(DeepSortWrapper::DEFAULT_MAX_IOU_DISTANCE,
-                                                    DeepSortWrapper::DEFAULT_MAX_AGE, DeepSortWrapper::DEFAULT_N_INIT,
-                                                    DeepSortWrapper::DEFAULT_MAX_COSINE_DISTANCE,
-                                                    DeepSortWrapper::DEFAULT_NN_BUDGET, dptrckcfg, std::move(mapper));
+        return new DeepSortWrapper::DeepSortTracker(
+            DeepSortWrapper::DEFAULT_MAX_IOU_DISTANCE, DeepSortWrapper::DEFAULT_MAX_AGE,
+            DeepSortWrapper::DEFAULT_N_INIT, DeepSortWrapper::DEFAULT_MAX_COSINE_DISTANCE,
+            DeepSortWrapper::DEFAULT_NN_BUDGET, dptrckcfg, std::move(mapper), std::move(service));
     };
     result &= TrackerFactory::Register(GstGvaTrackingType::DEEP_SORT, create_deep_sort_tracker);
 
@@ -81,6 +81,39 @@ enum class BackendType {
  */
 enum class ColorFormat { BGR, NV12, BGRX, GRAY, I420 };
 
+/**
+ * @class ImagePlanes
+ *
+ * Planes of NV12 or I420 image. Planes are not required to be contiguous in memory, so mapped video surfaces can be
+ * passed without copying.
+ */
+class ImagePlanes {
+  public:
+    int32_t width = 0;
+    int32_t height = 0;
+
+    /**
+     * Luma plane.
+     */
+    const uint8_t *y = nullptr;
+
+    /**
+     * U plane, or interleaved UV plane of NV12 image.
+     */
+    const uint8_t *u = nullptr;
+
+    /**
+     * V plane, not used for NV12 image.
+     */
+    const uint8_t *v = nullptr;
+
+    /**
+     * Row strides of planes in bytes. Both chroma planes of I420 image have the same stride.
+     */
+    int32_t y_stride = 0;
+    int32_t uv_stride = 0;
+};
+
 }; // namespace vas
 
 #endif // __VAS_COMMON_H__
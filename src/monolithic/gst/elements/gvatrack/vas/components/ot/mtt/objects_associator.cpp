@@ -7,10 +7,11 @@
 #include "vas/components/ot/mtt/objects_associator.h"
 
 #include "vas/common/exception.h"
-#include "vas/components/ot/mtt/hungarian_wrap.h"
 #include "vas/components/ot/mtt/spatial_rgb_histogram.h"
 #include "vas/components/ot/prof_def.h"
 
+#include "linear_assignment.h"
+
 namespace vas {
 namespace ot {
 
@@ -69,11 +70,9 @@ ObjectsAssociator::Associate(const std::vector<Detection> &detections,
     PROF_END(PROF_COMPONENTS_OT_ASSOCIATE_COMPUTE_DIST_TABLE);
 
     PROF_START(PROF_COMPONENTS_OT_ASSOCIATE_COMPUTE_COST_TABLE);
-    // Compute detection-tracklet association cost table
-    cv::Mat_<float> d2t_cost_table;
-    d2t_cost_table.create(static_cast<int32_t>(detections.size()),
-                          static_cast<int32_t>(tracklets.size() + detections.size()));
-    d2t_cost_table = kAssociationCostThreshold + 1.0f;
+    // Compute detection-tracklet association cost table, detections and tracklets of different class are not
+    // associated
+    cv::Mat_<float> d2t_cost_table(n_detections, n_tracklets, LinearAssignmentSolver::FORBIDDEN);
 
     for (int32_t t = 0; t < n_tracklets; ++t) {
         const auto &tracklet = tracklets[t];
@@ -100,25 +99,25 @@ ObjectsAssociator::Associate(const std::vector<Detection> &detections,
             }
         }
     }
-
-    for (int32_t d = 0; d < n_detections; ++d) {
-        d2t_cost_table(d, d + n_tracklets) = kAssociationCostThreshold;
-    }
     PROF_END(PROF_COMPONENTS_OT_ASSOCIATE_COMPUTE_COST_TABLE);
 
-    // Solve detection-tracking association using Hungarian algorithm
+    // Solve detection-tracking association, detection is not associated if its costs exceed the threshold
     PROF_START(PROF_COMPONENTS_OT_ASSOCIATE_WITH_HUNGARIAN);
-    HungarianAlgo hungarian(d2t_cost_table);
-    cv::Mat_<uint8_t> d2t_assign_table = hungarian.Solve();
+    // Prices of tracklets from previous association are warm start of the solver
+    tracklet_prices_.resize(n_tracklets);
+    for (int32_t t = 0; t < n_tracklets; ++t)
+        tracklet_prices_[t] = tracklets[t]->association_price;
+    const std::vector<int> &d_assigned_t = assignment_solver_.solve(
+        d2t_cost_table.ptr<float>(), n_detections, n_tracklets, kAssociationCostThreshold, tracklet_prices_.data());
+    for (int32_t t = 0; t < n_tracklets; ++t)
+        tracklets[t]->association_price = tracklet_prices_[t];
     PROF_END(PROF_COMPONENTS_OT_ASSOCIATE_WITH_HUNGARIAN);
 
     for (int32_t d = 0; d < n_detections; ++d) {
-        for (int32_t t = 0; t < n_tracklets; ++t) {
-            if (d2t_assign_table(d, t)) {
-                d_is_associated[d] = true;
-                t_associated_d_index[t] = d;
-                break;
-            }
+        const int32_t t = d_assigned_t[d];
+        if (t >= 0) {
+            d_is_associated[d] = true;
+            t_associated_d_index[t] = d;
         }
     }
 
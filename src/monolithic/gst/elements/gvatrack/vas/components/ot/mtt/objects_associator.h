@@ -9,6 +9,8 @@
 
 #include "vas/components/ot/tracklet.h"
 
+#include "linear_assignment.h"
+
 #include <opencv2/opencv.hpp>
 
 namespace vas {
@@ -35,6 +37,9 @@ class ObjectsAssociator {
 
   private:
     bool tracking_per_class_;
+
+    LinearAssignmentSolver assignment_solver_;
+    std::vector<float> tracklet_prices_;
 };
 
 }; // namespace ot
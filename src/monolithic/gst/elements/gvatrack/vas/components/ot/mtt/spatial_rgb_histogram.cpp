@@ -8,9 +8,56 @@
 
 #include "vas/components/ot/prof_def.h"
 
+#include <algorithm>
+#include <tuple>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(_WIN32)
+#define YUV_HISTOGRAM_MULTIVERSION __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define YUV_HISTOGRAM_MULTIVERSION
+#endif
+
 namespace vas {
 namespace ot {
 
+namespace {
+
+// BT.601 YUV to RGB conversion of cv::cvtColor in fixed point with 20 fractional bits
+const int32_t kYuvShift = 20;
+const int32_t kYuvRound = 1 << (kYuvShift - 1);
+const int32_t kYToRgb = 1220542;
+const int32_t kUToB = 2116026;
+const int32_t kUToG = -409993;
+const int32_t kVToG = -852492;
+const int32_t kVToR = 1673527;
+
+struct PatchRow {
+    int32_t image_row;
+    int32_t roi;
+    int32_t patch_row;
+};
+
+/**
+ * Converts YUV samples to RGB histogram indices, index order is B, G, R as in AccumulateRgbHistogram. Division by bin
+ * size is multiplication by bin_div_mul = 2^16 / bin_size + 1, which is exact for 8-bit values.
+ */
+YUV_HISTOGRAM_MULTIVERSION
+void YuvToRgbHistIndex(const uint8_t *__restrict y, const uint8_t *__restrict u, const uint8_t *__restrict v,
+                       int32_t *__restrict index, int32_t size, int32_t num_bins, int32_t bin_div_mul) {
+    for (int32_t k = 0; k < size; ++k) {
+        const int32_t luma = std::max(0, y[k] - 16) * kYToRgb + kYuvRound;
+        const int32_t cb = u[k] - 128;
+        const int32_t cr = v[k] - 128;
+        const int32_t b = std::min(255, std::max(0, (luma + kUToB * cb) >> kYuvShift));
+        const int32_t g = std::min(255, std::max(0, (luma + kUToG * cb + kVToG * cr) >> kYuvShift));
+        const int32_t r = std::min(255, std::max(0, (luma + kVToR * cr) >> kYuvShift));
+        index[k] = num_bins * (num_bins * ((b * bin_div_mul) >> 16) + ((g * bin_div_mul) >> 16)) +
+                   ((r * bin_div_mul) >> 16);
+    }
+}
+
+} // namespace
+
 SpatialRgbHistogram::SpatialRgbHistogram(int32_t canonical_patch_size, int32_t spatial_bin_size,
                                          int32_t spatial_bin_stride, int32_t rgb_bin_size)
     : RgbHistogram(rgb_bin_size), canonical_patch_size_(canonical_patch_size), spatial_bin_size_(spatial_bin_size),
@@ -115,102 +162,78 @@ void SpatialRgbHistogram::ComputeFromBgra32(const cv::Mat &image, cv::Mat *hist)
     PROF_END(PROF_COMPONENTS_OT_SHORTTERM_COMPUTE_HIST);
 }
 
-void SpatialRgbHistogram::ComputeFromNv12(const YuvImage &image, const cv::Rect &roi, cv::Mat *hist) {
+void SpatialRgbHistogram::ComputeFromYuv(const vas::ImagePlanes &image, vas::ColorFormat format,
+                                         const std::vector<cv::Rect> &rois, std::vector<cv::Mat> *hists) {
     PROF_START(PROF_COMPONENTS_OT_SHORTTERM_COMPUTE_HIST);
-    cv::Point2f cp(roi.x + roi.width / 2, roi.y + roi.height / 2);
-
-    // Init output buffer
-    hist->create(1, spatial_hist_size_, CV_32F);
-    (*hist) = cv::Scalar(0);
-    float *rgb_hist_ptr = hist->ptr<float>();
-
-    // Normalize input image into canonical size
-    if (image.height_ <= 0 || image.width_ <= 0) {
-        PROF_END(PROF_COMPONENTS_OT_SHORTTERM_COMPUTE_HIST);
-        return;
-    }
-
-    cv::Mat patch;
-    YuvImage roi_patch(canonical_patch_size_, canonical_patch_size_, false);
-    image.CropAndResizeNv12(cp, cv::Size2f(roi.width, roi.height), &roi_patch);
-    cv::cvtColor(roi_patch.ToCVMat(), patch, cv::COLOR_YUV2BGR_NV12);
-
-#if 0 // Debugging
-    if (false)
-    {
-        char filename[256] = {};
-        std::snprintf(filename, sizeof(filename), "C:/Users/byungilm/Desktop/vbshared/intel_exported_working/engine/imv-lib/out_win64_icc/nv12_%dx%d_%d.yuv", canonical_patch_size_, canonical_patch_size_, canonical_patch_size_);
-        std::ofstream write_file(filename, std::ofstream::out | std::ofstream::binary);
-        write_file.write(const_cast<char*>(reinterpret_cast<char*>(roi_patch.data_)), roi_patch.size_);
-        write_file.close();
-    }
-
-    const char* window_name = "Debugging ComputeFromNv12";
-    cv::namedWindow(window_name, cv::WINDOW_NORMAL | cv::WINDOW_KEEPRATIO);
-    cv::imshow(window_name, patch);
-    cv::waitKey(0);
-#endif
-
-    // Compute spatial histogram
-    for (int32_t y_bin = 0; y_bin < spatial_num_bins_; ++y_bin) {
-        int32_t y = y_bin * spatial_bin_stride_;
-        for (int32_t x_bin = 0; x_bin < spatial_num_bins_; ++x_bin) {
-            int32_t x = x_bin * spatial_bin_stride_;
-            // Compute RGB histogram per each spatial bin
-            AccumulateRgbHistogram(patch(cv::Rect(x, y, spatial_bin_size_, spatial_bin_size_)),
-                                   weight_(cv::Rect(x, y, spatial_bin_size_, spatial_bin_size_)), rgb_hist_ptr);
-            rgb_hist_ptr += rgb_hist_size_;
+    const int32_t patch_size = canonical_patch_size_;
+    const int32_t num_rois = static_cast<int32_t>(rois.size());
+    const bool nv12 = (format == vas::ColorFormat::NV12);
+    const int32_t uv_step = nv12 ? 2 : 1;
+    const uint8_t *v_plane = nv12 ? image.u + 1 : image.v;
+    const int32_t bin_div_mul = (1 << 16) / rgb_bin_size_ + 1;
+
+    // Image columns sampled by patch columns, patch rows are listed in the order of image rows
+    std::vector<int32_t> y_columns(num_rois * patch_size);
+    std::vector<int32_t> uv_columns(num_rois * patch_size);
+    std::vector<PatchRow> patch_rows;
+    patch_rows.reserve(num_rois * patch_size);
+
+    hists->resize(rois.size());
+    const cv::Rect image_rect(0, 0, image.width, image.height);
+    for (int32_t r = 0; r < num_rois; ++r) {
+        cv::Mat &hist = (*hists)[r];
+        hist.create(1, spatial_hist_size_, CV_32F);
+        hist = cv::Scalar(0);
+
+        const cv::Rect roi = rois[r] & image_rect;
+        if (roi.width <= 0 || roi.height <= 0)
+            continue;
+        for (int32_t p = 0; p < patch_size; ++p) {
+            const int32_t x = roi.x + (2 * p + 1) * roi.width / (2 * patch_size);
+            y_columns[r * patch_size + p] = x;
+            uv_columns[r * patch_size + p] = (x / 2) * uv_step;
+            patch_rows.push_back({roi.y + (2 * p + 1) * roi.height / (2 * patch_size), r, p});
         }
     }
-
-    PROF_END(PROF_COMPONENTS_OT_SHORTTERM_COMPUTE_HIST);
-}
-
-void SpatialRgbHistogram::ComputeFromI420(const YuvImage &image, const cv::Rect &roi, cv::Mat *hist) {
-    PROF_START(PROF_COMPONENTS_OT_SHORTTERM_COMPUTE_HIST);
-    cv::Point2f cp(roi.x + roi.width / 2, roi.y + roi.height / 2);
-
-    // Init output buffer
-    hist->create(1, spatial_hist_size_, CV_32F);
-    (*hist) = cv::Scalar(0);
-    float *rgb_hist_ptr = hist->ptr<float>();
-
-    // Normalize input image into canonical size
-    if (image.height_ <= 0 || image.width_ <= 0) {
-        PROF_END(PROF_COMPONENTS_OT_SHORTTERM_COMPUTE_HIST);
-        return;
-    }
-
-    cv::Mat patch;
-    YuvImage roi_patch(canonical_patch_size_, canonical_patch_size_, false, YuvImage::FMT_I420);
-    image.CropAndResizeI420(cp, cv::Size2f(roi.width, roi.height), &roi_patch);
-    cv::cvtColor(roi_patch.ToCVMat(), patch, cv::COLOR_YUV2BGR_I420);
-
-#if 0 // Debugging
-    if (false)
-    {
-        char filename[256] = {};
-        std::snprintf(filename, sizeof(filename), "C:/Users/byungilm/Desktop/vbshared/intel_exported_working/engine/imv-lib/out_win64_icc/nv12_%dx%d_%d.yuv", canonical_patch_size_, canonical_patch_size_, canonical_patch_size_);
-        std::ofstream write_file(filename, std::ofstream::out | std::ofstream::binary);
-        write_file.write(const_cast<char*>(reinterpret_cast<char*>(roi_patch.data_)), roi_patch.size_);
-        write_file.close();
+    std::sort(patch_rows.begin(), patch_rows.end(), [](const PatchRow &lhs, const PatchRow &rhs) {
+        return std::tie(lhs.image_row, lhs.roi, lhs.patch_row) < std::tie(rhs.image_row, rhs.roi, rhs.patch_row);
+    });
+
+    // Spatial bins covering each patch row or column
+    std::vector<int32_t> first_bin(patch_size);
+    std::vector<int32_t> last_bin(patch_size);
+    for (int32_t p = 0; p < patch_size; ++p) {
+        first_bin[p] = (p < spatial_bin_size_) ? 0 : (p - spatial_bin_size_) / spatial_bin_stride_ + 1;
+        last_bin[p] = std::min(spatial_num_bins_ - 1, p / spatial_bin_stride_);
     }
 
-    const char* window_name = "Debugging ComputeFromNv12";
-    cv::namedWindow(window_name, cv::WINDOW_NORMAL | cv::WINDOW_KEEPRATIO);
-    cv::imshow(window_name, patch);
-    cv::waitKey(0);
-#endif
-
-    // Compute spatial histogram
-    for (int32_t y_bin = 0; y_bin < spatial_num_bins_; ++y_bin) {
-        int32_t y = y_bin * spatial_bin_stride_;
-        for (int32_t x_bin = 0; x_bin < spatial_num_bins_; ++x_bin) {
-            int32_t x = x_bin * spatial_bin_stride_;
-            // Compute RGB histogram per each spatial bin
-            AccumulateRgbHistogram(patch(cv::Rect(x, y, spatial_bin_size_, spatial_bin_size_)),
-                                   weight_(cv::Rect(x, y, spatial_bin_size_, spatial_bin_size_)), rgb_hist_ptr);
-            rgb_hist_ptr += rgb_hist_size_;
+    std::vector<uint8_t> y_samples(patch_size);
+    std::vector<uint8_t> u_samples(patch_size);
+    std::vector<uint8_t> v_samples(patch_size);
+    std::vector<int32_t> rgb_index(patch_size);
+    for (const auto &row : patch_rows) {
+        const uint8_t *y_line = image.y + static_cast<size_t>(row.image_row) * image.y_stride;
+        const size_t uv_offset = static_cast<size_t>(row.image_row / 2) * image.uv_stride;
+        const uint8_t *u_line = image.u + uv_offset;
+        const uint8_t *v_line = v_plane + uv_offset;
+        const int32_t *y_column = &y_columns[row.roi * patch_size];
+        const int32_t *uv_column = &uv_columns[row.roi * patch_size];
+        for (int32_t p = 0; p < patch_size; ++p) {
+            y_samples[p] = y_line[y_column[p]];
+            u_samples[p] = u_line[uv_column[p]];
+            v_samples[p] = v_line[uv_column[p]];
+        }
+        YuvToRgbHistIndex(y_samples.data(), u_samples.data(), v_samples.data(), rgb_index.data(), patch_size,
+                          rgb_num_bins_, bin_div_mul);
+
+        float *hist = (*hists)[row.roi].ptr<float>();
+        const float *weight = weight_.ptr<float>(row.patch_row);
+        for (int32_t y_bin = first_bin[row.patch_row]; y_bin <= last_bin[row.patch_row]; ++y_bin) {
+            float *row_hist = hist + y_bin * spatial_num_bins_ * rgb_hist_size_;
+            for (int32_t p = 0; p < patch_size; ++p) {
+                for (int32_t x_bin = first_bin[p]; x_bin <= last_bin[p]; ++x_bin)
+                    row_hist[x_bin * rgb_hist_size_ + rgb_index[p]] += weight[p];
+            }
         }
     }
 
@@ -7,9 +7,10 @@
 #ifndef __OT_SPATIAL_RGB_HISTOGRAM_H__
 #define __OT_SPATIAL_RGB_HISTOGRAM_H__
 
+#include "vas/common.h"
 #include "vas/components/ot/mtt/rgb_histogram.h"
 
-#include "vas/components/ot/container/yuv_image.h"
+#include <vector>
 
 namespace vas {
 namespace ot {
@@ -22,8 +23,13 @@ class SpatialRgbHistogram : public RgbHistogram {
 
     virtual void Compute(const cv::Mat &image, cv::Mat *hist);
     virtual void ComputeFromBgra32(const cv::Mat &image, cv::Mat *hist);
-    virtual void ComputeFromNv12(const YuvImage &image, const cv::Rect &roi, cv::Mat *hist);
-    virtual void ComputeFromI420(const YuvImage &image, const cv::Rect &roi, cv::Mat *hist);
+
+    /**
+     * Computes histograms of all rois of NV12 or I420 image in one pass over image rows. Canonical patch pixels are
+     * sampled from planes and binned from YUV directly, without cropping, resizing and color conversion of patches.
+     */
+    virtual void ComputeFromYuv(const vas::ImagePlanes &image, vas::ColorFormat format,
+                                const std::vector<cv::Rect> &rois, std::vector<cv::Mat> *hists);
 
     virtual int32_t FeatureSize(void) const;
 
@@ -73,6 +73,11 @@ class ObjectTracker::Impl {
     bool GetTrackingPerClass() const noexcept;
     void SetDeltaTime(float delta_t);
     std::vector<Object> Track(const cv::Mat &frame, const std::vector<DetectedObject> &objects);
+    std::vector<Object> Track(const vas::ImagePlanes &frame, const std::vector<DetectedObject> &objects);
+
+  private:
+    static std::vector<vas::ot::Detection> ToDetections(const std::vector<DetectedObject> &detected_objects);
+    std::vector<Object> ToObjects(const cv::Rect &frame_rect) const;
 
   private:
     std::unique_ptr<vas::ot::Tracker> tracker_;
@@ -133,6 +138,10 @@ std::vector<Object> ObjectTracker::Track(const cv::Mat &frame, const std::vector
     return impl_->Track(frame, objects);
 }
 
+std::vector<Object> ObjectTracker::Track(const vas::ImagePlanes &frame, const std::vector<DetectedObject> &objects) {
+    return impl_->Track(frame, objects);
+}
+
 ObjectTracker::Impl::Impl(const InitParameters &param)
     : max_num_objects_(param.max_num_objects), delta_t_(kDefaultDeltaTime), tracking_type_(param.tracking_type),
       backend_type_(param.backend_type), input_color_format_(param.format),
@@ -212,6 +221,59 @@ std::vector<Object> ObjectTracker::Impl::Track(const cv::Mat &frame,
 
     TRACE("START");
     PROF_START(PROF_COMPONENTS_OT_RUN_TRACK);
+    std::vector<vas::ot::Detection> detections = ToDetections(detected_objects);
+
+    std::vector<Object> objects;
+    if (backend_type_ == vas::BackendType::CPU) {
+        tracker_->TrackObjects(frame, detections, &produced_tracklets_, delta_t_);
+        TRACE("+ Number: Tracking objects (%d)", static_cast<int32_t>(produced_tracklets_.size()));
+        objects = ToObjects(frame_rect);
+    } else {
+        ETHROW(false, invalid_argument, "Unexpected input backend type for VAS-OT.")
+    }
+    TRACE("+ Number: Result objects (%d)", static_cast<int32_t>(objects.size()));
+
+    PROF_END(PROF_COMPONENTS_OT_RUN_TRACK);
+
+#ifdef DUMP_OTAV
+    otav_.Dump(frame, detections, produced_tracklets_, tracker_->GetFrameCount() - 1);
+#endif
+
+    TRACE("END");
+    return objects;
+}
+
+std::vector<Object> ObjectTracker::Impl::Track(const vas::ImagePlanes &frame,
+                                               const std::vector<DetectedObject> &detected_objects) {
+    if (frame.width <= 0 || frame.height <= 0 || frame.y == nullptr || frame.u == nullptr ||
+        (input_color_format_ == vas::ColorFormat::I420 && frame.v == nullptr)) {
+        ETHROW(false, invalid_argument, "Invalid frame planes(%dx%d)", frame.width, frame.height);
+    }
+    if (input_color_format_ != vas::ColorFormat::NV12 && input_color_format_ != vas::ColorFormat::I420) {
+        ETHROW(false, invalid_argument, "Frame planes are supported for NV12 and I420 formats only");
+    }
+    cv::Rect frame_rect(0, 0, frame.width, frame.height);
+
+    TRACE("START");
+    PROF_START(PROF_COMPONENTS_OT_RUN_TRACK);
+    std::vector<vas::ot::Detection> detections = ToDetections(detected_objects);
+
+    std::vector<Object> objects;
+    if (backend_type_ == vas::BackendType::CPU) {
+        tracker_->TrackObjects(frame, detections, &produced_tracklets_, delta_t_);
+        TRACE("+ Number: Tracking objects (%d)", static_cast<int32_t>(produced_tracklets_.size()));
+        objects = ToObjects(frame_rect);
+    } else {
+        ETHROW(false, invalid_argument, "Unexpected input backend type for VAS-OT.")
+    }
+    TRACE("+ Number: Result objects (%d)", static_cast<int32_t>(objects.size()));
+
+    PROF_END(PROF_COMPONENTS_OT_RUN_TRACK);
+    TRACE("END");
+    return objects;
+}
+
+std::vector<vas::ot::Detection> ObjectTracker::Impl::ToDetections(const std::vector<DetectedObject> &detected_objects) {
     std::vector<vas::ot::Detection> detections;
 
     TRACE("+ Number: Detected objects (%d)", static_cast<int32_t>(detected_objects.size()));
@@ -226,52 +288,39 @@ std::vector<Object> ObjectTracker::Impl::Track(const cv::Mat &frame,
         detections.emplace_back(detection);
         index++;
     }
+    return detections;
+}
 
+std::vector<Object> ObjectTracker::Impl::ToObjects(const cv::Rect &frame_rect) const {
     std::vector<Object> objects;
-    if (backend_type_ == vas::BackendType::CPU) {
-        tracker_->TrackObjects(frame, detections, &produced_tracklets_, delta_t_);
-        TRACE("+ Number: Tracking objects (%d)", static_cast<int32_t>(produced_tracklets_.size()));
-
-        for (const auto &tracklet : produced_tracklets_) // result 'Tracklet'
-        {
-            cv::Rect rect = static_cast<cv::Rect>(tracklet->trajectory_filtered.back());
-            if ((rect & frame_rect).area() > 0) {
-                Object object;
-                // TRACE("     - ID(%d) Status(%d)", tracklet.id, tracklet.status);
-                object.rect = static_cast<cv::Rect>(tracklet->trajectory_filtered.back());
-                object.tracking_id = tracklet->id;
-                object.class_label = tracklet->label;
-                object.association_idx = tracklet->association_idx;
+    for (const auto &tracklet : produced_tracklets_) // result 'Tracklet'
+    {
+        cv::Rect rect = static_cast<cv::Rect>(tracklet->trajectory_filtered.back());
+        if ((rect & frame_rect).area() > 0) {
+            Object object;
+            // TRACE("     - ID(%d) Status(%d)", tracklet.id, tracklet.status);
+            object.rect = static_cast<cv::Rect>(tracklet->trajectory_filtered.back());
+            object.tracking_id = tracklet->id;
+            object.class_label = tracklet->label;
+            object.association_idx = tracklet->association_idx;
+            object.status = vas::ot::TrackingStatus::LOST;
+            switch (tracklet->status) {
+            case ST_NEW:
+                object.status = vas::ot::TrackingStatus::NEW;
+                break;
+            case ST_TRACKED:
+                object.status = vas::ot::TrackingStatus::TRACKED;
+                break;
+            case ST_LOST:
+            default:
                 object.status = vas::ot::TrackingStatus::LOST;
-                switch (tracklet->status) {
-                case ST_NEW:
-                    object.status = vas::ot::TrackingStatus::NEW;
-                    break;
-                case ST_TRACKED:
-                    object.status = vas::ot::TrackingStatus::TRACKED;
-                    break;
-                case ST_LOST:
-                default:
-                    object.status = vas::ot::TrackingStatus::LOST;
-                }
-                objects.emplace_back(object);
-            } else {
-                TRACE("[ %d, %d, %d, %d ] is out of the image bound! -> Filtered out.", rect.x, rect.y, rect.width,
-                      rect.height);
             }
+            objects.emplace_back(object);
+        } else {
+            TRACE("[ %d, %d, %d, %d ] is out of the image bound! -> Filtered out.", rect.x, rect.y, rect.width,
+                  rect.height);
         }
-    } else {
-        ETHROW(false, invalid_argument, "Unexpected input backend type for VAS-OT.")
     }
-    TRACE("+ Number: Result objects (%d)", static_cast<int32_t>(objects.size()));
-
-    PROF_END(PROF_COMPONENTS_OT_RUN_TRACK);
-
-#ifdef DUMP_OTAV
-    otav_.Dump(frame, detections, produced_tracklets_, tracker_->GetFrameCount() - 1);
-#endif
-
-    TRACE("END");
     return objects;
 }
 
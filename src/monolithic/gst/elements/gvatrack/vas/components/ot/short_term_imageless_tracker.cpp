@@ -62,9 +62,10 @@ int32_t ShortTermImagelessTracker::TrackObjects(const cv::Mat &mat, const std::v
 
     PROF_START(PROF_COMPONENTS_OT_SHORTTERM_KALMAN_PREDICTION);
     // Predict tracklets state
+    kalman_filters_.PredictAll(delta_t);
     for (auto &tracklet : tracklets_) {
         auto sttimgless_tracklet = std::dynamic_pointer_cast<ShortTermImagelessTracklet>(tracklet);
-        cv::Rect2f predicted_rect = sttimgless_tracklet->kalman_filter->Predict(delta_t);
+        cv::Rect2f predicted_rect = kalman_filters_.GetPredicted(sttimgless_tracklet->kalman_filter);
         sttimgless_tracklet->predicted = predicted_rect;
         sttimgless_tracklet->trajectory.push_back(predicted_rect);
         sttimgless_tracklet->trajectory_filtered.push_back(predicted_rect);
@@ -131,15 +132,15 @@ int32_t ShortTermImagelessTracker::TrackObjects(const cv::Mat &mat, const std::v
 
                 if (sttimgless_tracklet->status == ST_NEW) {
                     sttimgless_tracklet->trajectory.back() = d_bounding_box;
-                    sttimgless_tracklet->trajectory_filtered.back() =
-                        sttimgless_tracklet->kalman_filter->Correct(sttimgless_tracklet->trajectory.back());
+                    sttimgless_tracklet->trajectory_filtered.back() = kalman_filters_.Correct(
+                        sttimgless_tracklet->kalman_filter, sttimgless_tracklet->trajectory.back());
                     sttimgless_tracklet->status = ST_TRACKED;
                 } else if (sttimgless_tracklet->status == ST_TRACKED) {
                     sttimgless_tracklet->trajectory.back() = d_bounding_box;
-                    sttimgless_tracklet->trajectory_filtered.back() =
-                        sttimgless_tracklet->kalman_filter->Correct(sttimgless_tracklet->trajectory.back());
+                    sttimgless_tracklet->trajectory_filtered.back() = kalman_filters_.Correct(
+                        sttimgless_tracklet->kalman_filter, sttimgless_tracklet->trajectory.back());
                 } else if (sttimgless_tracklet->status == ST_LOST) {
-                    sttimgless_tracklet->RenewTrajectory(d_bounding_box);
+                    RenewTrackletWithMotion(sttimgless_tracklet.get(), d_bounding_box);
                     sttimgless_tracklet->status = ST_TRACKED;
                 }
             } else // Association failure
@@ -181,8 +182,8 @@ int32_t ShortTermImagelessTracker::TrackObjects(const cv::Mat &mat, const std::v
                     sttimgless_tracklet->association_fail_count = 0;
                     sttimgless_tracklet->age = 0;
                 } else {
-                    sttimgless_tracklet->trajectory_filtered.back() =
-                        sttimgless_tracklet->kalman_filter->Correct(sttimgless_tracklet->trajectory.back());
+                    sttimgless_tracklet->trajectory_filtered.back() = kalman_filters_.Correct(
+                        sttimgless_tracklet->kalman_filter, sttimgless_tracklet->trajectory.back());
                 }
             }
 
@@ -216,7 +217,7 @@ int32_t ShortTermImagelessTracker::TrackObjects(const cv::Mat &mat, const std::v
 
             const cv::Rect2f &bounding_box = detections[d].rect & image_boundary;
             tracklet->InitTrajectory(bounding_box);
-            tracklet->kalman_filter = std::make_unique<KalmanFilterNoOpencv>(bounding_box);
+            tracklet->kalman_filter = kalman_filters_.Add(bounding_box);
             tracklets_.push_back(std::move(tracklet));
         }
     }
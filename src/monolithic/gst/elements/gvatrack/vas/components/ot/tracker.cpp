@@ -43,12 +43,21 @@ std::unique_ptr<Tracker> Tracker::CreateInstance(InitParameters init_parameters)
     return tracker;
 }
 
+int32_t Tracker::TrackObjects(const vas::ImagePlanes &frame, const std::vector<Detection> &detections,
+                              std::vector<std::shared_ptr<Tracklet>> *tracklets, float delta_t) {
+    // Matrix of NV12 / I420 frame size, its data is not read
+    const cv::Mat frame_mat(frame.height * 3 / 2, frame.width, CV_8UC1, const_cast<uint8_t *>(frame.y),
+                            frame.y_stride);
+    return TrackObjects(frame_mat, detections, tracklets, delta_t);
+}
+
 int32_t Tracker::RemoveObject(const int32_t id) {
     if (id == 0)
         return -1;
 
     for (auto tracklet = tracklets_.begin(); tracklet != tracklets_.end(); ++tracklet) {
         if ((*tracklet)->id == id) {
+            kalman_filters_.Remove((*tracklet)->kalman_filter);
             tracklet = tracklets_.erase(tracklet);
             return 0;
         }
@@ -59,6 +68,7 @@ int32_t Tracker::RemoveObject(const int32_t id) {
 void Tracker::Reset(void) {
     frame_count_ = 0;
     tracklets_.clear();
+    kalman_filters_.Clear();
 }
 
 int32_t Tracker::GetFrameCount(void) const {
@@ -101,6 +111,7 @@ void Tracker::RemoveOutOfBoundTracklets(int32_t input_width, int32_t input_heigh
             is_filtered ? (*tracklet)->trajectory_filtered.back() : (*tracklet)->trajectory.back();
         if ((image_region & object_region).area() / object_region.area() <
             min_region_ratio_in_boundary_) { // only 10% is in image boundary
+            kalman_filters_.Remove((*tracklet)->kalman_filter);
             tracklet = tracklets_.erase(tracklet);
         } else {
             ++tracklet;
@@ -111,6 +122,7 @@ void Tracker::RemoveOutOfBoundTracklets(int32_t input_width, int32_t input_heigh
 void Tracker::RemoveDeadTracklets() {
     for (auto tracklet = tracklets_.begin(); tracklet != tracklets_.end();) {
         if ((*tracklet)->status == ST_DEAD) {
+            kalman_filters_.Remove((*tracklet)->kalman_filter);
             tracklet = tracklets_.erase(tracklet);
         } else {
             ++tracklet;
@@ -118,10 +130,23 @@ void Tracker::RemoveDeadTracklets() {
     }
 }
 
+void Tracker::RenewTrackletWithMotion(Tracklet *tracklet, const cv::Rect2f &bounding_box) {
+    float velo_x = bounding_box.x - tracklet->trajectory.back().x;
+    float velo_y = bounding_box.y - tracklet->trajectory.back().y;
+    cv::Rect rect_predict(bounding_box.x + velo_x / 3, bounding_box.y + velo_y / 3, bounding_box.width,
+                          bounding_box.height);
+
+    tracklet->RenewTrajectory(bounding_box);
+    kalman_filters_.Reset(tracklet->kalman_filter, bounding_box);
+    kalman_filters_.Predict(tracklet->kalman_filter);
+    kalman_filters_.Correct(tracklet->kalman_filter, rect_predict);
+}
+
 bool Tracker::RemoveOneLostTracklet() {
     for (auto tracklet = tracklets_.begin(); tracklet != tracklets_.end();) {
         if ((*tracklet)->status == ST_LOST) {
             // The first tracklet is the oldest
+            kalman_filters_.Remove((*tracklet)->kalman_filter);
             tracklet = tracklets_.erase(tracklet);
             return true;
         } else {
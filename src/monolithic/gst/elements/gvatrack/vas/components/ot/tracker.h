@@ -70,6 +70,15 @@ class Tracker {
     virtual int32_t TrackObjects(const cv::Mat &mat, const std::vector<Detection> &detections,
                                  std::vector<std::shared_ptr<Tracklet>> *tracklets, float delta_t = 0.033f) = 0;
 
+    /**
+     * perform tracking with NV12 or I420 frame given by planes
+     *
+     * Default implementation is for trackers which use only frame size, trackers using image content sample the
+     * planes directly.
+     */
+    virtual int32_t TrackObjects(const vas::ImagePlanes &frame, const std::vector<Detection> &detections,
+                                 std::vector<std::shared_ptr<Tracklet>> *tracklets, float delta_t = 0.033f);
+
     /**
      * remove object
      *
@@ -106,6 +115,10 @@ class Tracker {
     void RemoveDeadTracklets();
     bool RemoveOneLostTracklet();
 
+    // Restarts trajectory and Kalman filter of a lost tracklet found again, filter gets motion since the tracklet
+    // was lost
+    void RenewTrackletWithMotion(Tracklet *tracklet, const cv::Rect2f &bounding_box);
+
   protected:
     int32_t max_objects_; // -1 means no limitation
     int32_t next_id_;
@@ -116,6 +129,7 @@ class Tracker {
 
     ObjectsAssociator associator_;
     std::vector<std::shared_ptr<Tracklet>> tracklets_;
+    KalmanFilterNoOpencvBank kalman_filters_;
 };
 
 }; // namespace ot
@@ -58,6 +58,8 @@ class Tracklet {
     float occlusion_ratio;
     float association_delta_t;
     int32_t association_fail_count;
+    float association_price; // Warm start of association solver
+    int32_t kalman_filter;   // Index of Kalman filter in the tracker's bank
 
     std::deque<cv::Rect2f> trajectory;
     std::deque<cv::Rect2f> trajectory_filtered;
@@ -75,7 +77,6 @@ class ZeroTermChistTracklet : public Tracklet {
   public:
     int32_t birth_count;
     std::deque<cv::Mat> rgb_features;
-    std::unique_ptr<KalmanFilterNoOpencv> kalman_filter;
 };
 
 class ZeroTermImagelessTracklet : public Tracklet {
@@ -83,22 +84,14 @@ class ZeroTermImagelessTracklet : public Tracklet {
     ZeroTermImagelessTracklet();
     virtual ~ZeroTermImagelessTracklet();
 
-    void RenewTrajectory(const cv::Rect2f &bounding_box) override;
-
   public:
     int32_t birth_count;
-    std::unique_ptr<KalmanFilterNoOpencv> kalman_filter;
 };
 
 class ShortTermImagelessTracklet : public Tracklet {
   public:
     ShortTermImagelessTracklet();
     virtual ~ShortTermImagelessTracklet();
-
-    void RenewTrajectory(const cv::Rect2f &bounding_box) override;
-
-  public:
-    std::unique_ptr<KalmanFilterNoOpencv> kalman_filter;
 };
 
 }; // namespace ot
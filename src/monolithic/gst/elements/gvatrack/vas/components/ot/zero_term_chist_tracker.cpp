@@ -45,22 +45,69 @@ ZeroTermChistTracker::~ZeroTermChistTracker() {
 
 int32_t ZeroTermChistTracker::TrackObjects(const cv::Mat &mat, const std::vector<Detection> &detections,
                                            std::vector<std::shared_ptr<Tracklet>> *tracklets, float delta_t) {
-    PROF_START(PROF_COMPONENTS_OT_ZEROTERM_RUN_TRACKER);
-
-    int32_t input_img_width = mat.cols;
-    int32_t input_img_height = mat.rows;
-
     if (input_image_format_ == vas::ColorFormat::NV12 || input_image_format_ == vas::ColorFormat::I420) {
-        input_img_height = mat.rows / 3 * 2;
+        // Contiguous planes of frame
+        vas::ImagePlanes frame;
+        frame.width = mat.cols;
+        frame.height = mat.rows / 3 * 2;
+        frame.y = mat.data;
+        frame.y_stride = static_cast<int32_t>(mat.step);
+        frame.u = frame.y + frame.y_stride * frame.height;
+        if (input_image_format_ == vas::ColorFormat::NV12) {
+            frame.uv_stride = frame.y_stride;
+        } else {
+            frame.uv_stride = frame.y_stride / 2;
+            frame.v = frame.u + frame.uv_stride * ((frame.height + 1) / 2);
+        }
+        return TrackObjects(frame, detections, tracklets, delta_t);
     }
-    const cv::Rect2f image_boundary(0.0f, 0.0f, static_cast<float>(input_img_width),
-                                    static_cast<float>(input_img_height));
+
+    const cv::Size image_size(mat.cols, mat.rows);
+    std::vector<cv::Mat> d_rgb_features(detections.size());
+    const auto rois = ClipDetections(detections, image_size);
+    for (size_t d = 0; d < rois.size(); ++d) {
+        if (input_image_format_ == vas::ColorFormat::BGR) {
+            rgb_hist_.Compute(mat(rois[d]), &d_rgb_features[d]);
+        } else if (input_image_format_ == vas::ColorFormat::BGRX) {
+            rgb_hist_.ComputeFromBgra32(mat(rois[d]), &d_rgb_features[d]);
+        }
+    }
+    return TrackObjects(image_size, detections, d_rgb_features, tracklets, delta_t);
+}
+
+int32_t ZeroTermChistTracker::TrackObjects(const vas::ImagePlanes &frame, const std::vector<Detection> &detections,
+                                           std::vector<std::shared_ptr<Tracklet>> *tracklets, float delta_t) {
+    const cv::Size image_size(frame.width, frame.height);
+    std::vector<cv::Mat> d_rgb_features;
+    rgb_hist_.ComputeFromYuv(frame, input_image_format_, ClipDetections(detections, image_size), &d_rgb_features);
+    return TrackObjects(image_size, detections, d_rgb_features, tracklets, delta_t);
+}
+
+std::vector<cv::Rect> ZeroTermChistTracker::ClipDetections(const std::vector<Detection> &detections,
+                                                           const cv::Size &image_size) const {
+    const cv::Rect2f image_boundary(0.0f, 0.0f, static_cast<float>(image_size.width),
+                                    static_cast<float>(image_size.height));
+    std::vector<cv::Rect> rois;
+    rois.reserve(detections.size());
+    for (const auto &detection : detections)
+        rois.push_back(static_cast<cv::Rect>(detection.rect & image_boundary));
+    return rois;
+}
+
+int32_t ZeroTermChistTracker::TrackObjects(const cv::Size &image_size, const std::vector<Detection> &detections,
+                                           const std::vector<cv::Mat> &d_rgb_features,
+                                           std::vector<std::shared_ptr<Tracklet>> *tracklets, float delta_t) {
+    PROF_START(PROF_COMPONENTS_OT_ZEROTERM_RUN_TRACKER);
+
+    int32_t input_img_width = image_size.width;
+    int32_t input_img_height = image_size.height;
 
     PROF_START(PROF_COMPONENTS_OT_ZEROTERM_KALMAN_PREDICTION);
     // Predict tracklets state
+    kalman_filters_.PredictAll(delta_t);
     for (auto &tracklet : tracklets_) {
         auto zttchist_tracklet = std::dynamic_pointer_cast<ZeroTermChistTracklet>(tracklet);
-        cv::Rect2f predicted_rect = zttchist_tracklet->kalman_filter->Predict(delta_t);
+        cv::Rect2f predicted_rect = kalman_filters_.GetPredicted(zttchist_tracklet->kalman_filter);
         zttchist_tracklet->predicted = predicted_rect;
         zttchist_tracklet->trajectory.push_back(predicted_rect);
         zttchist_tracklet->trajectory_filtered.push_back(predicted_rect);
@@ -78,31 +125,7 @@ int32_t ZeroTermChistTracker::TrackObjects(const cv::Mat &mat, const std::vector
     std::vector<bool> d_is_associated(n_detections, false);
     std::vector<int32_t> t_associated_d_index(n_tracklets, -1);
 
-    std::vector<cv::Mat> d_rgb_features;
-
     if (detections.size() > 0) {
-        // Compute RGB features for new detections
-        for (const auto &detection : detections) {
-            cv::Mat rgb_feature;
-            if (input_image_format_ == vas::ColorFormat::NV12) {
-                YuvImage img(mat, YuvImage::FMT_NV12, frame_count_);
-                rgb_hist_.ComputeFromNv12(img, detection.rect & image_boundary,
-                                          &rgb_feature); // YuvImage container to feature
-            } else if (input_image_format_ == vas::ColorFormat::BGR) {
-                cv::Mat roi_patch = mat(detection.rect & image_boundary);
-                rgb_hist_.Compute(roi_patch, &rgb_feature);
-            } else if (input_image_format_ == vas::ColorFormat::BGRX) {
-                cv::Mat roi_patch = mat(detection.rect & image_boundary);
-                rgb_hist_.ComputeFromBgra32(roi_patch, &rgb_feature);
-            } else if (input_image_format_ == vas::ColorFormat::I420) {
-                YuvImage img(mat, YuvImage::FMT_I420, frame_count_);
-                rgb_hist_.ComputeFromI420(img, detection.rect & image_boundary,
-                                          &rgb_feature); // YuvImage container to feature
-            }
-
-            d_rgb_features.push_back(rgb_feature);
-        }
-
         auto result = associator_.Associate(detections, tracklets_, &d_rgb_features);
         d_is_associated = result.first;
         t_associated_d_index = result.second;
@@ -131,7 +154,7 @@ int32_t ZeroTermChistTracker::TrackObjects(const cv::Mat &mat, const std::vector
             if (zttchist_tracklet->status == ST_NEW) {
                 zttchist_tracklet->trajectory.back() = d_bounding_box;
                 zttchist_tracklet->trajectory_filtered.back() =
-                    zttchist_tracklet->kalman_filter->Correct(zttchist_tracklet->trajectory.back());
+                    kalman_filters_.Correct(zttchist_tracklet->kalman_filter, zttchist_tracklet->trajectory.back());
                 zttchist_tracklet->birth_count += 1;
                 if (zttchist_tracklet->birth_count >= kMinBirthCount) {
                     zttchist_tracklet->status = ST_TRACKED;
@@ -139,10 +162,10 @@ int32_t ZeroTermChistTracker::TrackObjects(const cv::Mat &mat, const std::vector
             } else if (zttchist_tracklet->status == ST_TRACKED) {
                 zttchist_tracklet->trajectory.back() = d_bounding_box;
                 zttchist_tracklet->trajectory_filtered.back() =
-                    zttchist_tracklet->kalman_filter->Correct(zttchist_tracklet->trajectory.back());
+                    kalman_filters_.Correct(zttchist_tracklet->kalman_filter, zttchist_tracklet->trajectory.back());
             } else if (zttchist_tracklet->status == ST_LOST) {
                 zttchist_tracklet->RenewTrajectory(d_bounding_box);
-                zttchist_tracklet->kalman_filter = std::make_unique<KalmanFilterNoOpencv>(d_bounding_box);
+                kalman_filters_.Reset(zttchist_tracklet->kalman_filter, d_bounding_box);
                 zttchist_tracklet->status = ST_TRACKED;
             }
         } else {
@@ -205,7 +228,7 @@ int32_t ZeroTermChistTracker::TrackObjects(const cv::Mat &mat, const std::vector
 
             const cv::Rect2f &bounding_box = detections[d].rect;
             tracklet->InitTrajectory(bounding_box);
-            tracklet->kalman_filter = std::make_unique<KalmanFilterNoOpencv>(bounding_box);
+            tracklet->kalman_filter = kalman_filters_.Add(bounding_box);
             tracklet->rgb_features.push_back(d_rgb_features[d]);
 
             tracklets_.push_back(std::move(tracklet));
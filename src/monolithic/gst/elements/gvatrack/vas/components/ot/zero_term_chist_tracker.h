@@ -23,12 +23,18 @@ class ZeroTermChistTracker : public Tracker {
 
     virtual int32_t TrackObjects(const cv::Mat &mat, const std::vector<Detection> &detections,
                                  std::vector<std::shared_ptr<Tracklet>> *tracklets, float delta_t);
+    virtual int32_t TrackObjects(const vas::ImagePlanes &frame, const std::vector<Detection> &detections,
+                                 std::vector<std::shared_ptr<Tracklet>> *tracklets, float delta_t);
 
     ZeroTermChistTracker() = delete;
     ZeroTermChistTracker(const ZeroTermChistTracker &) = delete;
     ZeroTermChistTracker &operator=(const ZeroTermChistTracker &) = delete;
 
   private:
+    int32_t TrackObjects(const cv::Size &image_size, const std::vector<Detection> &detections,
+                         const std::vector<cv::Mat> &d_rgb_features, std::vector<std::shared_ptr<Tracklet>> *tracklets,
+                         float delta_t);
+    std::vector<cv::Rect> ClipDetections(const std::vector<Detection> &detections, const cv::Size &image_size) const;
     void TrimTrajectories();
 
   private:
@@ -49,9 +49,10 @@ int32_t ZeroTermImagelessTracker::TrackObjects(const cv::Mat &mat, const std::ve
 
     PROF_START(PROF_COMPONENTS_OT_ZEROTERM_KALMAN_PREDICTION);
     // Predict tracklets state
+    kalman_filters_.PredictAll(delta_t);
     for (auto &tracklet : tracklets_) {
         auto zttimgless_tracklet = std::dynamic_pointer_cast<ZeroTermImagelessTracklet>(tracklet);
-        cv::Rect2f predicted_rect = zttimgless_tracklet->kalman_filter->Predict(delta_t);
+        cv::Rect2f predicted_rect = kalman_filters_.GetPredicted(zttimgless_tracklet->kalman_filter);
         zttimgless_tracklet->predicted = predicted_rect;
         zttimgless_tracklet->trajectory.push_back(predicted_rect);
         zttimgless_tracklet->trajectory_filtered.push_back(predicted_rect);
@@ -100,7 +101,7 @@ int32_t ZeroTermImagelessTracker::TrackObjects(const cv::Mat &mat, const std::ve
             if (zttimgless_tracklet->status == ST_NEW) {
                 zttimgless_tracklet->trajectory.back() = d_bounding_box;
                 zttimgless_tracklet->trajectory_filtered.back() =
-                    zttimgless_tracklet->kalman_filter->Correct(zttimgless_tracklet->trajectory.back());
+                    kalman_filters_.Correct(zttimgless_tracklet->kalman_filter, zttimgless_tracklet->trajectory.back());
                 zttimgless_tracklet->birth_count += 1;
                 if (zttimgless_tracklet->birth_count >= kMinBirthCount) {
                     zttimgless_tracklet->status = ST_TRACKED;
@@ -108,9 +109,9 @@ int32_t ZeroTermImagelessTracker::TrackObjects(const cv::Mat &mat, const std::ve
             } else if (zttimgless_tracklet->status == ST_TRACKED) {
                 zttimgless_tracklet->trajectory.back() = d_bounding_box;
                 zttimgless_tracklet->trajectory_filtered.back() =
-                    zttimgless_tracklet->kalman_filter->Correct(zttimgless_tracklet->trajectory.back());
+                    kalman_filters_.Correct(zttimgless_tracklet->kalman_filter, zttimgless_tracklet->trajectory.back());
             } else if (zttimgless_tracklet->status == ST_LOST) {
-                zttimgless_tracklet->RenewTrajectory(d_bounding_box);
+                RenewTrackletWithMotion(zttimgless_tracklet.get(), d_bounding_box);
                 zttimgless_tracklet->status = ST_TRACKED;
             }
         } else {
@@ -149,7 +150,7 @@ int32_t ZeroTermImagelessTracker::TrackObjects(const cv::Mat &mat, const std::ve
 
             const cv::Rect2f &bounding_box = detections[d].rect & image_boundary;
             tracklet->InitTrajectory(bounding_box);
-            tracklet->kalman_filter = std::make_unique<KalmanFilterNoOpencv>(bounding_box);
+            tracklet->kalman_filter = kalman_filters_.Add(bounding_box);
             tracklets_.push_back(std::move(tracklet));
         }
     }
@@ -294,6 +294,20 @@ class ObjectTracker {
     VAS_EXPORT std::vector<Object>
     Track(const cv::Mat &frame, const std::vector<DetectedObject> &detected_objects = std::vector<DetectedObject>());
 
+    /**
+     * Tracks objects with NV12 or I420 video frames given by planes.
+     * It behaves as Track() with cv::Mat input, but planes need not be contiguous, so mapped video surfaces are used
+     * without copying. Color histogram tracking reads only the pixels sampled from detected objects.
+     *
+     * @param[in] frame Planes of input frame.
+     * @param[in] detected_objects Detected objects in the input frame. Default value is an empty vector.
+     * @return Information of tracked objects.
+     * @exception std::invalid_argument Input frame is invalid or input color format is not NV12 or I420.
+     */
+    VAS_EXPORT std::vector<Object>
+    Track(const vas::ImagePlanes &frame,
+          const std::vector<DetectedObject> &detected_objects = std::vector<DetectedObject>());
+
     /**
      * This function is to set a parameter indicating 'delta time' between now and last call to Track() in seconds.
      * The default value of the delta time is 0.033f which is tuned for 30 fps video frame rate.
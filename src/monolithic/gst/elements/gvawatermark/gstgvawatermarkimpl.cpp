@@ -38,6 +38,7 @@
 #include "renderer/color_converter.h"
 #include "renderer/cpu/create_renderer.h"
 
+#include <algorithm>
 #include <array>
 #include <exception>
 #include <optional>
@@ -60,6 +61,7 @@ GST_DEBUG_CATEGORY_STATIC(gst_gva_watermark_impl_debug_category);
 
 #define DEFAULT_DEVICE nullptr
 #define DEFAULT_THICKNESS (2)
+#define DEFAULT_DRAW_THREADS (1)
 #define DEFAULT_TEXT_SCALE (0.5)
 #define DEFAULT_COLOR_IDX (-1)
 
@@ -193,6 +195,7 @@ struct Impl {
         bool draw_text_background = true;
         int color_idx = DEFAULT_COLOR_IDX;
         uint thickness = DEFAULT_THICKNESS;
+        int draw_threads = DEFAULT_DRAW_THREADS;
         int font_type = cv::FONT_HERSHEY_TRIPLEX;
         double font_scale = DEFAULT_TEXT_SCALE;
         std::optional<std::unordered_set<std::string>> include_labels_filter;
@@ -755,6 +758,7 @@ Impl::Impl(GstVideoInfo *info, InferenceBackend::MemoryType mem_type, GstElement
         _renderer->enable_draw_txt_bg(true);
         _renderer_opencv->enable_draw_txt_bg(true);
     }
+    _renderer->set_draw_threads(_displCfg.draw_threads);
 }
 
 size_t get_keypoint_index_by_name(const gchar *target_name, GValueArray *names) {
@@ -1009,7 +1013,15 @@ void Impl::preparePrimsForTensor(const GVA::Tensor &tensor, GVA::Rect<double> re
     }
 
     if (tensor.format() == "segmentation_mask") {
-        std::vector<float> mask = tensor.data<float>();
+        std::vector<float> mask;
+        if (tensor.precision() == GVA::Tensor::Precision::U8) {
+            // probabilities scaled to [0, 255]
+            const std::vector<uint8_t> mask_u8 = tensor.data<uint8_t>();
+            mask.resize(mask_u8.size());
+            std::transform(mask_u8.begin(), mask_u8.end(), mask.begin(), [](uint8_t value) { return value / 255.f; });
+        } else {
+            mask = tensor.data<float>();
+        }
         std::vector<guint> dims = tensor.dims();
         assert(dims.size() == 2);
         const cv::Size &mask_size{int(dims[0]), int(dims[1])};
@@ -1232,6 +1244,16 @@ void Impl::parse_displ_config() {
             }
             cfg.erase(iter);
         }
+        if (iter = cfg.find("draw-threads"); iter != cfg.end()) {
+            const int draw_threads = std::stoi(iter->second);
+            if (draw_threads < 1) {
+                GST_WARNING("[gvawatermarkimpl] 'draw-threads' parameter value must be positive, using default %d",
+                            DEFAULT_DRAW_THREADS);
+            } else {
+                _displCfg.draw_threads = draw_threads;
+            }
+            cfg.erase(iter);
+        }
         if (iter = cfg.find("color-idx"); iter != cfg.end()) {
             int _color_idx = std::stoi(iter->second);
             if (_color_idx >= COLOR_IDX_RED && _color_idx <= COLOR_IDX_BLUE) {
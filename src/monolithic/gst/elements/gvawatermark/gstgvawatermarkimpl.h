@@ -86,6 +86,7 @@ enum { PROP_0, PROP_DEVICE, PROP_OBB, PROP_DISPL_AVGFPS, PROP_DISPL_CFG };
     "default empty\n"                                                                                                  \
     "\t\t\thide-roi=<string> colon-separated list of labels to exclude (these objects will be hidden), default "       \
     "empty\n"                                                                                                          \
+    "\t\t\tdraw-threads=<uint> number of threads drawing horizontal tiles of a frame on CPU, default 1\n"              \
     "\t\t\te.g.: displ-cfg=show-labels=false\n"                                                                        \
     "\t\t\te.g.: displ-cfg=font-scale=0.5,thickness=3,color-idx=2,font-type=simplex\n"                                 \
     "\t\t\te.g.: displ-cfg=show-labels=true,show-roi=person:car:truck\n"                                               \
@@ -0,0 +1,114 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "label_atlas.h"
+
+#include <opencv2/imgproc.hpp>
+
+#include <algorithm>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(_WIN32)
+#define LABEL_ATLAS_MULTIVERSION __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define LABEL_ATLAS_MULTIVERSION
+#endif
+
+namespace {
+
+// Same as thickness of lines on U and V planes of RendererYUV
+int chroma_thickness(int thick) {
+    if (thick <= 1)
+        return thick;
+    return thick / 2;
+}
+
+TextMask rasterize(const std::string &text, int fonttype, double fontscale, int thick) {
+    int baseline = 0;
+    const cv::Size size = cv::getTextSize(text, fonttype, fontscale, thick, &baseline);
+    // Glyphs such as brackets, accents or italic letters go out of the text box by a fraction of the line height, so
+    // text is drawn with a margin of the whole line height and the mask is cropped to the drawn pixels
+    const int line_height = size.height + baseline;
+    for (int margin = line_height + std::max(thick, 1);; margin *= 2) {
+        const cv::Point origin(margin, margin + size.height);
+        cv::Mat canvas = cv::Mat::zeros(line_height + 2 * margin, size.width + 2 * margin, CV_8UC1);
+        cv::putText(canvas, text, origin, fonttype, fontscale, cv::Scalar(255), thick);
+
+        const cv::Rect ink = cv::boundingRect(canvas);
+        if (ink.empty())
+            return {}; // e.g. text of spaces
+        if (ink.x == 0 || ink.y == 0 || ink.br().x == canvas.cols || ink.br().y == canvas.rows)
+            continue;
+        TextMask mask;
+        mask.alpha = canvas(ink).clone();
+        mask.offset = ink.tl() - origin;
+        return mask;
+    }
+}
+
+std::string label_key(const render::Text &text) {
+    std::string key;
+    key.reserve(text.text.size() + sizeof(text.fontscale) + 2 * sizeof(int));
+    key.append(reinterpret_cast<const char *>(&text.fonttype), sizeof(text.fonttype));
+    key.append(reinterpret_cast<const char *>(&text.fontscale), sizeof(text.fontscale));
+    key.append(reinterpret_cast<const char *>(&text.thick), sizeof(text.thick));
+    key.append(text.text);
+    return key;
+}
+
+// dst = (dst * (255 - alpha) + color * alpha) / 255, rounded
+LABEL_ATLAS_MULTIVERSION
+void blend_row(uint8_t *__restrict dst, const uint8_t *__restrict alpha, int size, uint8_t color) {
+    for (int x = 0; x < size; ++x) {
+        const uint32_t a = alpha[x];
+        dst[x] = static_cast<uint8_t>((dst[x] * (255 - a) + color * a + 127) / 255);
+    }
+}
+
+// Same for interleaved two channel plane, e.g. UV plane of NV12 image
+LABEL_ATLAS_MULTIVERSION
+void blend_row_2ch(uint8_t *__restrict dst, const uint8_t *__restrict alpha, int size, uint8_t color0,
+                   uint8_t color1) {
+    for (int x = 0; x < size; ++x) {
+        const uint32_t a = alpha[x];
+        dst[2 * x] = static_cast<uint8_t>((dst[2 * x] * (255 - a) + color0 * a + 127) / 255);
+        dst[2 * x + 1] = static_cast<uint8_t>((dst[2 * x + 1] * (255 - a) + color1 * a + 127) / 255);
+    }
+}
+
+} // namespace
+
+std::shared_ptr<const RasterizedLabel> LabelAtlas::get(const render::Text &text) {
+    const std::string key = label_key(text);
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (auto *label = _labels.find(key))
+        return *label;
+
+    auto label = std::make_shared<RasterizedLabel>();
+    label->text_size = cv::getTextSize(text.text, text.fonttype, text.fontscale, text.thick, &label->baseline);
+    label->luma = rasterize(text.text, text.fonttype, text.fontscale, text.thick);
+    label->chroma = rasterize(text.text, text.fonttype, text.fontscale / 2.0, chroma_thickness(text.thick));
+    _labels.put(key, label);
+    return label;
+}
+
+void blend_mask(cv::Mat &plane, const TextMask &mask, cv::Point origin, const cv::Scalar &color) {
+    const cv::Rect mask_rect(origin + mask.offset, mask.alpha.size());
+    const cv::Rect dst_rect = mask_rect & cv::Rect(0, 0, plane.cols, plane.rows);
+    if (dst_rect.empty())
+        return;
+
+    const cv::Point src_tl = dst_rect.tl() - mask_rect.tl();
+    const uint8_t color0 = cv::saturate_cast<uint8_t>(color[0]);
+    const uint8_t color1 = cv::saturate_cast<uint8_t>(color[1]);
+    for (int y = 0; y < dst_rect.height; ++y) {
+        const uint8_t *alpha = mask.alpha.ptr<uint8_t>(src_tl.y + y) + src_tl.x;
+        uint8_t *dst = plane.ptr<uint8_t>(dst_rect.y + y) + dst_rect.x * plane.channels();
+        if (plane.channels() == 2)
+            blend_row_2ch(dst, alpha, dst_rect.width, color0, color1);
+        else
+            blend_row(dst, alpha, dst_rect.width, color0);
+    }
+}
@@ -0,0 +1,59 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include "lru_cache.h"
+#include "render_prim.h"
+
+#include <opencv2/core.hpp>
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+/**
+ * Binary alpha mask of text rasterized by cv::putText, cropped to drawn pixels. Mask top-left corner is at text origin
+ * + offset, the mask is empty if nothing is drawn.
+ */
+struct TextMask {
+    cv::Mat alpha;
+    cv::Point offset;
+};
+
+/**
+ * Text rasterized at luma and chroma resolution of YUV image together with its metrics at luma resolution
+ */
+struct RasterizedLabel {
+    TextMask luma;
+    TextMask chroma;
+    cv::Size text_size;
+    int baseline = 0;
+};
+
+/**
+ * Cache of rasterized labels keyed by string, font, scale and thickness. Hershey fonts are rasterized once per label,
+ * least recently used labels are evicted. Labels may be requested concurrently by tiles drawn in parallel.
+ */
+class LabelAtlas {
+  public:
+    static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+    explicit LabelAtlas(size_t capacity = DEFAULT_CAPACITY) : _labels(capacity) {
+    }
+
+    std::shared_ptr<const RasterizedLabel> get(const render::Text &text);
+
+  private:
+    std::mutex _mutex;
+    LRUCache<std::string, std::shared_ptr<const RasterizedLabel>> _labels;
+};
+
+/**
+ * Blends color into 1 or 2 channel 8-bit plane through mask of text drawn at origin, mask is clipped by plane. Pixels
+ * of 255 alpha get the color exactly, as if text was drawn by cv::putText.
+ */
+void blend_mask(cv::Mat &plane, const TextMask &mask, cv::Point origin, const cv::Scalar &color);
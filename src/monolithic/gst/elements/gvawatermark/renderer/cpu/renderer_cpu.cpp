@@ -10,6 +10,9 @@
 #include <inference_backend/buffer_mapper.h>
 #include <opencv2/opencv.hpp>
 
+#include <algorithm>
+#include <iterator>
+
 namespace {
 
 const std::vector<cv::Vec3b> PascalVoc21ClColorPalette = {
@@ -57,6 +60,63 @@ cv::Point2i calc_point_for_u_v_planes(cv::Point2i pt) {
     return pt / 2;
 }
 
+constexpr int MIN_TILE_HEIGHT = 64;
+
+int align_up(int value, int alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+cv::Rect expand(const cv::Rect &rect, int thick) {
+    // One more pixel for rectangles drawn twice on Y plane and rounding of chroma coordinates
+    const int margin = std::max(thick, 1) + 2;
+    return cv::Rect(rect.x - margin, rect.y - margin, rect.width + 2 * margin + 1, rect.height + 2 * margin + 1);
+}
+
+// Primitive box is within one tile, boxes above the image are in the first tile
+bool within_tile(const cv::Rect &box, int tile_height) {
+    const int top = std::max(box.y, 0);
+    const int bottom = std::max(box.y + box.height, 1);
+    return top / tile_height == (bottom - 1) / tile_height;
+}
+
+bool is_mask(const render::Prim &p) {
+    return std::holds_alternative<render::InstanceSegmantationMask>(p) ||
+           std::holds_alternative<render::SemanticSegmantationMask>(p);
+}
+
+// Thin slanted lines are clipped to the image before rasterization, so a clipped part may shift by a pixel
+bool has_slanted_lines(const render::Prim &p) {
+    if (std::holds_alternative<render::Line>(p)) {
+        const auto &line = std::get<render::Line>(p);
+        return line.pt1.x != line.pt2.x && line.pt1.y != line.pt2.y;
+    }
+    if (std::holds_alternative<render::Rect>(p))
+        return std::get<render::Rect>(p).rotation != 0.0;
+    return false;
+}
+
+render::Prim shifted(const render::Prim &p, cv::Point shift) {
+    if (std::holds_alternative<render::Line>(p)) {
+        render::Line line = std::get<render::Line>(p);
+        line.pt1 += shift;
+        line.pt2 += shift;
+        return line;
+    } else if (std::holds_alternative<render::Rect>(p)) {
+        render::Rect rect = std::get<render::Rect>(p);
+        rect.rect += shift;
+        return rect;
+    } else if (std::holds_alternative<render::Circle>(p)) {
+        render::Circle circle = std::get<render::Circle>(p);
+        circle.center += shift;
+        return circle;
+    } else if (std::holds_alternative<render::Text>(p)) {
+        render::Text text = std::get<render::Text>(p);
+        text.org += shift;
+        return text;
+    }
+    return p;
+}
+
 } // namespace
 
 template <typename T>
@@ -94,23 +154,118 @@ void RendererCPU::DrawRotatedRectangle(cv::InputOutputArray img, cv::Point pt1,
 }
 
 void RendererYUV::draw_backend(std::vector<cv::Mat> &image_planes, std::vector<render::Prim> &prims) {
-    for (auto &p : prims) {
-        if (std::holds_alternative<render::Line>(p)) {
-            draw_line(image_planes, std::get<render::Line>(p));
-        } else if (std::holds_alternative<render::Rect>(p)) {
-            draw_rectangle(image_planes, std::get<render::Rect>(p));
-        } else if (std::holds_alternative<render::Circle>(p)) {
-            draw_circle(image_planes, std::get<render::Circle>(p));
-        } else if (std::holds_alternative<render::Text>(p)) {
-            if (draw_txt_bg)
-                draw_text_bg(image_planes, std::get<render::Text>(p));
-            draw_text(image_planes, std::get<render::Text>(p));
-        } else if (std::holds_alternative<render::InstanceSegmantationMask>(p)) {
-            draw_instance_mask(image_planes, std::get<render::InstanceSegmantationMask>(p));
-        } else if (std::holds_alternative<render::SemanticSegmantationMask>(p)) {
-            draw_semantic_mask(image_planes, std::get<render::SemanticSegmantationMask>(p));
+    const int height = image_planes[0].rows;
+    const int tiles_num = std::min(draw_threads, height / MIN_TILE_HEIGHT);
+    if (tiles_num <= 1 || prims.size() < 2) {
+        for (const auto &p : prims)
+            draw_prim(image_planes, p);
+        return;
+    }
+    // Multiple of 4 keeps rounding of halved chroma coordinates of shifted primitives
+    const int tile_height = align_up((height + tiles_num - 1) / tiles_num, 4);
+
+    // Masks and slanted lines crossing tile border are drawn on whole image between tiled runs of other primitives
+    auto run_begin = prims.cbegin();
+    for (auto it = prims.cbegin(); it != prims.cend(); ++it) {
+        if (is_tiled(*it, tile_height))
+            continue;
+        draw_tiles(image_planes, run_begin, it, tile_height);
+        draw_prim(image_planes, *it);
+        run_begin = std::next(it);
+    }
+    draw_tiles(image_planes, run_begin, prims.cend(), tile_height);
+}
+
+void RendererYUV::draw_prim(std::vector<cv::Mat> &image_planes, const render::Prim &p) {
+    if (std::holds_alternative<render::Line>(p)) {
+        draw_line(image_planes, std::get<render::Line>(p));
+    } else if (std::holds_alternative<render::Rect>(p)) {
+        draw_rectangle(image_planes, std::get<render::Rect>(p));
+    } else if (std::holds_alternative<render::Circle>(p)) {
+        draw_circle(image_planes, std::get<render::Circle>(p));
+    } else if (std::holds_alternative<render::Text>(p)) {
+        if (draw_txt_bg)
+            draw_text_bg(image_planes, std::get<render::Text>(p));
+        draw_text(image_planes, std::get<render::Text>(p));
+    } else if (std::holds_alternative<render::InstanceSegmantationMask>(p)) {
+        draw_instance_mask(image_planes, std::get<render::InstanceSegmantationMask>(p));
+    } else if (std::holds_alternative<render::SemanticSegmantationMask>(p)) {
+        draw_semantic_mask(image_planes, std::get<render::SemanticSegmantationMask>(p));
+    }
+}
+
+void RendererYUV::draw_tiles(std::vector<cv::Mat> &image_planes, std::vector<render::Prim>::const_iterator first,
+                             std::vector<render::Prim>::const_iterator last, int tile_height) {
+    if (first == last)
+        return;
+    const int height = image_planes[0].rows;
+    const int tiles_num = (height + tile_height - 1) / tile_height;
+
+    // Bin primitives by bounding box, a primitive crossing tile border is drawn clipped in each tile
+    std::vector<std::vector<const render::Prim *>> tiles(tiles_num);
+    for (auto it = first; it != last; ++it) {
+        const cv::Rect box = bounding_box(*it);
+        const int top = std::max(box.y, 0);
+        const int bottom = std::min(box.y + box.height, height);
+        for (int t = top / tile_height; top < bottom && t <= (bottom - 1) / tile_height; ++t)
+            tiles[t].push_back(&*it);
+    }
+
+    cv::parallel_for_(cv::Range(0, tiles_num), [&](const cv::Range &range) {
+        for (int t = range.start; t < range.end; ++t) {
+            if (tiles[t].empty())
+                continue;
+            // Y and chroma rows of the tile are drawn together
+            const int y0 = t * tile_height;
+            const int y1 = std::min(y0 + tile_height, height);
+            std::vector<cv::Mat> tile_planes;
+            tile_planes.reserve(image_planes.size());
+            tile_planes.push_back(image_planes[0].rowRange(y0, y1));
+            for (size_t i = 1; i < image_planes.size(); ++i) {
+                const int rows = image_planes[i].rows;
+                tile_planes.push_back(image_planes[i].rowRange(y0 / 2, y1 == height ? rows : y1 / 2));
+            }
+            for (const render::Prim *p : tiles[t])
+                draw_prim(tile_planes, shifted(*p, cv::Point(0, -y0)));
         }
+    });
+}
+
+bool RendererYUV::is_tiled(const render::Prim &p, int tile_height) {
+    if (is_mask(p))
+        return false;
+    if (!has_slanted_lines(p))
+        return true;
+    return within_tile(bounding_box(p), tile_height);
+}
+
+cv::Rect RendererYUV::bounding_box(const render::Prim &p) {
+    if (std::holds_alternative<render::Line>(p)) {
+        const auto &line = std::get<render::Line>(p);
+        return expand(cv::Rect(line.pt1, line.pt2), line.thick);
+    } else if (std::holds_alternative<render::Rect>(p)) {
+        const auto &rect = std::get<render::Rect>(p);
+        cv::Rect box = rect.rect;
+        if (rect.rotation != 0.0)
+            box = cv::RotatedRect((rect.rect.tl() + rect.rect.br()) / 2, rect.rect.size(), rect.rotation * 180 / CV_PI)
+                      .boundingRect();
+        return expand(box, rect.thick);
+    } else if (std::holds_alternative<render::Circle>(p)) {
+        const auto &circle = std::get<render::Circle>(p);
+        const cv::Point radius(circle.radius, circle.radius);
+        return expand(cv::Rect(circle.center - radius, circle.center + radius), circle.thick);
+    } else if (std::holds_alternative<render::Text>(p)) {
+        const auto &text = std::get<render::Text>(p);
+        auto label = _label_atlas.get(text);
+        // Masks are cropped to glyphs, background rectangle reaches cap height and descent of the font
+        const cv::Point chroma_org = calc_point_for_u_v_planes(text.org);
+        const cv::Rect chroma_box((chroma_org + label->chroma.offset) * 2, label->chroma.alpha.size() * 2);
+        const cv::Rect background(cv::Point(text.org.x, text.org.y - label->text_size.height),
+                                  cv::Point(text.org.x + label->text_size.width, text.org.y + label->baseline));
+        return expand(cv::Rect(text.org + label->luma.offset, label->luma.alpha.size()) | chroma_box | background, 1);
     }
+    // Masks are not tiled
+    return cv::Rect();
 }
 
 void RendererYUV::draw_rect_y_plane(cv::Mat &y, cv::Point2i pt1, cv::Point2i pt2, double rotation, double color,
@@ -174,11 +329,11 @@ void RendererI420::draw_text(std::vector<cv::Mat> &mats, render::Text text) {
     cv::Scalar color =
         draw_txt_bg ? cv::Scalar(255, 128, 128) : cv::Scalar(text.color[0], text.color[1], text.color[2]);
 
-    cv::putText(y, text.text, text.org, text.fonttype, text.fontscale, color[0], text.thick);
+    auto label = _label_atlas.get(text);
+    blend_mask(y, label->luma, text.org, color[0]);
     cv::Point2i pos_u_v(calc_point_for_u_v_planes(text.org));
-    int thick = calc_thick_for_u_v_planes(text.thick);
-    cv::putText(u, text.text, pos_u_v, text.fonttype, text.fontscale / 2.0, color[1], thick);
-    cv::putText(v, text.text, pos_u_v, text.fonttype, text.fontscale / 2.0, color[2], thick);
+    blend_mask(u, label->chroma, pos_u_v, color[1]);
+    blend_mask(v, label->chroma, pos_u_v, color[2]);
 }
 
 void RendererI420::draw_text_bg(std::vector<cv::Mat> &mats, render::Text text) {
@@ -188,12 +343,11 @@ void RendererI420::draw_text_bg(std::vector<cv::Mat> &mats, render::Text text) {
     cv::Mat &v = mats[2];
 
     // Get text size to calculate background rectangle
-    int baseline = 0;
-    cv::Size textSize = cv::getTextSize(text.text, text.fonttype, text.fontscale, text.thick, &baseline);
+    auto label = _label_atlas.get(text);
 
     // Define background rectangle on Y plane
-    cv::Point bg_tl(text.org.x, text.org.y - textSize.height);
-    cv::Point bg_br(text.org.x + textSize.width, text.org.y + baseline);
+    cv::Point bg_tl(text.org.x, text.org.y - label->text_size.height);
+    cv::Point bg_br(text.org.x + label->text_size.width, text.org.y + label->baseline);
 
     // Draw background on Y plane (use original text,rectangle color for background)
     cv::rectangle(y, bg_tl, bg_br, text.color[0], cv::FILLED);
@@ -268,10 +422,10 @@ void RendererNV12::draw_text(std::vector<cv::Mat> &mats, render::Text text) {
     cv::Scalar color =
         draw_txt_bg ? cv::Scalar(255, 128, 128) : cv::Scalar(text.color[0], text.color[1], text.color[2]);
 
-    cv::putText(y, text.text, text.org, text.fonttype, text.fontscale, color[0], text.thick);
+    auto label = _label_atlas.get(text);
+    blend_mask(y, label->luma, text.org, color[0]);
     cv::Point2i pos_u_v(calc_point_for_u_v_planes(text.org));
-    cv::putText(u_v, text.text, pos_u_v, text.fonttype, text.fontscale / 2.0, {color[1], color[2]},
-                calc_thick_for_u_v_planes(text.thick));
+    blend_mask(u_v, label->chroma, pos_u_v, {color[1], color[2]});
 }
 
 void RendererNV12::draw_text_bg(std::vector<cv::Mat> &mats, render::Text text) {
@@ -280,12 +434,11 @@ void RendererNV12::draw_text_bg(std::vector<cv::Mat> &mats, render::Text text) {
     cv::Mat &u_v = mats[1];
 
     // Get text size to calculate background rectangle
-    int baseline = 0;
-    cv::Size textSize = cv::getTextSize(text.text, text.fonttype, text.fontscale, text.thick, &baseline);
+    auto label = _label_atlas.get(text);
 
     // Define background rectangle on Y plane
-    cv::Point bg_tl(text.org.x, text.org.y - textSize.height);
-    cv::Point bg_br(text.org.x + textSize.width, text.org.y + baseline);
+    cv::Point bg_tl(text.org.x, text.org.y - label->text_size.height);
+    cv::Point bg_br(text.org.x + label->text_size.width, text.org.y + label->baseline);
 
     // Draw background on Y plane (use original text,rectangle color for background)
     cv::rectangle(y, bg_tl, bg_br, text.color[0], cv::FILLED);
@@ -404,6 +557,12 @@ void RendererBGR::draw_line(std::vector<cv::Mat> &mats, render::Line line) {
     cv::line(mats[0], line.pt1, line.pt2, line.color, line.thick);
 }
 
+bool RendererBGR::is_tiled(const render::Prim &p, int tile_height) {
+    if (std::holds_alternative<render::Text>(p))
+        return within_tile(bounding_box(p), tile_height);
+    return RendererYUV::is_tiled(p, tile_height);
+}
+
 void RendererBGR::draw_instance_mask(std::vector<cv::Mat> &mats, render::InstanceSegmantationMask mask) {
     cv::Mat unpadded{mask.size, CV_32F, mask.data.data()};
     cv::Mat raw_cls_mask;
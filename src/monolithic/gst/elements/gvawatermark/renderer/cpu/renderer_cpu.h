@@ -8,6 +8,7 @@
 
 #include "dlstreamer/base/memory_mapper.h"
 #include "iostream"
+#include "label_atlas.h"
 #include "renderer.h"
 
 class RendererCPU : public Renderer {
@@ -43,6 +44,18 @@ class RendererYUV : public RendererCPU {
     virtual void draw_semantic_mask(std::vector<cv::Mat> &mats, render::SemanticSegmantationMask mask) = 0;
 
     void draw_rect_y_plane(cv::Mat &y, cv::Point2i pt1, cv::Point2i pt2, double rotation, double color, int thick);
+
+    void draw_prim(std::vector<cv::Mat> &mats, const render::Prim &prim);
+    // Draws primitives in horizontal tiles of image in parallel, primitives keep their order within a tile
+    void draw_tiles(std::vector<cv::Mat> &mats, std::vector<render::Prim>::const_iterator first,
+                    std::vector<render::Prim>::const_iterator last, int tile_height);
+    // Primitive is drawn in tiles if it renders the same when clipped to each tile it touches
+    virtual bool is_tiled(const render::Prim &prim, int tile_height);
+    // Area of luma plane which primitive may change
+    cv::Rect bounding_box(const render::Prim &prim);
+
+    // Labels are rasterized once and blended into planes
+    LabelAtlas _label_atlas;
 };
 
 class RendererI420 : public RendererYUV {
@@ -91,4 +104,7 @@ class RendererBGR : public RendererYUV {
     void draw_line(std::vector<cv::Mat> &mats, render::Line line) override;
     void draw_instance_mask(std::vector<cv::Mat> &mats, render::InstanceSegmantationMask mask) override;
     void draw_semantic_mask(std::vector<cv::Mat> &mats, render::SemanticSegmantationMask mask) override;
+
+    // cv::putText clips glyph lines to the image before rasterization, so text crossing tile border is drawn untiled
+    bool is_tiled(const render::Prim &prim, int tile_height) override;
 };
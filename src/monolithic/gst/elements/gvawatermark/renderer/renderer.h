@@ -22,6 +22,9 @@ class Renderer {
     void enable_draw_txt_bg(bool enable) {
         draw_txt_bg = enable;
     }
+    void set_draw_threads(int threads) {
+        draw_threads = threads;
+    }
     virtual ~Renderer() = default;
 
   protected:
@@ -36,6 +39,8 @@ class Renderer {
     virtual dlstreamer::FramePtr buffer_map(dlstreamer::FramePtr buffer) = 0;
 
     bool draw_txt_bg = false;
+    // Upper bound of threads drawing primitives of one frame
+    int draw_threads = 1;
 
   private:
     static int FourccToOpenCVMatType(int fourcc);
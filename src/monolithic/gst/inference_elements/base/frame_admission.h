@@ -0,0 +1,62 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+/**
+ * Admission of frames into reorder buffers of an inference instance. A frame waits while downstream of its stream is
+ * blocked or the instance holds max_frames_in_flight frames. With latency policy a frame not later than frames
+ * already queued is admitted over the limit, so frames are scheduled according to their presentation time.
+ */
+struct FrameAdmission {
+    size_t max_frames_in_flight = 0; // 0 - unlimited
+    bool latency_policy = false;
+
+    /**
+     * Returns limit of frames in flight: the configured one if set, otherwise with latency policy enough frames to
+     * fill all inference requests and one more, unlimited with throughput policy
+     */
+    static size_t MaxFramesInFlight(size_t configured, bool latency_policy, size_t nireq, size_t batch_size,
+                                    size_t inference_interval) {
+        if (configured)
+            return configured;
+        if (!latency_policy)
+            return 0;
+        return nireq * batch_size * inference_interval + 1;
+    }
+
+    /**
+     * @param latest_queued_pts returns the latest presentation time of queued frames, called only at the limit
+     */
+    template <typename LatestPts>
+    bool CanAdmit(bool downstream_blocked, size_t frames_in_flight, uint64_t pts, LatestPts latest_queued_pts) const {
+        if (downstream_blocked)
+            return false;
+        if (!max_frames_in_flight || frames_in_flight < max_frames_in_flight)
+            return true;
+        return latency_policy && !(pts > latest_queued_pts());
+    }
+};
+
+/**
+ * Waits on 'cv' with 'output_lock' until can_admit returns true. 'lock' is released while waiting and taken back
+ * before 'output_lock' to keep lock order, the condition is checked again once both are held.
+ */
+template <typename Predicate>
+void WaitForAdmission(std::unique_lock<std::mutex> &lock, std::unique_lock<std::mutex> &output_lock,
+                      std::condition_variable &cv, Predicate can_admit) {
+    while (!can_admit()) {
+        lock.unlock();
+        cv.wait(output_lock, can_admit);
+        output_lock.unlock();
+        lock.lock();
+        output_lock.lock();
+    }
+}
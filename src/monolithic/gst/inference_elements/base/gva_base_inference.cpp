@@ -48,6 +48,34 @@
 #define DEFAULT_MIN_BATCH_TIMEOUT -1
 #define DEFAULT_MAX_BATCH_TIMEOUT INT_MAX
 
+#define DEFAULT_MIN_MAX_BATCH_LATENCY 0
+#define DEFAULT_MAX_MAX_BATCH_LATENCY UINT_MAX
+#define DEFAULT_MAX_BATCH_LATENCY 0
+
+#define DEFAULT_PARTIAL_BATCH_POLICY "padded"
+
+#define DEFAULT_MODEL_CACHE_DIR nullptr
+
+#define DEFAULT_MIN_STREAM_WEIGHT 1
+#define DEFAULT_MAX_STREAM_WEIGHT 1024
+#define DEFAULT_STREAM_WEIGHT 1
+
+#define DEFAULT_MIN_STREAM_QUEUE_DEPTH 0
+#define DEFAULT_MAX_STREAM_QUEUE_DEPTH 1024
+#define DEFAULT_STREAM_QUEUE_DEPTH 0
+
+#define DEFAULT_MIN_MAX_FRAMES_IN_FLIGHT 0
+#define DEFAULT_MAX_MAX_FRAMES_IN_FLIGHT UINT_MAX
+#define DEFAULT_MAX_FRAMES_IN_FLIGHT 0
+
+#define DEFAULT_STAGE_TIMING FALSE
+
+#define DEFAULT_MIN_STAGE_TIMING_INTERVAL 1
+#define DEFAULT_MAX_STAGE_TIMING_INTERVAL UINT_MAX
+#define DEFAULT_STAGE_TIMING_INTERVAL 1000
+
+#define DEFAULT_STAGE_TRACE_FILE nullptr
+
 #define DEFAULT_MIN_RESHAPE_WIDTH 0
 #define DEFAULT_MAX_RESHAPE_WIDTH UINT_MAX
 #define DEFAULT_RESHAPE_WIDTH 0
@@ -95,12 +123,21 @@ enum {
     PROP_RESHAPE,
     PROP_BATCH_SIZE,
     PROP_BATCH_TIMEOUT,
+    PROP_MAX_BATCH_LATENCY,
+    PROP_PARTIAL_BATCH_POLICY,
+    PROP_MODEL_CACHE_DIR,
     PROP_RESHAPE_WIDTH,
     PROP_RESHAPE_HEIGHT,
     PROP_NO_BLOCK,
     PROP_NIREQ,
     PROP_MODEL_INSTANCE_ID,
     PROP_SCHEDULING_POLICY,
+    PROP_STREAM_WEIGHT,
+    PROP_STREAM_QUEUE_DEPTH,
+    PROP_MAX_FRAMES_IN_FLIGHT,
+    PROP_STAGE_TIMING,
+    PROP_STAGE_TIMING_INTERVAL,
+    PROP_STAGE_TRACE_FILE,
     PROP_PRE_PROC_BACKEND,
     PROP_MODEL_PROC,
     PROP_CPU_THROUGHPUT_STREAMS,
@@ -115,7 +152,8 @@ enum {
     PROP_CUSTOM_PREPROC_LIB,
     PROP_CUSTOM_POSTPROC_LIB,
     PROP_OV_EXTENSION_LIB,
-    PROP_SHARE_VADISPLAY_CTX
+    PROP_SHARE_VADISPLAY_CTX,
+    PROP_QUEUE_STATS
 };
 
 GType gst_gva_base_inference_get_inf_region(void) {
@@ -260,15 +298,66 @@ void gva_base_inference_class_init(GvaBaseInferenceClass *klass) {
                             "Scheduling policy across streams sharing same model instance: "
                             "throughput (select first incoming frame), "
                             "latency (select frames with earliest presentation time out of the streams sharing same "
-                            "model-instance-id; recommended batch-size less than or equal to the number of streams) ",
+                            "model-instance-id; recommended batch-size less than or equal to the number of streams), "
+                            "round-robin (queue frames per stream and submit them from a single scheduler thread in "
+                            "weighted round-robin order, see stream-weight and stream-queue-depth) ",
                             DEFAULT_SCHEDULING_POLICY, (GParamFlags)(param_flags)));
 
+    g_object_class_install_property(
+        gobject_class, PROP_STREAM_WEIGHT,
+        g_param_spec_uint("stream-weight", "Stream weight",
+                          "Number of frames taken from this stream's queue in one round when "
+                          "scheduling-policy=round-robin. Streams with higher weight get a larger share of "
+                          "each batch.",
+                          DEFAULT_MIN_STREAM_WEIGHT, DEFAULT_MAX_STREAM_WEIGHT, DEFAULT_STREAM_WEIGHT, param_flags));
+
+    g_object_class_install_property(
+        gobject_class, PROP_STREAM_QUEUE_DEPTH,
+        g_param_spec_uint("stream-queue-depth", "Stream queue depth",
+                          "Maximum number of frames queued per stream when scheduling-policy=round-robin. "
+                          "A stream exceeding it blocks without affecting other streams. "
+                          "If set to 0, nireq * batch-size is used.",
+                          DEFAULT_MIN_STREAM_QUEUE_DEPTH, DEFAULT_MAX_STREAM_QUEUE_DEPTH, DEFAULT_STREAM_QUEUE_DEPTH,
+                          param_flags));
+
+    g_object_class_install_property(
+        gobject_class, PROP_MAX_FRAMES_IN_FLIGHT,
+        g_param_spec_uint("max-frames-in-flight", "Max frames in flight",
+                          "Maximum number of frames queued for inference across all streams sharing the same "
+                          "model-instance-id. New frames wait for admission until earlier frames are pushed "
+                          "downstream. If set to 0, frames are not limited with scheduling-policy=throughput and "
+                          "limited to nireq * batch-size * inference-interval with scheduling-policy=latency.",
+                          DEFAULT_MIN_MAX_FRAMES_IN_FLIGHT, DEFAULT_MAX_MAX_FRAMES_IN_FLIGHT,
+                          DEFAULT_MAX_FRAMES_IN_FLIGHT, param_flags));
+
+    g_object_class_install_property(
+        gobject_class, PROP_STAGE_TIMING,
+        g_param_spec_boolean("stage-timing", "Stage timing",
+                             "If true, wall time of inference stages (map, preproc, infer, postproc, attach, push) "
+                             "is measured per model instance and summary is logged every stage-timing-interval "
+                             "at INFO level (GST_DEBUG=GVA_common:4)",
+                             DEFAULT_STAGE_TIMING, param_flags));
+
+    g_object_class_install_property(
+        gobject_class, PROP_STAGE_TIMING_INTERVAL,
+        g_param_spec_uint("stage-timing-interval", "Stage timing interval",
+                          "Interval in milliseconds between stage timing summaries, see stage-timing",
+                          DEFAULT_MIN_STAGE_TIMING_INTERVAL, DEFAULT_MAX_STAGE_TIMING_INTERVAL,
+                          DEFAULT_STAGE_TIMING_INTERVAL, param_flags));
+
+    g_object_class_install_property(
+        gobject_class, PROP_STAGE_TRACE_FILE,
+        g_param_spec_string("stage-trace-file", "Stage trace file",
+                            "Path to JSON file for recent stage events in Chrome trace format (chrome://tracing, "
+                            "Perfetto), written when the model instance is released. Requires stage-timing=true.",
+                            DEFAULT_STAGE_TRACE_FILE, param_flags));
+
     g_object_class_install_property(
         gobject_class, PROP_PRE_PROC_BACKEND,
         g_param_spec_string(
             "pre-process-backend", "Pre-processing method",
             "Select a pre-processing method (color conversion, resize and crop), "
-            "one of 'ie', 'opencv', 'va', 'va-surface-sharing, 'vaapi', 'vaapi-surface-sharing'."
+            "one of 'ie', 'opencv', 'fused-cpu', 'va', 'va-surface-sharing, 'vaapi', 'vaapi-surface-sharing'."
             " If not set, it will be selected automatically: 'va' for VAMemory and DMABuf, 'ie' for SYSTEM memory.",
             DEFAULT_PRE_PROC, param_flags));
 
@@ -309,6 +398,35 @@ void gva_base_inference_class_init(GvaBaseInferenceClass *klass) {
                          "Note: Not supported with VA backends (pre-process-backend=va or va-surface-sharing).",
                          DEFAULT_MIN_BATCH_TIMEOUT, DEFAULT_MAX_BATCH_TIMEOUT, DEFAULT_BATCH_TIMEOUT, param_flags));
 
+    g_object_class_install_property(
+        gobject_class, PROP_MAX_BATCH_LATENCY,
+        g_param_spec_uint("max-batch-latency", "Max batch latency",
+                          "Deadline (us) for dispatching a partially filled batch, counted from the first frame "
+                          "added to the batch. If batch-size frames are not collected before the deadline, inference "
+                          "is executed on the collected frames as configured by partial-batch-policy. "
+                          "Value 0 disables the deadline, waiting for full batch. "
+                          "Applies only if batch-size > 1 and OpenVINO™ Automatic Batching (batch-timeout) is not used.",
+                          DEFAULT_MIN_MAX_BATCH_LATENCY, DEFAULT_MAX_MAX_BATCH_LATENCY, DEFAULT_MAX_BATCH_LATENCY,
+                          param_flags));
+
+    g_object_class_install_property(
+        gobject_class, PROP_PARTIAL_BATCH_POLICY,
+        g_param_spec_string("partial-batch-policy", "Partial batch policy",
+                            "How a partially filled batch is dispatched on max-batch-latency deadline: "
+                            "padded (fill remaining batch slots with copies of the last frame), "
+                            "dynamic (run with actual number of frames; model is compiled with dynamic batch "
+                            "dimension, falls back to padded if the model does not allow it)",
+                            DEFAULT_PARTIAL_BATCH_POLICY, param_flags));
+
+    g_object_class_install_property(
+        gobject_class, PROP_MODEL_CACHE_DIR,
+        g_param_spec_string("model-cache-dir", "Model cache directory",
+                            "Directory of compiled models. If set, network compiled for the device is exported to "
+                            "this directory and imported on next start instead of compiling it again. Blob is "
+                            "selected by hash of the model, device, ie-config and reshape/pre-processing settings, "
+                            "so changing any of them compiles and caches the network again.",
+                            DEFAULT_MODEL_CACHE_DIR, param_flags));
+
     g_object_class_install_property(
         gobject_class, PROP_INFERENCE_INTERVAL,
         g_param_spec_uint("inference-interval", "Inference Interval",
@@ -413,6 +531,18 @@ void gva_base_inference_class_init(GvaBaseInferenceClass *klass) {
                              "Whether to share VA Display context across inference elements: "
                              "true (share context, default), false (do not share context)",
                              DEFAULT_SHARE_VADISPLAY_CTX, param_flags));
+
+    constexpr auto stats_flags = static_cast<GParamFlags>(G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+    g_object_class_install_property(
+        gobject_class, PROP_QUEUE_STATS,
+        g_param_spec_boxed("queue-stats", "Queue Statistics",
+                           "Inference queue statistics: nireq, batch-size, requests-in-flight, cumulative batches and "
+                           "batched-frames of the inference instance (shared by elements with the same "
+                           "model-instance-id), reorder-depth of this element and frames-in-flight of the instance, "
+                           "cumulative free-request-wait, admission-wait and downstream-wait in nanoseconds, "
+                           "admission-wait-histogram of the instance (frame counts in log2 buckets of microseconds). "
+                           "NULL until the element starts. Sampled by inference_queue_tracer",
+                           GST_TYPE_STRUCTURE, stats_flags));
 }
 
 void gva_base_inference_cleanup(GvaBaseInference *base_inference) {
@@ -446,6 +576,15 @@ void gva_base_inference_cleanup(GvaBaseInference *base_inference) {
     g_free(base_inference->scheduling_policy);
     base_inference->scheduling_policy = nullptr;
 
+    g_free(base_inference->partial_batch_policy);
+    base_inference->partial_batch_policy = nullptr;
+
+    g_free(base_inference->model_cache_dir);
+    base_inference->model_cache_dir = nullptr;
+
+    g_free(base_inference->stage_trace_file);
+    base_inference->stage_trace_file = nullptr;
+
     g_free(base_inference->pre_proc_type);
     base_inference->pre_proc_type = nullptr;
 
@@ -510,6 +649,15 @@ void gva_base_inference_init(GvaBaseInference *base_inference) {
     base_inference->reshape = DEFAULT_RESHAPE;
     base_inference->batch_size = DEFAULT_BATCH_SIZE;
     base_inference->batch_timeout = DEFAULT_BATCH_TIMEOUT;
+    base_inference->max_batch_latency = DEFAULT_MAX_BATCH_LATENCY;
+    base_inference->partial_batch_policy = g_strdup(DEFAULT_PARTIAL_BATCH_POLICY);
+    base_inference->model_cache_dir = g_strdup(DEFAULT_MODEL_CACHE_DIR);
+    base_inference->stream_weight = DEFAULT_STREAM_WEIGHT;
+    base_inference->stream_queue_depth = DEFAULT_STREAM_QUEUE_DEPTH;
+    base_inference->max_frames_in_flight = DEFAULT_MAX_FRAMES_IN_FLIGHT;
+    base_inference->stage_timing = DEFAULT_STAGE_TIMING;
+    base_inference->stage_timing_interval = DEFAULT_STAGE_TIMING_INTERVAL;
+    base_inference->stage_trace_file = g_strdup(DEFAULT_STAGE_TRACE_FILE);
     base_inference->reshape_width = DEFAULT_RESHAPE_WIDTH;
     base_inference->reshape_height = DEFAULT_RESHAPE_HEIGHT;
     base_inference->no_block = DEFAULT_NO_BLOCK;
@@ -556,6 +704,11 @@ GstStateChangeReturn gva_base_inference_change_state(GstElement *element, GstSta
         base_inference->inference->FlushOutputs();
     }
 
+    if (base_inference->inference && (transition == GST_STATE_CHANGE_PAUSED_TO_READY)) {
+        // streaming thread may wait for admission, let it re-check before pads are deactivated
+        base_inference->inference->WakeUpAdmissionWaiters();
+    }
+
     return GST_ELEMENT_CLASS(gva_base_inference_parent_class)->change_state(element, transition);
 }
 
@@ -643,6 +796,17 @@ void gva_base_inference_set_property(GObject *object, guint property_id, const G
     case PROP_BATCH_TIMEOUT:
         base_inference->batch_timeout = g_value_get_int(value);
         break;
+    case PROP_MAX_BATCH_LATENCY:
+        base_inference->max_batch_latency = g_value_get_uint(value);
+        break;
+    case PROP_PARTIAL_BATCH_POLICY:
+        g_free(base_inference->partial_batch_policy);
+        base_inference->partial_batch_policy = g_value_dup_string(value);
+        break;
+    case PROP_MODEL_CACHE_DIR:
+        g_free(base_inference->model_cache_dir);
+        base_inference->model_cache_dir = g_value_dup_string(value);
+        break;
     case PROP_RESHAPE_WIDTH:
         base_inference->reshape_width = g_value_get_uint(value);
         break;
@@ -663,6 +827,25 @@ void gva_base_inference_set_property(GObject *object, guint property_id, const G
         g_free(base_inference->scheduling_policy);
         base_inference->scheduling_policy = g_value_dup_string(value);
         break;
+    case PROP_STREAM_WEIGHT:
+        base_inference->stream_weight = g_value_get_uint(value);
+        break;
+    case PROP_STREAM_QUEUE_DEPTH:
+        base_inference->stream_queue_depth = g_value_get_uint(value);
+        break;
+    case PROP_MAX_FRAMES_IN_FLIGHT:
+        base_inference->max_frames_in_flight = g_value_get_uint(value);
+        break;
+    case PROP_STAGE_TIMING:
+        base_inference->stage_timing = g_value_get_boolean(value);
+        break;
+    case PROP_STAGE_TIMING_INTERVAL:
+        base_inference->stage_timing_interval = g_value_get_uint(value);
+        break;
+    case PROP_STAGE_TRACE_FILE:
+        g_free(base_inference->stage_trace_file);
+        base_inference->stage_trace_file = g_value_dup_string(value);
+        break;
     case PROP_PRE_PROC_BACKEND:
         g_free(base_inference->pre_proc_type);
         base_inference->pre_proc_type = g_value_dup_string(value);
@@ -777,6 +960,15 @@ void gva_base_inference_get_property(GObject *object, guint property_id, GValue
     case PROP_BATCH_TIMEOUT:
         g_value_set_int(value, base_inference->batch_timeout);
         break;
+    case PROP_MAX_BATCH_LATENCY:
+        g_value_set_uint(value, base_inference->max_batch_latency);
+        break;
+    case PROP_PARTIAL_BATCH_POLICY:
+        g_value_set_string(value, base_inference->partial_batch_policy);
+        break;
+    case PROP_MODEL_CACHE_DIR:
+        g_value_set_string(value, base_inference->model_cache_dir);
+        break;
     case PROP_RESHAPE_WIDTH:
         g_value_set_uint(value, base_inference->reshape_width);
         break;
@@ -834,9 +1026,30 @@ void gva_base_inference_get_property(GObject *object, guint property_id, GValue
     case PROP_SHARE_VADISPLAY_CTX:
         g_value_set_boolean(value, base_inference->share_va_display_ctx);
         break;
+    case PROP_QUEUE_STATS:
+        g_value_take_boxed(value, get_inference_queue_stats(base_inference));
+        break;
     case PROP_SCHEDULING_POLICY:
         g_value_set_string(value, base_inference->scheduling_policy);
         break;
+    case PROP_STREAM_WEIGHT:
+        g_value_set_uint(value, base_inference->stream_weight);
+        break;
+    case PROP_STREAM_QUEUE_DEPTH:
+        g_value_set_uint(value, base_inference->stream_queue_depth);
+        break;
+    case PROP_MAX_FRAMES_IN_FLIGHT:
+        g_value_set_uint(value, base_inference->max_frames_in_flight);
+        break;
+    case PROP_STAGE_TIMING:
+        g_value_set_boolean(value, base_inference->stage_timing);
+        break;
+    case PROP_STAGE_TIMING_INTERVAL:
+        g_value_set_uint(value, base_inference->stage_timing_interval);
+        break;
+    case PROP_STAGE_TRACE_FILE:
+        g_value_set_string(value, base_inference->stage_trace_file);
+        break;
     default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID(object, property_id, pspec);
         break;
@@ -1056,6 +1269,17 @@ gboolean gva_base_inference_check_properties_correctness(GvaBaseInference *base_
         return FALSE;
     }
 
+    if (base_inference->partial_batch_policy && !g_str_equal(base_inference->partial_batch_policy, "padded") &&
+        !g_str_equal(base_inference->partial_batch_policy, "dynamic")) {
+        GST_ELEMENT_ERROR(base_inference, RESOURCE, SETTINGS, ("'partial-batch-policy' is invalid"),
+                          ("unsupported partial-batch-policy '%s', expected 'padded' or 'dynamic'",
+                           base_inference->partial_batch_policy));
+        return FALSE;
+    }
+
+    if (base_inference->stage_trace_file && *base_inference->stage_trace_file && !base_inference->stage_timing)
+        GST_WARNING_OBJECT(base_inference, "'stage-trace-file' is ignored because 'stage-timing' is not enabled");
+
     return TRUE;
 }
 
@@ -1074,17 +1298,20 @@ gboolean gva_base_inference_start(GstBaseTransform *trans) {
         base_inference,
         "%s inference parameters:\n -- Model: %s\n -- Model proc: %s\n "
         "-- Device: %s\n -- Inference interval: %d\n -- Reshape: %s\n -- Batch size: %d\n -- Batch timeout: %d\n "
+        "-- Max batch latency: %u\n -- Partial batch policy: %s\n -- Model cache dir: %s\n "
         "-- Reshape width: %d\n -- Reshape height: %d\n -- No block: %s\n -- Num of requests: %d\n "
         "-- Model instance ID: %s\n -- CPU streams: %d\n -- GPU streams: %d\n -- IE config: %s\n "
         "-- Allocator name: %s\n -- Preprocessing type: %s\n -- Object class: %s\n "
-        "-- Labels: %s\n",
+        "-- Labels: %s\n -- Stage timing: %s\n -- Stage trace file: %s\n",
         GST_ELEMENT_NAME(GST_ELEMENT_CAST(base_inference)), base_inference->model, base_inference->model_proc,
         base_inference->device, base_inference->inference_interval, base_inference->reshape ? "true" : "false",
-        base_inference->batch_size, base_inference->batch_timeout, base_inference->reshape_width,
+        base_inference->batch_size, base_inference->batch_timeout, base_inference->max_batch_latency,
+        base_inference->partial_batch_policy, base_inference->model_cache_dir, base_inference->reshape_width,
         base_inference->reshape_height, base_inference->no_block ? "true" : "false", base_inference->nireq,
         base_inference->model_instance_id, base_inference->cpu_streams, base_inference->gpu_streams,
         base_inference->ie_config, base_inference->allocator_name, base_inference->pre_proc_type,
-        base_inference->object_class, base_inference->labels);
+        base_inference->object_class, base_inference->labels, base_inference->stage_timing ? "true" : "false",
+        base_inference->stage_trace_file);
 
     if (!gva_base_inference_check_properties_correctness(base_inference)) {
         return base_inference->initialized;
@@ -40,9 +40,15 @@ typedef struct _GvaBaseInference {
     gboolean no_block;
     gboolean reshape;
     gboolean share_va_display_ctx;
+    gboolean stage_timing;
     guint inference_interval;
     guint batch_size;
     gint batch_timeout;
+    guint max_batch_latency;
+    guint stream_weight;
+    guint stream_queue_depth;
+    guint max_frames_in_flight;
+    guint stage_timing_interval;
     guint reshape_width;
     guint reshape_height;
     guint nireq;
@@ -50,9 +56,12 @@ typedef struct _GvaBaseInference {
     guint gpu_streams;
     gchar *model;
     gchar *model_proc;
+    gchar *model_cache_dir;
+    gchar *stage_trace_file;
     gchar *device;
     gchar *model_instance_id;
     gchar *scheduling_policy;
+    gchar *partial_batch_policy;
     gchar *ie_config;
     gchar *pre_proc_config;
     gchar *allocator_name;
@@ -116,6 +116,8 @@ inline std::string ImagePreprocessorTypeToString(ImagePreprocessorType type) {
         return "VA(API)_SURFACE_SHARING";
     case ImagePreprocessorType::OPENCV:
         return "OPENCV";
+    case ImagePreprocessorType::FUSED_CPU:
+        return "FUSED_CPU";
     default:
         return "UNKNOWN";
     }
@@ -130,6 +132,7 @@ ImagePreprocessorType ImagePreprocessorTypeFromString(const std::string &image_p
         {"va", ImagePreprocessorType::VAAPI_SYSTEM},
         {"va-surface-sharing", ImagePreprocessorType::VAAPI_SURFACE_SHARING},
         {"opencv", ImagePreprocessorType::OPENCV},
+        {"fused-cpu", ImagePreprocessorType::FUSED_CPU},
         {"d3d11", ImagePreprocessorType::D3D11},
         {"d3d11-surface-sharing", ImagePreprocessorType::D3D11_SURFACE_SHARING}};
 
@@ -221,11 +224,17 @@ InferenceConfig CreateNestedInferenceConfig(GvaBaseInference *gva_base_inference
     if (batch_timeout > -1) {
         inference[ov::auto_batch_timeout.name()] = std::to_string(batch_timeout);
     }
-
-    // add KEY_VAAPI_THREAD_POOL_SIZE, KEY_VAAPI_FAST_SCALE_LOAD_FACTOR elements to preprocessor config
-    // other elements from pre_processor info are consumed by model proc info
+    base[KEY_MAX_BATCH_LATENCY] = std::to_string(gva_base_inference->max_batch_latency);
+    if (gva_base_inference->partial_batch_policy)
+        base[KEY_PARTIAL_BATCH_POLICY] = gva_base_inference->partial_batch_policy;
+    if (gva_base_inference->model_cache_dir && *gva_base_inference->model_cache_dir)
+        base[KEY_MODEL_CACHE_DIR] = gva_base_inference->model_cache_dir;
+
+    // add KEY_VAAPI_THREAD_POOL_SIZE, KEY_VAAPI_FAST_SCALE_LOAD_FACTOR, KEY_CPU_THREAD_POOL_SIZE elements to
+    // preprocessor config, other elements from pre_processor info are consumed by model proc info
     for (const auto &element : Utils::stringToMap(gva_base_inference->pre_proc_config)) {
-        if (element.first == KEY_VAAPI_THREAD_POOL_SIZE || element.first == KEY_VAAPI_FAST_SCALE_LOAD_FACTOR)
+        if (element.first == KEY_VAAPI_THREAD_POOL_SIZE || element.first == KEY_VAAPI_FAST_SCALE_LOAD_FACTOR ||
+            element.first == KEY_CPU_THREAD_POOL_SIZE)
             preproc[element.first] = element.second;
     }
 
@@ -305,6 +314,7 @@ bool IsPreprocSupported(ImagePreprocessorType preproc,
         return !isNpu && !isCustomLib &&
                IsModelProcSupportedForVaapiSurfaceSharing(model_input_processor_info, input_video_info);
     case ImagePreprocessorType::OPENCV:
+    case ImagePreprocessorType::FUSED_CPU:
     case ImagePreprocessorType::D3D11:
         return true;
     case ImagePreprocessorType::AUTO:
@@ -580,11 +590,12 @@ MemoryType GetMemoryType(MemoryType input_image_memory_type, ImagePreprocessorTy
     case MemoryType::SYSTEM: {
         switch (image_preprocessor_type) {
         case ImagePreprocessorType::OPENCV:
+        case ImagePreprocessorType::FUSED_CPU:
         case ImagePreprocessorType::IE:
             type = MemoryType::SYSTEM;
             break;
         default:
-            throw std::invalid_argument("For system memory only supports ie, opencv image preprocessors");
+            throw std::invalid_argument("For system memory only supports ie, opencv, fused-cpu image preprocessors");
         }
         break;
     }
@@ -592,6 +603,7 @@ MemoryType GetMemoryType(MemoryType input_image_memory_type, ImagePreprocessorTy
     case MemoryType::DMA_BUFFER: {
         switch (image_preprocessor_type) {
         case ImagePreprocessorType::OPENCV:
+        case ImagePreprocessorType::FUSED_CPU:
         case ImagePreprocessorType::IE:
             type = MemoryType::SYSTEM;
             break;
@@ -878,6 +890,29 @@ InferenceImpl::InferenceImpl(GvaBaseInference *gva_base_inference) {
     GVA_INFO("Initial settings: batch_size=%u, batch_timeout=%d, nireq=%u", gva_base_inference->batch_size,
              gva_base_inference->batch_timeout, gva_base_inference->nireq);
     this->model = CreateModel(gva_base_inference, model_file, model_proc, labels_str, custom_preproc_lib);
+    max_frames_in_flight = gva_base_inference->max_frames_in_flight;
+
+    if (gva_base_inference->stage_timing) {
+        if (gva_base_inference->stage_trace_file)
+            stage_trace_file = gva_base_inference->stage_trace_file;
+        const char *instance_name = gva_base_inference->model_instance_id
+                                        ? gva_base_inference->model_instance_id
+                                        : GST_ELEMENT_NAME(GST_ELEMENT(gva_base_inference));
+        stage_timer = std::make_shared<StageTimer>(
+            instance_name, std::chrono::milliseconds(gva_base_inference->stage_timing_interval),
+            !stage_trace_file.empty());
+        model.inference->SetStageTimer(stage_timer);
+        GVA_INFO("Stage timing enabled: interval=%u ms, trace file=%s", gva_base_inference->stage_timing_interval,
+                 stage_trace_file.empty() ? "none" : stage_trace_file.c_str());
+    }
+
+    if (gva_base_inference->scheduling_policy && !strcmp(gva_base_inference->scheduling_policy, "round-robin")) {
+        size_t queue_depth = gva_base_inference->stream_queue_depth;
+        if (queue_depth == 0)
+            queue_depth = model.inference->GetNireq() * model.inference->GetBatchSize();
+        GVA_INFO("Round-robin scheduling across streams: stream queue depth=%lu", queue_depth);
+        batch_scheduler = std::make_unique<StreamBatchScheduler>(queue_depth);
+    }
 }
 
 dlstreamer::ContextPtr InferenceImpl::GetDisplay(GvaBaseInference *gva_base_inference) {
@@ -892,9 +927,28 @@ void InferenceImpl::SetDisplay(GvaBaseInference *gva_base_inference, const dlstr
 }
 
 void InferenceImpl::FlushInference() {
+    if (batch_scheduler)
+        batch_scheduler->WaitIdle();
     model.inference->Flush();
 }
 
+void InferenceImpl::ReleaseStream(GvaBaseInference *element) {
+    if (batch_scheduler)
+        batch_scheduler->RemoveStream(element);
+
+    std::unique_lock<std::mutex> output_lock(output_frames_mutex);
+    auto it = output_streams.find(element);
+    if (it == output_streams.end())
+        return;
+    // the entry is used by the thread pushing frames of the stream
+    output_frames_cv.wait(output_lock, [&] { return !it->second.pushing; });
+    if (it->second.frames.empty()) {
+        output_streams.erase(it);
+        std::lock_guard<std::mutex> stats_guard(stream_stats_mutex);
+        stream_stats.erase(element);
+    }
+}
+
 void InferenceImpl::FlushOutputs() {
     PushOutput();
 }
@@ -960,6 +1014,21 @@ bool InferenceImpl::FilterObjectClass(const std::string &object_class) const {
 }
 
 InferenceImpl::~InferenceImpl() {
+    // submit remaining frames before the model goes away
+    batch_scheduler.reset();
+    if (admission_wait.Total() > admission_wait.buckets[0])
+        GVA_INFO("Frame admission wait time histogram: %s", admission_wait.ToString().c_str());
+    if (stage_timer) {
+        stage_timer->Report();
+        if (!stage_trace_file.empty()) {
+            try {
+                stage_timer->WriteChromeTrace(stage_trace_file);
+                GVA_INFO("Stage trace written to %s", stage_trace_file.c_str());
+            } catch (const std::exception &e) {
+                GVA_WARNING("%s", e.what());
+            }
+        }
+    }
     for (auto proc : model.output_processor_info)
         gst_structure_free(proc.second);
 }
@@ -978,22 +1047,60 @@ bool InferenceImpl::IsRoiSizeValid(const GstAnalyticsODMtd roi_meta) {
 }
 
 /**
- * Acquires output_frames_mutex with std::lock_guard.
+ * Pushes completed frames of all streams.
+ * Acquires output_frames_mutex with std::unique_lock.
  */
 void InferenceImpl::PushOutput() {
     ITT_TASK(__FUNCTION__);
-    std::lock_guard<std::mutex> guard(output_frames_mutex);
+    std::unique_lock<std::mutex> output_lock(output_frames_mutex);
 
-    // track output queues that are full
-    std::map<std::string, bool> output_full;
+    // entries are not erased while their frames are pushed, so iteration survives releases of the lock
+    for (auto &stream : output_streams)
+        PushStreamOutput(output_lock, stream.second);
+}
 
-    auto frame = output_frames.begin();
-    while (frame != output_frames.end()) {
-        if ((*frame).inference_count != 0) {
+/**
+ * Pushes completed frames of the 'filter' stream.
+ * Acquires output_frames_mutex with std::unique_lock.
+ */
+void InferenceImpl::PushOutput(GvaBaseInference *filter) {
+    ITT_TASK(__FUNCTION__);
+    std::unique_lock<std::mutex> output_lock(output_frames_mutex);
+
+    auto it = output_streams.find(filter);
+    if (it != output_streams.end())
+        PushStreamOutput(output_lock, it->second);
+}
+
+/**
+ * Releases frames from the head of the stream's reorder buffer while their inference is completed.
+ * Frames of other streams are never scanned, so a slow stream does not delay the rest. Frames are pushed with
+ * output_frames_mutex released, so downstream blocking the push stalls neither completion callbacks nor admission
+ * of other streams. Returns at once if another thread pushes frames of the stream, that thread pushes frames
+ * completed meanwhile too.
+ * Expects output_frames_mutex to be held by caller through 'output_lock', it is held again on return.
+ */
+void InferenceImpl::PushStreamOutput(std::unique_lock<std::mutex> &output_lock, StreamOutput &stream) {
+    if (stream.pushing)
+        return;
+    stream.pushing = true;
+    // the lock is held whenever the loop is left, exceptions are thrown only before a frame is taken
+    struct PushingReset {
+        StreamOutput &stream;
+        std::condition_variable &cv;
+        ~PushingReset() {
+            stream.pushing = false;
+            cv.notify_all();
+        }
+    } pushing_reset{stream, output_frames_cv};
+
+    while (!stream.frames.empty()) {
+        OutputFrame &frame = stream.frames.front();
+        if (frame.inference_count != 0) {
             break; // inference not completed yet
         }
 
-        for (const std::shared_ptr<InferenceFrame> &inference_roi : (*frame).inference_rois) {
+        for (const std::shared_ptr<InferenceFrame> &inference_roi : frame.inference_rois) {
             gint meta_id = 0;
             if (inference_roi->roi.id >= 0) {
                 GMutexLockGuard guard(&inference_roi->gva_base_inference->meta_mutex);
@@ -1015,43 +1122,123 @@ void InferenceImpl::PushOutput() {
             }
 
             for (const GstStructure *roi_classification : inference_roi->roi_classifications) {
-                UpdateClassificationHistory(meta_id, (*frame).filter, roi_classification);
+                UpdateClassificationHistory(meta_id, frame.filter, roi_classification);
             }
         }
 
-        // 'output_frames' queue can be shared across streams and it is subject to HOL blocking
-        // do not send frame to a blocked output, but check if there frames ready to non-blocked outputs
-        GstObject *src = &(*frame).filter->base_transform.element.object;
-        if (CheckSrcPadBlocked(src) || output_full[src->name]) {
-            output_full[src->name] = true;
-            frame++; // output blocked, try next frame
-        } else {
-            PushBufferToSrcPad(*frame);
-            frame = output_frames.erase(frame);
-        }
+        OutputFrame output_frame = std::move(frame);
+        stream.frames.pop_front();
+        output_lock.unlock();
+
+        // downstream blocks the push when its queues are full, the push in progress is seen by GetQueueStats
+        stream.stats->push_time.Begin();
+        PushBufferToSrcPad(output_frame);
+        stream.stats->push_time.End();
+
+        output_lock.lock();
+        stream.stats->reorder_depth--;
+        output_frames_count--;
+        // frame was released
+        output_frames_cv.notify_all();
     }
 }
 
-bool InferenceImpl::CheckSrcPadBlocked(GstObject *src) {
-    bool blocked = false;
+void InferenceImpl::WakeUpAdmissionWaiters() {
+    std::lock_guard<std::mutex> guard(output_frames_mutex);
+    output_frames_cv.notify_all();
+}
 
-    GstObject *dst = gst_pad_get_parent(gst_pad_get_peer(GST_BASE_TRANSFORM_SRC_PAD(src)));
-    if (dst == nullptr)
-        return false;
+size_t InferenceImpl::GetMaxFramesInFlight(GvaBaseInference *gva_base_inference, bool latency_policy) const {
+    return FrameAdmission::MaxFramesInFlight(max_frames_in_flight, latency_policy, model.inference->GetNireq(),
+                                             model.inference->GetBatchSize(), gva_base_inference->inference_interval);
+}
 
-    if (strcmp(dst->name, "queue") > 0) {
-        guint buf_cnt;
-        g_object_get(dst, "current-level-buffers", &buf_cnt, NULL);
-        GstState state, pending;
-        gst_element_get_state(GST_ELEMENT(dst), &state, &pending, GST_CLOCK_TIME_NONE);
+void InferenceImpl::AdmissionWaitHistogram::Add(std::chrono::microseconds wait) {
+    size_t bucket = 0;
+    for (auto us = wait.count(); us > 0 && bucket < buckets.size() - 1; us >>= 1)
+        bucket++;
+    buckets[bucket]++;
+}
 
-        if ((buf_cnt > 1) && (state == GST_STATE_PAUSED)) {
-            blocked = true;
-        }
+std::string InferenceImpl::AdmissionWaitHistogram::ToString() const {
+    std::string str;
+    for (size_t i = 0; i < buckets.size(); i++) {
+        if (!buckets[i])
+            continue;
+        if (i == 0)
+            str += "<1us";
+        else if (i == buckets.size() - 1)
+            str += ">=" + std::to_string(1ull << (i - 1)) + "us";
+        else
+            str += "[" + std::to_string(1ull << (i - 1)) + "," + std::to_string(1ull << i) + ")us";
+        str += ": " + std::to_string(buckets[i]) + " ";
+    }
+    return str;
+}
+
+/**
+ * Reads counters without output_frames_mutex, so sampling does not wait for frames pushed downstream.
+ */
+GstStructure *InferenceImpl::GetQueueStats(GvaBaseInference *element) {
+    const auto queue_stats = model.inference->GetQueueStats();
+
+    guint reorder_depth = 0;
+    guint64 admission_wait_ns = 0;
+    guint64 push_wait_ns = 0;
+    std::shared_ptr<StreamStats> stream;
+    {
+        std::lock_guard<std::mutex> guard(stream_stats_mutex);
+        auto it = stream_stats.find(element);
+        if (it != stream_stats.end())
+            stream = it->second;
+    }
+    if (stream) {
+        reorder_depth = stream->reorder_depth;
+        admission_wait_ns = stream->admission_wait_ns;
+        push_wait_ns = stream->push_time.Total();
+    }
+    const guint frames_in_flight = safe_convert<guint>(output_frames_count.load());
+
+    GstStructure *stats = gst_structure_new(
+        "queue-stats", "nireq", G_TYPE_UINT, safe_convert<guint>(model.inference->GetNireq()), "batch-size",
+        G_TYPE_UINT, safe_convert<guint>(model.inference->GetBatchSize()), "requests-in-flight", G_TYPE_UINT,
+        safe_convert<guint>(queue_stats.requests_in_flight), "batches", G_TYPE_UINT64,
+        static_cast<guint64>(queue_stats.batches), "batched-frames", G_TYPE_UINT64,
+        static_cast<guint64>(queue_stats.batched_frames), "free-request-wait", G_TYPE_UINT64,
+        static_cast<guint64>(queue_stats.free_request_wait_ns), "reorder-depth", G_TYPE_UINT, reorder_depth,
+        "frames-in-flight", G_TYPE_UINT, frames_in_flight, "admission-wait", G_TYPE_UINT64, admission_wait_ns,
+        "downstream-wait", G_TYPE_UINT64, push_wait_ns, nullptr);
+
+    // log2 buckets of microseconds: bucket 0 counts admissions without wait, bucket i waits in [2^(i-1), 2^i) us
+    GValue histogram = G_VALUE_INIT;
+    g_value_init(&histogram, GST_TYPE_ARRAY);
+    for (const auto &count : admission_wait.buckets) {
+        GValue item = G_VALUE_INIT;
+        g_value_init(&item, G_TYPE_UINT64);
+        g_value_set_uint64(&item, count);
+        gst_value_array_append_value(&histogram, &item);
+        g_value_unset(&item);
     }
-    gst_object_unref(dst);
+    gst_structure_take_value(stats, "admission-wait-histogram", &histogram);
+    return stats;
+}
 
-    return blocked;
+/**
+ * Returns latest presentation timestamp of frames in all reorder buffers.
+ * Expects output_frames_mutex to be held by caller.
+ */
+GstClockTime InferenceImpl::LatestOutputPts() const {
+    GstClockTime latest_pts = 0;
+    for (const auto &stream : output_streams) {
+        // frames are kept in arrival order, so only the tail has to be checked
+        for (auto frame = stream.second.frames.rbegin(); frame != stream.second.frames.rend(); ++frame) {
+            if (GST_BUFFER_PTS_IS_VALID(frame->buffer)) {
+                latest_pts = std::max(latest_pts, GST_BUFFER_PTS(frame->buffer));
+                break;
+            }
+        }
+    }
+    return latest_pts;
 }
 
 void InferenceImpl::PushBufferToSrcPad(OutputFrame &output_frame) {
@@ -1103,6 +1290,7 @@ GstFlowReturn InferenceImpl::SubmitImages(GvaBaseInference *gva_base_inference,
 
         auto &buf_mapper = *gva_base_inference->priv->buffer_mapper;
         assert(buf_mapper.memoryType() == GetInferenceMemoryType() && "Mapper mem type =/= inference mem type");
+        const uint64_t map_begin = stage_timer ? StageTimer::Ticks() : 0;
 
         /* we invoke CreateImage::gva_buffer_map::gst_video_frame_map with
          * GST_VIDEO_FRAME_MAP_FLAG_NO_REF to avoid refcount increase.
@@ -1113,26 +1301,32 @@ GstFlowReturn InferenceImpl::SubmitImages(GvaBaseInference *gva_base_inference,
         if (!image)
             throw std::invalid_argument("image is null");
 
-        size_t i = 0;
+        // Regions are submitted together, so backend can pre-process them in parallel into consecutive batch slots.
+        // Each region gets own image with region boundaries, all of them keep the frame mapped until released.
+        std::vector<InferenceBackend::ImageInference::IFrameBase::Ptr> results;
+        std::vector<std::map<std::string, InferenceBackend::InputLayerDesc::Ptr>> input_preprocessors;
+        results.reserve(metas.size());
+        input_preprocessors.reserve(metas.size());
         for (auto meta : metas) {
-            // Workaround for CodeCoverity
-            if (!image)
-                break;
-
-            ApplyImageBoundaries(image, &meta, gva_base_inference->inference_region, buffer);
-            auto result = MakeInferenceResult(gva_base_inference, model, &meta, image, buffer);
-            // Because image is a shared pointer with custom deleter which performs buffer unmapping
-            // we need to manually reset it after we passed it to the last InferenceResult
-            // Otherwise it may try to unmap buffer which is already pushed to downstream
-            // if completion callback is called before we exit this scope
-            if (++i == metas.size())
-                image.reset();
-            std::map<std::string, InferenceBackend::InputLayerDesc::Ptr> input_preprocessors;
+            InferenceBackend::ImagePtr region_image =
+                metas.size() == 1 ? image
+                                  : InferenceBackend::ImagePtr(new InferenceBackend::Image(*image),
+                                                               [image](InferenceBackend::Image *p) { delete p; });
+            ApplyImageBoundaries(region_image, &meta, gva_base_inference->inference_region, buffer);
+            results.push_back(MakeInferenceResult(gva_base_inference, model, &meta, region_image, buffer));
+            input_preprocessors.emplace_back();
             if (!model.input_processor_info.empty() && gva_base_inference->input_prerocessors_factory)
-                input_preprocessors =
+                input_preprocessors.back() =
                     gva_base_inference->input_prerocessors_factory(model.inference, model.input_processor_info, &meta);
-            model.inference->SubmitImage(std::move(result), input_preprocessors);
         }
+        // Because image is a shared pointer with custom deleter which performs buffer unmapping
+        // we need to manually reset it after we passed it to the InferenceResults
+        // Otherwise it may try to unmap buffer which is already pushed to downstream
+        // if completion callback is called before we exit this scope
+        image.reset();
+        if (stage_timer)
+            stage_timer->Record(Stage::MAP, map_begin, StageTimer::Ticks());
+        model.inference->SubmitImages(std::move(results), input_preprocessors);
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to submit images to inference"));
     }
@@ -1141,6 +1335,20 @@ GstFlowReturn InferenceImpl::SubmitImages(GvaBaseInference *gva_base_inference,
     return GST_BASE_TRANSFORM_FLOW_DROPPED;
 }
 
+/**
+ * Runs on StreamBatchScheduler thread. Errors are reported on the element the frame belongs to, as there is no
+ * streaming thread to return them to.
+ */
+void InferenceImpl::SubmitScheduledImages(GvaBaseInference *gva_base_inference,
+                                          const std::vector<GstVideoRegionOfInterestMeta> &metas, GstBuffer *buffer) {
+    try {
+        SubmitImages(gva_base_inference, metas, buffer);
+    } catch (const std::exception &e) {
+        GST_ELEMENT_ERROR(gva_base_inference, STREAM, FAILED, ("base_inference failed on frame processing"),
+                          ("%s", Utils::createNestedErrorMsg(e).c_str()));
+    }
+}
+
 const InferenceImpl::Model &InferenceImpl::GetModel() const {
     return model;
 }
@@ -1218,54 +1426,51 @@ GstFlowReturn InferenceImpl::TransformFrameIp(GvaBaseInference *gva_base_inferen
         GVA_WARNING("The frame counter value limit has been reached. This value will be reset.");
     }
 
-    // push into output_frames queue
+    // push into stream reorder buffer
     {
         ITT_TASK("InferenceImpl::TransformFrameIp pushIntoOutputFramesQueue");
         std::unique_lock output_lock(output_frames_mutex);
-
-        // pause on accepting a new frame if downstream already blocks
-        GstObject *src = &gva_base_inference->base_transform.element.object;
-        while (CheckSrcPadBlocked(src)) {
-            output_lock.unlock();
-            lock.unlock();
-            GVA_INFO("Wait on blocking output <%s>", src->name);
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
-            lock.lock();
-            output_lock.lock();
+        // map nodes are stable, the entry is erased only when the element releases the instance
+        StreamOutput &stream = output_streams[gva_base_inference];
+        if (!stream.stats) {
+            stream.stats = std::make_shared<StreamStats>();
+            std::lock_guard<std::mutex> stats_guard(stream_stats_mutex);
+            stream_stats[gva_base_inference] = stream.stats;
         }
 
-        // schedule frames according to their presentation time
-        if (!strcmp(gva_base_inference->scheduling_policy, "latency")) {
-            // find latest presentation timestamp in buffered frames
-            GstClockTime latest_pts = 0;
-            for (const auto &output_frame : output_frames)
-                if ((output_frame.buffer->pts != GST_CLOCK_TIME_NONE) && (output_frame.buffer->pts > latest_pts))
-                    latest_pts = output_frame.buffer->pts;
-
-            // pause if total number of buffered frames exceeds max number of frames in flight,
-            // and frame presentation time is later than ones already queued
-            while ((buffer->pts > latest_pts) &&
-                   (output_frames.size() > model.inference->GetNireq() * model.inference->GetBatchSize() *
-                                               gva_base_inference->inference_interval)) {
-                output_lock.unlock();
-                lock.unlock();
-                std::this_thread::sleep_for(std::chrono::milliseconds(10));
-                lock.lock();
-                output_lock.lock();
-                for (const auto &output_frame : output_frames)
-                    if ((output_frame.buffer->pts != GST_CLOCK_TIME_NONE) && (output_frame.buffer->pts > latest_pts))
-                        latest_pts = output_frame.buffer->pts;
-            }
+        FrameAdmission admission;
+        admission.latency_policy = !strcmp(gva_base_inference->scheduling_policy, "latency");
+        admission.max_frames_in_flight = GetMaxFramesInFlight(gva_base_inference, admission.latency_policy);
+        auto can_admit = [&] {
+            // backpressure of the stream's downstream, signalled by pushes instead of polling downstream queues
+            return admission.CanAdmit(stream.DownstreamBlocked(), output_frames_count, buffer->pts,
+                                      [this] { return LatestOutputPts(); });
+        };
+
+        const auto wait_start = std::chrono::steady_clock::now();
+        if (!can_admit()) {
+            ITT_TASK("InferenceImpl::TransformFrameIp waitForAdmission");
+            GVA_DEBUG("Wait for admission <%s>", GST_ELEMENT_NAME(gva_base_inference));
+            // woken up by PushOutput when frames leave reorder buffers
+            WaitForAdmission(lock, output_lock, output_frames_cv, can_admit);
         }
-
-        if (!inference_count && output_frames.empty()) {
-            // If we don't need to run inference and there are no frames queued for inference then finish transform
+        const auto wait_ns =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - wait_start);
+        admission_wait.Add(std::chrono::duration_cast<std::chrono::microseconds>(wait_ns));
+        stream.stats->admission_wait_ns += wait_ns.count();
+
+        if (!inference_count && stream.frames.empty()) {
+            // If we don't need to run inference and there are no frames of this stream queued for inference then
+            // finish transform
             return GST_FLOW_OK;
         }
 
         InferenceImpl::OutputFrame output_frame = {
             .buffer = buffer, .inference_count = inference_count, .filter = gva_base_inference, .inference_rois = {}};
-        output_frames.push_back(output_frame);
+        // keep arrival order, timestamps may be reset by segments
+        stream.frames.push_back(output_frame);
+        stream.stats->reorder_depth++;
+        output_frames_count++;
 
         // No need to unref buffer copy further
         buf_guard.disable();
@@ -1275,29 +1480,47 @@ GstFlowReturn InferenceImpl::TransformFrameIp(GvaBaseInference *gva_base_inferen
         }
     }
 
+    if (batch_scheduler) {
+        // Pre-processing and submission happen on scheduler thread, streams only contend on short ROI collection
+        lock.unlock();
+        batch_scheduler->Enqueue(
+            gva_base_inference,
+            [this, gva_base_inference, metas = std::move(metas), buffer] {
+                SubmitScheduledImages(gva_base_inference, metas, buffer);
+            },
+            gva_base_inference->stream_weight);
+        return GST_BASE_TRANSFORM_FLOW_DROPPED;
+    }
+
     return SubmitImages(gva_base_inference, metas, buffer);
 }
 
 void InferenceImpl::PushFramesIfInferenceFailed(
     std::vector<std::shared_ptr<InferenceBackend::ImageInference::IFrameBase>> frames) {
-    std::lock_guard<std::mutex> guard(output_frames_mutex);
+    // regions are completed without results, so their frames are still pushed in arrival order
+    std::vector<std::shared_ptr<InferenceFrame>> inference_frames;
     for (auto &frame : frames) {
         auto inference_result = std::dynamic_pointer_cast<InferenceResult>(frame);
         /* InferenceResult is inherited from IFrameBase */
         assert(inference_result.get() != nullptr && "Expected a valid InferenceResult");
+        inference_frames.push_back(inference_result->inference_frame);
+    }
+    PushCompletedFrames(inference_frames);
+}
 
-        std::shared_ptr<InferenceFrame> inference_roi = inference_result->inference_frame;
-        auto it =
-            std::find_if(output_frames.begin(), output_frames.end(), [inference_roi](const OutputFrame &output_frame) {
-                return output_frame.buffer == inference_roi->buffer;
-            });
-
-        if (it == output_frames.end())
-            continue;
-
-        PushBufferToSrcPad(*it);
-        output_frames.erase(it);
+/**
+ * Marks regions as completed and pushes frames of their streams which became ready.
+ */
+void InferenceImpl::PushCompletedFrames(std::vector<std::shared_ptr<InferenceFrame>> &inference_frames) {
+    StageScope push_scope(stage_timer.get(), Stage::PUSH);
+    std::vector<GvaBaseInference *> streams;
+    for (auto &inference_roi : inference_frames) {
+        UpdateOutputFrames(inference_roi);
+        if (std::find(streams.begin(), streams.end(), inference_roi->gva_base_inference) == streams.end())
+            streams.push_back(inference_roi->gva_base_inference);
     }
+    for (auto *stream : streams)
+        PushOutput(stream);
 }
 
 /**
@@ -1311,8 +1534,12 @@ void InferenceImpl::UpdateOutputFrames(std::shared_ptr<InferenceFrame> &inferenc
     assert(inference_roi && "Inference frame is null");
     std::lock_guard<std::mutex> guard(output_frames_mutex);
 
-    /* we must iterate through std::list because it has no lookup operations */
-    for (auto &output_frame : output_frames) {
+    auto stream = output_streams.find(inference_roi->gva_base_inference);
+    if (stream == output_streams.end())
+        return;
+
+    /* frames of a stream are few, linear lookup by buffer is enough */
+    for (auto &output_frame : stream->second.frames) {
         if (output_frame.buffer != inference_roi->buffer)
             continue;
 
@@ -1320,7 +1547,7 @@ void InferenceImpl::UpdateOutputFrames(std::shared_ptr<InferenceFrame> &inferenc
         if (inference_roi->gva_base_inference->type == GST_GVA_DETECT_TYPE ||
             inference_roi->gva_base_inference->inference_region == FULL_FRAME) {
             if (output_frame.inference_count == 0)
-                // This condition is necessary if two items in output_frames refer to the same buffer.
+                // This condition is necessary if two items in stream frames refer to the same buffer.
                 // If current output_frame.inference_count equals 0, then inference for this output_frame
                 // already happened, but buffer wasn't pushed further by pipeline yet. We skip this buffer
                 // to find another, to which current inference callback really belongs
@@ -1333,8 +1560,9 @@ void InferenceImpl::UpdateOutputFrames(std::shared_ptr<InferenceFrame> &inferenc
 }
 
 /**
- * Callback called when the inference request is completed. Updates output_frames and invokes post-processing for
- * corresponding inference element then makes gst_pad_push to send buffer further down the pipeline.
+ * Callback called when the inference request is completed. Updates stream reorder buffers and invokes
+ * post-processing for corresponding inference element then makes gst_pad_push to send buffer further down the
+ * pipeline.
  * Nullifies shared_ptr for InferenceBackend::Image created during 'SubmitImages'.
  *
  * @param[in] blobs - the resulting blobs obtained after executing inference
@@ -1375,8 +1603,7 @@ void InferenceImpl::InferenceCompletionCallback(
         GST_ERROR("%s", Utils::createNestedErrorMsg(e).c_str());
     }
 
-    for (auto &inference_roi : inference_frames) {
-        UpdateOutputFrames(inference_roi);
-    }
-    PushOutput();
+    PushCompletedFrames(inference_frames);
+    if (stage_timer)
+        stage_timer->ReportIfDue();
 }
@@ -5,17 +5,25 @@
  ******************************************************************************/
 #pragma once
 
+#include "busy_time_counter.h"
 #include "classification_history.h"
+#include "frame_admission.h"
 #include "gstgvaclassify.h"
 #include "gva_base_inference.h"
 #include "input_model_preproc.h"
+#include "stream_batch_scheduler.h"
 
 #include "inference_backend/image_inference.h"
 
 #include <gst/video/video.h>
 
 #include <gst/analytics/analytics.h>
-#include <list>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -40,6 +48,11 @@ class InferenceImpl {
     void FlushOutputs();
     void FlushInference();
     const Model &GetModel() const;
+    // Null unless stage-timing is enabled
+    InferenceBackend::StageTimer::Ptr GetStageTimer() const {
+        return stage_timer;
+    }
+    void ReleaseStream(GvaBaseInference *element);
 
     void UpdateObjectClasses(const gchar *obj_classes_str);
     bool FilterObjectClass(GstVideoRegionOfInterestMeta *roi) const;
@@ -55,6 +68,25 @@ class InferenceImpl {
     static bool IsRoiSizeValid(const GstVideoRegionOfInterestMeta *roi_meta);
     static bool IsRoiSizeValid(const GstAnalyticsODMtd roi_meta);
 
+    // Time frames waited for admission in TransformFrameIp, log2 buckets of microseconds
+    struct AdmissionWaitHistogram {
+        // bucket 0: no wait (< 1us), bucket i: [2^(i-1), 2^i) us, last bucket is open-ended
+        std::array<std::atomic<uint64_t>, 24> buckets = {};
+
+        void Add(std::chrono::microseconds wait);
+        uint64_t Total() const {
+            uint64_t total = 0;
+            for (const auto &count : buckets)
+                total += count;
+            return total;
+        }
+        std::string ToString() const;
+    };
+    // Returns queue statistics of the instance and the element's stream, see queue-stats property
+    GstStructure *GetQueueStats(GvaBaseInference *element);
+    // Wakes up streaming threads waiting for admission, e.g. when element is stopping
+    void WakeUpAdmissionWaiters();
+
   private:
     InferenceBackend::MemoryType memory_type;
     struct InferenceResult : public InferenceBackend::ImageInference::IFrameBase {
@@ -81,6 +113,8 @@ class InferenceImpl {
     mutable std::mutex _mutex;
     Model model;
     std::shared_ptr<InferenceBackend::Allocator> allocator;
+    // Set for scheduling-policy=round-robin, submits frames of all streams sharing the instance
+    std::unique_ptr<StreamBatchScheduler> batch_scheduler;
 
     struct OutputFrame {
         GstBuffer *buffer;
@@ -89,13 +123,52 @@ class InferenceImpl {
         std::vector<std::shared_ptr<InferenceFrame>> inference_rois;
     };
 
-    std::list<OutputFrame> output_frames;
+    // Counters of a stream, read by GetQueueStats without output_frames_mutex
+    struct StreamStats {
+        std::atomic<uint32_t> reorder_depth{0};
+        std::atomic<uint64_t> admission_wait_ns{0}; // time frames waited for admission
+        BusyTimeCounter push_time;                  // time spent in pushes downstream, by the stream's pusher
+    };
+
+    // Reorder buffer of a stream (inference element): frames wait here in arrival order until inference for all
+    // their ROIs is completed
+    struct StreamOutput {
+        std::deque<OutputFrame> frames;
+        std::shared_ptr<StreamStats> stats;
+        // Set while a thread pushes frames of the stream downstream without output_frames_mutex. Frames completed
+        // meanwhile are left to that thread, so frames of a stream are pushed in order by one thread at a time.
+        bool pushing = false;
+
+        // Downstream takes frames slower than inference completes them: a completed frame waits behind the push
+        // in progress. New frames of the stream are not admitted meanwhile.
+        bool DownstreamBlocked() const {
+            return pushing && !frames.empty() && frames.front().inference_count == 0;
+        }
+    };
+
+    std::map<GvaBaseInference *, StreamOutput> output_streams;
+    // frames in reorder buffers or being pushed, modified under output_frames_mutex
+    std::atomic<size_t> output_frames_count{0};
     std::mutex output_frames_mutex;
+    // Stats of streams by element, the mutex is held only for lookup
+    std::map<GvaBaseInference *, std::shared_ptr<StreamStats>> stream_stats;
+    std::mutex stream_stats_mutex;
+    // signalled when frames leave reorder buffers, guarded by output_frames_mutex
+    std::condition_variable output_frames_cv;
+    size_t max_frames_in_flight = 0;
+    AdmissionWaitHistogram admission_wait;
+
+    InferenceBackend::StageTimer::Ptr stage_timer;
+    std::string stage_trace_file;
 
     void PushOutput();
-    bool CheckSrcPadBlocked(GstObject *src);
+    void PushOutput(GvaBaseInference *filter);
+    void PushStreamOutput(std::unique_lock<std::mutex> &output_lock, StreamOutput &stream);
+    GstClockTime LatestOutputPts() const;
+    size_t GetMaxFramesInFlight(GvaBaseInference *gva_base_inference, bool latency_policy) const;
     void PushBufferToSrcPad(OutputFrame &output_frame);
     void PushFramesIfInferenceFailed(std::vector<std::shared_ptr<InferenceBackend::ImageInference::IFrameBase>> frames);
+    void PushCompletedFrames(std::vector<std::shared_ptr<InferenceFrame>> &inference_frames);
     void InferenceCompletionCallback(std::map<std::string, InferenceBackend::OutputBlob::Ptr> blobs,
                                      std::vector<std::shared_ptr<InferenceBackend::ImageInference::IFrameBase>> frames);
     void UpdateOutputFrames(std::shared_ptr<InferenceFrame> &inference_roi);
@@ -106,6 +179,8 @@ class InferenceImpl {
 
     GstFlowReturn SubmitImages(GvaBaseInference *gva_base_inference,
                                const std::vector<GstVideoRegionOfInterestMeta> &metas, GstBuffer *buffer);
+    void SubmitScheduledImages(GvaBaseInference *gva_base_inference,
+                               const std::vector<GstVideoRegionOfInterestMeta> &metas, GstBuffer *buffer);
     std::shared_ptr<InferenceResult> MakeInferenceResult(GvaBaseInference *gva_base_inference, Model &model,
                                                          GstVideoRegionOfInterestMeta *meta,
                                                          std::shared_ptr<InferenceBackend::Image> &image,
@@ -15,6 +15,8 @@
 
 struct InferenceRefs {
     std::set<GvaBaseInference *> refs;
+    // Serializes creation of the proxy, which is done without inference_pool_mutex_
+    std::mutex proxy_creation_mutex;
     std::shared_ptr<InferenceImpl> proxy = nullptr;
     dlstreamer::ContextPtr context = nullptr;
     GstVideoFormat videoFormat = GST_VIDEO_FORMAT_UNKNOWN;
@@ -80,9 +82,17 @@ void fillElementProps(GvaBaseInference *targetElem, GvaBaseInference *masterElem
     COPY_GSTRING(targetElem->model_proc, masterElem->model_proc);
     targetElem->batch_size = masterElem->batch_size;
     targetElem->batch_timeout = masterElem->batch_timeout;
+    targetElem->max_batch_latency = masterElem->max_batch_latency;
+    COPY_GSTRING(targetElem->partial_batch_policy, masterElem->partial_batch_policy);
+    COPY_GSTRING(targetElem->model_cache_dir, masterElem->model_cache_dir);
     targetElem->inference_interval = masterElem->inference_interval;
     targetElem->no_block = masterElem->no_block;
     targetElem->nireq = masterElem->nireq;
+    targetElem->stream_queue_depth = masterElem->stream_queue_depth;
+    targetElem->max_frames_in_flight = masterElem->max_frames_in_flight;
+    targetElem->stage_timing = masterElem->stage_timing;
+    targetElem->stage_timing_interval = masterElem->stage_timing_interval;
+    COPY_GSTRING(targetElem->stage_trace_file, masterElem->stage_trace_file);
     targetElem->cpu_streams = masterElem->cpu_streams;
     targetElem->gpu_streams = masterElem->gpu_streams;
     COPY_GSTRING(targetElem->ie_config, masterElem->ie_config);
@@ -161,23 +171,38 @@ std::shared_ptr<InferenceImpl> acquire_inference_instance(GvaBaseInference *base
         if (!base_inference)
             throw std::invalid_argument("GvaBaseInference is null");
 
-        std::lock_guard<std::mutex> guard(inference_pool_mutex_);
         std::shared_ptr<InferenceRefs> infRefs = nullptr;
-        std::string name = get_inference_key(base_inference);
-        GST_INFO_OBJECT(base_inference, "key: %s\n", name.c_str());
-        infRefs = registerElementUnlocked(base_inference);
+        {
+            std::lock_guard<std::mutex> guard(inference_pool_mutex_);
+            std::string name = get_inference_key(base_inference);
+            GST_INFO_OBJECT(base_inference, "key: %s\n", name.c_str());
+            infRefs = registerElementUnlocked(base_inference);
 
-        initInferenceProps(*infRefs, base_inference->info->finfo->format, base_inference->caps_feature);
-        check_inference_props_same(*infRefs, base_inference->info->finfo->format, base_inference->caps_feature);
+            initInferenceProps(*infRefs, base_inference->info->finfo->format, base_inference->caps_feature);
+            check_inference_props_same(*infRefs, base_inference->info->finfo->format, base_inference->caps_feature);
 
-        // if base_inference is not master element, it will get all master element's properties here
-        initExistingElements(infRefs);
+            // if base_inference is not master element, it will get all master element's properties here
+            initExistingElements(infRefs);
+        }
 
-        if (infRefs->proxy == nullptr) { // no instance for current inference-id acquired yet
-            infRefs->proxy =
-                std::make_shared<InferenceImpl>(base_inference); // one instance for all elements with same inference-id
+        // Model is read and compiled without holding the pool, so elements with different model-instance-id
+        // streaming in their own threads compile models in parallel. Elements sharing model-instance-id wait here.
+        std::lock_guard<std::mutex> creation_guard(infRefs->proxy_creation_mutex);
+        std::shared_ptr<InferenceImpl> proxy;
+        {
+            std::lock_guard<std::mutex> guard(inference_pool_mutex_);
+            proxy = infRefs->proxy;
+        }
+        if (proxy == nullptr) { // no instance for current inference-id acquired yet
+            GST_INFO_OBJECT(base_inference, "creating inference instance");
+            // one instance for all elements with same inference-id
+            proxy = std::make_shared<InferenceImpl>(base_inference);
         }
-        infRefs->context = InferenceImpl::GetDisplay(base_inference);
+        auto context = InferenceImpl::GetDisplay(base_inference);
+
+        std::lock_guard<std::mutex> guard(inference_pool_mutex_);
+        infRefs->proxy = proxy;
+        infRefs->context = context;
 
         return infRefs->proxy;
     } catch (const std::exception &e) {
@@ -193,7 +218,8 @@ void release_inference_instance(GvaBaseInference *base_inference) {
 
         for (auto it = inference_pool_.begin(); it != inference_pool_.end();) {
             auto infRefs = it->second;
-            infRefs->refs.erase(base_inference);
+            if (infRefs->refs.erase(base_inference) && infRefs->proxy)
+                infRefs->proxy->ReleaseStream(base_inference);
             if (infRefs->refs.empty()) {
                 infRefs->proxy.reset();
                 infRefs.reset();
@@ -207,3 +233,28 @@ void release_inference_instance(GvaBaseInference *base_inference) {
                           ("%s", Utils::createNestedErrorMsg(e).c_str()));
     }
 }
+
+/**
+ * Returns queue statistics of the inference instance used by the element, nullptr if the element has no instance.
+ * Called from any thread, e.g. by a tracer sampling the statistics.
+ */
+GstStructure *get_inference_queue_stats(GvaBaseInference *base_inference) {
+    try {
+        std::shared_ptr<InferenceImpl> proxy;
+        {
+            std::lock_guard<std::mutex> guard(inference_pool_mutex_);
+            for (const auto &entry : inference_pool_) {
+                if (entry.second->refs.count(base_inference)) {
+                    proxy = entry.second->proxy;
+                    break;
+                }
+            }
+        }
+        // the instance is kept alive by the reference, statistics are read without holding the pool
+        if (proxy)
+            return proxy->GetQueueStats(base_inference);
+    } catch (const std::exception &e) {
+        GST_WARNING_OBJECT(base_inference, "Couldn't get queue statistics: %s", Utils::createNestedErrorMsg(e).c_str());
+    }
+    return nullptr;
+}
@@ -26,6 +26,7 @@ typedef struct _GvaBaseInference GvaBaseInference;
 
 gboolean registerElement(GvaBaseInference *base_inference);
 void release_inference_instance(GvaBaseInference *base_inference);
+GstStructure *get_inference_queue_stats(GvaBaseInference *base_inference);
 
 #ifdef __cplusplus
 } /* extern C */
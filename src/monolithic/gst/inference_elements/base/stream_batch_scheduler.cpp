@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "stream_batch_scheduler.h"
+
+#include "inference_backend/logger.h"
+
+#include <algorithm>
+#include <exception>
+
+StreamBatchScheduler::StreamBatchScheduler(size_t max_queue_depth)
+    : max_queue_depth(std::max<size_t>(max_queue_depth, 1)) {
+    worker = std::thread(&StreamBatchScheduler::WorkingFunction, this);
+}
+
+StreamBatchScheduler::~StreamBatchScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+    }
+    task_available.notify_all();
+    task_done.notify_all();
+    // worker executes remaining tasks before exit, they own references to buffers
+    if (worker.joinable())
+        worker.join();
+}
+
+void StreamBatchScheduler::Enqueue(StreamId stream, Task task, uint32_t weight) {
+    ITT_TASK(__FUNCTION__);
+    std::unique_lock<std::mutex> lock(mutex);
+
+    auto it = streams.find(stream);
+    if (it == streams.end()) {
+        it = streams.emplace(stream, StreamQueue()).first;
+        order.push_back(stream);
+    }
+    StreamQueue &queue = it->second;
+    queue.weight = std::max<uint32_t>(weight, 1);
+    // the first stream is served from its full weight, as any stream the round-robin moves to
+    if (order.size() == 1 && credit == 0)
+        credit = queue.weight;
+
+    // backpressure only for the stream that overfills its own queue
+    task_done.wait(lock, [&] { return stop || queue.tasks.size() < max_queue_depth; });
+
+    queue.tasks.push_back(std::move(task));
+    lock.unlock();
+    task_available.notify_one();
+}
+
+void StreamBatchScheduler::WaitIdle() {
+    std::unique_lock<std::mutex> lock(mutex);
+    task_done.wait(lock, [this] { return !HasPendingTasks() && running == nullptr; });
+}
+
+void StreamBatchScheduler::RemoveStream(StreamId stream) {
+    std::unique_lock<std::mutex> lock(mutex);
+    task_done.wait(lock, [this, stream] { return !HasPendingTasks(stream) && running != stream; });
+
+    auto it = streams.find(stream);
+    if (it == streams.end())
+        return;
+    GVA_DEBUG("Stream %p removed from batch scheduler, tasks submitted: %lu", stream,
+              static_cast<unsigned long>(it->second.submitted));
+    streams.erase(it);
+
+    auto pos = std::find(order.begin(), order.end(), stream);
+    const size_t index = std::distance(order.begin(), pos);
+    order.erase(pos);
+    if (index < current) {
+        // the same stream keeps being served with the credit it has left
+        current--;
+    } else if (index == current) {
+        // the next stream takes place of the removed one and is served from its full weight
+        if (current >= order.size())
+            current = 0;
+        credit = order.empty() ? 0 : streams[order[current]].weight;
+    }
+}
+
+bool StreamBatchScheduler::HasPendingTasks() const {
+    return std::any_of(streams.begin(), streams.end(), [](const auto &item) { return !item.second.tasks.empty(); });
+}
+
+bool StreamBatchScheduler::HasPendingTasks(StreamId stream) const {
+    const auto it = streams.find(stream);
+    return it != streams.end() && !it->second.tasks.empty();
+}
+
+StreamBatchScheduler::StreamId StreamBatchScheduler::SelectStream() {
+    // visit every stream once after the current one is exhausted
+    for (size_t i = 0; i <= order.size(); i++) {
+        StreamId stream = order[current];
+        if (credit > 0 && !streams[stream].tasks.empty()) {
+            credit--;
+            return stream;
+        }
+        current = (current + 1) % order.size();
+        credit = streams[order[current]].weight;
+    }
+    return nullptr;
+}
+
+void StreamBatchScheduler::WorkingFunction() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        task_available.wait(lock, [this] { return stop || HasPendingTasks(); });
+
+        StreamId stream = order.empty() ? nullptr : SelectStream();
+        if (stream == nullptr) {
+            if (stop)
+                break;
+            continue;
+        }
+
+        StreamQueue &queue = streams[stream];
+        Task task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        queue.submitted++;
+        running = stream;
+
+        lock.unlock();
+        task_done.notify_all(); // there is a free slot in the stream's queue now
+        try {
+            task();
+        } catch (const std::exception &e) {
+            GVA_ERROR("Batch scheduler task failed: %s", e.what());
+        }
+        lock.lock();
+
+        running = nullptr;
+        task_done.notify_all();
+    }
+}
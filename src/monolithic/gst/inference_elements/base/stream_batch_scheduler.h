@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Submits work of several streams sharing one model instance from a single thread.
+ *
+ * Each stream has its own ingress queue limited by max_queue_depth; producers block when their own queue is full,
+ * so a hot stream throttles only itself. Queues are served in weighted round-robin order: up to 'weight' tasks are
+ * taken from a stream before moving to the next one, so batches formed by the inference backend mix streams fairly.
+ */
+class StreamBatchScheduler {
+  public:
+    using StreamId = const void *;
+    using Task = std::function<void()>;
+
+    explicit StreamBatchScheduler(size_t max_queue_depth);
+    ~StreamBatchScheduler();
+
+    StreamBatchScheduler(const StreamBatchScheduler &) = delete;
+    StreamBatchScheduler &operator=(const StreamBatchScheduler &) = delete;
+
+    // Blocks while the stream's ingress queue is full
+    void Enqueue(StreamId stream, Task task, uint32_t weight = 1);
+    // Blocks until all queued tasks are executed
+    void WaitIdle();
+    // Executes pending tasks of the stream and forgets it
+    void RemoveStream(StreamId stream);
+
+    size_t GetMaxQueueDepth() const {
+        return max_queue_depth;
+    }
+
+  private:
+    struct StreamQueue {
+        std::deque<Task> tasks;
+        uint32_t weight = 1;
+        uint64_t submitted = 0;
+    };
+
+    void WorkingFunction();
+    bool HasPendingTasks() const;
+    bool HasPendingTasks(StreamId stream) const;
+    // Returns stream to take next task from, nullptr if all queues are empty
+    StreamId SelectStream();
+
+    const size_t max_queue_depth;
+
+    mutable std::mutex mutex;
+    std::condition_variable task_available;
+    std::condition_variable task_done;
+
+    std::map<StreamId, StreamQueue> streams;
+    std::vector<StreamId> order; // round-robin order of registered streams
+    size_t current = 0;          // index in 'order' of the stream being served
+    uint32_t credit = 0;         // tasks left to take from current stream
+    StreamId running = nullptr;  // stream which task is being executed
+    bool stop = false;
+
+    std::thread worker;
+};
@@ -211,6 +211,8 @@ PostProcessor::PostProcessor(InferenceImpl *inference_impl, GvaBaseInference *ba
         initializer.custom_postproc_lib = base_inference->custom_postproc_lib;
     }
 
+    initializer.stage_timer = inference_impl->GetStageTimer();
+
     // This won't be converted to shared ptr because of memory placement
     new (&post_proc_impl) PostProcessorImpl(initializer);
 }
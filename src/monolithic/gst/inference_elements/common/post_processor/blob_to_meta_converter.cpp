@@ -31,10 +31,19 @@
 #include <exception>
 #include <map>
 #include <string>
+#include <vector>
 
 using namespace post_processing;
 
 namespace {
+std::vector<GQuark> labelsToQuarks(const std::vector<std::string> &labels) {
+    std::vector<GQuark> quarks;
+    quarks.reserve(labels.size());
+    for (const auto &label : labels)
+        quarks.push_back(g_quark_from_string(label.c_str()));
+    return quarks;
+}
+
 std::string getConverterType(GstStructure *s) {
     if (s == nullptr || !gst_structure_has_field(s, "converter"))
         throw std::runtime_error("Couldn't determine converter type.");
@@ -131,7 +140,7 @@ std::string checkOnNameDeprecation(const std::string &converter_name) {
 BlobToMetaConverter::BlobToMetaConverter(Initializer initializer)
     : model_name(initializer.model_name), input_image_info(initializer.input_image_info),
       outputs_info(initializer.outputs_info), model_proc_output_info(std::move(initializer.model_proc_output_info)),
-      labels(initializer.labels) {
+      labels(initializer.labels), label_quarks(labelsToQuarks(labels)) {
 }
 
 BlobToMetaConverter::Ptr BlobToMetaConverter::create(Initializer initializer, ConverterType converter_type,
@@ -38,6 +38,7 @@ class BlobToMetaConverter {
 
     GstStructureUniquePtr model_proc_output_info;
     const std::vector<std::string> labels;
+    const std::vector<GQuark> label_quarks;
 
   protected:
     const ModelImageInputInfo &getModelInputImageInfo() const {
@@ -85,6 +86,11 @@ class BlobToMetaConverter {
         return labels;
     }
 
+    // GQuarks of labels, same order as getLabels()
+    const std::vector<GQuark> &getLabelQuarks() const {
+        return label_quarks;
+    }
+
     virtual ~BlobToMetaConverter() = default;
 };
 
@@ -95,6 +95,7 @@ ConverterFacade::ConverterFacade(std::unordered_set<std::string> all_layer_names
     coordinates_restorer =
         createCoordinatesRestorer(converter_type, attach_type, input_image_info, model_proc_output_info);
     meta_attacher = MetaAttacher::create(converter_type, attach_type);
+    setDetectionsPath();
 }
 
 ConverterFacade::ConverterFacade(GstStructure *model_proc_output_info, ConverterType converter_type,
@@ -126,6 +127,13 @@ ConverterFacade::ConverterFacade(GstStructure *model_proc_output_info, Converter
     coordinates_restorer =
         createCoordinatesRestorer(converter_type, attach_type, input_image_info, model_proc_output_info);
     meta_attacher = MetaAttacher::create(converter_type, attach_type);
+    setDetectionsPath();
+}
+
+void ConverterFacade::setDetectionsPath() {
+    detections_converter = dynamic_cast<BlobToROIConverter *>(blob_to_meta.get());
+    detections_restorer = dynamic_cast<ROICoordinatesRestorer *>(coordinates_restorer.get());
+    detections_attacher = dynamic_cast<ROIToFrameAttacher *>(meta_attacher.get());
 }
 
 ModelOutputsInfo ConverterFacade::extractProcessedModelOutputsInfo(const ModelOutputsInfo &all_output_blobs) const {
@@ -156,17 +164,44 @@ OutputBlobs ConverterFacade::extractProcessedOutputBlobs(const OutputBlobs &all_
     return processed_output_blobs;
 }
 
-void ConverterFacade::convert(const OutputBlobs &all_output_blobs, FramesWrapper &frames) const {
-    TensorsTable tensors_batch;
-    if (process_all_outputs)
-        tensors_batch = blob_to_meta->convert(all_output_blobs);
-    else {
-        const auto processed_output_blobs = extractProcessedOutputBlobs(all_output_blobs);
-        tensors_batch = blob_to_meta->convert(processed_output_blobs);
+void ConverterFacade::convert(const OutputBlobs &all_output_blobs, FramesWrapper &frames,
+                              InferenceBackend::StageTimer *stage_timer) const {
+    using InferenceBackend::Stage;
+    using InferenceBackend::StageScope;
+
+    if (detections_converter && detections_attacher) {
+        DetectionsTable detections_batch;
+        {
+            StageScope postproc_scope(stage_timer, Stage::POSTPROC);
+            if (process_all_outputs)
+                detections_batch = detections_converter->convertToDetections(all_output_blobs);
+            else
+                detections_batch =
+                    detections_converter->convertToDetections(extractProcessedOutputBlobs(all_output_blobs));
+
+            if (frames.need_coordinate_restore() && detections_restorer != nullptr)
+                detections_restorer->restore(detections_batch, frames);
+        }
+
+        StageScope attach_scope(stage_timer, Stage::ATTACH);
+        detections_attacher->attach(detections_batch, frames, *detections_converter);
+        return;
     }
 
-    if (frames.need_coordinate_restore() && coordinates_restorer != nullptr)
-        coordinates_restorer->restore(tensors_batch, frames);
+    TensorsTable tensors_batch;
+    {
+        StageScope postproc_scope(stage_timer, Stage::POSTPROC);
+        if (process_all_outputs)
+            tensors_batch = blob_to_meta->convert(all_output_blobs);
+        else {
+            const auto processed_output_blobs = extractProcessedOutputBlobs(all_output_blobs);
+            tensors_batch = blob_to_meta->convert(processed_output_blobs);
+        }
+
+        if (frames.need_coordinate_restore() && coordinates_restorer != nullptr)
+            coordinates_restorer->restore(tensors_batch, frames);
+    }
 
+    StageScope attach_scope(stage_timer, Stage::ATTACH);
     meta_attacher->attach(tensors_batch, frames, *blob_to_meta);
 }
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "blob_to_meta_converter.h"
+#include "converters/to_roi/blob_to_roi_converter.h"
 #include "coordinates_restorer.h"
 #include "meta_attacher.h"
 
@@ -30,6 +31,7 @@ class ConverterFacade {
 
     CoordinatesRestorer::Ptr createCoordinatesRestorer(ConverterType, AttachType, const ModelImageInputInfo &,
                                                        GstStructure *model_proc_output_info = nullptr);
+    void setDetectionsPath();
 
   protected:
     std::unordered_set<std::string> layer_names_to_process;
@@ -39,6 +41,11 @@ class ConverterFacade {
     CoordinatesRestorer::Ptr coordinates_restorer;
     MetaAttacher::Ptr meta_attacher;
 
+    // TO_ROI converters pass detections as DetectionRecord, objects below are owned by pointers above
+    BlobToROIConverter *detections_converter = nullptr;
+    ROICoordinatesRestorer *detections_restorer = nullptr;
+    ROIToFrameAttacher *detections_attacher = nullptr;
+
   public:
     ConverterFacade(std::unordered_set<std::string> all_layer_names, GstStructure *model_proc_output_info,
                     ConverterType converter_type, AttachType attach_type, const ModelImageInputInfo &input_image_info,
@@ -49,7 +56,9 @@ class ConverterFacade {
                     const std::string &model_name, const std::vector<std::string> &labels,
                     const std::string &custom_postproc_lib);
 
-    void convert(const OutputBlobs &all_output_blobs, FramesWrapper &frames) const;
+    // Conversion with coordinates restoring and attaching are timed as Stage::POSTPROC and Stage::ATTACH
+    void convert(const OutputBlobs &all_output_blobs, FramesWrapper &frames,
+                 InferenceBackend::StageTimer *stage_timer = nullptr) const;
 
     ConverterFacade() = default;
     ConverterFacade(const ConverterFacade &) = delete;
@@ -111,67 +111,146 @@ BlobToMetaConverter::Ptr BlobToROIConverter::create(BlobToMetaConverter::Initial
     throw std::runtime_error("ToROIConverter \"" + converter_name + "\" is not implemented.");
 }
 
-TensorsTable BlobToROIConverter::toTensorsTable(const DetectedObjectsTable &bboxes_table) const {
+GQuark BlobToROIConverter::getLabelQuark(const DetectedObject &object) const {
+    if (object.label.empty())
+        return 0;
+    const auto &labels = getLabels();
+    if (object.label_id < labels.size() && labels[object.label_id] == object.label)
+        return getLabelQuarks()[object.label_id];
+    return g_quark_from_string(object.label.c_str());
+}
+
+DetectionsTable BlobToROIConverter::toDetectionsTable(const DetectedObjectsTable &bboxes_table) const {
     size_t batch_size = getModelInputImageInfo().batch_size;
 
     if (bboxes_table.size() != batch_size)
         throw std::logic_error("bboxes_table and batch_size must be equal.");
 
-    TensorsTable tensors_table(batch_size);
+    DetectionsTable detections_table;
+    detections_table.detections.resize(batch_size);
+    detections_table.tensors.resize(batch_size);
 
     for (size_t image_id = 0; image_id < batch_size; ++image_id) {
-        auto &tensors_batch = tensors_table[image_id];
         const auto &bboxes = bboxes_table[image_id];
+        auto &detections = detections_table.detections[image_id];
+        auto &tensors = detections_table.tensors[image_id];
+        detections.reserve(bboxes.size());
+        tensors.reserve(bboxes.size());
         for (const DetectedObject &object : bboxes) {
-            tensors_batch.emplace_back(object.toTensor(getModelProcOutputInfo()));
+            detections.push_back(object.toDetectionRecord(getLabelQuark(object)));
+            tensors.push_back(object.tensors);
         }
     }
 
-    return tensors_table;
+    return detections_table;
 }
 
-TensorsTable BlobToROIConverter::storeObjects(DetectedObjectsTable &objects_table) const {
+DetectionsTable BlobToROIConverter::storeObjects(DetectedObjectsTable &objects_table) const {
     ITT_TASK(__FUNCTION__);
     if (need_nms)
         for (auto &objects : objects_table)
             runNms(objects);
 
-    return toTensorsTable(objects_table);
+    return toDetectionsTable(objects_table);
+}
+
+GstStructureUniquePtr BlobToROIConverter::createDetectionTensorTemplate() const {
+    const auto &model_proc_output_info = getModelProcOutputInfo();
+    GstStructureUniquePtr detection_tensor(model_proc_output_info ? gst_structure_copy(model_proc_output_info.get())
+                                                                  : gst_structure_new_empty("detection"),
+                                           gst_structure_free);
+
+    // fields are added once, so per-detection copy only replaces their values
+    gst_structure_set_name(detection_tensor.get(), "detection"); // make sure name="detection"
+    gst_structure_set(detection_tensor.get(), "label_id", G_TYPE_INT, 0, "confidence", G_TYPE_DOUBLE, 0.0, "x_min",
+                      G_TYPE_DOUBLE, 0.0, "x_max", G_TYPE_DOUBLE, 0.0, "y_min", G_TYPE_DOUBLE, 0.0, "y_max",
+                      G_TYPE_DOUBLE, 0.0, "rotation", G_TYPE_DOUBLE, 0.0, NULL);
+    return detection_tensor;
+}
+
+GstStructure *BlobToROIConverter::createDetectionTensor(const DetectionRecord &detection) const {
+    GstStructure *detection_tensor = gst_structure_copy(detection_tensor_template.get());
+    gst_structure_set(detection_tensor, "label_id", G_TYPE_INT, detection.label_id, "confidence", G_TYPE_DOUBLE,
+                      detection.confidence, "x_min", G_TYPE_DOUBLE, detection.x_min, "x_max", G_TYPE_DOUBLE,
+                      detection.x_max, "y_min", G_TYPE_DOUBLE, detection.y_min, "y_max", G_TYPE_DOUBLE,
+                      detection.y_max, "rotation", G_TYPE_DOUBLE, detection.rotation, NULL);
+    return detection_tensor;
+}
+
+TensorsTable BlobToROIConverter::convert(const OutputBlobs &output_blobs) {
+    DetectionsTable detections_table = convertToDetections(output_blobs);
+
+    TensorsTable tensors_table(detections_table.detections.size());
+    for (size_t image_id = 0; image_id < tensors_table.size(); ++image_id) {
+        const auto &detections = detections_table.detections[image_id];
+        auto &tensors = detections_table.tensors[image_id];
+        auto &tensors_batch = tensors_table[image_id];
+        tensors_batch.reserve(detections.size());
+        for (size_t i = 0; i < detections.size(); ++i) {
+            GstStructure *detection_tensor = createDetectionTensor(detections[i]);
+            if (detections[i].label)
+                gst_structure_set(detection_tensor, "label", G_TYPE_STRING, g_quark_to_string(detections[i].label),
+                                  NULL);
+
+            std::vector<GstStructure *> object_tensors{detection_tensor};
+            object_tensors.insert(object_tensors.end(), tensors[i].begin(), tensors[i].end());
+            tensors_batch.push_back(std::move(object_tensors));
+        }
+    }
+
+    return tensors_table;
+}
+
+NmsEngine::Options BlobToROIConverter::readNmsOptions() const {
+    NmsEngine::Options options;
+    options.iou_threshold = static_cast<float>(iou_threshold);
+
+    const auto &model_proc_output_info = getModelProcOutputInfo();
+    if (model_proc_output_info == nullptr)
+        return options;
+
+    gboolean class_aware = FALSE;
+    if (gst_structure_get_boolean(model_proc_output_info.get(), "nms_class_aware", &class_aware))
+        options.class_aware = class_aware;
+    int top_k = 0;
+    if (gst_structure_get_int(model_proc_output_info.get(), "nms_top_k", &top_k)) {
+        if (top_k < 0)
+            throw std::runtime_error("Post-processor parameter nms_top_k must not be negative.");
+        options.top_k = static_cast<size_t>(top_k);
+    }
+    return options;
+}
+
+std::vector<size_t> BlobToROIConverter::selectByNms(const std::vector<DetectedObject> &candidates) const {
+    ITT_TASK(__FUNCTION__);
+    // buffers are reused between frames processed by the same thread
+    thread_local NmsEngine nms;
+    nms.clear();
+    nms.reserve(candidates.size());
+    for (const auto &candidate : candidates)
+        nms.add(static_cast<float>(candidate.x), static_cast<float>(candidate.y), static_cast<float>(candidate.w),
+                static_cast<float>(candidate.h), static_cast<float>(candidate.confidence),
+                static_cast<uint32_t>(candidate.label_id));
+    return nms.run(nms_options);
 }
 
 void BlobToROIConverter::runNms(std::vector<DetectedObject> &candidates) const {
     ITT_TASK(__FUNCTION__);
-    std::sort(candidates.rbegin(), candidates.rend());
-
-    for (auto p_first_candidate = candidates.begin(); p_first_candidate != candidates.end(); ++p_first_candidate) {
-        const auto &first_candidate = *p_first_candidate;
-        double first_candidate_area = first_candidate.w * first_candidate.h;
-
-        for (auto p_candidate = p_first_candidate + 1; p_candidate != candidates.end();) {
-            const auto &candidate = *p_candidate;
-
-            const double inter_width = std::min(first_candidate.x + first_candidate.w, candidate.x + candidate.w) -
-                                       std::max(first_candidate.x, candidate.x);
-            const double inter_height = std::min(first_candidate.y + first_candidate.h, candidate.y + candidate.h) -
-                                        std::max(first_candidate.y, candidate.y);
-            if (inter_width <= 0.0 || inter_height <= 0.0) {
-                ++p_candidate;
-                continue;
-            }
-
-            const double inter_area = inter_width * inter_height;
-            const double candidate_area = candidate.w * candidate.h;
-            const double union_area = candidate_area + first_candidate_area - inter_area;
-
-            assert(union_area != 0 && "union_area is null. Both of the boxes have zero areas.");
-            const double overlap = inter_area / union_area;
-            if (overlap > iou_threshold) {
-                for (auto tensor : p_candidate->tensors) {
-                    gst_structure_free(tensor);
-                }
-                p_candidate = candidates.erase(p_candidate);
-            } else
-                ++p_candidate;
-        }
+    const auto kept = selectByNms(candidates);
+
+    std::vector<bool> is_kept(candidates.size(), false);
+    for (size_t index : kept)
+        is_kept[index] = true;
+    for (size_t i = 0; i < candidates.size(); i++) {
+        if (is_kept[i])
+            continue;
+        for (auto tensor : candidates[i].tensors)
+            gst_structure_free(tensor);
     }
+
+    std::vector<DetectedObject> result;
+    result.reserve(kept.size());
+    for (size_t index : kept)
+        result.push_back(std::move(candidates[index]));
+    candidates = std::move(result);
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "nms.h"
 #include "post_processor/blob_to_meta_converter.h"
 #include "post_processor/post_proc_common.h"
 
@@ -61,33 +62,38 @@ class BlobToROIConverter : public BlobToMetaConverter {
             return this->confidence > other.confidence;
         }
 
-        std::vector<GstStructure *> toTensor(const GstStructureUniquePtr &detection_result) const {
-            GstStructure *detection_tensor = gst_structure_copy(detection_result.get());
-
-            gst_structure_set_name(detection_tensor, "detection"); // make sure name="detection"
-            gst_structure_set(detection_tensor, "label_id", G_TYPE_INT, label_id, "confidence", G_TYPE_DOUBLE,
-                              confidence, "x_min", G_TYPE_DOUBLE, x, "x_max", G_TYPE_DOUBLE, x + w, "y_min",
-                              G_TYPE_DOUBLE, y, "y_max", G_TYPE_DOUBLE, y + h, "rotation", G_TYPE_DOUBLE, r, NULL);
-
-            if (not label.empty())
-                gst_structure_set(detection_tensor, "label", G_TYPE_STRING, label.c_str(), NULL);
-
-            std::vector<GstStructure *> results{detection_tensor};
-            for (size_t i = 0; i < tensors.size(); i++)
-                results.push_back(tensors[i]);
-
-            return results;
+        DetectionRecord toDetectionRecord(GQuark label_quark) const {
+            DetectionRecord record;
+            record.x_min = x;
+            record.y_min = y;
+            record.x_max = x + w;
+            record.y_max = y + h;
+            record.rotation = r;
+            record.confidence = confidence;
+            record.label_id = static_cast<int>(label_id);
+            record.label = label_quark;
+            return record;
         }
     };
     using DetectedObjectsTable = std::vector<std::vector<DetectedObject>>;
 
-    TensorsTable storeObjects(DetectedObjectsTable &objects) const;
+    DetectionsTable storeObjects(DetectedObjectsTable &objects) const;
     void runNms(std::vector<DetectedObject> &candidates) const;
-    TensorsTable toTensorsTable(const DetectedObjectsTable &bboxes_table) const;
+    // Returns indices of candidates surviving NMS, most confident first. Candidates are not modified.
+    std::vector<size_t> selectByNms(const std::vector<DetectedObject> &candidates) const;
+    DetectionsTable toDetectionsTable(const DetectedObjectsTable &bboxes_table) const;
+    GQuark getLabelQuark(const DetectedObject &object) const;
+    NmsEngine::Options readNmsOptions() const;
+    GstStructureUniquePtr createDetectionTensorTemplate() const;
 
     const double confidence_threshold;
     const bool need_nms;
     const double iou_threshold;
+    const NmsEngine::Options nms_options;
+
+  private:
+    // model-proc output info with "detection" fields in their final order, copied for each attached detection
+    const GstStructureUniquePtr detection_tensor_template;
 
   public:
     BlobToROIConverter() = delete;
@@ -95,10 +101,16 @@ class BlobToROIConverter : public BlobToMetaConverter {
     BlobToROIConverter(BlobToMetaConverter::Initializer initializer, double confidence_threshold, bool need_nms,
                        double iou_threshold)
         : BlobToMetaConverter(std::move(initializer)), confidence_threshold(confidence_threshold), need_nms(need_nms),
-          iou_threshold(iou_threshold) {
+          iou_threshold(iou_threshold), nms_options(readNmsOptions()),
+          detection_tensor_template(createDetectionTensorTemplate()) {
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) = 0;
+    // Legacy tensors view of detections: "detection" tensor with "label" field followed by additional tensors
+    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    virtual DetectionsTable convertToDetections(const OutputBlobs &output_blobs) = 0;
+
+    // Creates "detection" tensor attached to GstVideoRegionOfInterestMeta of the detection
+    GstStructure *createDetectionTensor(const DetectionRecord &detection) const;
 
     static BlobToMetaConverter::Ptr create(BlobToMetaConverter::Initializer initializer,
                                            const std::string &converter_name, const std::string &custom_postproc_lib);
@@ -126,7 +126,7 @@ void BoxesLabelsScoresConverter::parseOutputBlob(const float *boxes_data, const
     }
 }
 
-TensorsTable BoxesLabelsScoresConverter::convert(const OutputBlobs &output_blobs) {
+DetectionsTable BoxesLabelsScoresConverter::convertToDetections(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -151,5 +151,5 @@ TensorsTable BoxesLabelsScoresConverter::convert(const OutputBlobs &output_blobs
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do ATSS post-processing."));
     }
-    return TensorsTable{};
+    return DetectionsTable{};
 }
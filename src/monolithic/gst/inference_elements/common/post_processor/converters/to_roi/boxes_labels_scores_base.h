@@ -43,7 +43,7 @@ class BoxesLabelsScoresConverter : public BlobToROIConverter {
         : BlobToROIConverter(std::move(initializer), confidence_threshold, false, 0.0) {
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectionsTable convertToDetections(const OutputBlobs &output_blobs) override;
 
     static bool isValidModelBoxesOutput(const std::map<std::string, std::vector<size_t>> &model_outputs_info);
     static bool isValidModelAdditionalOutput(const std::map<std::string, std::vector<size_t>> &model_outputs_info,
@@ -113,7 +113,7 @@ void CenterfaceConverter::addLandmarksTensor(DetectedObject &detected_object, co
     detected_object.tensors.push_back(tensor);
 }
 
-TensorsTable CenterfaceConverter::convert(const OutputBlobs &output_blobs) {
+DetectionsTable CenterfaceConverter::convertToDetections(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -146,5 +146,5 @@ TensorsTable CenterfaceConverter::convert(const OutputBlobs &output_blobs) {
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do Centerface post-processing."));
     }
-    return TensorsTable{};
+    return DetectionsTable{};
 }
@@ -38,7 +38,7 @@ class CenterfaceConverter : public BlobToROIConverter {
     const float *parseOutputBlob(const OutputBlobs &output_blobs, const std::string &key, size_t batch_size,
                                  size_t batch_number) const;
     void addLandmarksTensor(DetectedObject &detected_object, const float *landmarks, int num_of_landmarks) const;
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectionsTable convertToDetections(const OutputBlobs &output_blobs) override;
 
     static std::string getName() {
         return "centerface";
@@ -22,7 +22,7 @@
 
 using namespace post_processing;
 
-TensorsTable CustomToRoiConverter::convert(const OutputBlobs &output_blobs) {
+DetectionsTable CustomToRoiConverter::convertToDetections(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -214,5 +214,5 @@ TensorsTable CustomToRoiConverter::convert(const OutputBlobs &output_blobs) {
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do YoloV8 post-processing."));
     }
-    return TensorsTable{};
+    return DetectionsTable{};
 }
@@ -101,7 +101,7 @@ void DetectionOutputConverter::parseOutputBlob(const InferenceBackend::OutputBlo
     }
 }
 
-TensorsTable DetectionOutputConverter::convert(const OutputBlobs &output_blobs) {
+DetectionsTable DetectionOutputConverter::convertToDetections(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
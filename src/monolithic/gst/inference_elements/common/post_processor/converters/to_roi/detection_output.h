@@ -30,7 +30,7 @@ class DetectionOutputConverter : public BlobToROIConverter {
         : BlobToROIConverter(std::move(initializer), confidence_threshold, false, 0.0) {
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectionsTable convertToDetections(const OutputBlobs &output_blobs) override;
 
     static const size_t model_object_size = 7; // SSD DetectionOutput format
 
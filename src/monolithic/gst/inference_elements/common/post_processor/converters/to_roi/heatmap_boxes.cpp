@@ -74,7 +74,7 @@ void HeatMapBoxesConverter::parseOutputBlob(const float *data, const std::vector
     }
 }
 
-TensorsTable HeatMapBoxesConverter::convert(const OutputBlobs &output_blobs) {
+DetectionsTable HeatMapBoxesConverter::convertToDetections(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -102,7 +102,7 @@ TensorsTable HeatMapBoxesConverter::convert(const OutputBlobs &output_blobs) {
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do heatmap post-processing."));
     }
-    return TensorsTable{};
+    return DetectionsTable{};
 }
 
 cv::Rect2d HeatMapBoxesConverter::findBoxDimensions(std::vector<cv::Point> &contour) const {
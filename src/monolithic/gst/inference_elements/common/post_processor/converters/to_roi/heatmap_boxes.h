@@ -67,7 +67,7 @@ class HeatMapBoxesConverter : public BlobToROIConverter {
         }
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectionsTable convertToDetections(const OutputBlobs &output_blobs) override;
 
     static std::string getName() {
         return "heatmap_boxes";
@@ -20,7 +20,7 @@
 
 using namespace post_processing;
 
-TensorsTable MaskRCNNConverter::convert(const OutputBlobs &output_blobs) {
+DetectionsTable MaskRCNNConverter::convertToDetections(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -167,5 +167,5 @@ TensorsTable MaskRCNNConverter::convert(const OutputBlobs &output_blobs) {
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do Mask-RCNN post-processing."));
     }
-    return TensorsTable{};
+    return DetectionsTable{};
 }
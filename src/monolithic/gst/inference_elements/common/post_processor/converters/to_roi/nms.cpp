@@ -0,0 +1,160 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "nms.h"
+
+#include "inference_backend/logger.h"
+
+#include <algorithm>
+#include <numeric>
+
+// Overlap kernel is compiled for several instruction sets, the best one is selected when the library is loaded
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(_WIN32)
+#define NMS_MULTIVERSION __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define NMS_MULTIVERSION
+#endif
+
+using namespace post_processing;
+
+namespace {
+
+constexpr size_t BLOCK_SIZE = 64; // candidates per suppression bitmask word
+
+struct Box {
+    float x_min;
+    float y_min;
+    float x_max;
+    float y_max;
+    float area;
+    uint32_t label;
+};
+
+struct Block {
+    const float *x_min;
+    const float *y_min;
+    const float *x_max;
+    const float *y_max;
+    const float *area;
+    const uint32_t *label;
+};
+
+// Returns bitmask of block candidates overlapping the box with IoU above threshold.
+// IoU > threshold is checked as intersection > threshold * union, so no division is needed.
+NMS_MULTIVERSION
+uint64_t OverlapMask(const Box &box, const Block &block, float iou_threshold, bool class_aware) {
+    // branch-free, so the loop is vectorized
+    const uint32_t any_class = !class_aware;
+    uint32_t overlaps[BLOCK_SIZE];
+    for (size_t i = 0; i < BLOCK_SIZE; i++) {
+        const float inter_width =
+            std::max(std::min(box.x_max, block.x_max[i]) - std::max(box.x_min, block.x_min[i]), 0.f);
+        const float inter_height =
+            std::max(std::min(box.y_max, block.y_max[i]) - std::max(box.y_min, block.y_min[i]), 0.f);
+        const float inter_area = inter_width * inter_height;
+        const float union_area = box.area + block.area[i] - inter_area;
+        const uint32_t same_class = static_cast<uint32_t>(block.label[i] == box.label) | any_class;
+        // degenerate boxes may have negative area, so non-overlapping boxes are excluded explicitly
+        const uint32_t overlap = static_cast<uint32_t>(inter_area > 0.f) &
+                                 static_cast<uint32_t>(inter_area > iou_threshold * union_area);
+        overlaps[i] = overlap & same_class;
+    }
+
+    uint64_t mask = 0;
+    for (size_t i = 0; i < BLOCK_SIZE; i++)
+        mask |= static_cast<uint64_t>(overlaps[i]) << i;
+    return mask;
+}
+
+} // namespace
+
+void NmsEngine::reserve(size_t capacity) {
+    x_min.reserve(capacity);
+    y_min.reserve(capacity);
+    x_max.reserve(capacity);
+    y_max.reserve(capacity);
+    confidence.reserve(capacity);
+    label.reserve(capacity);
+}
+
+void NmsEngine::clear() {
+    x_min.clear();
+    y_min.clear();
+    x_max.clear();
+    y_max.clear();
+    confidence.clear();
+    label.clear();
+}
+
+void NmsEngine::add(float x, float y, float w, float h, float confidence, uint32_t label_id) {
+    x_min.push_back(x);
+    y_min.push_back(y);
+    x_max.push_back(x + w);
+    y_max.push_back(y + h);
+    this->confidence.push_back(confidence);
+    label.push_back(label_id);
+}
+
+const std::vector<size_t> &NmsEngine::run(const Options &options) {
+    ITT_TASK(__FUNCTION__);
+    kept.clear();
+    const size_t candidates_num = size();
+    if (candidates_num == 0)
+        return kept;
+
+    // Only indices are ordered, ties keep order of addition so results are deterministic
+    order.resize(candidates_num);
+    std::iota(order.begin(), order.end(), 0);
+    const auto more_confident = [this](uint32_t a, uint32_t b) {
+        return confidence[a] > confidence[b] || (confidence[a] == confidence[b] && a < b);
+    };
+    const size_t count = (options.top_k > 0 && options.top_k < candidates_num) ? options.top_k : candidates_num;
+    std::partial_sort(order.begin(), order.begin() + count, order.end(), more_confident);
+
+    // Gather candidates in confidence order, tail of the last block is padded with empty boxes
+    const size_t blocks_num = (count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    const size_t padded = blocks_num * BLOCK_SIZE;
+    sorted_x_min.assign(padded, 0.f);
+    sorted_y_min.assign(padded, 0.f);
+    sorted_x_max.assign(padded, 0.f);
+    sorted_y_max.assign(padded, 0.f);
+    sorted_area.assign(padded, 0.f);
+    sorted_label.assign(padded, 0);
+    for (size_t i = 0; i < count; i++) {
+        const uint32_t index = order[i];
+        sorted_x_min[i] = x_min[index];
+        sorted_y_min[i] = y_min[index];
+        sorted_x_max[i] = x_max[index];
+        sorted_y_max[i] = y_max[index];
+        sorted_area[i] = (x_max[index] - x_min[index]) * (y_max[index] - y_min[index]);
+        sorted_label[i] = label[index];
+    }
+
+    suppressed.assign(blocks_num, 0);
+    for (size_t i = 0; i < count; i++) {
+        const size_t own_block = i / BLOCK_SIZE;
+        if ((suppressed[own_block] >> (i % BLOCK_SIZE)) & 1)
+            continue;
+        kept.push_back(order[i]);
+
+        const Box box = {sorted_x_min[i], sorted_y_min[i], sorted_x_max[i],
+                         sorted_y_max[i], sorted_area[i],  sorted_label[i]};
+        for (size_t block = own_block; block < blocks_num; block++) {
+            if (suppressed[block] == ~uint64_t(0))
+                continue;
+            const size_t offset = block * BLOCK_SIZE;
+            uint64_t mask = OverlapMask(box,
+                                        {&sorted_x_min[offset], &sorted_y_min[offset], &sorted_x_max[offset],
+                                         &sorted_y_max[offset], &sorted_area[offset], &sorted_label[offset]},
+                                        options.iou_threshold, options.class_aware);
+            // only less confident candidates are suppressed by the box
+            if (block == own_block)
+                mask &= (~uint64_t(0) << (i % BLOCK_SIZE)) << 1;
+            suppressed[block] |= mask;
+        }
+    }
+    return kept;
+}
@@ -0,0 +1,54 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace post_processing {
+
+/**
+ * Greedy non-maximum suppression over axis-aligned boxes.
+ *
+ * Candidates are kept in structure-of-arrays layout and ordered through a compact index array, so the IoU of a kept
+ * box against a block of 64 candidates is computed by a branch-free vectorizable loop. Suppressed candidates are
+ * marked in a bitmask instead of being removed from the candidate list.
+ */
+class NmsEngine {
+  public:
+    struct Options {
+        float iou_threshold = 0.5f;
+        bool class_aware = false; // suppress only candidates having the same label_id
+        size_t top_k = 0;         // consider only top_k most confident candidates, 0 - all of them
+    };
+
+    void reserve(size_t capacity);
+    void clear();
+    void add(float x, float y, float w, float h, float confidence, uint32_t label_id);
+
+    size_t size() const {
+        return confidence.size();
+    }
+
+    // Returns indices (in order of add calls) of kept candidates, most confident first
+    const std::vector<size_t> &run(const Options &options);
+
+  private:
+    // Input candidates
+    std::vector<float> x_min, y_min, x_max, y_max, confidence;
+    std::vector<uint32_t> label;
+
+    // Candidates reordered by confidence, padded to whole blocks
+    std::vector<float> sorted_x_min, sorted_y_min, sorted_x_max, sorted_y_max, sorted_area;
+    std::vector<uint32_t> sorted_label;
+    std::vector<uint32_t> order;
+    std::vector<uint64_t> suppressed;
+    std::vector<size_t> kept;
+};
+
+} // namespace post_processing
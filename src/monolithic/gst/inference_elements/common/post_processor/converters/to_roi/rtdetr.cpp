@@ -120,7 +120,7 @@ void RTDETRConverter::parseOutputBlobs(const float *logits_data, const std::vect
     }
 }
 
-TensorsTable RTDETRConverter::convert(const OutputBlobs &output_blobs) {
+DetectionsTable RTDETRConverter::convertToDetections(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -172,5 +172,5 @@ TensorsTable RTDETRConverter::convert(const OutputBlobs &output_blobs) {
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do RT-DETR post-processing."));
     }
-    return TensorsTable{};
+    return DetectionsTable{};
 }
\ No newline at end of file
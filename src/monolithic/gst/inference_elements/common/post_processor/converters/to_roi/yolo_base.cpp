@@ -356,7 +356,7 @@ BlobToMetaConverter::Ptr YOLOBaseConverter::create(BlobToMetaConverter::Initiali
     return nullptr;
 }
 
-TensorsTable YOLOBaseConverter::convert(const OutputBlobs &output_blobs) {
+DetectionsTable YOLOBaseConverter::convertToDetections(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -388,5 +388,5 @@ TensorsTable YOLOBaseConverter::convert(const OutputBlobs &output_blobs) {
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do YoloV3 post-processing."));
     }
-    return TensorsTable{};
+    return DetectionsTable{};
 }
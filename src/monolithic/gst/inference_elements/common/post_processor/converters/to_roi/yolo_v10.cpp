@@ -63,7 +63,7 @@ void YOLOv10Converter::parseOutputBlob(const float *data, const std::vector<size
     }
 }
 
-TensorsTable YOLOv10Converter::convert(const OutputBlobs &output_blobs) {
+DetectionsTable YOLOv10Converter::convertToDetections(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -89,5 +89,5 @@ TensorsTable YOLOv10Converter::convert(const OutputBlobs &output_blobs) {
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do YoloV10 post-processing."));
     }
-    return TensorsTable{};
+    return DetectionsTable{};
 }
\ No newline at end of file
@@ -16,7 +16,7 @@
 
 using namespace post_processing;
 
-TensorsTable YOLOv26ObbConverter::convert(const OutputBlobs &output_blobs) {
+DetectionsTable YOLOv26ObbConverter::convertToDetections(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -42,10 +42,10 @@ TensorsTable YOLOv26ObbConverter::convert(const OutputBlobs &output_blobs) {
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do yolo26-obb post-processing."));
     }
-    return TensorsTable{};
+    return DetectionsTable{};
 }
 
-TensorsTable YOLOv26PoseConverter::convert(const OutputBlobs &output_blobs) {
+DetectionsTable YOLOv26PoseConverter::convertToDetections(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -71,7 +71,7 @@ TensorsTable YOLOv26PoseConverter::convert(const OutputBlobs &output_blobs) {
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do yolo26-pose post-processing."));
     }
-    return TensorsTable{};
+    return DetectionsTable{};
 }
 
 static const std::vector<std::string> point_names = {
@@ -221,7 +221,7 @@ void YOLOv26SegConverter::parseOutputBlob(const float *boxes_data, const std::ve
     }
 }
 
-TensorsTable YOLOv26SegConverter::convert(const OutputBlobs &output_blobs) {
+DetectionsTable YOLOv26SegConverter::convertToDetections(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -266,5 +266,5 @@ TensorsTable YOLOv26SegConverter::convert(const OutputBlobs &output_blobs) {
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do yolo26-seg post-processing."));
     }
-    return TensorsTable{};
+    return DetectionsTable{};
 }
@@ -53,7 +53,7 @@ class YOLOv26ObbConverter : public YOLOv26Converter {
         : YOLOv26Converter(std::move(initializer), confidence_threshold, iou_threshold) {
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectionsTable convertToDetections(const OutputBlobs &output_blobs) override;
 
     static std::string getName() {
         return "yolo_v26_obb";
@@ -71,7 +71,7 @@ class YOLOv26PoseConverter : public YOLOv26Converter {
         : YOLOv26Converter(std::move(initializer), confidence_threshold, iou_threshold) {
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectionsTable convertToDetections(const OutputBlobs &output_blobs) override;
 
     static std::string getName() {
         return "yolo_v26_pose";
@@ -88,7 +88,7 @@ class YOLOv26SegConverter : public YOLOv26Converter {
         : YOLOv26Converter(std::move(initializer), confidence_threshold, iou_threshold) {
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectionsTable convertToDetections(const OutputBlobs &output_blobs) override;
 
     static std::string getName() {
         return "yolo_v26_seg";
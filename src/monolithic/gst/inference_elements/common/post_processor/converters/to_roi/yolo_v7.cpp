@@ -71,7 +71,7 @@ void YOLOv7Converter::parseOutputBlob(const float *data, const std::vector<size_
     }
 }
 
-TensorsTable YOLOv7Converter::convert(const OutputBlobs &output_blobs) {
+DetectionsTable YOLOv7Converter::convertToDetections(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -97,5 +97,5 @@ TensorsTable YOLOv7Converter::convert(const OutputBlobs &output_blobs) {
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do YoloV7 post-processing."));
     }
-    return TensorsTable{};
+    return DetectionsTable{};
 }
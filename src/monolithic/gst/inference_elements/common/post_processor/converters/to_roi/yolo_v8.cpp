@@ -14,13 +14,53 @@
 #include <dlstreamer/gst/videoanalytics/tensor.h>
 #include <gst/gst.h>
 
+#include <algorithm>
+#include <cmath>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <vector>
 
+// Class scores scan is compiled for several instruction sets, the best one is selected when the library is loaded
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(_WIN32)
+#define YOLOV8_MULTIVERSION __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define YOLOV8_MULTIVERSION
+#endif
+
 using namespace post_processing;
 
+namespace {
+
+/*
+Output tensor is [C, N]: values of channel c for all proposals are contiguous and value of proposal i is at c * N + i.
+Proposals are evaluated channel row by channel row, so the tensor is never transposed and only proposals above
+confidence threshold are gathered from remaining channels.
+*/
+YOLOV8_MULTIVERSION
+void findBestClasses(const float *data, size_t proposal_count, size_t first_class_channel, size_t class_count,
+                     std::vector<float> &best_scores, std::vector<uint32_t> &best_classes) {
+    const float *scores = data + first_class_channel * proposal_count;
+    best_scores.assign(scores, scores + proposal_count);
+    best_classes.assign(proposal_count, 0);
+    float *best_score = best_scores.data();
+    uint32_t *best_class = best_classes.data();
+    for (uint32_t class_id = 1; class_id < class_count; class_id++) {
+        scores += proposal_count;
+        // branch-free, so the loop is vectorized; first maximum wins as in cv::minMaxLoc
+        for (size_t i = 0; i < proposal_count; i++) {
+            const float score = scores[i];
+            const float best = best_score[i];
+            const uint32_t best_id = best_class[i];
+            best_score[i] = score > best ? score : best;
+            best_class[i] = score > best ? class_id : best_id;
+        }
+    }
+}
+
+} // namespace
+
 void YOLOv8Converter::parseOutputBlob(const float *data, const std::vector<size_t> &dims,
                                       std::vector<DetectedObject> &objects, bool oob) const {
 
@@ -35,34 +75,29 @@ void YOLOv8Converter::parseOutputBlob(const float *data, const std::vector<size_
 
     size_t object_size = dims[dims_size - 2];
     size_t max_proposal_count = dims[dims_size - 1];
+    size_t class_count = object_size - YOLOV8_OFFSET_CS - (oob ? 1 : 0);
 
-    // transpose
-    cv::Mat outputs(object_size, max_proposal_count, CV_32F, (float *)data);
-    cv::transpose(outputs, outputs);
-    float *output_data = (float *)outputs.data;
+    // buffers are reused between frames processed by the same thread
+    thread_local std::vector<float> best_scores;
+    thread_local std::vector<uint32_t> best_classes;
+    findBestClasses(data, max_proposal_count, YOLOV8_OFFSET_CS, class_count, best_scores, best_classes);
 
     for (size_t i = 0; i < max_proposal_count; ++i) {
-        float *classes_scores = output_data + YOLOV8_OFFSET_CS;
-        cv::Mat scores(1, object_size - YOLOV8_OFFSET_CS - (oob ? 1 : 0), CV_32FC1, classes_scores);
-        cv::Point class_id;
-        double maxClassScore;
-        cv::minMaxLoc(scores, 0, &maxClassScore, 0, &class_id);
-        if (maxClassScore > confidence_threshold) {
-
-            float x = output_data[YOLOV8_OFFSET_X];
-            float y = output_data[YOLOV8_OFFSET_Y];
-            float w = output_data[YOLOV8_OFFSET_W];
-            float h = output_data[YOLOV8_OFFSET_H];
-            float r = oob ? output_data[object_size - 1] : 0;
-            objects.push_back(DetectedObject(x, y, w, h, r, maxClassScore, class_id.x,
-                                             BlobToMetaConverter::getLabelByLabelId(class_id.x), 1.0f / input_width,
-                                             1.0f / input_height, true));
+        if (best_scores[i] > confidence_threshold) {
+            const float *channels = data + i;
+            float x = channels[YOLOV8_OFFSET_X * max_proposal_count];
+            float y = channels[YOLOV8_OFFSET_Y * max_proposal_count];
+            float w = channels[YOLOV8_OFFSET_W * max_proposal_count];
+            float h = channels[YOLOV8_OFFSET_H * max_proposal_count];
+            float r = oob ? channels[(object_size - 1) * max_proposal_count] : 0;
+            objects.push_back(DetectedObject(x, y, w, h, r, best_scores[i], best_classes[i],
+                                             BlobToMetaConverter::getLabelByLabelId(best_classes[i]),
+                                             1.0f / input_width, 1.0f / input_height, true));
         }
-        output_data += object_size;
     }
 }
 
-TensorsTable YOLOv8Converter::convert(const OutputBlobs &output_blobs) {
+DetectionsTable YOLOv8Converter::convertToDetections(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -88,10 +123,10 @@ TensorsTable YOLOv8Converter::convert(const OutputBlobs &output_blobs) {
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do YoloV8 post-processing."));
     }
-    return TensorsTable{};
+    return DetectionsTable{};
 }
 
-TensorsTable YOLOv8ObbConverter::convert(const OutputBlobs &output_blobs) {
+DetectionsTable YOLOv8ObbConverter::convertToDetections(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -117,10 +152,10 @@ TensorsTable YOLOv8ObbConverter::convert(const OutputBlobs &output_blobs) {
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do YoloV8-OBB post-processing."));
     }
-    return TensorsTable{};
+    return DetectionsTable{};
 }
 
-TensorsTable YOLOv8PoseConverter::convert(const OutputBlobs &output_blobs) {
+DetectionsTable YOLOv8PoseConverter::convertToDetections(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -146,7 +181,7 @@ TensorsTable YOLOv8PoseConverter::convert(const OutputBlobs &output_blobs) {
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do YoloV8 post-processing."));
     }
-    return TensorsTable{};
+    return DetectionsTable{};
 }
 
 static const std::vector<std::string> point_names = {
@@ -173,20 +208,19 @@ void YOLOv8PoseConverter::parseOutputBlob(const float *data, const std::vector<s
     size_t max_proposal_count = dims[boxes_dims_size - 1];
     size_t keypoint_count = (object_size - YOLOV8_OFFSET_CS - 1) / 3;
 
-    // Transpose objects
-    cv::Mat outputs(object_size, max_proposal_count, CV_32F, (float *)data);
-    cv::transpose(outputs, outputs);
-    float *output_data = (float *)outputs.data;
-
+    // Single confidence channel is scanned first, see findBestClasses
+    const float *confidences_row = data + YOLOV8_OFFSET_CS * max_proposal_count;
     for (size_t i = 0; i < max_proposal_count; ++i) {
-        float confidence = output_data[YOLOV8_OFFSET_CS];
+        float confidence = confidences_row[i];
         if (confidence > confidence_threshold) {
+            const float *channels = data + i;
+            const auto channel = [channels, max_proposal_count](size_t c) { return channels[c * max_proposal_count]; };
 
             // coordinates are relative to bounding box center
-            float w = output_data[YOLOV8_OFFSET_W];
-            float h = output_data[YOLOV8_OFFSET_H];
-            float x = output_data[YOLOV8_OFFSET_X] - w / 2;
-            float y = output_data[YOLOV8_OFFSET_Y] - h / 2;
+            float w = channel(YOLOV8_OFFSET_W);
+            float h = channel(YOLOV8_OFFSET_H);
+            float x = channel(YOLOV8_OFFSET_X) - w / 2;
+            float y = channel(YOLOV8_OFFSET_Y) - h / 2;
 
             auto detected_object =
                 DetectedObject(x, y, w, h, 0, confidence, 0, BlobToMetaConverter::getLabelByLabelId(0),
@@ -196,11 +230,11 @@ void YOLOv8PoseConverter::parseOutputBlob(const float *data, const std::vector<s
             cv::Mat positions(keypoint_count, 2, CV_32F);
             std::vector<float> confidences(keypoint_count, 0.0f);
             for (size_t k = 0; k < keypoint_count; k++) {
-                float position_x = output_data[YOLOV8_OFFSET_CS + 1 + k * 3 + 0];
-                float position_y = output_data[YOLOV8_OFFSET_CS + 1 + k * 3 + 1];
+                float position_x = channel(YOLOV8_OFFSET_CS + 1 + k * 3 + 0);
+                float position_y = channel(YOLOV8_OFFSET_CS + 1 + k * 3 + 1);
                 positions.at<float>(k, 0) = (position_x - x) / w;
                 positions.at<float>(k, 1) = (position_y - y) / h;
-                confidences[k] = output_data[YOLOV8_OFFSET_CS + 1 + k * 3 + 2];
+                confidences[k] = channel(YOLOV8_OFFSET_CS + 1 + k * 3 + 2);
             }
 
             // create tensor with keypoints
@@ -223,15 +257,57 @@ void YOLOv8PoseConverter::parseOutputBlob(const float *data, const std::vector<s
             detected_object.tensors.push_back(tensor.gst_structure());
             objects.push_back(detected_object);
         }
-        output_data += object_size;
+    }
+}
+
+bool YOLOv8SegConverter::readU8Masks() const {
+    const auto &model_proc_output_info = getModelProcOutputInfo();
+    if (model_proc_output_info == nullptr)
+        return false;
+    const gchar *precision = gst_structure_get_string(model_proc_output_info.get(), "mask_precision");
+    if (precision == nullptr || g_ascii_strcasecmp(precision, "FP32") == 0)
+        return false;
+    if (g_ascii_strcasecmp(precision, "U8") == 0)
+        return true;
+    throw std::invalid_argument(std::string("Unsupported mask_precision: ") + precision + ". Expected FP32 or U8.");
+}
 
-        // Future optimization: generate masks after running NMS algorithm on detected objects
+bool YOLOv8SegConverter::readBoxMasks() const {
+    const auto &model_proc_output_info = getModelProcOutputInfo();
+    if (model_proc_output_info == nullptr)
+        return false;
+    const gchar *resolution = gst_structure_get_string(model_proc_output_info.get(), "mask_resolution");
+    if (resolution == nullptr || g_ascii_strcasecmp(resolution, "prototype") == 0)
+        return false;
+    if (g_ascii_strcasecmp(resolution, "box") == 0)
+        return true;
+    throw std::invalid_argument(std::string("Unsupported mask_resolution: ") + resolution +
+                                ". Expected prototype or box.");
+}
+
+namespace {
+
+// Applies sigmoid to mask logits, probabilities of U8 mask are scaled to [0, 255]
+void activateMask(const cv::Mat &logits, cv::Mat &mask) {
+    for (int row = 0; row < logits.rows; row++) {
+        const float *src = logits.ptr<float>(row);
+        if (mask.depth() == CV_8U) {
+            uint8_t *dst = mask.ptr<uint8_t>(row);
+            for (int col = 0; col < logits.cols; col++)
+                dst[col] = cv::saturate_cast<uint8_t>(255.f / (1 + std::exp(-src[col])));
+        } else {
+            float *dst = mask.ptr<float>(row);
+            for (int col = 0; col < logits.cols; col++)
+                dst[col] = 1 / (1 + std::exp(-src[col]));
+        }
     }
 }
 
+} // namespace
+
 void YOLOv8SegConverter::parseOutputBlob(const float *boxes_data, const std::vector<size_t> &boxes_dims,
-                                         const float *masks_data, const std::vector<size_t> &masks_dims,
-                                         std::vector<DetectedObject> &objects) const {
+                                         const std::vector<size_t> &masks_dims, std::vector<DetectedObject> &objects,
+                                         std::vector<float> &proposals) const {
     size_t boxes_dims_size = boxes_dims.size();
     size_t masks_dims_size = masks_dims.size();
     size_t input_width = getModelInputImageInfo().width;
@@ -246,76 +322,113 @@ void YOLOv8SegConverter::parseOutputBlob(const float *boxes_data, const std::vec
     size_t max_proposal_count = boxes_dims[boxes_dims_size - 1];
     size_t mask_count = masks_dims[masks_dims_size - 3];
     size_t class_count = object_size - mask_count - YOLOV8_OFFSET_CS;
-    size_t mask_height = masks_dims[masks_dims_size - 2];
-    size_t mask_width = masks_dims[masks_dims_size - 1];
-
-    // Transpose objects
-    cv::Mat outputs(object_size, max_proposal_count, CV_32F, (float *)boxes_data);
-    cv::transpose(outputs, outputs);
-    float *output_data = (float *)outputs.data;
 
-    // Map masks
-    cv::Mat masks(mask_count, mask_width * mask_height, CV_32F, (float *)masks_data);
+    // buffers are reused between frames processed by the same thread
+    thread_local std::vector<float> best_scores;
+    thread_local std::vector<uint32_t> best_classes;
+    findBestClasses(boxes_data, max_proposal_count, YOLOV8_OFFSET_CS, class_count, best_scores, best_classes);
 
     for (size_t i = 0; i < max_proposal_count; ++i) {
-        cv::Mat class_scores(1, class_count, CV_32F, output_data + YOLOV8_OFFSET_CS);
-        cv::Mat mask_scores(1, mask_count, CV_32F, output_data + YOLOV8_OFFSET_CS + class_count);
-        cv::Point class_id;
-        double max_class_score;
-        cv::minMaxLoc(class_scores, 0, &max_class_score, 0, &class_id);
-        if (max_class_score > confidence_threshold) {
+        if (best_scores[i] > confidence_threshold) {
+            const float *channels = boxes_data + i;
+            const auto channel = [channels, max_proposal_count](size_t c) { return channels[c * max_proposal_count]; };
 
             // coordinates are relative to bounding box center
-            float w = output_data[YOLOV8_OFFSET_W];
-            float h = output_data[YOLOV8_OFFSET_H];
-            float x = output_data[YOLOV8_OFFSET_X] - w / 2;
-            float y = output_data[YOLOV8_OFFSET_Y] - h / 2;
-
-            auto detected_object = DetectedObject(x, y, w, h, 0, max_class_score, class_id.x,
-                                                  BlobToMetaConverter::getLabelByLabelId(class_id.x),
-                                                  1.0f / input_width, 1.0f / input_height, false);
-
-            // compose mask for detected bounding box
-            cv::Mat composed_mask = mask_scores * masks;
-            composed_mask = composed_mask.reshape(1, mask_height);
-
-            // crop composed mask to fit into object bounding box
-            cv::Mat cropped_mask;
-            int cx = std::max(int(x * mask_width / input_width), int(0));
-            int cy = std::max(int(y * mask_height / input_height), int(0));
-            int cw = std::min(int(w * mask_width / input_width), int(mask_width - cx));
-            int ch = std::min(int(h * mask_height / input_height), int(mask_height - cy));
-            composed_mask(cv::Rect(cx, cy, cw, ch)).copyTo(cropped_mask);
-
-            // apply sigmoid activation
-            cropped_mask.forEach<float>([](float &element, const int position[]) -> void {
-                std::ignore = position;
-                element = 1 / (1 + std::exp(-element));
-            });
-
-            // create segmentation mask tensor
-            GstStructure *gst_structure = gst_structure_copy(getModelProcOutputInfo().get());
-            GVA::Tensor tensor(gst_structure);
-            tensor.set_name("mask_yolov8");
-            tensor.set_format("segmentation_mask");
+            float w = channel(YOLOV8_OFFSET_W);
+            float h = channel(YOLOV8_OFFSET_H);
+            float x = channel(YOLOV8_OFFSET_X) - w / 2;
+            float y = channel(YOLOV8_OFFSET_Y) - h / 2;
+
+            objects.push_back(DetectedObject(x, y, w, h, 0, best_scores[i], best_classes[i],
+                                             BlobToMetaConverter::getLabelByLabelId(best_classes[i]),
+                                             1.0f / input_width, 1.0f / input_height, false));
+
+            // keep mask coefficients, mask is composed only if object survives NMS
+            proposals.insert(proposals.end(), {x, y, w, h});
+            for (size_t m = 0; m < mask_count; m++)
+                proposals.push_back(channel(YOLOV8_OFFSET_CS + class_count + m));
+        }
+    }
+}
 
-            // set tensor data
-            tensor.set_dims({safe_convert<uint32_t>(cropped_mask.cols), safe_convert<uint32_t>(cropped_mask.rows)});
-            tensor.set_precision(GVA::Tensor::Precision::FP32);
-            tensor.set_data(reinterpret_cast<const void *>(cropped_mask.data),
-                            cropped_mask.rows * cropped_mask.cols * sizeof(float));
+void YOLOv8SegConverter::decodeMasks(const float *masks_data, const std::vector<size_t> &masks_dims,
+                                     const std::vector<size_t> &kept, const std::vector<float> &proposals,
+                                     std::vector<DetectedObject> &objects) const {
+    ITT_TASK(__FUNCTION__);
+    size_t masks_dims_size = masks_dims.size();
+    size_t input_width = getModelInputImageInfo().width;
+    size_t input_height = getModelInputImageInfo().height;
+    size_t mask_count = masks_dims[masks_dims_size - 3];
+    size_t mask_height = masks_dims[masks_dims_size - 2];
+    size_t mask_width = masks_dims[masks_dims_size - 1];
+    size_t proposal_size = YOLOV8_SEG_PROPOSAL_BOX_SIZE + mask_count;
 
-            // add tensor to the list of detected objects
-            detected_object.tensors.push_back(tensor.gst_structure());
-            objects.push_back(detected_object);
+    if (kept.empty()) {
+        objects.clear();
+        return;
+    }
+
+    // compose masks of all survivors at once: [kept, mask_count] x [mask_count, mask_height * mask_width]
+    cv::Mat coefficients(kept.size(), mask_count, CV_32F);
+    for (size_t k = 0; k < kept.size(); k++) {
+        const float *mask_scores = proposals.data() + kept[k] * proposal_size + YOLOV8_SEG_PROPOSAL_BOX_SIZE;
+        std::copy(mask_scores, mask_scores + mask_count, coefficients.ptr<float>(k));
+    }
+    cv::Mat masks(mask_count, mask_width * mask_height, CV_32F, (float *)masks_data);
+    cv::Mat composed_masks;
+    cv::gemm(coefficients, masks, 1.0, cv::noArray(), 0.0, composed_masks);
+
+    std::vector<DetectedObject> survivors;
+    survivors.reserve(kept.size());
+    for (size_t k = 0; k < kept.size(); k++) {
+        const float *box = proposals.data() + kept[k] * proposal_size;
+        float x = box[0];
+        float y = box[1];
+        float w = box[2];
+        float h = box[3];
+
+        // crop composed mask to fit into object bounding box
+        cv::Mat composed_mask = composed_masks.row(k).reshape(1, mask_height);
+        int cx = std::max(int(x * mask_width / input_width), int(0));
+        int cy = std::max(int(y * mask_height / input_height), int(0));
+        int cw = std::min(int(w * mask_width / input_width), int(mask_width - cx));
+        int ch = std::min(int(h * mask_height / input_height), int(mask_height - cy));
+        cv::Mat cropped_mask = composed_mask(cv::Rect(cx, cy, cw, ch));
+
+        // apply sigmoid activation, probabilities are resized to the part of bounding box inside the image
+        cv::Mat mask;
+        if (box_masks && !cropped_mask.empty()) {
+            cv::Mat probabilities(cropped_mask.size(), CV_32F);
+            activateMask(cropped_mask, probabilities);
+            int bw = std::lround(std::min(x + w, float(input_width)) - std::max(x, 0.f));
+            int bh = std::lround(std::min(y + h, float(input_height)) - std::max(y, 0.f));
+            cv::Mat resized;
+            cv::resize(probabilities, resized, cv::Size(std::max(bw, 1), std::max(bh, 1)), 0, 0, cv::INTER_LINEAR);
+            resized.convertTo(mask, u8_masks ? CV_8U : CV_32F, u8_masks ? 255.0 : 1.0);
+        } else {
+            mask.create(cropped_mask.rows, cropped_mask.cols, u8_masks ? CV_8U : CV_32F);
+            activateMask(cropped_mask, mask);
         }
-        output_data += object_size;
 
-        // Future optimization: generate masks after running NMS algorithm on detected objects
+        // create segmentation mask tensor
+        GstStructure *gst_structure = gst_structure_copy(getModelProcOutputInfo().get());
+        GVA::Tensor tensor(gst_structure);
+        tensor.set_name("mask_yolov8");
+        tensor.set_format("segmentation_mask");
+
+        // set tensor data
+        tensor.set_dims({safe_convert<uint32_t>(mask.cols), safe_convert<uint32_t>(mask.rows)});
+        tensor.set_precision(u8_masks ? GVA::Tensor::Precision::U8 : GVA::Tensor::Precision::FP32);
+        tensor.set_data(reinterpret_cast<const void *>(mask.data), mask.total() * mask.elemSize());
+
+        // add tensor to the surviving object
+        survivors.push_back(std::move(objects[kept[k]]));
+        survivors.back().tensors.push_back(tensor.gst_structure());
     }
+    objects = std::move(survivors);
 }
 
-TensorsTable YOLOv8SegConverter::convert(const OutputBlobs &output_blobs) {
+DetectionsTable YOLOv8SegConverter::convertToDetections(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -349,16 +462,26 @@ TensorsTable YOLOv8SegConverter::convert(const OutputBlobs &output_blobs) {
 
             size_t boxes_unbatched_size = boxes_blob->GetSize() / batch_size;
             size_t masks_unbatched_size = masks_blob->GetSize() / batch_size;
+            std::vector<float> proposals;
             parseOutputBlob(
                 reinterpret_cast<const float *>(boxes_blob->GetData()) + boxes_unbatched_size * batch_number,
-                boxes_blob->GetDims(),
-                reinterpret_cast<const float *>(masks_blob->GetData()) + masks_unbatched_size * batch_number,
-                masks_blob->GetDims(), objects);
+                boxes_blob->GetDims(), masks_blob->GetDims(), objects, proposals);
+
+            // NMS runs before masks are generated, so masks of suppressed objects are never computed
+            std::vector<size_t> kept;
+            if (need_nms) {
+                kept = selectByNms(objects);
+            } else {
+                kept.resize(objects.size());
+                std::iota(kept.begin(), kept.end(), 0);
+            }
+            decodeMasks(reinterpret_cast<const float *>(masks_blob->GetData()) + masks_unbatched_size * batch_number,
+                        masks_blob->GetDims(), kept, proposals, objects);
         }
 
-        return storeObjects(objects_table);
+        return toDetectionsTable(objects_table);
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do YoloV8-SEG post-processing."));
     }
-    return TensorsTable{};
+    return DetectionsTable{};
 }
\ No newline at end of file
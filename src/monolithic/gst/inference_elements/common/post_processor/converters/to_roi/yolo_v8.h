@@ -46,7 +46,7 @@ class YOLOv8Converter : public BlobToROIConverter {
         : BlobToROIConverter(std::move(initializer), confidence_threshold, true, iou_threshold) {
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectionsTable convertToDetections(const OutputBlobs &output_blobs) override;
 
     static std::string getName() {
         return "yolo_v8";
@@ -63,7 +63,7 @@ class YOLOv8ObbConverter : public YOLOv8Converter {
         : YOLOv8Converter(std::move(initializer), confidence_threshold, iou_threshold) {
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectionsTable convertToDetections(const OutputBlobs &output_blobs) override;
 
     static std::string getName() {
         return "yolo_v8_obb";
@@ -91,24 +91,42 @@ class YOLOv8PoseConverter : public YOLOv8Converter {
         : YOLOv8Converter(std::move(initializer), confidence_threshold, iou_threshold) {
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectionsTable convertToDetections(const OutputBlobs &output_blobs) override;
 
     static std::string getName() {
         return "yolo_v8_pose";
     }
 };
 
+/*
+yolo_v8_seg masks are generated only for objects surviving NMS. Until then each candidate keeps a proposal of
+[x, y, w, h, mask_1, ..., mask_nm] format, where:
+    (x, y) - top-left corner of bounding box in model input pixels
+    (w, h) - width and height of bounding box in model input pixels
+    mask_1, ..., mask_nm - coefficients of prototype masks
+*/
+const size_t YOLOV8_SEG_PROPOSAL_BOX_SIZE = 4;
+
 class YOLOv8SegConverter : public YOLOv8Converter {
   protected:
-    void parseOutputBlob(const float *boxes_data, const std::vector<size_t> &boxes_dims, const float *masks_data,
-                         const std::vector<size_t> &masks_dims, std::vector<DetectedObject> &objects) const;
+    void parseOutputBlob(const float *boxes_data, const std::vector<size_t> &boxes_dims,
+                         const std::vector<size_t> &masks_dims, std::vector<DetectedObject> &objects,
+                         std::vector<float> &proposals) const;
+    void decodeMasks(const float *masks_data, const std::vector<size_t> &masks_dims, const std::vector<size_t> &kept,
+                     const std::vector<float> &proposals, std::vector<DetectedObject> &objects) const;
+    bool readU8Masks() const;
+    bool readBoxMasks() const;
+
+    const bool u8_masks;  // emit masks as U8 probabilities scaled to [0, 255] instead of FP32
+    const bool box_masks; // emit masks resized to bounding box size in model input pixels instead of prototype size
 
   public:
     YOLOv8SegConverter(BlobToMetaConverter::Initializer initializer, double confidence_threshold, double iou_threshold)
-        : YOLOv8Converter(std::move(initializer), confidence_threshold, iou_threshold) {
+        : YOLOv8Converter(std::move(initializer), confidence_threshold, iou_threshold), u8_masks(readU8Masks()),
+          box_masks(readBoxMasks()) {
     }
 
-    TensorsTable convert(const OutputBlobs &output_blobs) override;
+    DetectionsTable convertToDetections(const OutputBlobs &output_blobs) override;
 
     static std::string getName() {
         return "yolo_v8_seg";
@@ -85,7 +85,7 @@ void YOLOxConverter::parseOutputBlob(const float *data, const std::vector<size_t
     } // stride loop
 }
 
-TensorsTable YOLOxConverter::convert(const OutputBlobs &output_blobs) {
+DetectionsTable YOLOxConverter::convertToDetections(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     try {
         const auto &model_input_image_info = getModelInputImageInfo();
@@ -113,5 +113,5 @@ TensorsTable YOLOxConverter::convert(const OutputBlobs &output_blobs) {
     } catch (const std::exception &e) {
         std::throw_with_nested(std::runtime_error("Failed to do YoloX post-processing."));
     }
-    return TensorsTable{};
+    return DetectionsTable{};
 }
\ No newline at end of file
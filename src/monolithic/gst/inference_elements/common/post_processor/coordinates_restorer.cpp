@@ -147,24 +147,18 @@ void ROICoordinatesRestorer::getRealCoordinates(GstStructure *detection_tensor,
     }
 }
 
-void ROICoordinatesRestorer::getCoordinates(GstStructure *detection_tensor, const FrameWrapper &frame,
-                                            double &x_min_real, double &y_min_real, double &x_max_real,
-                                            double &y_max_real, uint32_t &x_abs, uint32_t &y_abs, uint32_t &w_abs,
-                                            uint32_t &h_abs) {
-
-    getRealCoordinates(detection_tensor, x_min_real, y_min_real, x_max_real, y_max_real);
-
+void ROICoordinatesRestorer::restoreDetection(DetectionRecord &detection, const FrameWrapper &frame) {
     if (frame.image_transform_info and frame.image_transform_info->WasTransformation()) {
-        restoreActualCoordinates(frame, x_min_real, y_min_real);
-        restoreActualCoordinates(frame, x_max_real, y_max_real);
+        restoreActualCoordinates(frame, detection.x_min, detection.y_min);
+        restoreActualCoordinates(frame, detection.x_max, detection.y_max);
     }
 
-    updateCoordinatesToFullFrame(x_min_real, y_min_real, x_max_real, y_max_real, frame);
+    updateCoordinatesToFullFrame(detection.x_min, detection.y_min, detection.x_max, detection.y_max, frame);
 
-    clipNormalizedRect(x_min_real, y_min_real, x_max_real, y_max_real);
+    clipNormalizedRect(detection.x_min, detection.y_min, detection.x_max, detection.y_max);
 
-    getAbsoluteCoordinates(frame.width, frame.height, x_min_real, y_min_real, x_max_real, y_max_real, x_abs, y_abs,
-                           w_abs, h_abs);
+    getAbsoluteCoordinates(frame.width, frame.height, detection.x_min, detection.y_min, detection.x_max,
+                           detection.y_max, detection.x_abs, detection.y_abs, detection.w_abs, detection.h_abs);
 }
 
 void ROICoordinatesRestorer::restore(TensorsTable &tensors_batch, const FramesWrapper &frames) {
@@ -178,15 +172,16 @@ void ROICoordinatesRestorer::restore(TensorsTable &tensors_batch, const FramesWr
             for (size_t j = 0; j < tensor.size(); ++j) {
                 GstStructure *detection_tensor = tensor[j][DETECTION_TENSOR_ID];
 
-                double x_min_real, y_min_real, x_max_real, y_max_real;
-                uint32_t x_abs, y_abs, w_abs, h_abs;
-                getCoordinates(detection_tensor, frame, x_min_real, y_min_real, x_max_real, y_max_real, x_abs, y_abs,
-                               w_abs, h_abs);
+                DetectionRecord detection;
+                getRealCoordinates(detection_tensor, detection.x_min, detection.y_min, detection.x_max,
+                                   detection.y_max);
+                restoreDetection(detection, frame);
 
-                gst_structure_set(detection_tensor, "x_min", G_TYPE_DOUBLE, x_min_real, "x_max", G_TYPE_DOUBLE,
-                                  x_max_real, "y_min", G_TYPE_DOUBLE, y_min_real, "y_max", G_TYPE_DOUBLE, y_max_real,
-                                  "x_abs", G_TYPE_UINT, x_abs, "y_abs", G_TYPE_UINT, y_abs, "w_abs", G_TYPE_UINT, w_abs,
-                                  "h_abs", G_TYPE_UINT, h_abs, NULL);
+                gst_structure_set(detection_tensor, "x_min", G_TYPE_DOUBLE, detection.x_min, "x_max", G_TYPE_DOUBLE,
+                                  detection.x_max, "y_min", G_TYPE_DOUBLE, detection.y_min, "y_max", G_TYPE_DOUBLE,
+                                  detection.y_max, "x_abs", G_TYPE_UINT, detection.x_abs, "y_abs", G_TYPE_UINT,
+                                  detection.y_abs, "w_abs", G_TYPE_UINT, detection.w_abs, "h_abs", G_TYPE_UINT,
+                                  detection.h_abs, NULL);
             }
         }
     } catch (const std::exception &e) {
@@ -194,6 +189,19 @@ void ROICoordinatesRestorer::restore(TensorsTable &tensors_batch, const FramesWr
     }
 }
 
+void ROICoordinatesRestorer::restore(DetectionsTable &detections_batch, const FramesWrapper &frames) {
+    try {
+        checkFramesAndTensorsTable(frames, detections_batch.tensors);
+
+        for (size_t i = 0; i < frames.size(); ++i) {
+            for (auto &detection : detections_batch.detections[i])
+                restoreDetection(detection, frames[i]);
+        }
+    } catch (const std::exception &e) {
+        GVA_ERROR("An error occurred while restoring coordinates for ROI: %s", e.what());
+    }
+}
+
 void KeypointsCoordinatesRestorer::restore(TensorsTable &tensors, const FramesWrapper &frames) {
     try {
         checkFramesAndTensorsTable(frames, tensors);
@@ -46,9 +46,7 @@ class ROICoordinatesRestorer : public CoordinatesRestorer {
                                 uint32_t &abs_h);
     void getRealCoordinates(GstStructure *detection_tensor, double &x_min_real, double &y_min_real, double &x_max_real,
                             double &y_max_real);
-    void getCoordinates(GstStructure *detection_tensor, const FrameWrapper &frame, double &x_min_real,
-                        double &y_min_real, double &x_max_real, double &y_max_real, uint32_t &x_abs, uint32_t &y_abs,
-                        uint32_t &w_abs, uint32_t &h_abs);
+    void restoreDetection(DetectionRecord &detection, const FrameWrapper &frame);
 
   public:
     ROICoordinatesRestorer(const ModelImageInputInfo &input_info, AttachType type)
@@ -56,6 +54,7 @@ class ROICoordinatesRestorer : public CoordinatesRestorer {
     }
 
     virtual void restore(TensorsTable &tensors_batch, const FramesWrapper &frames) override;
+    void restore(DetectionsTable &detections_batch, const FramesWrapper &frames);
 };
 
 class KeypointsCoordinatesRestorer : public CoordinatesRestorer {
@@ -6,6 +6,7 @@
 
 #include "meta_attacher.h"
 
+#include "converters/to_roi/blob_to_roi_converter.h"
 #include "gmutex_lock_guard.h"
 #include "gva_utils.h"
 #include "processor_types.h"
@@ -37,6 +38,24 @@ MetaAttacher::Ptr MetaAttacher::create(ConverterType converter_type, AttachType
     }
 }
 
+namespace {
+
+// Reads fields of legacy "detection" tensor used by ROIToFrameAttacher
+DetectionRecord readDetectionRecord(const GstStructure *detection_tensor) {
+    DetectionRecord detection;
+    gst_structure_get_uint(detection_tensor, "x_abs", &detection.x_abs);
+    gst_structure_get_uint(detection_tensor, "y_abs", &detection.y_abs);
+    gst_structure_get_uint(detection_tensor, "w_abs", &detection.w_abs);
+    gst_structure_get_uint(detection_tensor, "h_abs", &detection.h_abs);
+    gst_structure_get_double(detection_tensor, "confidence", &detection.confidence);
+    gst_structure_get_double(detection_tensor, "rotation", &detection.rotation);
+    gst_structure_get_int(detection_tensor, "label_id", &detection.label_id);
+    detection.label = g_quark_from_string(gst_structure_get_string(detection_tensor, "label"));
+    return detection;
+}
+
+} // namespace
+
 void ROIToFrameAttacher::attach(const TensorsTable &tensors, FramesWrapper &frames,
                                 const BlobToMetaConverter &blob_to_meta) {
     checkFramesAndTensorsTable(frames, tensors);
@@ -48,146 +67,158 @@ void ROIToFrameAttacher::attach(const TensorsTable &tensors, FramesWrapper &fram
 
         for (size_t j = 0; j < tensor.size(); ++j) {
             GstStructure *detection_tensor = tensor[j][DETECTION_TENSOR_ID];
+            const DetectionRecord detection = readDetectionRecord(detection_tensor);
 
-            uint32_t x_abs, y_abs, w_abs, h_abs;
-            gst_structure_get_uint(detection_tensor, "x_abs", &x_abs);
-            gst_structure_get_uint(detection_tensor, "y_abs", &y_abs);
-            gst_structure_get_uint(detection_tensor, "w_abs", &w_abs);
-            gst_structure_get_uint(detection_tensor, "h_abs", &h_abs);
-
-            const gchar *label = gst_structure_get_string(detection_tensor, "label");
-
-            GstBuffer **writable_buffer = &frame.buffer;
-            gva_buffer_check_and_make_writable(writable_buffer, PRETTY_FUNCTION_NAME);
-
-            GMutexLockGuard guard(frame.meta_mutex);
-            GQuark gquark_label = g_quark_from_string(label);
-
-            gdouble conf;
-            gst_structure_get_double(detection_tensor, "confidence", &conf);
-
-            GstAnalyticsRelationMeta *relation_meta = gst_buffer_add_analytics_relation_meta(*writable_buffer);
+            gst_structure_remove_field(detection_tensor, "label");
+            gst_structure_remove_field(detection_tensor, "x_abs");
+            gst_structure_remove_field(detection_tensor, "y_abs");
+            gst_structure_remove_field(detection_tensor, "w_abs");
+            gst_structure_remove_field(detection_tensor, "h_abs");
 
-            if (not relation_meta)
-                throw std::runtime_error("Failed to add GstAnalyticsRelationMeta to buffer");
+            attachDetection(frame, detection, tensor[j], j == 0, blob_to_meta, cls_descriptor_mtd);
+        }
+    }
+}
 
-            const auto &labels = blob_to_meta.getLabels();
-            if (j == 0 && !labels.empty()) {
-                gsize length = labels.size();
-                std::vector<gfloat> confidence_levels(length, 0.0f);
-                std::vector<GQuark> class_quarks(length, 0);
+void ROIToFrameAttacher::attach(const DetectionsTable &detections_batch, FramesWrapper &frames,
+                                const BlobToROIConverter &blob_to_roi) {
+    checkFramesAndTensorsTable(frames, detections_batch.tensors);
 
-                for (size_t i = 0; i < length; i++) {
-                    class_quarks[i] = g_quark_from_string(labels[i].c_str());
-                }
+    std::vector<GstStructure *> roi_tensors;
+    for (size_t i = 0; i < frames.size(); ++i) {
+        auto &frame = frames[i];
+        const auto &detections = detections_batch.detections[i];
+        const auto &tensors = detections_batch.tensors[i];
+        GstAnalyticsClsMtd cls_descriptor_mtd = {0, nullptr};
 
-                // find or create class descriptor metadata
-                bool found = false;
-                gpointer state = NULL;
-
-                // check if class descriptor meta already exists
-                while (gst_analytics_relation_meta_iterate(relation_meta, &state, gst_analytics_cls_mtd_get_mtd_type(),
-                                                           &cls_descriptor_mtd)) {
-                    if (gst_analytics_cls_mtd_get_length(&cls_descriptor_mtd) == length) {
-                        bool skip = false;
-                        for (size_t k = 0; k < length; k++) {
-                            if (gst_analytics_cls_mtd_get_quark(&cls_descriptor_mtd, k) != class_quarks[k]) {
-                                skip = true;
-                                break;
-                            }
-                        }
+        for (size_t j = 0; j < detections.size(); ++j) {
+            // "detection" tensor is created directly with its final fields
+            roi_tensors.clear();
+            roi_tensors.push_back(blob_to_roi.createDetectionTensor(detections[j]));
+            roi_tensors.insert(roi_tensors.end(), tensors[j].begin(), tensors[j].end());
 
-                        if (skip) {
-                            continue;
-                        }
+            attachDetection(frame, detections[j], roi_tensors, j == 0, blob_to_roi, cls_descriptor_mtd);
+        }
+    }
+}
 
-                        found = true;
+void ROIToFrameAttacher::attachDetection(FrameWrapper &frame, const DetectionRecord &detection,
+                                         const std::vector<GstStructure *> &tensors, bool first_in_frame,
+                                         const BlobToMetaConverter &blob_to_meta,
+                                         GstAnalyticsClsMtd &cls_descriptor_mtd) {
+    GstBuffer **writable_buffer = &frame.buffer;
+    gva_buffer_check_and_make_writable(writable_buffer, PRETTY_FUNCTION_NAME);
+
+    GMutexLockGuard guard(frame.meta_mutex);
+
+    GstAnalyticsRelationMeta *relation_meta = gst_buffer_add_analytics_relation_meta(*writable_buffer);
+
+    if (not relation_meta)
+        throw std::runtime_error("Failed to add GstAnalyticsRelationMeta to buffer");
+
+    const auto &class_quarks = blob_to_meta.getLabelQuarks();
+    if (first_in_frame && !class_quarks.empty()) {
+        gsize length = class_quarks.size();
+        std::vector<gfloat> confidence_levels(length, 0.0f);
+
+        // find or create class descriptor metadata
+        bool found = false;
+        gpointer state = NULL;
+
+        // check if class descriptor meta already exists
+        while (gst_analytics_relation_meta_iterate(relation_meta, &state, gst_analytics_cls_mtd_get_mtd_type(),
+                                                   &cls_descriptor_mtd)) {
+            if (gst_analytics_cls_mtd_get_length(&cls_descriptor_mtd) == length) {
+                bool skip = false;
+                for (size_t k = 0; k < length; k++) {
+                    if (gst_analytics_cls_mtd_get_quark(&cls_descriptor_mtd, k) != class_quarks[k]) {
+                        skip = true;
                         break;
                     }
                 }
 
-                // create class descriptor if one does not exists
-                if (!found) {
-                    if (!gst_analytics_relation_meta_add_cls_mtd(relation_meta, length, confidence_levels.data(),
-                                                                 class_quarks.data(), &cls_descriptor_mtd)) {
-                        throw std::runtime_error("Failed to add class descriptor to meta");
-                    }
+                if (skip) {
+                    continue;
                 }
-            }
-
-            gdouble rotation = 0;
-            gst_structure_get_double(detection_tensor, "rotation", &rotation);
 
-            GstAnalyticsODMtd od_mtd;
-            if (!gst_analytics_relation_meta_add_oriented_od_mtd(relation_meta, gquark_label, x_abs, y_abs, w_abs,
-                                                                 h_abs, rotation, conf, &od_mtd)) {
-                throw std::runtime_error("Failed to add detection data to meta");
+                found = true;
+                break;
             }
+        }
 
-            if (label && cls_descriptor_mtd.meta == relation_meta) {
-                if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_RELATE_TO,
-                                                              od_mtd.id, cls_descriptor_mtd.id)) {
-                    throw std::runtime_error(
-                        "Failed to set relation between object detection metadata and class descriptor metadata");
-                }
+        // create class descriptor if one does not exists
+        if (!found) {
+            if (!gst_analytics_relation_meta_add_cls_mtd(relation_meta, length, confidence_levels.data(),
+                                                         const_cast<GQuark *>(class_quarks.data()),
+                                                         &cls_descriptor_mtd)) {
+                throw std::runtime_error("Failed to add class descriptor to meta");
             }
+        }
+    }
 
-            for (size_t k = 0; k < tensor[j].size(); k++) {
-                GstAnalyticsMtd tensor_mtd;
-                GVA::Tensor gva_tensor(tensor[j][k]);
-                if (gva_tensor.convert_to_meta(&tensor_mtd, &od_mtd, relation_meta)) {
-                    if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_CONTAIN,
-                                                                  od_mtd.id, tensor_mtd.id)) {
-                        throw std::runtime_error(
-                            "Failed to set relation between object detection metadata and tensor metadata");
-                    }
-                    if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_IS_PART_OF,
-                                                                  tensor_mtd.id, od_mtd.id)) {
-                        throw std::runtime_error(
-                            "Failed to set relation between tensor metadata and object detection metadata");
-                    }
-                }
-            }
+    GstAnalyticsODMtd od_mtd;
+    if (!gst_analytics_relation_meta_add_oriented_od_mtd(relation_meta, detection.label, detection.x_abs,
+                                                         detection.y_abs, detection.w_abs, detection.h_abs,
+                                                         detection.rotation, detection.confidence, &od_mtd)) {
+        throw std::runtime_error("Failed to add detection data to meta");
+    }
 
-            GstVideoRegionOfInterestMeta *roi_meta =
-                gst_buffer_add_video_region_of_interest_meta(*writable_buffer, label, x_abs, y_abs, w_abs, h_abs);
+    if (detection.label && cls_descriptor_mtd.meta == relation_meta) {
+        if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_RELATE_TO, od_mtd.id,
+                                                      cls_descriptor_mtd.id)) {
+            throw std::runtime_error(
+                "Failed to set relation between object detection metadata and class descriptor metadata");
+        }
+    }
 
-            if (not roi_meta)
-                throw std::runtime_error("Failed to add GstVideoRegionOfInterestMeta to buffer");
+    for (GstStructure *tensor : tensors) {
+        GstAnalyticsMtd tensor_mtd;
+        GVA::Tensor gva_tensor(tensor);
+        if (gva_tensor.convert_to_meta(&tensor_mtd, &od_mtd, relation_meta)) {
+            if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_CONTAIN, od_mtd.id,
+                                                          tensor_mtd.id)) {
+                throw std::runtime_error(
+                    "Failed to set relation between object detection metadata and tensor metadata");
+            }
+            if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_IS_PART_OF,
+                                                          tensor_mtd.id, od_mtd.id)) {
+                throw std::runtime_error(
+                    "Failed to set relation between tensor metadata and object detection metadata");
+            }
+        }
+    }
 
-            roi_meta->id = od_mtd.id;
-            if (frame.roi) {
-                roi_meta->parent_id = frame.roi->id;
+    GstVideoRegionOfInterestMeta *roi_meta = gst_buffer_add_video_region_of_interest_meta_id(
+        *writable_buffer, detection.label, detection.x_abs, detection.y_abs, detection.w_abs, detection.h_abs);
 
-                if (frame.roi->id >= 0) {
-                    GstAnalyticsODMtd parent_od_mtd;
-                    if (gst_analytics_relation_meta_get_od_mtd(relation_meta, frame.roi->id, &parent_od_mtd)) {
-                        if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_IS_PART_OF,
-                                                                      od_mtd.id, parent_od_mtd.id)) {
-                            throw std::runtime_error(
-                                "Failed to set relation between object detection metadata and parent metadata");
-                        }
+    if (not roi_meta)
+        throw std::runtime_error("Failed to add GstVideoRegionOfInterestMeta to buffer");
 
-                        if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_CONTAIN,
-                                                                      parent_od_mtd.id, od_mtd.id)) {
-                            throw std::runtime_error(
-                                "Failed to set relation between object detection metadata and parent metadata");
-                        }
-                    }
-                }
-            }
+    roi_meta->id = od_mtd.id;
+    if (frame.roi) {
+        roi_meta->parent_id = frame.roi->id;
 
-            gst_structure_remove_field(detection_tensor, "label");
-            gst_structure_remove_field(detection_tensor, "x_abs");
-            gst_structure_remove_field(detection_tensor, "y_abs");
-            gst_structure_remove_field(detection_tensor, "w_abs");
-            gst_structure_remove_field(detection_tensor, "h_abs");
+        if (frame.roi->id >= 0) {
+            GstAnalyticsODMtd parent_od_mtd;
+            if (gst_analytics_relation_meta_get_od_mtd(relation_meta, frame.roi->id, &parent_od_mtd)) {
+                if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_IS_PART_OF,
+                                                              od_mtd.id, parent_od_mtd.id)) {
+                    throw std::runtime_error(
+                        "Failed to set relation between object detection metadata and parent metadata");
+                }
 
-            for (size_t k = 0; k < tensor[j].size(); k++) {
-                gst_video_region_of_interest_meta_add_param(roi_meta, tensor[j][k]);
+                if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_CONTAIN,
+                                                              parent_od_mtd.id, od_mtd.id)) {
+                    throw std::runtime_error(
+                        "Failed to set relation between object detection metadata and parent metadata");
+                }
             }
         }
     }
+
+    for (GstStructure *tensor : tensors) {
+        gst_video_region_of_interest_meta_add_param(roi_meta, tensor);
+    }
 }
 
 void TensorToFrameAttacher::attach(const TensorsTable &tensors_batch, FramesWrapper &frames,
@@ -228,15 +259,10 @@ void TensorToROIAttacher::attach(const TensorsTable &tensors_batch, FramesWrappe
         }
 
         GstAnalyticsClsMtd cls_descriptor_mtd = {0, nullptr};
-        const auto &labels = blob_to_meta.getLabels();
-        if (!labels.empty()) {
-            gsize length = labels.size();
+        const auto &class_quarks = blob_to_meta.getLabelQuarks();
+        if (!class_quarks.empty()) {
+            gsize length = class_quarks.size();
             std::vector<gfloat> confidence_levels(length, 0.0f);
-            std::vector<GQuark> class_quarks(length, 0);
-
-            for (size_t i = 0; i < length; i++) {
-                class_quarks[i] = g_quark_from_string(labels[i].c_str());
-            }
 
             // find or create class descriptor metadata
             bool found = false;
@@ -266,7 +292,8 @@ void TensorToROIAttacher::attach(const TensorsTable &tensors_batch, FramesWrappe
             // create class descriptor if one does not exists
             if (!found) {
                 if (!gst_analytics_relation_meta_add_cls_mtd(od_meta.meta, length, confidence_levels.data(),
-                                                             class_quarks.data(), &cls_descriptor_mtd)) {
+                                                             const_cast<GQuark *>(class_quarks.data()),
+                                                             &cls_descriptor_mtd)) {
                     throw std::runtime_error("Failed to add class descriptor to meta");
                 }
             }
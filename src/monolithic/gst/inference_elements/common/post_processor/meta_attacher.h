@@ -15,6 +15,8 @@
 
 namespace post_processing {
 
+class BlobToROIConverter;
+
 class MetaAttacher {
   public:
     MetaAttacher() = default;
@@ -29,11 +31,19 @@ class MetaAttacher {
 };
 
 class ROIToFrameAttacher : public MetaAttacher {
+  private:
+    // Adds analytics and region of interest metadata of the detection, tensors are moved to the region of interest
+    void attachDetection(FrameWrapper &frame, const DetectionRecord &detection,
+                         const std::vector<GstStructure *> &tensors, bool first_in_frame,
+                         const BlobToMetaConverter &blob_to_meta, GstAnalyticsClsMtd &cls_descriptor_mtd);
+
   public:
     ROIToFrameAttacher() = default;
 
     void attach(const TensorsTable &tensors_batch, FramesWrapper &frames,
                 const BlobToMetaConverter &blob_to_meta) override;
+    // Attaches detection records, no intermediate GstStructure is read back or modified
+    void attach(const DetectionsTable &detections_batch, FramesWrapper &frames, const BlobToROIConverter &blob_to_roi);
 };
 
 class TensorToFrameAttacher : public MetaAttacher {
@@ -23,6 +23,35 @@ namespace post_processing {
 static const int DETECTION_TENSOR_ID = 0;
 using TensorsTable = std::vector<std::vector<std::vector<GstStructure *>>>;
 using OutputBlobs = std::map<std::string, InferenceBackend::OutputBlob::Ptr>;
+
+/**
+ * Object detected by TO_ROI converter. Detections are passed from converter to meta attacher as plain records, so
+ * GstStructure of "detection" tensor is created only once, when it is attached to GstVideoRegionOfInterestMeta.
+ */
+struct DetectionRecord {
+    // normalized coordinates, restored to full frame by ROICoordinatesRestorer
+    double x_min = 0;
+    double y_min = 0;
+    double x_max = 0;
+    double y_max = 0;
+    double rotation = 0;
+
+    double confidence = 0;
+    int label_id = 0;
+    GQuark label = 0; // 0 if object has no label
+
+    // absolute coordinates in frame, filled by ROICoordinatesRestorer
+    uint32_t x_abs = 0;
+    uint32_t y_abs = 0;
+    uint32_t w_abs = 0;
+    uint32_t h_abs = 0;
+};
+
+// DetectionsTable = frames<objects>, tensors[i][j] are additional tensors (masks, keypoints) of detections[i][j]
+struct DetectionsTable {
+    std::vector<std::vector<DetectionRecord>> detections;
+    TensorsTable tensors;
+};
 // <layer_name, blob_dims>
 using ModelOutputsInfo = std::map<std::string, std::vector<size_t>>;
 
@@ -60,7 +60,7 @@ void PostProcessorImpl::setDefaultConverter(GstStructure *model_proc_output, con
     }
 }
 
-PostProcessorImpl::PostProcessorImpl(Initializer initializer) {
+PostProcessorImpl::PostProcessorImpl(Initializer initializer) : stage_timer(initializer.stage_timer) {
     try {
         if (initializer.use_default) {
             std::unordered_set<std::string> layer_names;
@@ -125,7 +125,7 @@ PostProcessorImpl::PostProcessorImpl(Initializer initializer) {
 PostProcessorImpl::ExitStatus PostProcessorImpl::process(const OutputBlobs &output_blobs, FramesWrapper &frames) const {
     try {
         for (const auto &converter : converters) {
-            converter.convert(output_blobs, frames);
+            converter.convert(output_blobs, frames, stage_timer.get());
         }
     } catch (const std::exception &e) {
         GVA_ERROR("Post-processing error: %s", Utils::createNestedErrorMsg(e).c_str());
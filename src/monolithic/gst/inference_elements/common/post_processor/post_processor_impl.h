@@ -22,6 +22,7 @@ namespace post_processing {
 class PostProcessorImpl {
   protected:
     std::vector<ConverterFacade> converters;
+    InferenceBackend::StageTimer::Ptr stage_timer;
     const std::string any_layer_name = "ANY";
 
   public:
@@ -43,6 +44,8 @@ class PostProcessorImpl {
         double threshold = 0.5;
 
         std::string custom_postproc_lib;
+        /* optional timing of post-processing stages */
+        InferenceBackend::StageTimer::Ptr stage_timer;
     };
 
     PostProcessorImpl(Initializer initializer);
@@ -96,7 +96,8 @@ ImageInferenceAsyncD3D11::ImageInferenceAsyncD3D11(const InferenceBackend::Infer
 }
 
 void ImageInferenceAsyncD3D11::SubmitInference(D3D11Image *d3d11_image, IFrameBase::Ptr frame,
-                                               const std::map<std::string, InputLayerDesc::Ptr> &input_preprocessors) {
+                                               const std::map<std::string, InputLayerDesc::Ptr> &input_preprocessors,
+                                               uint64_t preproc_begin) {
     if (!d3d11_image)
         throw std::invalid_argument("Invalid D3D11Image object");
     if (!frame)
@@ -114,6 +115,9 @@ void ImageInferenceAsyncD3D11::SubmitInference(D3D11Image *d3d11_image, IFrameBa
 
     Image mapped_image = d3d11_image->Map();
     frame->SetImage(std::shared_ptr<Image>(new Image(mapped_image), deleter));
+    // conversion is complete once the image is mapped
+    if (_stage_timer)
+        _stage_timer->Record(Stage::PREPROC, preproc_begin, StageTimer::Ticks());
     _inference->SubmitImage(std::move(frame), input_preprocessors);
 }
 
@@ -122,6 +126,7 @@ void ImageInferenceAsyncD3D11::SubmitImage(IFrameBase::Ptr frame,
     assert(frame && "Expected valid IFrameBase pointer");
     D3D11Image *d3d11_image = _d3d11_image_pool->AcquireBuffer();
 
+    const uint64_t preproc_begin = _stage_timer ? StageTimer::Ticks() : 0;
     try {
         _d3d11_converter->Convert(*frame->GetImage(), *d3d11_image, getImagePreProcInfo(input_preprocessors),
                                   frame->GetImageTransformationParams());
@@ -131,14 +136,15 @@ void ImageInferenceAsyncD3D11::SubmitImage(IFrameBase::Ptr frame,
         std::throw_with_nested(std::runtime_error("Unable to convert image using D3D11"));
     }
 
-    d3d11_image->sync = _thread_pool->schedule([this, d3d11_image, f = std::move(frame), input_preprocessors]() {
-        try {
-            SubmitInference(d3d11_image, std::move(f), input_preprocessors);
-        } catch (const std::exception &e) {
-            GVA_ERROR("D3D11 async task exception: %s", e.what());
-            throw;
-        }
-    });
+    d3d11_image->sync =
+        _thread_pool->schedule([this, d3d11_image, f = std::move(frame), input_preprocessors, preproc_begin]() {
+            try {
+                SubmitInference(d3d11_image, std::move(f), input_preprocessors, preproc_begin);
+            } catch (const std::exception &e) {
+                GVA_ERROR("D3D11 async task exception: %s", e.what());
+                throw;
+            }
+        });
 }
 
 const std::string &ImageInferenceAsyncD3D11::GetModelName() const {
@@ -186,6 +192,15 @@ bool ImageInferenceAsyncD3D11::IsQueueFull() {
     return _inference->IsQueueFull();
 }
 
+ImageInference::QueueStats ImageInferenceAsyncD3D11::GetQueueStats() const {
+    return _inference->GetQueueStats();
+}
+
+void ImageInferenceAsyncD3D11::SetStageTimer(StageTimer::Ptr timer) {
+    _stage_timer = timer;
+    _inference->SetStageTimer(std::move(timer));
+}
+
 void ImageInferenceAsyncD3D11::Flush() {
     if (_d3d11_image_pool) {
         _d3d11_image_pool->Flush();
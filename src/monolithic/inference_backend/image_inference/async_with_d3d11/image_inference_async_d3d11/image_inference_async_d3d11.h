@@ -46,6 +46,8 @@ class ImageInferenceAsyncD3D11 : public ImageInference {
     std::map<std::string, GstStructure *> GetModelInfoPostproc() const override;
 
     bool IsQueueFull() override;
+    QueueStats GetQueueStats() const override;
+    void SetStageTimer(StageTimer::Ptr timer) override;
 
     void Flush() override;
 
@@ -60,9 +62,11 @@ class ImageInferenceAsyncD3D11 : public ImageInference {
     ImageInference::Ptr _inference;
 
     std::unique_ptr<D3D11::ThreadPool> _thread_pool;
+    StageTimer::Ptr _stage_timer;
 
     void SubmitInference(D3D11Image *d3d11_image, IFrameBase::Ptr frame,
-                         const std::map<std::string, InputLayerDesc::Ptr> &input_preprocessors);
+                         const std::map<std::string, InputLayerDesc::Ptr> &input_preprocessors,
+                         uint64_t preproc_begin);
 };
 
 } // namespace InferenceBackend
@@ -88,8 +88,10 @@ ImageInferenceAsync::ImageInferenceAsync(const InferenceBackend::InferenceConfig
                                          dlstreamer::ContextPtr vadpy_context, ImageInference::Ptr inference)
     : _inference(inference) {
     const auto &pre_process_config = config.at(KEY_PRE_PROCESSOR);
-    if (!Utils::checkAllKeysAreKnown({KEY_VAAPI_THREAD_POOL_SIZE, KEY_VAAPI_FAST_SCALE_LOAD_FACTOR},
-                                     pre_process_config)) {
+    // KEY_CPU_THREAD_POOL_SIZE is consumed by wrapped inference
+    if (!Utils::checkAllKeysAreKnown(
+            {KEY_VAAPI_THREAD_POOL_SIZE, KEY_VAAPI_FAST_SCALE_LOAD_FACTOR, KEY_CPU_THREAD_POOL_SIZE},
+            pre_process_config)) {
         throw std::invalid_argument("Unknown key in pre-processing configuration.");
     }
 
@@ -127,7 +129,8 @@ ImageInferenceAsync::ImageInferenceAsync(const InferenceBackend::InferenceConfig
 }
 
 void ImageInferenceAsync::SubmitInference(VaApiImage *va_api_image, IFrameBase::Ptr frame,
-                                          const std::map<std::string, InputLayerDesc::Ptr> &input_preprocessors) {
+                                          const std::map<std::string, InputLayerDesc::Ptr> &input_preprocessors,
+                                          uint64_t preproc_begin) {
     if (!va_api_image)
         throw std::invalid_argument("Invalid VaapiImage object");
     if (!frame)
@@ -143,6 +146,9 @@ void ImageInferenceAsync::SubmitInference(VaApiImage *va_api_image, IFrameBase::
         }
     };
     frame->SetImage(std::shared_ptr<Image>(new Image(va_api_image->Map()), deleter));
+    // conversion is complete once the image is mapped
+    if (_stage_timer)
+        _stage_timer->Record(Stage::PREPROC, preproc_begin, StageTimer::Ticks());
     _inference->SubmitImage(std::move(frame), input_preprocessors);
 }
 
@@ -152,6 +158,7 @@ void ImageInferenceAsync::SubmitImage(IFrameBase::Ptr frame,
 
     VaApiImage *dst_image = _va_image_pool->AcquireBuffer();
 
+    const uint64_t preproc_begin = _stage_timer ? StageTimer::Ticks() : 0;
     try {
         _va_converter->Convert(
             *frame->GetImage(), *dst_image,
@@ -162,9 +169,10 @@ void ImageInferenceAsync::SubmitImage(IFrameBase::Ptr frame,
         std::throw_with_nested(std::runtime_error("Unable to convert image using VA-API"));
     }
 
-    dst_image->sync = _thread_pool->schedule([this, dst_image, f = std::move(frame), input_preprocessors]() {
-        SubmitInference(dst_image, std::move(f), input_preprocessors);
-    });
+    dst_image->sync =
+        _thread_pool->schedule([this, dst_image, f = std::move(frame), input_preprocessors, preproc_begin]() {
+            SubmitInference(dst_image, std::move(f), input_preprocessors, preproc_begin);
+        });
 }
 
 const std::string &ImageInferenceAsync::GetModelName() const {
@@ -212,6 +220,15 @@ bool ImageInferenceAsync::IsQueueFull() {
     return _inference->IsQueueFull();
 }
 
+ImageInference::QueueStats ImageInferenceAsync::GetQueueStats() const {
+    return _inference->GetQueueStats();
+}
+
+void ImageInferenceAsync::SetStageTimer(StageTimer::Ptr timer) {
+    _stage_timer = timer;
+    _inference->SetStageTimer(std::move(timer));
+}
+
 void ImageInferenceAsync::Flush() {
     if (_va_image_pool) {
         _va_image_pool->Flush();
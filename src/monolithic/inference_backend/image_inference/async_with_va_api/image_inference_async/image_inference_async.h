@@ -48,6 +48,8 @@ class ImageInferenceAsync : public ImageInference {
     std::map<std::string, GstStructure *> GetModelInfoPostproc() const override;
 
     bool IsQueueFull() override;
+    QueueStats GetQueueStats() const override;
+    void SetStageTimer(StageTimer::Ptr timer) override;
 
     void Flush() override;
 
@@ -62,9 +64,11 @@ class ImageInferenceAsync : public ImageInference {
     ImageInference::Ptr _inference;
 
     std::unique_ptr<ThreadPool> _thread_pool;
+    StageTimer::Ptr _stage_timer;
 
     void SubmitInference(VaApiImage *va_api_image, IFrameBase::Ptr frame,
-                         const std::map<std::string, InputLayerDesc::Ptr> &input_preprocessors);
+                         const std::map<std::string, InputLayerDesc::Ptr> &input_preprocessors,
+                         uint64_t preproc_begin);
 };
 
 } // namespace InferenceBackend
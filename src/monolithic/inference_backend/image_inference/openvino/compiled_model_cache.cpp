@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "compiled_model_cache.h"
+
+#include "inference_backend/logger.h"
+
+#include <openvino/pass/manager.hpp>
+#include <openvino/pass/serialize.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <system_error>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+CompiledModelCache::CompiledModelCache(std::string directory) : directory(std::move(directory)) {
+}
+
+bool CompiledModelCache::IsSupported(const std::string &device, const ov::AnyMap &params) {
+    if (device.rfind("BATCH:", 0) == 0)
+        return false;
+    const auto hint = params.find(ov::hint::performance_mode.name());
+    if (device.rfind("GPU", 0) != 0 || hint == params.end() ||
+        hint->second.as<ov::hint::PerformanceMode>() != ov::hint::PerformanceMode::THROUGHPUT)
+        return true;
+    const auto allow = params.find(ov::hint::allow_auto_batching.name());
+    return allow != params.end() && !allow->second.as<bool>();
+}
+
+std::string CompiledModelCache::MakeKey(const std::shared_ptr<ov::Model> &model, const std::string &device,
+                                        const ov::AnyMap &params) {
+    uint64_t model_hash = 0;
+    ov::pass::Manager manager;
+    manager.register_pass<ov::pass::Hash>(model_hash);
+    manager.run_passes(model);
+
+    // AnyMap is ordered by name, so equal parameters give equal string
+    std::string compile_config = device;
+    for (const auto &param : params)
+        compile_config += ";" + param.first + "=" + param.second.as<std::string>();
+    const uint64_t config_hash = std::hash<std::string>{}(compile_config);
+
+    std::ostringstream key;
+    key << std::hex << std::setfill('0') << std::setw(16) << model_hash << std::setw(16) << config_hash;
+    return key.str();
+}
+
+std::string CompiledModelCache::GetBlobPath(const std::string &model_path, const std::string &key) const {
+    return (fs::path(directory) / (fs::path(model_path).stem().string() + "-" + key + ".blob")).string();
+}
+
+bool CompiledModelCache::Import(const std::string &blob_path, const std::function<void(std::istream &)> &import) const {
+    std::ifstream blob(blob_path, std::ios::binary);
+    if (!blob.is_open())
+        return false;
+    try {
+        import(blob);
+        return true;
+    } catch (const std::exception &e) {
+        GVA_WARNING("Couldn't import compiled model from %s, it will be recompiled: %s", blob_path.c_str(), e.what());
+    }
+    blob.close();
+    std::error_code ec;
+    fs::remove(blob_path, ec);
+    return false;
+}
+
+void CompiledModelCache::Export(const std::string &blob_path, const ov::CompiledModel &compiled_model) const {
+    // Unique name of the temporary file, directory may be shared by several processes
+    const std::string temp_path =
+        blob_path + ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + "-" +
+        std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+    try {
+        fs::create_directories(directory);
+        {
+            std::ofstream blob(temp_path, std::ios::binary | std::ios::trunc);
+            if (!blob.is_open())
+                throw std::runtime_error("couldn't open " + temp_path);
+            compiled_model.export_model(blob);
+            if (!blob.flush())
+                throw std::runtime_error("couldn't write " + temp_path);
+        }
+        // Rename is atomic, pipelines importing the blob concurrently never see partially written file
+        fs::rename(temp_path, blob_path);
+        GVA_INFO("Compiled model exported to %s", blob_path.c_str());
+    } catch (const std::exception &e) {
+        GVA_WARNING("Couldn't export compiled model to %s: %s", blob_path.c_str(), e.what());
+        std::error_code ec;
+        fs::remove(temp_path, ec);
+    }
+}
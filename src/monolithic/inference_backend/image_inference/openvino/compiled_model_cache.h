@@ -0,0 +1,45 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <openvino/openvino.hpp>
+
+#include <functional>
+#include <istream>
+#include <memory>
+#include <string>
+
+/**
+ * Directory of compiled models exported by OpenVINO™ toolkit. Blob name is derived from hash of the configured model
+ * (graph, weights, reshape and pre-processing steps), target device and compile parameters, so any change of them
+ * results in cache miss. Blobs are written through a temporary file and renamed, several pipelines may share the
+ * directory. Models compiled with automatic batching are not cached, see IsSupported().
+ */
+class CompiledModelCache {
+  public:
+    explicit CompiledModelCache(std::string directory);
+
+    // Returns false for models compiled with automatic batching, explicitly with BATCH: device or implicitly for GPU
+    // with THROUGHPUT performance hint. Their export and import do not keep batching, so the imported model differs.
+    static bool IsSupported(const std::string &device, const ov::AnyMap &params);
+
+    // Returns blob key for the model compiled for 'device' with 'params'
+    static std::string MakeKey(const std::shared_ptr<ov::Model> &model, const std::string &device,
+                               const ov::AnyMap &params);
+
+    std::string GetBlobPath(const std::string &model_path, const std::string &key) const;
+
+    // Calls 'import' with stream of the blob if it exists. Blob failed to import is removed.
+    // Returns true if the model was imported.
+    bool Import(const std::string &blob_path, const std::function<void(std::istream &)> &import) const;
+
+    // Exports compiled model to the blob, failures are logged and ignored
+    void Export(const std::string &blob_path, const ov::CompiledModel &compiled_model) const;
+
+  private:
+    std::string directory;
+};
@@ -20,6 +20,7 @@
 
 #include <spdlog/fmt/bundled/ranges.h>
 
+#include "compiled_model_cache.h"
 #include "model_api_converters.h"
 #include "openvino_image_inference.h"
 
@@ -40,8 +41,12 @@
 #endif
 #endif
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <functional>
 #include <iterator>
+#include <mutex>
 #include <regex>
 #include <stdio.h>
 #include <thread>
@@ -75,6 +80,9 @@ struct fmt::formatter<InferenceBackend::ImagePreprocessorType> : formatter<strin
         case ImagePreprocessorType::D3D11_SURFACE_SHARING:
             name = "D3D11 Surface Sharing";
             break;
+        case ImagePreprocessorType::FUSED_CPU:
+            name = "Fused CPU";
+            break;
         }
         return formatter<string_view>::format(name, ctx);
     }
@@ -238,6 +246,10 @@ struct ConfigHelper {
         return base_config.at(KEY_MODEL);
     }
 
+    const std::string &model_cache_dir() const {
+        return base_get_or_empty(KEY_MODEL_CACHE_DIR);
+    }
+
     const std::string custom_preproc_lib() const {
         return base_config.at(KEY_CUSTOM_PREPROC_LIB);
     }
@@ -258,6 +270,29 @@ struct ConfigHelper {
         return std::stoi(it->second);
     }
 
+    size_t max_batch_latency() const {
+        const auto it = base_config.find(KEY_MAX_BATCH_LATENCY);
+        if (it == base_config.cend())
+            return 0;
+        return std::stoul(it->second);
+    }
+
+    size_t cpu_thread_pool_size() const {
+        // regions are converted sequentially by the streaming thread unless configured
+        static constexpr size_t DEFAULT_CPU_THREAD_POOL_SIZE = 0;
+        const auto pp_config = config.find(InferenceBackend::KEY_PRE_PROCESSOR);
+        if (pp_config == config.cend())
+            return DEFAULT_CPU_THREAD_POOL_SIZE;
+        const auto it = pp_config->second.find(InferenceBackend::KEY_CPU_THREAD_POOL_SIZE);
+        if (it == pp_config->second.cend())
+            return DEFAULT_CPU_THREAD_POOL_SIZE;
+        return std::stoul(it->second);
+    }
+
+    bool dynamic_partial_batch() const {
+        return base_get_or_empty(KEY_PARTIAL_BATCH_POLICY) == "dynamic";
+    }
+
     const std::string &image_format() const {
         return base_get_or_empty(KEY_IMAGE_FORMAT);
     }
@@ -456,6 +491,7 @@ class OpenVinoNewApiImpl {
           _error_handler(error_handler) {
 #endif
         log_api_message();
+        const auto startup_begin = std::chrono::steady_clock::now();
 
         _device = config.device();
         _nireq = config.nireq();
@@ -477,13 +513,21 @@ class OpenVinoNewApiImpl {
 
         configure_model(config);
         create_remote_context();
+        const auto model_ready = std::chrono::steady_clock::now();
 
         // Load nn to device
-        load_network(config);
+        const bool from_cache = load_network(config);
 
         if (!_nireq)
             _nireq = _compiled_model.get_property(ov::optimal_number_of_infer_requests);
         GVA_DEBUG("Num of inference req: %d", _nireq);
+
+        using ms = std::chrono::duration<double, std::milli>;
+        const auto startup_end = std::chrono::steady_clock::now();
+        GVA_INFO("Model startup time: %.1f ms (read and configure %.1f ms, %s %.1f ms), model=%s, device=%s",
+                 ms(startup_end - startup_begin).count(), ms(model_ready - startup_begin).count(),
+                 from_cache ? "import from cache" : "compile", ms(startup_end - model_ready).count(),
+                 _model_path.c_str(), _device.c_str());
     }
 
     ~OpenVinoNewApiImpl() {
@@ -549,7 +593,7 @@ class OpenVinoNewApiImpl {
             GVA_DEBUG("get_model_image_input_info(): using wa, w=%zu, h=%zu", width, height);
         }
 
-        if (batch_size == 0) {
+        if (batch_size == 0 || _dynamic_batch) {
             batch_size = _batch_size;
         }
 
@@ -786,6 +830,7 @@ class OpenVinoNewApiImpl {
     int _auto_batch_num_requests = 0;
     int _batch_size = 0;
     int _batch_timeout = -1;
+    bool _dynamic_batch = false;
 
     size_t _origin_model_in_w = 0;
     size_t _origin_model_in_h = 0;
@@ -829,8 +874,21 @@ class OpenVinoNewApiImpl {
             _batch_size = 1;
         }
 
-        GVA_DEBUG("Setting batch size of %d to model", _batch_size);
-        ov::set_batch(_model, _batch_size);
+        // Partially filled batches dispatched by max-batch-latency may run without padding if batch is dynamic
+        _dynamic_batch = _batch_size > 1 && config.max_batch_latency() > 0 && config.dynamic_partial_batch();
+        if (_dynamic_batch && !can_use_dynamic_batch()) {
+            GVA_WARNING("partial-batch-policy=dynamic requires a single input model with static non-batch "
+                        "dimensions, falling back to partial-batch-policy=padded");
+            _dynamic_batch = false;
+        }
+
+        if (_dynamic_batch) {
+            GVA_DEBUG("Setting dynamic batch size of 1..%d to model", _batch_size);
+            ov::set_batch(_model, ov::Dimension(1, _batch_size));
+        } else {
+            GVA_DEBUG("Setting batch size of %d to model", _batch_size);
+            ov::set_batch(_model, _batch_size);
+        }
 
         GVA_DEBUG("Model inputs after configuration:");
         size_t idx = 0;
@@ -845,6 +903,19 @@ class OpenVinoNewApiImpl {
         _image_input_name = item.get_any_name();
     }
 
+    bool can_use_dynamic_batch() const {
+        if (_model->inputs().size() != 1)
+            return false;
+        const auto &partial_shape = _model->input().get_partial_shape();
+        if (partial_shape.rank().is_dynamic())
+            return false;
+        for (size_t i = 1; i < partial_shape.size(); i++) {
+            if (partial_shape[i].is_dynamic())
+                return false;
+        }
+        return true;
+    }
+
     void configure_model_inputs(const ConfigHelper &config, ov::preprocess::PrePostProcessor &preproc) {
         const auto &inputs = _model->inputs();
 
@@ -944,9 +1015,9 @@ class OpenVinoNewApiImpl {
         std::string pp_type_string = fmt::format("Pre-processing: {}", pp_type);
         GVA_DEBUG("%s", pp_type_string.c_str());
 
-        // OPENCV and VAAPI pre-processors handle color coversion and scaling, input tensors in NCHW format
-        if (pp_type == ImagePreprocessorType::OPENCV || pp_type == ImagePreprocessorType::VAAPI_SYSTEM ||
-            pp_type == ImagePreprocessorType::D3D11) {
+        // OPENCV, FUSED_CPU and VAAPI pre-processors handle color coversion and scaling, input tensors in NCHW format
+        if (pp_type == ImagePreprocessorType::OPENCV || pp_type == ImagePreprocessorType::FUSED_CPU ||
+            pp_type == ImagePreprocessorType::VAAPI_SYSTEM || pp_type == ImagePreprocessorType::D3D11) {
             input.tensor().set_layout("NCHW");
         }
 
@@ -1066,8 +1137,8 @@ class OpenVinoNewApiImpl {
         print_input_and_outputs_info(*_model);
     }
 
-    // Loads network to the device
-    void load_network(const ConfigHelper &config) {
+    // Loads network to the device, returns true if compiled model was imported from model cache directory
+    bool load_network(const ConfigHelper &config) {
         assert(!_compiled_model);
         ov::AnyMap ov_params = config.inference_cfg();
         std::string params = fmt::format("Params for compile_model:\n  {}", fmt::join(ov_params, "\n  "));
@@ -1079,15 +1150,45 @@ class OpenVinoNewApiImpl {
             GVA_INFO("using remote context");
         }
 
+        std::string formatted_device = _device;
+        if (!_openvino_context && _batch_timeout > -1) {
+            formatted_device = fmt::format("BATCH:{}({})", _device, _auto_batch_num_requests);
+        }
+
+        // Compiled blob depends on configured model (reshape and pre-processing included), device and parameters
+        std::unique_ptr<CompiledModelCache> cache;
+        std::string blob_path;
+        bool from_cache = false;
+        const std::string cache_device = _openvino_context ? "remote:" + _device : formatted_device;
+        if (!config.model_cache_dir().empty() && !CompiledModelCache::IsSupported(cache_device, ov_params)) {
+            static std::once_flag logged;
+            std::call_once(logged, [&] {
+                GVA_WARNING("Model cache is not used for device %s with automatic batching", cache_device.c_str());
+            });
+        } else if (!config.model_cache_dir().empty()) {
+            cache = std::make_unique<CompiledModelCache>(config.model_cache_dir());
+            blob_path = cache->GetBlobPath(_model_path, CompiledModelCache::MakeKey(_model, cache_device, ov_params));
+            from_cache = cache->Import(blob_path, [&](std::istream &blob) {
+                if (_openvino_context)
+                    _compiled_model = core().import_model(blob, _openvino_context->remote_context(), ov_params);
+                else
+                    _compiled_model = core().import_model(blob, formatted_device, ov_params);
+            });
+            if (from_cache)
+                GVA_INFO("Model cache hit: network imported from %s", blob_path.c_str());
+            else
+                GVA_INFO("Model cache miss: compiling network to %s", blob_path.c_str());
+        }
+
         // print_input_and_outputs_info(*_model);
-        if (_openvino_context) {
-            _compiled_model = core().compile_model(_model, _openvino_context->remote_context(), ov_params);
-        } else {
-            std::string formatted_device = _device;
-            if (_batch_timeout > -1) {
-                formatted_device = fmt::format("BATCH:{}({})", _device, _auto_batch_num_requests);
+        if (!from_cache) {
+            if (_openvino_context) {
+                _compiled_model = core().compile_model(_model, _openvino_context->remote_context(), ov_params);
+            } else {
+                _compiled_model = core().compile_model(_model, formatted_device, ov_params);
             }
-            _compiled_model = core().compile_model(_model, formatted_device, ov_params);
+            if (cache)
+                cache->Export(blob_path, _compiled_model);
         }
         GVA_INFO("Network loaded to device");
 
@@ -1098,6 +1199,7 @@ class OpenVinoNewApiImpl {
             auto prop = _compiled_model.get_property(cfg);
             GVA_DEBUG(" %s: %s", cfg.c_str(), prop.as<std::string>().c_str());
         }
+        return from_cache;
     }
 
     static std::pair<ov::preprocess::ColorFormat, std::vector<std::string>>
@@ -1175,6 +1277,8 @@ void OpenVINOImageInference::SetCompletionCallback(std::shared_ptr<BatchRequest>
 
     auto cb = [=, this](std::exception_ptr ex) {
         ITT_TASK("completion_callback_lambda_new");
+        if (stage_timer)
+            stage_timer->Record(Stage::INFER, batch_request->start_ticks, StageTimer::Ticks());
 
         try {
             if (ex) {
@@ -1189,6 +1293,7 @@ void OpenVINOImageInference::SetCompletionCallback(std::shared_ptr<BatchRequest>
                       Utils::createNestedErrorMsg(e).c_str());
         }
 
+        --requests_in_flight_;
         FreeRequest(batch_request);
     };
     batch_request->infer_request_new.set_callback(cb);
@@ -1222,6 +1327,9 @@ OpenVINOImageInference::OpenVINOImageInference(const InferenceBackend::Inference
         batch_size = _impl->_batch_size;
         batch_timeout = _impl->_batch_timeout;
         image_layer = _impl->_image_input_name;
+        dynamic_batch = _impl->_dynamic_batch;
+        if (batch_size > 1)
+            max_batch_latency = std::chrono::microseconds(cfg_helper.max_batch_latency());
 
         for (int i = 0; i < nireq; i++) {
             std::shared_ptr<BatchRequest> batch_request = std::make_shared<BatchRequest>();
@@ -1233,14 +1341,30 @@ OpenVINOImageInference::OpenVINOImageInference(const InferenceBackend::Inference
 
 #ifndef ENABLE_D3D_NPU_COLOR_CONV
         if (pp_type == InferenceBackend::ImagePreprocessorType::OPENCV ||
+            pp_type == InferenceBackend::ImagePreprocessorType::FUSED_CPU ||
             pp_type == InferenceBackend::ImagePreprocessorType::D3D11) {
 #else
-        if (pp_type == InferenceBackend::ImagePreprocessorType::OPENCV) {
+        if (pp_type == InferenceBackend::ImagePreprocessorType::OPENCV ||
+            pp_type == InferenceBackend::ImagePreprocessorType::FUSED_CPU) {
 #endif
             std::string pp_type_string = fmt::format("creating pre-processor, type: {}", pp_type);
             GVA_INFO("%s", pp_type_string.c_str());
             const std::string custom_preproc_lib = cfg_helper.custom_preproc_lib();
             pre_processor.reset(InferenceBackend::ImagePreprocessor::Create(pp_type, custom_preproc_lib));
+
+            // user pre-processing library is not required to be reentrant
+            const size_t workers = std::min<size_t>(cfg_helper.cpu_thread_pool_size(),
+                                                    std::max(1U, std::thread::hardware_concurrency()));
+            if (workers > 1 && custom_preproc_lib.empty()) {
+                GVA_INFO("Regions of a frame are pre-processed by shared pool of %zu threads", workers);
+                pre_proc_workers = WorkerPool::GetShared(workers);
+            }
+        }
+
+        if (max_batch_latency.count() > 0) {
+            GVA_INFO("Partially filled batches are dispatched after %ld us (%s)",
+                     static_cast<long>(max_batch_latency.count()), dynamic_batch ? "dynamic" : "padded");
+            batch_dispatcher_ = std::thread(&OpenVINOImageInference::BatchDispatcherFunction, this);
         }
 
     } catch (const std::exception &e) {
@@ -1268,6 +1392,20 @@ bool OpenVINOImageInference::IsQueueFull() {
     return freeRequests.empty();
 }
 
+/**
+ * Takes a free request, time spent waiting for a running one to complete is accumulated for queue statistics.
+ * Expects requests_mutex_ to be held by caller, so a request seen in the queue can't be taken by another thread.
+ */
+std::shared_ptr<OpenVINOImageInference::BatchRequest> OpenVINOImageInference::PopFreeRequest() {
+    if (!freeRequests.empty())
+        return freeRequests.pop();
+    const auto wait_start = std::chrono::steady_clock::now();
+    auto request = freeRequests.pop();
+    free_request_wait_ns_ +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - wait_start).count();
+    return request;
+}
+
 Image fill_image(ov::Tensor &tensor, size_t bindex) {
     Image image = Image();
     const auto &dims = tensor.get_shape();
@@ -1314,18 +1452,31 @@ Image map_ov_tensor_to_img(ov::Tensor &tensor, size_t batch_index) {
     return image;
 }
 
+Image OpenVINOImageInference::PrepareInputImage(const std::string &input_name, BatchRequest &request,
+                                                size_t batch_index) {
+    // FIXME: single input
+    if (request.in_tensors.front().empty()) {
+        if (dynamic_batch) {
+            // Dynamic batch input has no tensor of full batch size until one is set, keep our own per request
+            if (!request.batch_input) {
+                const auto input = _impl->_compiled_model.input(input_name);
+                request.batch_input = ov::Tensor(input.get_element_type(), input.get_partial_shape().get_max_shape());
+            }
+            request.in_tensors.front().push_back(request.batch_input);
+        } else {
+            request.in_tensors.front().push_back(request.infer_request_new.get_tensor(input_name));
+        }
+    }
+    return map_ov_tensor_to_img(request.in_tensors.front().front(), batch_index);
+}
+
 void OpenVINOImageInference::SubmitImageProcessing(const std::string &input_name, std::shared_ptr<BatchRequest> request,
                                                    const Image &src_img, const InputImageLayerDesc::Ptr &pre_proc_info,
                                                    const ImageTransformationParams::Ptr image_transform_info) {
     ITT_TASK(__FUNCTION__);
     assert(request);
 
-    // FIXME: single input
-    if (request->in_tensors.front().empty()) {
-        request->in_tensors.front().push_back(request->infer_request_new.get_tensor(input_name));
-    }
-    const size_t batch_index = request->buffers.size();
-    Image dst_img = map_ov_tensor_to_img(request->in_tensors.front().front(), batch_index);
+    Image dst_img = PrepareInputImage(input_name, *request, request->buffers.size());
     if (src_img.planes[0] != dst_img.planes[0]) { // only convert if different buffers
         try {
             pre_processor->Convert(src_img, dst_img, pre_proc_info, image_transform_info);
@@ -1413,7 +1564,8 @@ void OpenVINOImageInference::ApplyInputPreprocessors(
         const auto &model_inputs = _impl->_model->inputs();
         std::shared_ptr<OpenvinoInputTensor> intput_tensor = nullptr;
         if (model_inputs.size() == 1) {
-            intput_tensor = std::make_shared<OpenvinoInputTensor>(request->infer_request_new.get_input_tensor());
+            intput_tensor = std::make_shared<OpenvinoInputTensor>(
+                request->batch_input ? request->batch_input : request->infer_request_new.get_input_tensor());
         } else {
             intput_tensor =
                 std::make_shared<OpenvinoInputTensor>(request->infer_request_new.get_tensor(preprocessor.second->name));
@@ -1432,10 +1584,13 @@ void OpenVINOImageInference::SubmitImage(
 
     std::unique_lock<std::mutex> lk(requests_mutex_);
     ++requests_processing_;
-    std::shared_ptr<BatchRequest> request = freeRequests.pop();
+    std::shared_ptr<BatchRequest> request = PopFreeRequest();
 
     try {
-        if (DoNeedImagePreProcessing(frame->GetImage())) {
+        const bool need_pre_processing = DoNeedImagePreProcessing(frame->GetImage());
+        // Bypassed images are converted and timed by async wrappers, or converted within inference
+        StageScope preproc_scope(need_pre_processing ? stage_timer.get() : nullptr, Stage::PREPROC);
+        if (need_pre_processing) {
             SubmitImageProcessing(
                 image_layer, request, *frame->GetImage(),
                 getImagePreProcInfo(input_preprocessors), // contain operations order for Custom Image PreProcessing
@@ -1458,15 +1613,222 @@ void OpenVINOImageInference::SubmitImage(
     }
 
     try {
-        // start inference asynchronously if enough buffers for batching
-        if (request->buffers.size() >= safe_convert<size_t>(batch_size)) {
-            request->start_async();
+        DispatchRequest(request);
+    } catch (const std::exception &e) {
+        std::throw_with_nested(std::runtime_error("Inference async start was failed."));
+    }
+}
+
+void OpenVINOImageInference::SubmitImages(
+    std::vector<IFrameBase::Ptr> frames,
+    const std::vector<std::map<std::string, InferenceBackend::InputLayerDesc::Ptr>> &input_preprocessors) {
+    ITT_TASK(__FUNCTION__);
+
+    if (frames.size() != input_preprocessors.size())
+        throw std::invalid_argument("Number of frames and input pre-processors mismatch");
+    for (const auto &frame : frames) {
+        if (!frame || !frame->GetImage())
+            throw std::invalid_argument("Invalid frame provided");
+    }
+
+    if (!pre_proc_workers || frames.size() < 2 || !DoNeedImagePreProcessing(frames.front()->GetImage())) {
+        ImageInference::SubmitImages(std::move(frames), input_preprocessors);
+        return;
+    }
+
+    struct Slot {
+        std::shared_ptr<BatchRequest> request;
+        Image dst_img;
+    };
+    const size_t full_batch_size = safe_convert<size_t>(batch_size);
+
+    for (size_t first = 0; first < frames.size();) {
+        std::unique_lock<std::mutex> lk(requests_mutex_);
+
+        // Reserve batch slots for regions. Waiting is allowed for the first request only, further ones are taken
+        // while available, regions not fitting into free requests are submitted with the next chunk.
+        std::vector<std::shared_ptr<BatchRequest>> requests;
+        std::vector<Slot> slots;
+        try {
+            while (first + slots.size() < frames.size() && (requests.empty() || !freeRequests.empty())) {
+                requests.push_back(PopFreeRequest());
+                auto &request = requests.back();
+                for (size_t index = request->buffers.size();
+                     index < full_batch_size && first + slots.size() < frames.size(); index++)
+                    slots.push_back({request, PrepareInputImage(image_layer, *request, index)});
+            }
+        } catch (const std::exception &e) {
+            for (auto it = requests.rbegin(); it != requests.rend(); ++it)
+                freeRequests.push_front(*it);
+            std::throw_with_nested(std::runtime_error("Failed to reserve batch slots for frame regions"));
+        }
+        requests_processing_ += slots.size();
+
+        size_t submitted = 0;
+        try {
+            StageScope preproc_scope(stage_timer.get(), Stage::PREPROC);
+            pre_proc_workers->ParallelFor(slots.size(), [&](size_t i) {
+                const auto &frame = frames[first + i];
+                const Image &src_img = *frame->GetImage();
+                if (src_img.planes[0] == slots[i].dst_img.planes[0]) // only convert if different buffers
+                    return;
+                pre_processor->Convert(src_img, slots[i].dst_img, getImagePreProcInfo(input_preprocessors[first + i]),
+                                       frame->GetImageTransformationParams());
+            });
+
+            for (; submitted < slots.size(); submitted++) {
+                auto &frame = frames[first + submitted];
+                // After conversion self-managed image memory is filled, region image (and mapped frame) is released
+                frame->SetImage(nullptr);
+                ApplyInputPreprocessors(slots[submitted].request, input_preprocessors[first + submitted]);
+                slots[submitted].request->buffers.push_back(std::move(frame));
+            }
+        } catch (const std::exception &e) {
+            // Converted but not submitted slots are overwritten by next submissions
+            requests_processing_ -= slots.size() - submitted;
+            // Full requests are started in order, the rest are returned in reverse order, so the partially filled
+            // one is at the front of the queue ahead of the empty ones following it
+            for (const auto &request : requests)
+                if (request->buffers.size() >= full_batch_size)
+                    DispatchRequest(request);
+            for (auto it = requests.rbegin(); it != requests.rend(); ++it)
+                if ((*it)->buffers.size() < full_batch_size)
+                    DispatchRequest(*it);
+            GVA_ERROR("Pre-processing has failed: %s", e.what());
+            std::throw_with_nested(std::runtime_error("Pre-processing was failed."));
+        }
+
+        try {
+            // Only the last request may stay partially filled, it is returned to the front of the queue
+            for (const auto &request : requests)
+                DispatchRequest(request);
+        } catch (const std::exception &e) {
+            std::throw_with_nested(std::runtime_error("Inference async start was failed."));
+        }
+        first += slots.size();
+    }
+}
+
+void OpenVINOImageInference::DispatchRequest(const std::shared_ptr<BatchRequest> &request) {
+    // start inference asynchronously if enough buffers for batching
+    if (request->buffers.size() >= safe_convert<size_t>(batch_size)) {
+        partial_batch_deadline_.Disarm();
+        StartBatch(request);
+        ++batches_by_size_;
+    } else if (request->buffers.empty()) {
+        freeRequests.push_front(request);
+    } else {
+        // arm deadline on first frame of the batch, the request stays at the front of the queue
+        if (max_batch_latency.count() > 0)
+            partial_batch_deadline_.Arm(max_batch_latency);
+        freeRequests.push_front(request);
+    }
+}
+
+void OpenVINOImageInference::StartBatch(const std::shared_ptr<BatchRequest> &request) {
+    assert(request);
+
+    const size_t frames_num = request->buffers.size();
+    const size_t full_batch_size = safe_convert<size_t>(batch_size);
+
+    if (full_batch_size > 1 && frames_num < full_batch_size && !DoNeedImagePreProcessing(nullptr)) {
+        size_t input_idx = 0;
+        for (auto &input_vec : request->in_tensors) {
+            // WA: Fill non-complete batch with last element. Can be removed once supported in OV
+            if (!dynamic_batch) {
+                for (size_t i = input_vec.size(); i < full_batch_size; i++)
+                    input_vec.push_back(input_vec.back());
+            }
+            // FIXME: move?
+            request->infer_request_new.set_input_tensors(input_idx, input_vec);
+            input_idx++;
+        }
+    } else if (request->batch_input) {
+        // Batch is the outermost dimension, so the first frames_num images form a continuous ROI
+        const ov::Shape &shape = request->batch_input.get_shape();
+        if (frames_num < shape[0]) {
+            ov::Coordinate begin(shape.size(), 0);
+            ov::Coordinate end(shape);
+            end[0] = frames_num;
+            request->infer_request_new.set_tensor(image_layer, ov::Tensor(request->batch_input, begin, end));
         } else {
+            request->infer_request_new.set_tensor(image_layer, request->batch_input);
+        }
+    }
+
+    // counted before start, completion callback may run before start_async returns
+    ++requests_in_flight_;
+    if (stage_timer)
+        request->start_ticks = StageTimer::Ticks();
+    try {
+        request->start_async();
+    } catch (...) {
+        --requests_in_flight_;
+        throw;
+    }
+    batched_frames_ += frames_num;
+}
+
+void OpenVINOImageInference::BatchDispatcherFunction() {
+    std::unique_lock<std::mutex> lk(requests_mutex_);
+
+    while (partial_batch_deadline_.Wait(lk)) {
+        if (freeRequests.empty())
+            continue;
+
+        // Partially filled request is always kept at the front of the queue, see SubmitImage
+        auto request = freeRequests.pop();
+        if (request->buffers.empty()) {
             freeRequests.push_front(request);
+            continue;
         }
-    } catch (const std::exception &e) {
-        std::throw_with_nested(std::runtime_error("Inference async start was failed."));
+
+        try {
+            StartBatch(request);
+            ++batches_by_deadline_;
+        } catch (const std::exception &e) {
+            GVA_ERROR("Couldn't start inference on batch deadline: %s", e.what());
+            this->handleError(request->buffers);
+            FreeRequest(request);
+        }
+    }
+}
+
+void OpenVINOImageInference::StopBatchDispatcher() {
+    if (!batch_dispatcher_.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lk(requests_mutex_);
+        partial_batch_deadline_.Stop();
     }
+    batch_dispatcher_.join();
+
+    const auto stats = GetBatchDispatchStats();
+    std::string stats_str = fmt::format("Batches dispatched for model {}: by size: {}, by deadline: {}, by flush: {}",
+                                        model_name, stats.by_size, stats.by_deadline, stats.by_flush);
+    GVA_INFO("%s", stats_str.c_str());
+}
+
+OpenVINOImageInference::BatchDispatchStats OpenVINOImageInference::GetBatchDispatchStats() const {
+    BatchDispatchStats stats;
+    stats.by_size = batches_by_size_;
+    stats.by_deadline = batches_by_deadline_;
+    stats.by_flush = batches_by_flush_;
+    return stats;
+}
+
+OpenVINOImageInference::QueueStats OpenVINOImageInference::GetQueueStats() const {
+    QueueStats stats;
+    stats.requests_in_flight = requests_in_flight_;
+    stats.batches = batches_by_size_ + batches_by_deadline_ + batches_by_flush_;
+    stats.batched_frames = batched_frames_;
+    stats.free_request_wait_ns = free_request_wait_ns_;
+    return stats;
+}
+
+void OpenVINOImageInference::SetStageTimer(StageTimer::Ptr timer) {
+    stage_timer = std::move(timer);
 }
 
 const std::string &OpenVINOImageInference::GetModelName() const {
@@ -1525,25 +1887,15 @@ void OpenVINOImageInference::Flush() {
     std::unique_lock<std::mutex> requests_lk(requests_mutex_);
 
     std::unique_lock<std::mutex> flush_lk(flush_mutex);
+    partial_batch_deadline_.Disarm();
 
     while (requests_processing_ != 0) {
         auto request = freeRequests.pop();
 
         if (request->buffers.size() > 0) {
             try {
-                // WA: Fill non-complete batch with last element. Can be removed once supported in OV
-                if (batch_size > 1 && !DoNeedImagePreProcessing(nullptr)) {
-                    size_t input_idx = 0;
-                    for (auto &input_vec : request->in_tensors) {
-                        for (int i = input_vec.size(); i < batch_size; i++)
-                            input_vec.push_back(input_vec.back());
-                        // FIXME: move?
-                        request->infer_request_new.set_input_tensors(input_idx, input_vec);
-                        input_idx++;
-                    }
-                }
-
-                request->start_async();
+                StartBatch(request);
+                ++batches_by_flush_;
             } catch (const std::exception &e) {
                 GVA_ERROR("Couldn't start inferece on flush: %s", e.what());
                 this->handleError(request->buffers);
@@ -1560,7 +1912,9 @@ void OpenVINOImageInference::Flush() {
 }
 
 void OpenVINOImageInference::Close() {
+    StopBatchDispatcher();
     Flush();
+
     while (!freeRequests.empty()) {
         auto req = freeRequests.pop();
         req->infer_request_new.set_callback([](std::exception_ptr) {});
@@ -1574,7 +1928,36 @@ void OpenVINOImageInference::WorkingFunction(const std::shared_ptr<BatchRequest>
     const auto &outputs = _impl->_compiled_model.outputs();
     for (size_t i = 0; i < outputs.size(); i++) {
         auto name = outputs[i].get_names().size() > 0 ? outputs[i].get_any_name() : std::string("output");
-        output_blobs[name] = std::make_shared<OpenvinoOutputTensor>(request->infer_request_new.get_output_tensor(i));
+        ov::Tensor output = request->infer_request_new.get_output_tensor(i);
+        if (dynamic_batch)
+            output = PadOutputToBatch(*request, i, output);
+        output_blobs[name] = std::make_shared<OpenvinoOutputTensor>(output);
     }
     callback(output_blobs, request->buffers);
 }
+
+/**
+ * Post-processing slices outputs by the model batch size, so outputs of a partially filled dynamic batch are copied
+ * into tensors of full batch size. The tail is zero-filled, results of missing frames are dropped as for padded
+ * batches.
+ */
+ov::Tensor OpenVINOImageInference::PadOutputToBatch(BatchRequest &request, size_t output_index,
+                                                    const ov::Tensor &output) {
+    const ov::Shape &shape = output.get_shape();
+    const size_t full_batch_size = safe_convert<size_t>(batch_size);
+    if (shape.empty() || shape[0] >= full_batch_size)
+        return output;
+
+    ov::Shape padded_shape = shape;
+    padded_shape[0] = full_batch_size;
+    if (request.batch_outputs.size() <= output_index)
+        request.batch_outputs.resize(output_index + 1);
+    ov::Tensor &padded = request.batch_outputs[output_index];
+    if (!padded || padded.get_shape() != padded_shape || padded.get_element_type() != output.get_element_type())
+        padded = ov::Tensor(output.get_element_type(), padded_shape);
+
+    const size_t byte_size = output.get_byte_size();
+    std::memcpy(padded.data(), output.data(), byte_size);
+    std::memset(static_cast<uint8_t *>(padded.data()) + byte_size, 0, padded.get_byte_size() - byte_size);
+    return padded;
+}
@@ -13,13 +13,16 @@
 #include <openvino/openvino.hpp>
 
 #include <atomic>
+#include <chrono>
 #include <gst/gst.h>
 #include <map>
 #include <string>
 #include <thread>
 
 #include "config.h"
+#include "partial_batch_deadline.h"
 #include "safe_queue.h"
+#include "worker_pool.h"
 
 class OpenVINOImageInference : public InferenceBackend::ImageInference {
   public:
@@ -32,6 +35,10 @@ class OpenVINOImageInference : public InferenceBackend::ImageInference {
     void SubmitImage(IFrameBase::Ptr frame,
                      const std::map<std::string, InferenceBackend::InputLayerDesc::Ptr> &input_preprocessors) override;
 
+    void SubmitImages(std::vector<IFrameBase::Ptr> frames,
+                      const std::vector<std::map<std::string, InferenceBackend::InputLayerDesc::Ptr>>
+                          &input_preprocessors) override;
+
     const std::string &GetModelName() const override;
 
     size_t GetBatchSize() const override;
@@ -49,6 +56,15 @@ class OpenVINOImageInference : public InferenceBackend::ImageInference {
 
     bool IsQueueFull() override;
 
+    struct BatchDispatchStats {
+        uint64_t by_size = 0;     // batches started because batch-size frames were collected
+        uint64_t by_deadline = 0; // partially filled batches started by max-batch-latency timer
+        uint64_t by_flush = 0;    // partially filled batches started on flush (EOS)
+    };
+    BatchDispatchStats GetBatchDispatchStats() const;
+    QueueStats GetQueueStats() const override;
+    void SetStageTimer(InferenceBackend::StageTimer::Ptr timer) override;
+
     void Flush() override;
 
     void Close() override;
@@ -60,6 +76,12 @@ class OpenVINOImageInference : public InferenceBackend::ImageInference {
         ov::InferRequest infer_request_new;
         std::vector<IFrameBase::Ptr> buffers;
         std::vector<ov::TensorVector> in_tensors;
+        // Full-size image input tensor, allocated only for dynamic batch models
+        ov::Tensor batch_input;
+        // Output tensors of full batch size, partial dynamic batches are copied there for post-processing
+        ov::TensorVector batch_outputs;
+        // Start time of inference for Stage::INFER
+        uint64_t start_ticks = 0;
 
         void start_async() {
             return this->infer_request_new.start_async();
@@ -68,6 +90,7 @@ class OpenVINOImageInference : public InferenceBackend::ImageInference {
 
     void HandleError(const std::shared_ptr<BatchRequest> &request);
     void WorkingFunction(const std::shared_ptr<BatchRequest> &request);
+    ov::Tensor PadOutputToBatch(BatchRequest &request, size_t output_index, const ov::Tensor &output);
 
     dlstreamer::ContextPtr context_;
     InferenceBackend::MemoryType memory_type;
@@ -83,6 +106,9 @@ class OpenVINOImageInference : public InferenceBackend::ImageInference {
     SafeQueue<std::shared_ptr<BatchRequest>> freeRequests;
 
     std::unique_ptr<InferenceBackend::ImagePreprocessor> pre_processor;
+    // Converts regions submitted together by SubmitImages in parallel, shared by all instances in the process. Set
+    // for software pre-processors if cpu thread pool size is configured
+    std::shared_ptr<WorkerPool> pre_proc_workers;
 
     // Threading
     std::mutex requests_mutex_;
@@ -90,9 +116,27 @@ class OpenVINOImageInference : public InferenceBackend::ImageInference {
     std::condition_variable request_processed_;
     std::mutex flush_mutex;
 
+    // Partial batch dispatching (max-batch-latency)
+    std::chrono::microseconds max_batch_latency{0};
+    bool dynamic_batch = false;
+    PartialBatchDeadline partial_batch_deadline_; // guarded by requests_mutex_
+    std::thread batch_dispatcher_;
+    std::atomic<uint64_t> batches_by_size_{0};
+    std::atomic<uint64_t> batches_by_deadline_{0};
+    std::atomic<uint64_t> batches_by_flush_{0};
+
+    // Queue instrumentation, see GetQueueStats
+    std::atomic<size_t> requests_in_flight_{0};
+    std::atomic<uint64_t> batched_frames_{0};
+    std::atomic<uint64_t> free_request_wait_ns_{0};
+    InferenceBackend::StageTimer::Ptr stage_timer;
+
   private:
     void FreeRequest(std::shared_ptr<BatchRequest> request);
+    std::shared_ptr<BatchRequest> PopFreeRequest();
     bool DoNeedImagePreProcessing(const InferenceBackend::ImagePtr src_img);
+    InferenceBackend::Image PrepareInputImage(const std::string &input_name, BatchRequest &request,
+                                              size_t batch_index);
     void SubmitImageProcessing(const std::string &input_name, std::shared_ptr<BatchRequest> request,
                                const InferenceBackend::Image &src_img,
                                const InferenceBackend::InputImageLayerDesc::Ptr &pre_proc_info,
@@ -100,6 +144,10 @@ class OpenVINOImageInference : public InferenceBackend::ImageInference {
     void BypassImageProcessing(const std::string &input_name, std::shared_ptr<BatchRequest> request,
                                const InferenceBackend::Image &src_img, size_t batch_size);
     void SetCompletionCallback(std::shared_ptr<BatchRequest> &batch_request);
+    void StartBatch(const std::shared_ptr<BatchRequest> &request);
+    void DispatchRequest(const std::shared_ptr<BatchRequest> &request);
+    void BatchDispatcherFunction();
+    void StopBatchDispatcher();
     void
     ApplyInputPreprocessors(std::shared_ptr<BatchRequest> &request,
                             const std::map<std::string, InferenceBackend::InputLayerDesc::Ptr> &input_preprocessors);
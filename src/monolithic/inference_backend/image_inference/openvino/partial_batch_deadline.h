@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+/**
+ * Deadline of partially filled batch request (max-batch-latency). It is armed by the first frame put into the request
+ * and disarmed when the request is started by size or flush. The dispatcher thread waits for the deadline to expire
+ * and starts the partial batch. All methods are called under the mutex of the requests queue, Wait() releases it
+ * while waiting.
+ */
+class PartialBatchDeadline {
+  public:
+    // Arms the deadline 'latency' from now, the deadline armed already is kept
+    void Arm(std::chrono::microseconds latency) {
+        if (armed)
+            return;
+        deadline = std::chrono::steady_clock::now() + latency;
+        armed = true;
+        cv.notify_one();
+    }
+
+    void Disarm() {
+        armed = false;
+    }
+
+    // Makes Wait() return false
+    void Stop() {
+        stopped = true;
+        cv.notify_all();
+    }
+
+    /**
+     * Waits until the armed deadline expires and disarms it. Deadline disarmed or armed again while waiting is not
+     * reported, the wait continues for the next one.
+     * @return false once stopped
+     */
+    bool Wait(std::unique_lock<std::mutex> &lock) {
+        while (!stopped) {
+            if (!armed) {
+                cv.wait(lock, [this] { return stopped || armed; });
+                continue;
+            }
+            const auto current = deadline;
+            const bool changed =
+                cv.wait_until(lock, current, [this, current] { return stopped || !armed || deadline != current; });
+            if (changed)
+                continue;
+            armed = false;
+            return true;
+        }
+        return false;
+    }
+
+  private:
+    bool armed = false;
+    bool stopped = false;
+    std::chrono::steady_clock::time_point deadline;
+    std::condition_variable cv;
+};
@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "worker_pool.h"
+
+#include "inference_backend/logger.h"
+
+#include <map>
+
+WorkerPool::WorkerPool(size_t size) {
+    for (size_t i = 1; i < size; i++)
+        threads.emplace_back(&WorkerPool::WorkingFunction, this);
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+    }
+    job_available.notify_all();
+    for (auto &thread : threads) {
+        if (thread.joinable())
+            thread.join();
+    }
+}
+
+std::shared_ptr<WorkerPool> WorkerPool::GetShared(size_t size) {
+    static std::mutex pools_mutex;
+    static std::map<size_t, std::weak_ptr<WorkerPool>> pools;
+
+    std::lock_guard<std::mutex> lock(pools_mutex);
+    auto pool = pools[size].lock();
+    if (!pool) {
+        pool = std::make_shared<WorkerPool>(size);
+        pools[size] = pool;
+    }
+    return pool;
+}
+
+void WorkerPool::ParallelFor(size_t count, const std::function<void(size_t)> &body) {
+    ITT_TASK(__FUNCTION__);
+    // threads of the shared pool are busy with another element's job, don't wait for them
+    std::unique_lock<std::mutex> submit_lock(submit_mutex, std::try_to_lock);
+    if (threads.empty() || count < 2 || !submit_lock.owns_lock()) {
+        for (size_t i = 0; i < count; i++)
+            body(i);
+        return;
+    }
+
+    uint64_t job;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->body = &body;
+        this->count = count;
+        next_index = 0;
+        done = 0;
+        error = nullptr;
+        job = ++generation;
+    }
+    job_available.notify_all();
+
+    RunJob(job);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    job_done.wait(lock, [this, count] { return done == count; });
+    this->body = nullptr;
+    if (error)
+        std::rethrow_exception(error);
+}
+
+void WorkerPool::RunJob(uint64_t job) {
+    while (true) {
+        size_t index;
+        {
+            // workers woken up late must not take indices of a newer job
+            std::lock_guard<std::mutex> lock(mutex);
+            if (generation != job || next_index >= count)
+                return;
+            index = next_index++;
+        }
+
+        std::exception_ptr body_error;
+        try {
+            (*body)(index);
+        } catch (...) {
+            body_error = std::current_exception();
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (body_error && !error)
+            error = body_error;
+        if (++done == count)
+            job_done.notify_all();
+    }
+}
+
+void WorkerPool::WorkingFunction() {
+    uint64_t last_job = 0;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        job_available.wait(lock, [this, last_job] { return stop || generation != last_job; });
+        if (stop)
+            break;
+        last_job = generation;
+
+        lock.unlock();
+        RunJob(last_job);
+        lock.lock();
+    }
+}
@@ -0,0 +1,60 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Fixed set of threads executing indices of one job at a time, the submitting thread takes part in the work.
+ * Used to pre-process regions of a frame into their batch slots concurrently. Inference instances share one pool
+ * per process, a job submitted while the pool is busy runs in the submitting thread.
+ */
+class WorkerPool {
+  public:
+    // 'size' includes the submitting thread, so size - 1 threads are created
+    explicit WorkerPool(size_t size);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    // Returns the process-wide pool of 'size' threads, it is destroyed when the last user releases it
+    static std::shared_ptr<WorkerPool> GetShared(size_t size);
+
+    // Calls body(i) for each i in [0, count) and waits for all calls. Rethrows the first exception thrown by body.
+    // If another job is running, calls are made sequentially by the caller.
+    void ParallelFor(size_t count, const std::function<void(size_t)> &body);
+
+    size_t GetSize() const {
+        return threads.size() + 1;
+    }
+
+  private:
+    void WorkingFunction();
+    void RunJob(uint64_t job);
+
+    std::vector<std::thread> threads;
+    std::mutex submit_mutex; // one job at a time
+
+    std::mutex mutex;
+    std::condition_variable job_available;
+    std::condition_variable job_done;
+    const std::function<void(size_t)> *body = nullptr;
+    uint64_t generation = 0; // identifies current job
+    size_t count = 0;
+    size_t next_index = 0;
+    size_t done = 0;
+    std::exception_ptr error;
+    bool stop = false;
+};
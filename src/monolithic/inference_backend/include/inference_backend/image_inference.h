@@ -6,15 +6,18 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <gst/gst.h>
 #include <map>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
 #include "image.h"
 #include "input_image_layer_descriptor.h"
+#include "stage_timer.h"
 
 namespace InferenceBackend {
 
@@ -59,6 +62,17 @@ class ImageInference {
     virtual void SubmitImage(IFrameBase::Ptr frame,
                              const std::map<std::string, std::shared_ptr<InputLayerDesc>> &input_preprocessors) = 0;
 
+    // Submits several regions of the same frame, frames[i] is pre-processed with input_preprocessors[i]. Backends may
+    // pre-process the regions in parallel into consecutive batch slots, by default they are submitted one by one.
+    virtual void
+    SubmitImages(std::vector<IFrameBase::Ptr> frames,
+                 const std::vector<std::map<std::string, std::shared_ptr<InputLayerDesc>>> &input_preprocessors) {
+        if (frames.size() != input_preprocessors.size())
+            throw std::invalid_argument("Number of frames and input pre-processors mismatch");
+        for (size_t i = 0; i < frames.size(); i++)
+            SubmitImage(std::move(frames[i]), input_preprocessors[i]);
+    }
+
     virtual const std::string &GetModelName() const = 0;
     virtual size_t GetBatchSize() const = 0;
     virtual size_t GetNireq() const = 0;
@@ -74,6 +88,24 @@ class ImageInference {
     GetModelInfoPreproc(const std::string model_file, const gchar *pre_proc_config, const gchar *ov_extension_lib);
 
     virtual bool IsQueueFull() = 0;
+
+    // Cumulative counters of the inference request queue
+    struct QueueStats {
+        size_t requests_in_flight = 0;     // requests with inference started and not completed yet
+        uint64_t batches = 0;              // batches started
+        uint64_t batched_frames = 0;       // frames in started batches
+        uint64_t free_request_wait_ns = 0; // time submitting threads were blocked waiting for a free request
+    };
+    // Backends without request queue report zeros
+    virtual QueueStats GetQueueStats() const {
+        return {};
+    }
+
+    // Enables timing of backend stages (pre-processing, inference), set before the first submission
+    virtual void SetStageTimer(StageTimer::Ptr timer) {
+        (void)timer;
+    }
+
     virtual void Flush() = 0;
     virtual void Close() = 0;
 
@@ -162,7 +194,8 @@ __DECLARE_CONFIG_KEY(PRE_PROCESSOR);
 __DECLARE_CONFIG_KEY(INPUT_LAYER_PRECISION);
 __DECLARE_CONFIG_KEY(FORMAT);
 __DECLARE_CONFIG_KEY(DEVICE);
-__DECLARE_CONFIG_KEY(MODEL); // Path to model
+__DECLARE_CONFIG_KEY(MODEL);           // Path to model
+__DECLARE_CONFIG_KEY(MODEL_CACHE_DIR); // directory of compiled model blobs
 __DECLARE_CONFIG_KEY(CUSTOM_PREPROC_LIB);
 __DECLARE_CONFIG_KEY(OV_EXTENSION_LIB);
 __DECLARE_CONFIG_KEY(NIREQ);
@@ -174,6 +207,8 @@ __DECLARE_CONFIG_KEY(PRE_PROCESSOR_TYPE);
 __DECLARE_CONFIG_KEY(IMAGE_FORMAT);
 __DECLARE_CONFIG_KEY(MODEL_FORMAT);
 __DECLARE_CONFIG_KEY(BATCH_SIZE);
+__DECLARE_CONFIG_KEY(MAX_BATCH_LATENCY);    // deadline (us) for dispatching partially filled batches
+__DECLARE_CONFIG_KEY(PARTIAL_BATCH_POLICY); // how partially filled batches are dispatched: padded or dynamic
 __DECLARE_CONFIG_KEY(RESHAPE);
 __DECLARE_CONFIG_KEY(RESHAPE_STATIC);
 __DECLARE_CONFIG_KEY(RESHAPE_WIDTH);
@@ -183,6 +218,7 @@ __DECLARE_CONFIG_KEY(CAPS_FEATURE);
 __DECLARE_CONFIG_KEY(VAAPI_THREAD_POOL_SIZE);
 __DECLARE_CONFIG_KEY(VAAPI_FAST_SCALE_LOAD_FACTOR);
 __DECLARE_CONFIG_KEY(D3D11_THREAD_POOL_SIZE);
+__DECLARE_CONFIG_KEY(CPU_THREAD_POOL_SIZE); // threads pre-processing regions of a frame with software pre-processors
 // 'mean' parameter for OpenVINO™ (gets subtracted from input values prior to division)
 // 'scale' parameter for OpenVINO™ (divides pixel values)
 __DECLARE_CONFIG_KEY(PIXEL_VALUE_MEAN);
@@ -18,7 +18,8 @@ enum class ImagePreprocessorType : int {
     VAAPI_SYSTEM,
     VAAPI_SURFACE_SHARING,
     D3D11,
-    D3D11_SURFACE_SHARING
+    D3D11_SURFACE_SHARING,
+    FUSED_CPU
 };
 class ImagePreprocessor {
   public:
@@ -39,4 +40,5 @@ class ImagePreprocessor {
 Image ApplyCrop(const Image &src);
 
 ImagePreprocessor *CreatePreProcOpenCV(const std::string custom_preproc_lib);
+ImagePreprocessor *CreatePreProcFusedCPU(const std::string custom_preproc_lib);
 } // namespace InferenceBackend
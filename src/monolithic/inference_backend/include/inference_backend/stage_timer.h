@@ -0,0 +1,154 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "thread_shards.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define STAGE_TIMER_RDTSC
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define STAGE_TIMER_RDTSC
+#endif
+
+namespace InferenceBackend {
+
+// Stages of the inference path in order of frame processing
+enum class Stage : uint8_t {
+    MAP,      // mapping of input buffer and preparation of regions for submission
+    PREPROC,  // image pre-processing and input pre-processors
+    INFER,    // inference request from start to completion
+    POSTPROC, // conversion of output blobs and restoring of coordinates
+    ATTACH,   // attaching of conversion results to frames
+    PUSH      // pushing of completed frames downstream
+};
+constexpr size_t STAGE_COUNT = 6;
+
+const char *StageName(Stage stage);
+
+/**
+ * Measures wall time of inference stages of one model instance with low overhead, so it can be left enabled in
+ * production. Timestamps are read with rdtsc on x86 (invariant TSC is assumed) and with steady clock elsewhere.
+ * Each recording thread gets own shard of per-stage counters and optionally a ring buffer of recent events for
+ * Chrome trace export, no lock is taken on recording after the first event of a thread.
+ */
+class StageTimer {
+  public:
+    using Ptr = std::shared_ptr<StageTimer>;
+
+    static constexpr size_t TRACE_EVENTS_PER_THREAD = 1 << 16;
+
+    struct StageSummary {
+        uint64_t count = 0;
+        double total_ms = 0;
+        double max_ms = 0;
+    };
+    struct Summary {
+        double interval_ms = 0;
+        std::array<StageSummary, STAGE_COUNT> stages;
+    };
+
+    /**
+     * @param name of the model instance used in reports
+     * @param report_interval between summaries logged by ReportIfDue
+     * @param keep_trace enables ring buffers of events for WriteChromeTrace
+     */
+    StageTimer(std::string name, std::chrono::milliseconds report_interval, bool keep_trace);
+    StageTimer(const StageTimer &) = delete;
+    StageTimer &operator=(const StageTimer &) = delete;
+
+    static uint64_t Ticks() {
+#ifdef STAGE_TIMER_RDTSC
+        return __rdtsc();
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+#endif
+    }
+
+    void Record(Stage stage, uint64_t begin_ticks, uint64_t end_ticks);
+
+    // Summary of stages recorded by all threads since previous call
+    Summary Collect();
+
+    // Logs summary of stages recorded since previous report at INFO level, nothing if no stage was recorded
+    void Report();
+    // Reports once report interval elapsed, cheap to call from the hot path
+    void ReportIfDue();
+
+    /**
+     * Writes recent events of all threads in Chrome trace format (chrome://tracing, Perfetto). Events may be lost if
+     * recording threads are still running, call it once processing is finished.
+     */
+    void WriteChromeTrace(const std::string &path);
+
+    const std::string &GetName() const {
+        return name;
+    }
+
+  private:
+    struct Event {
+        uint64_t begin;
+        uint64_t end;
+        Stage stage;
+    };
+    struct alignas(64) Shard {
+        std::array<std::atomic<uint64_t>, STAGE_COUNT> count{};
+        std::array<std::atomic<uint64_t>, STAGE_COUNT> ticks{};
+        std::array<std::atomic<uint64_t>, STAGE_COUNT> max_ticks{};
+        std::unique_ptr<Event[]> events;
+        std::atomic<uint64_t> events_written{0};
+    };
+
+    Shard &LocalShard();
+    double TicksPerMs();
+
+    const std::string name;
+    const std::chrono::steady_clock::duration report_interval;
+    const bool keep_trace;
+
+    // reference points to convert ticks to time
+    const uint64_t start_ticks;
+    const std::chrono::steady_clock::time_point start_time;
+
+    std::atomic<int64_t> next_report; // steady clock time in ns
+
+    std::mutex mutex; // guards last_collect
+    std::chrono::steady_clock::time_point last_collect;
+
+    ThreadShards<Shard> shards;
+};
+
+// Records time of the enclosing scope as stage, does nothing if timer is null
+class StageScope {
+  public:
+    StageScope(StageTimer *timer, Stage stage) : timer(timer), stage(stage), begin(timer ? StageTimer::Ticks() : 0) {
+    }
+    ~StageScope() {
+        if (timer)
+            timer->Record(stage, begin, StageTimer::Ticks());
+    }
+    StageScope(const StageScope &) = delete;
+    StageScope &operator=(const StageScope &) = delete;
+
+  private:
+    StageTimer *const timer;
+    const Stage stage;
+    const uint64_t begin;
+};
+
+} // namespace InferenceBackend
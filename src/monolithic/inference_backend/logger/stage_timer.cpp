@@ -0,0 +1,182 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "inference_backend/stage_timer.h"
+#include "inference_backend/logger.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace InferenceBackend {
+
+namespace {
+
+int64_t SteadyNs(std::chrono::steady_clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+
+std::string EscapeJson(const std::string &str) {
+    std::string escaped;
+    for (char c : str) {
+        if (c == '"' || c == '\\')
+            escaped += '\\';
+        if (static_cast<unsigned char>(c) >= 0x20)
+            escaped += c;
+    }
+    return escaped;
+}
+
+} // namespace
+
+const char *StageName(Stage stage) {
+    switch (stage) {
+    case Stage::MAP:
+        return "map";
+    case Stage::PREPROC:
+        return "preproc";
+    case Stage::INFER:
+        return "infer";
+    case Stage::POSTPROC:
+        return "postproc";
+    case Stage::ATTACH:
+        return "attach";
+    case Stage::PUSH:
+        return "push";
+    }
+    return "unknown";
+}
+
+StageTimer::StageTimer(std::string name, std::chrono::milliseconds report_interval, bool keep_trace)
+    : name(std::move(name)), report_interval(report_interval), keep_trace(keep_trace), start_ticks(Ticks()),
+      start_time(std::chrono::steady_clock::now()), next_report(SteadyNs(start_time + report_interval)),
+      last_collect(start_time) {
+}
+
+StageTimer::Shard &StageTimer::LocalShard() {
+    return shards.local([this](Shard &shard) {
+        if (keep_trace)
+            shard.events = std::make_unique<Event[]>(TRACE_EVENTS_PER_THREAD);
+    });
+}
+
+void StageTimer::Record(Stage stage, uint64_t begin_ticks, uint64_t end_ticks) {
+    const uint64_t duration = end_ticks > begin_ticks ? end_ticks - begin_ticks : 0;
+    const size_t index = static_cast<size_t>(stage);
+    Shard &shard = LocalShard();
+    // Only the owning thread writes to the shard, Collect() drains it with exchange
+    shard.count[index].fetch_add(1, std::memory_order_relaxed);
+    shard.ticks[index].fetch_add(duration, std::memory_order_relaxed);
+    uint64_t max = shard.max_ticks[index].load(std::memory_order_relaxed);
+    while (duration > max && !shard.max_ticks[index].compare_exchange_weak(max, duration, std::memory_order_relaxed)) {
+    }
+
+    if (shard.events) {
+        const uint64_t written = shard.events_written.load(std::memory_order_relaxed);
+        shard.events[written % TRACE_EVENTS_PER_THREAD] = {begin_ticks, end_ticks, stage};
+        shard.events_written.store(written + 1, std::memory_order_release);
+    }
+}
+
+double StageTimer::TicksPerMs() {
+#ifdef STAGE_TIMER_RDTSC
+    // Calibrated against steady clock over the whole lifetime of the timer, so precision improves with time
+    const uint64_t ticks = Ticks();
+    const int64_t ns = SteadyNs(std::chrono::steady_clock::now()) - SteadyNs(start_time);
+    if (ns <= 0 || ticks <= start_ticks)
+        return 1e6;
+    return static_cast<double>(ticks - start_ticks) * 1e6 / ns;
+#else
+    return 1e6;
+#endif
+}
+
+StageTimer::Summary StageTimer::Collect() {
+    Summary summary;
+    std::lock_guard<std::mutex> guard(mutex);
+    const double ticks_per_ms = TicksPerMs();
+    shards.for_each([&](Shard &shard) {
+        for (size_t i = 0; i < STAGE_COUNT; i++) {
+            auto &stage = summary.stages[i];
+            stage.count += shard.count[i].exchange(0, std::memory_order_relaxed);
+            stage.total_ms += shard.ticks[i].exchange(0, std::memory_order_relaxed) / ticks_per_ms;
+            stage.max_ms =
+                std::max(stage.max_ms, shard.max_ticks[i].exchange(0, std::memory_order_relaxed) / ticks_per_ms);
+        }
+    });
+    const auto now = std::chrono::steady_clock::now();
+    summary.interval_ms = std::chrono::duration<double, std::milli>(now - last_collect).count();
+    last_collect = now;
+    return summary;
+}
+
+void StageTimer::ReportIfDue() {
+    const int64_t now = SteadyNs(std::chrono::steady_clock::now());
+    int64_t due = next_report.load(std::memory_order_relaxed);
+    if (now < due)
+        return;
+    // Only one of the threads calling concurrently reports
+    const int64_t next = now + std::chrono::duration_cast<std::chrono::nanoseconds>(report_interval).count();
+    if (next_report.compare_exchange_strong(due, next, std::memory_order_relaxed))
+        Report();
+}
+
+void StageTimer::Report() {
+    const Summary summary = Collect();
+    std::ostringstream report;
+    report.precision(3);
+    report << std::fixed;
+    for (size_t i = 0; i < STAGE_COUNT; i++) {
+        const auto &stage = summary.stages[i];
+        if (!stage.count)
+            continue;
+        // Busy share above 100% means the stage runs in several threads or requests in parallel
+        report << " " << StageName(static_cast<Stage>(i)) << ": n=" << stage.count
+               << " avg=" << stage.total_ms / stage.count << "ms max=" << stage.max_ms
+               << "ms busy=" << (summary.interval_ms > 0 ? 100.0 * stage.total_ms / summary.interval_ms : 0.0)
+               << "%;";
+    }
+    if (report.tellp() <= 0)
+        return;
+    GVA_INFO("Stage timing of %s over %.1f ms:%s", name.c_str(), summary.interval_ms, report.str().c_str());
+}
+
+void StageTimer::WriteChromeTrace(const std::string &path) {
+    std::ofstream file(path);
+    if (!file)
+        throw std::runtime_error("Failed to open stage trace file '" + path + "'");
+
+    const double ticks_per_us = TicksPerMs() / 1000.0;
+    auto to_us = [&](uint64_t ticks) { return ticks > start_ticks ? (ticks - start_ticks) / ticks_per_us : 0.0; };
+
+    file.precision(3);
+    file << std::fixed;
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"" << EscapeJson(name) << "\"}}";
+    size_t next_tid = 0;
+    shards.for_each([&](const Shard &shard) {
+        const size_t tid = next_tid++;
+        file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << tid
+             << ",\"args\":{\"name\":\"thread " << tid << "\"}}";
+        if (!shard.events)
+            return;
+        const uint64_t written = shard.events_written.load(std::memory_order_acquire);
+        const uint64_t first = written > TRACE_EVENTS_PER_THREAD ? written - TRACE_EVENTS_PER_THREAD : 0;
+        for (uint64_t i = first; i < written; i++) {
+            const Event &event = shard.events[i % TRACE_EVENTS_PER_THREAD];
+            const double begin_us = to_us(event.begin);
+            const double end_us = std::max(begin_us, to_us(event.end));
+            file << ",\n{\"name\":\"" << StageName(event.stage) << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << tid
+                 << ",\"ts\":" << begin_us << ",\"dur\":" << end_us - begin_us << "}";
+        }
+    });
+    file << "\n]}\n";
+    if (!file)
+        throw std::runtime_error("Failed to write stage trace file '" + path + "'");
+}
+
+} // namespace InferenceBackend
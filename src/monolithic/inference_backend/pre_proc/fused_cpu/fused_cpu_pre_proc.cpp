@@ -0,0 +1,487 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+#include "fused_cpu_pre_proc.h"
+#include "inference_backend/logger.h"
+#include "safe_arithmetic.hpp"
+
+#include <opencv2/core.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using namespace InferenceBackend;
+
+// Row kernels are compiled for several instruction sets, the best one is selected when the library is loaded
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(_WIN32)
+#define FUSED_CPU_MULTIVERSION __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define FUSED_CPU_MULTIVERSION
+#endif
+
+namespace {
+
+// Same fixed-point precision as cv::resize uses for 8-bit images
+constexpr int COEF_BITS = 11;
+constexpr int COEF_SCALE = 1 << COEF_BITS;
+constexpr int VERTICAL_SHIFT = 2 * COEF_BITS;
+
+// BT.601 limited range YUV to RGB coefficients in Q20, the same as cv::cvtColor uses
+constexpr int YUV_SHIFT = 20;
+constexpr int YUV_CY = 1220542;
+constexpr int YUV_CUB = 2116026;
+constexpr int YUV_CUG = -409993;
+constexpr int YUV_CVG = -852492;
+constexpr int YUV_CVR = 1673527;
+
+constexpr int ROWS_PER_STRIPE = 16;
+
+enum class SourceLayout { PACKED, NV12, I420 };
+
+struct Source {
+    SourceLayout layout = SourceLayout::PACKED;
+    const uint8_t *planes[3] = {};
+    uint32_t stride[3] = {};
+    int pixel_size = 1; // bytes per pixel of packed formats
+    int channels = 3;   // channels of the image OpenCV_VPP would build before color conversion
+    int width = 0;
+    int height = 0;
+};
+
+// Source sample positions and weights along one axis, following cv::resize INTER_LINEAR mapping
+struct AxisMap {
+    std::vector<int32_t> pos0;
+    std::vector<int32_t> pos1;
+    std::vector<int32_t> weight0;
+    std::vector<int32_t> weight1;
+};
+
+struct ColumnMap : AxisMap {
+    // positions of chroma samples, used for NV12 and I420 sources
+    std::vector<int32_t> chroma0;
+    std::vector<int32_t> chroma1;
+};
+
+struct Plan {
+    int dst_width = 0;
+    int dst_height = 0;
+    int width = 0;   // size of resized image inside destination
+    int height = 0;  //
+    int shift_x = 0; // position of resized image inside destination
+    int shift_y = 0; //
+    bool swap_rb = false;
+    std::array<uint8_t, 3> fill = {0, 0, 0}; // per destination plane
+};
+
+bool GetSource(const Image &src, Source &source) {
+    switch (src.format) {
+    case FOURCC_BGR:
+        source.layout = SourceLayout::PACKED;
+        source.pixel_size = source.channels = 3;
+        break;
+    case FOURCC_BGRX:
+    case FOURCC_BGRA:
+        source.layout = SourceLayout::PACKED;
+        source.pixel_size = source.channels = 4;
+        break;
+    case FOURCC_NV12:
+        source.layout = SourceLayout::NV12;
+        break;
+    case FOURCC_I420:
+        source.layout = SourceLayout::I420;
+        break;
+    default:
+        return false;
+    }
+
+    const int planes_count = source.layout == SourceLayout::I420 ? 3 : (source.layout == SourceLayout::NV12 ? 2 : 1);
+    for (int i = 0; i < planes_count; i++) {
+        source.planes[i] = src.planes[i];
+        source.stride[i] = src.stride[i];
+        if (!source.planes[i])
+            return false;
+    }
+
+    if (src.width > static_cast<uint32_t>(std::numeric_limits<int>::max()) ||
+        src.height > static_cast<uint32_t>(std::numeric_limits<int>::max()))
+        return false;
+    source.width = static_cast<int>(src.width);
+    source.height = static_cast<int>(src.height);
+    if (source.layout != SourceLayout::PACKED) {
+        // as in OpenCV_VPP, odd last row and column of subsampled formats are dropped
+        source.width &= ~1;
+        source.height &= ~1;
+    }
+    return source.width > 0 && source.height > 0;
+}
+
+AxisMap BuildAxisMap(int src_size, int dst_size) {
+    AxisMap map;
+    map.pos0.resize(dst_size);
+    map.pos1.resize(dst_size);
+    map.weight0.resize(dst_size);
+    map.weight1.resize(dst_size);
+
+    const double scale = static_cast<double>(src_size) / dst_size;
+    for (int d = 0; d < dst_size; d++) {
+        float f = static_cast<float>((d + 0.5) * scale - 0.5);
+        int s = static_cast<int>(std::floor(f));
+        f -= s;
+        if (s < 0) {
+            s = 0;
+            f = 0;
+        }
+        if (s >= src_size - 1) {
+            s = src_size - 1;
+            f = 0;
+        }
+        map.pos0[d] = s;
+        map.pos1[d] = std::min(s + 1, src_size - 1);
+        map.weight0[d] = static_cast<int32_t>(std::lround((1.f - f) * COEF_SCALE));
+        map.weight1[d] = static_cast<int32_t>(std::lround(f * COEF_SCALE));
+    }
+    return map;
+}
+
+ColumnMap BuildColumnMap(const Source &source, int dst_width) {
+    ColumnMap map;
+    static_cast<AxisMap &>(map) = BuildAxisMap(source.width, dst_width);
+
+    switch (source.layout) {
+    case SourceLayout::PACKED:
+        // byte offsets of pixels
+        for (int d = 0; d < dst_width; d++) {
+            map.pos0[d] *= source.pixel_size;
+            map.pos1[d] *= source.pixel_size;
+        }
+        break;
+    case SourceLayout::NV12:
+    case SourceLayout::I420: {
+        // chroma is shared by two neighbor pixels, as with cv::cvtColor before resize
+        const int32_t chroma_step = source.layout == SourceLayout::NV12 ? 2 : 1;
+        map.chroma0.resize(dst_width);
+        map.chroma1.resize(dst_width);
+        for (int d = 0; d < dst_width; d++) {
+            map.chroma0[d] = map.pos0[d] / 2 * chroma_step;
+            map.chroma1[d] = map.pos1[d] / 2 * chroma_step;
+        }
+        break;
+    }
+    }
+    return map;
+}
+
+inline uint8_t SaturateU8(int32_t value) {
+    return static_cast<uint8_t>(std::min(std::max(value, 0), 255));
+}
+
+FUSED_CPU_MULTIVERSION
+void HorizontalInterpolate(const uint8_t *row, const int32_t *pos0, const int32_t *pos1, const int32_t *weight0,
+                           const int32_t *weight1, int count, int32_t *dst) {
+    for (int i = 0; i < count; i++)
+        dst[i] = row[pos0[i]] * weight0[i] + row[pos1[i]] * weight1[i];
+}
+
+FUSED_CPU_MULTIVERSION
+void VerticalInterpolate(const int32_t *row0, const int32_t *row1, int32_t weight0, int32_t weight1, int count,
+                         uint8_t *dst) {
+    constexpr int32_t round = 1 << (VERTICAL_SHIFT - 1);
+    for (int i = 0; i < count; i++)
+        dst[i] = SaturateU8((row0[i] * weight0 + row1[i] * weight1 + round) >> VERTICAL_SHIFT);
+}
+
+inline void YuvToBgr(int32_t y, int32_t u, int32_t v, int32_t &b, int32_t &g, int32_t &r) {
+    constexpr int32_t round = 1 << (YUV_SHIFT - 1);
+    const int32_t luma = std::max(0, y - 16) * YUV_CY;
+    const int32_t cb = u - 128;
+    const int32_t cr = v - 128;
+    b = SaturateU8((luma + YUV_CUB * cb + round) >> YUV_SHIFT);
+    g = SaturateU8((luma + YUV_CUG * cb + YUV_CVG * cr + round) >> YUV_SHIFT);
+    r = SaturateU8((luma + YUV_CVR * cr + round) >> YUV_SHIFT);
+}
+
+// Converts both samples to BGR before weighting, so saturation matches cv::cvtColor followed by cv::resize
+FUSED_CPU_MULTIVERSION
+void HorizontalInterpolateYuv(const uint8_t *luma, const uint8_t *cb, const uint8_t *cr, const ColumnMap &columns,
+                              int count, int32_t *const dst[3]) {
+    for (int i = 0; i < count; i++) {
+        int32_t b0, g0, r0, b1, g1, r1;
+        YuvToBgr(luma[columns.pos0[i]], cb[columns.chroma0[i]], cr[columns.chroma0[i]], b0, g0, r0);
+        YuvToBgr(luma[columns.pos1[i]], cb[columns.chroma1[i]], cr[columns.chroma1[i]], b1, g1, r1);
+        dst[0][i] = b0 * columns.weight0[i] + b1 * columns.weight1[i];
+        dst[1][i] = g0 * columns.weight0[i] + g1 * columns.weight1[i];
+        dst[2][i] = r0 * columns.weight0[i] + r1 * columns.weight1[i];
+    }
+}
+
+FUSED_CPU_MULTIVERSION
+void ToFloat(const uint8_t *src, int count, float *dst) {
+    for (int i = 0; i < count; i++)
+        dst[i] = src[i];
+}
+
+// Interpolates horizontally B,G,R channels of source row 'y'
+void InterpolateSourceRow(const Source &source, const ColumnMap &columns, int y, int32_t *const dst[3]) {
+    const int count = static_cast<int>(columns.pos0.size());
+    const int32_t *w0 = columns.weight0.data();
+    const int32_t *w1 = columns.weight1.data();
+
+    switch (source.layout) {
+    case SourceLayout::PACKED: {
+        const uint8_t *row = source.planes[0] + static_cast<size_t>(y) * source.stride[0];
+        for (int c = 0; c < 3; c++)
+            HorizontalInterpolate(row + c, columns.pos0.data(), columns.pos1.data(), w0, w1, count, dst[c]);
+        break;
+    }
+    case SourceLayout::NV12: {
+        const uint8_t *luma = source.planes[0] + static_cast<size_t>(y) * source.stride[0];
+        const uint8_t *chroma = source.planes[1] + static_cast<size_t>(y / 2) * source.stride[1];
+        HorizontalInterpolateYuv(luma, chroma, chroma + 1, columns, count, dst);
+        break;
+    }
+    case SourceLayout::I420: {
+        const uint8_t *luma = source.planes[0] + static_cast<size_t>(y) * source.stride[0];
+        const uint8_t *u = source.planes[1] + static_cast<size_t>(y / 2) * source.stride[1];
+        const uint8_t *v = source.planes[2] + static_cast<size_t>(y / 2) * source.stride[2];
+        HorizontalInterpolateYuv(luma, u, v, columns, count, dst);
+        break;
+    }
+    }
+}
+
+template <typename T>
+void FillSpan(const Image &dst, int plane, size_t offset, size_t count, uint8_t value) {
+    T *begin = reinterpret_cast<T *>(dst.planes[plane]) + offset;
+    std::fill(begin, begin + count, static_cast<T>(value));
+}
+
+template <typename T>
+void StoreSpan(const Image &dst, int plane, size_t offset, const uint8_t *values, int count);
+
+template <>
+void StoreSpan<uint8_t>(const Image &dst, int plane, size_t offset, const uint8_t *values, int count) {
+    std::memcpy(dst.planes[plane] + offset, values, count);
+}
+
+template <>
+void StoreSpan<float>(const Image &dst, int plane, size_t offset, const uint8_t *values, int count) {
+    ToFloat(values, count, reinterpret_cast<float *>(dst.planes[plane]) + offset);
+}
+
+// Produces destination rows [range.start, range.end), planes are tightly packed as in MatToMultiPlaneImage
+template <typename T>
+void ConvertRows(const Source &source, const Plan &plan, const ColumnMap &columns, const AxisMap &rows,
+                 const Image &dst, const cv::Range &range) {
+    const int width = plan.width;
+    const size_t dst_width = static_cast<size_t>(plan.dst_width);
+    const size_t right_border = dst_width - plan.shift_x - width;
+
+    // Two horizontally interpolated source rows needed by the current destination row
+    std::vector<int32_t> cache(6 * static_cast<size_t>(width));
+    int32_t *cached_rows[2][3];
+    for (int k = 0; k < 2; k++)
+        for (int c = 0; c < 3; c++)
+            cached_rows[k][c] = cache.data() + (k * 3 + c) * static_cast<size_t>(width);
+    int cached_y[2] = {-1, -1};
+
+    std::vector<uint8_t> pixels(3 * static_cast<size_t>(width));
+    uint8_t *blended[3];
+    for (int c = 0; c < 3; c++)
+        blended[c] = pixels.data() + c * static_cast<size_t>(width);
+
+    for (int dy = range.start; dy < range.end; dy++) {
+        const size_t row_offset = static_cast<size_t>(dy) * dst_width;
+        const int ry = dy - plan.shift_y;
+        if (ry < 0 || ry >= plan.height) {
+            for (int plane = 0; plane < 3; plane++)
+                FillSpan<T>(dst, plane, row_offset, dst_width, plan.fill[plane]);
+            continue;
+        }
+        for (int plane = 0; plane < 3; plane++) {
+            FillSpan<T>(dst, plane, row_offset, plan.shift_x, plan.fill[plane]);
+            FillSpan<T>(dst, plane, row_offset + plan.shift_x + width, right_border, plan.fill[plane]);
+        }
+
+        const int y0 = rows.pos0[ry];
+        const int y1 = rows.pos1[ry];
+        if (cached_y[0] != y0) {
+            if (cached_y[1] == y0) {
+                std::swap(cached_rows[0], cached_rows[1]);
+                std::swap(cached_y[0], cached_y[1]);
+            } else {
+                InterpolateSourceRow(source, columns, y0, cached_rows[0]);
+                cached_y[0] = y0;
+            }
+        }
+        if (cached_y[1] != y1) {
+            InterpolateSourceRow(source, columns, y1, cached_rows[1]);
+            cached_y[1] = y1;
+        }
+
+        for (int c = 0; c < 3; c++)
+            VerticalInterpolate(cached_rows[0][c], cached_rows[1][c], rows.weight0[ry], rows.weight1[ry], width,
+                                blended[c]);
+        for (int c = 0; c < 3; c++) {
+            const int plane = plan.swap_rb ? 2 - c : c;
+            StoreSpan<T>(dst, plane, row_offset + plan.shift_x, blended[c], width);
+        }
+    }
+}
+
+} // namespace
+
+ImagePreprocessor *InferenceBackend::CreatePreProcFusedCPU(const std::string custom_preproc_lib) {
+    return new FusedCPU_VPP(custom_preproc_lib);
+}
+
+FusedCPU_VPP::FusedCPU_VPP(const std::string &custom_preproc_lib)
+    : fallback(CreatePreProcOpenCV(custom_preproc_lib)), use_custom_lib(!custom_preproc_lib.empty()) {
+    if (use_custom_lib)
+        GVA_INFO("Custom pre-processing library is set, fused CPU pre-processing is performed by OpenCV");
+}
+
+FusedCPU_VPP::~FusedCPU_VPP() = default;
+
+bool FusedCPU_VPP::FusedConvert(const Image &raw_src, Image &dst, const InputImageLayerDesc::Ptr &pre_proc_info,
+                                const ImageTransformationParams::Ptr &image_transform_info) {
+    if (dst.format != FOURCC_RGBP && dst.format != FOURCC_RGBP_F32)
+        return false;
+    if (dst.width == 0 || dst.height == 0 || dst.width > static_cast<uint32_t>(std::numeric_limits<int>::max()) ||
+        dst.height > static_cast<uint32_t>(std::numeric_limits<int>::max()))
+        return false;
+
+    Source source;
+    if (!GetSource(raw_src, source))
+        return false;
+    Image src = ApplyCrop(raw_src);
+    if (!GetSource(src, source))
+        return false;
+
+    Plan plan;
+    plan.dst_width = static_cast<int>(dst.width);
+    plan.dst_height = static_cast<int>(dst.height);
+
+    bool custom_convert = needCustomImageConvert(pre_proc_info);
+    bool resized = false;
+    double resize_scale_x = 1;
+    double resize_scale_y = 1;
+
+    if (!custom_convert) {
+        // plain resize to destination size
+        plan.width = plan.dst_width;
+        plan.height = plan.dst_height;
+    } else {
+        if (pre_proc_info->doNeedCrop())
+            return false;
+
+        int channels = source.layout == SourceLayout::PACKED ? source.channels : 3;
+        switch (pre_proc_info->getTargetColorSpace()) {
+        case InputImageLayerDesc::ColorSpace::NO:
+            break;
+        case InputImageLayerDesc::ColorSpace::BGR:
+            channels = 3;
+            break;
+        case InputImageLayerDesc::ColorSpace::RGB:
+            channels = 3;
+            plan.swap_rb = true;
+            break;
+        default:
+            return false;
+        }
+
+        size_t padding_x = 0;
+        size_t padding_y = 0;
+        std::vector<double> fill_value;
+        if (pre_proc_info->doNeedPadding()) {
+            const auto &padding = pre_proc_info->getPadding();
+            padding_x = padding.stride_x;
+            padding_y = padding.stride_y;
+            fill_value = padding.fill_value;
+        }
+        if (padding_x > dst.width / 2 || padding_y > dst.height / 2)
+            return false;
+        const int inner_width = plan.dst_width - static_cast<int>(padding_x * 2);
+        const int inner_height = plan.dst_height - static_cast<int>(padding_y * 2);
+        if (inner_width <= 0 || inner_height <= 0)
+            return false;
+
+        plan.width = source.width;
+        plan.height = source.height;
+        if (pre_proc_info->doNeedResize() && (source.width != inner_width || source.height != inner_height)) {
+            resize_scale_x = safe_convert<double>(inner_width) / source.width;
+            resize_scale_y = safe_convert<double>(inner_height) / source.height;
+            if (pre_proc_info->getResizeType() == InputImageLayerDesc::Resize::ASPECT_RATIO ||
+                pre_proc_info->getResizeType() == InputImageLayerDesc::Resize::ASPECT_RATIO_PAD) {
+                resize_scale_x = resize_scale_y = std::min(resize_scale_x, resize_scale_y);
+            }
+            plan.width = static_cast<int>(source.width * resize_scale_x);
+            plan.height = static_cast<int>(source.height * resize_scale_y);
+            resized = true;
+        }
+
+        if (!fill_value.empty()) {
+            if (fill_value.size() < static_cast<size_t>(channels))
+                return false;
+            for (size_t plane = 0; plane < plan.fill.size(); plane++)
+                plan.fill[plane] = cv::saturate_cast<uint8_t>(fill_value[plane]);
+        }
+
+        if (pre_proc_info->getResizeType() != InputImageLayerDesc::Resize::ASPECT_RATIO_PAD) {
+            plan.shift_x = (plan.dst_width - plan.width) / 2;
+            plan.shift_y = (plan.dst_height - plan.height) / 2;
+        }
+    }
+
+    if (plan.width <= 0 || plan.height <= 0 || plan.width > plan.dst_width || plan.height > plan.dst_height)
+        return false;
+
+    ITT_TASK("FusedCPU_VPP::FusedConvert");
+    const ColumnMap columns = BuildColumnMap(source, plan.width);
+    const AxisMap rows = BuildAxisMap(source.height, plan.height);
+
+    const double stripes = std::max(1, std::min(plan.dst_height / ROWS_PER_STRIPE, cv::getNumThreads() * 2));
+    if (dst.format == FOURCC_RGBP_F32) {
+        cv::parallel_for_(
+            cv::Range(0, plan.dst_height),
+            [&](const cv::Range &range) { ConvertRows<float>(source, plan, columns, rows, dst, range); }, stripes);
+    } else {
+        cv::parallel_for_(
+            cv::Range(0, plan.dst_height),
+            [&](const cv::Range &range) { ConvertRows<uint8_t>(source, plan, columns, rows, dst, range); }, stripes);
+    }
+
+    if (custom_convert && image_transform_info) {
+        if (resized)
+            image_transform_info->ResizeHasDone(resize_scale_x, resize_scale_y);
+        image_transform_info->PaddingHasDone(safe_convert<size_t>(plan.shift_x), safe_convert<size_t>(plan.shift_y));
+    }
+    return true;
+}
+
+void FusedCPU_VPP::Convert(const Image &src, Image &dst, const InputImageLayerDesc::Ptr &pre_proc_info,
+                           const ImageTransformationParams::Ptr &image_transform_info, bool make_planar,
+                           bool allocate_destination) {
+    ITT_TASK("FusedCPU_VPP");
+
+    if (!use_custom_lib && make_planar && !allocate_destination && needPreProcessing(src, dst)) {
+        try {
+            if (FusedConvert(src, dst, pre_proc_info, image_transform_info))
+                return;
+        } catch (const std::exception &e) {
+            std::throw_with_nested(std::runtime_error("Failed during fused CPU image pre-processing"));
+        }
+        if (!fallback_reported.exchange(true))
+            GVA_INFO("Requested image transformation is not supported by fused CPU pre-processing, using OpenCV");
+    }
+
+    fallback->Convert(src, dst, pre_proc_info, image_transform_info, make_planar, allocate_destination);
+}
+
+void FusedCPU_VPP::ReleaseImage(const Image &) {
+}
@@ -0,0 +1,48 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+#ifndef FUSED_CPU_PRE_PROC_H
+#define FUSED_CPU_PRE_PROC_H
+
+#include "inference_backend/pre_proc.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+namespace InferenceBackend {
+
+/**
+ * Software pre-processor writing model input in a single pass over destination rows.
+ *
+ * ROI crop, NV12/I420/BGR/BGRx color conversion, bilinear resize, letterbox padding and conversion to tensor
+ * precision are fused, so no intermediate full-frame BGR, resized or padded images are created. Transformations
+ * not covered by the fused path (crop types, grayscale, custom pre-processing library) are delegated to
+ * OpenCV_VPP, which is also the reference the fused path is checked against.
+ */
+class FusedCPU_VPP : public ImagePreprocessor {
+  public:
+    FusedCPU_VPP(const std::string &custom_preproc_lib = "");
+    ~FusedCPU_VPP();
+
+    // PreProc interface
+    void Convert(const Image &src, Image &dst, const InputImageLayerDesc::Ptr &pre_proc_info,
+                 const ImageTransformationParams::Ptr &image_transform_info, bool make_planar = true,
+                 bool allocate_destination = false);
+    void ReleaseImage(const Image &);
+
+  private:
+    std::unique_ptr<ImagePreprocessor> fallback; // OpenCV_VPP
+    bool use_custom_lib = false;
+    std::atomic_bool fallback_reported{false};
+
+    // Returns false if the conversion is not supported by the fused path
+    bool FusedConvert(const Image &src, Image &dst, const InputImageLayerDesc::Ptr &pre_proc_info,
+                      const ImageTransformationParams::Ptr &image_transform_info);
+};
+
+} // namespace InferenceBackend
+
+#endif // FUSED_CPU_PRE_PROC_H
@@ -10,6 +10,10 @@
 #include "dlstreamer/utils.h"
 #include <opencv2/video.hpp>
 
+#include "kalman_filter_bank.h"
+
+#include <vector>
+
 const float kMeasurementNoiseCoordinate = 0.001f;
 
 const float kMeasurementNoiseRectSize = 0.002f;
@@ -17,74 +21,68 @@ const float kMeasurementNoiseRectSize = 0.002f;
 namespace vas {
 
 /*
- * This class implements a kernel of a standard kalman filter using OpenCV.
+ * This class implements kernels of standard kalman filters of tracked objects' boxes without OpenCV.
  * It supplies simple and common APIs to be use by all components.
  *
+ * Filters of all objects are kept in one KalmanFilterBank, so they are predicted together in vectorized loops.
+ * Each object keeps index of its filter returned by Add().
+ *
  * The description of Kalman filter refers to the file here.
  * (~Sharepoint)/PVAPlatform/VAS/KalmanFilter.pptx
  */
-class KalmanFilterNoOpencv {
+class KalmanFilterNoOpencvBank {
   public:
-    /** @brief Create & initialize KalmanFilterNoOpencv
-     *      This function initializes Kalman filter with a spectific value of the ratio for measurement noise covariance
-     * matrix. If you consider the detection method is enough reliable, it is recommended to use lower ratio value than
-     * the default value.
+    KalmanFilterNoOpencvBank() = default;
+
+    KalmanFilterNoOpencvBank(const KalmanFilterNoOpencvBank &) = delete;
+    KalmanFilterNoOpencvBank &operator=(const KalmanFilterNoOpencvBank &) = delete;
+
+    /** @brief Create & initialize Kalman filter of an object
      * @code
-     *      cv::Rect2f input_rect(50.f, 50.f, 100.f, 100.f);
-     *      cv::Rect2f predicted, corrected;
-     *      vas::KalmanFilter kalman_filter = new vas::KalmanFilter(input_rect);
-     *      predicted = kalman_filter->Predict();
-     *      corrected = kalman_filter->Correct(cv::Rect(52, 52, 105, 105));
-     *      delete kalman_filter;
+     *      vas::KalmanFilterNoOpencvBank kalman_filters;
+     *      int32_t filter = kalman_filters.Add(cv::Rect2f(50.f, 50.f, 100.f, 100.f));
+     *      cv::Rect2f predicted = kalman_filters.Predict(filter);
+     *      cv::Rect2f corrected = kalman_filters.Correct(filter, cv::Rect(52, 52, 105, 105));
+     *      kalman_filters.Remove(filter);
      * @endcode
      * @param
      *      initial_rect                        Initial rectangular coordinates
+     * @return index of the filter
+     */
+    int32_t Add(const cv::Rect2f &initial_rect);
+
+    /*
+     * This function restarts the filter from the initial rect.
      */
-    explicit KalmanFilterNoOpencv(const cv::Rect2f &initial_rect);
-    KalmanFilterNoOpencv() = delete;
+    void Reset(int32_t filter, const cv::Rect2f &initial_rect);
 
-    KalmanFilterNoOpencv(const KalmanFilterNoOpencv &) = delete;
-    KalmanFilterNoOpencv &operator=(const KalmanFilterNoOpencv &) = delete;
+    /*
+     * This function releases the filter, its index may be returned by next Add().
+     */
+    void Remove(int32_t filter);
+    void Clear();
 
-    /* @brief Destroy Kalman filter kernel
+    /*
+     * This function computes predicted states of all filters, result of each is returned by GetPredicted().
      */
-    ~KalmanFilterNoOpencv() = default;
+    void PredictAll(float delta_t = 0.033f);
 
     /*
-     * This function computes a predicted state.
-     * input 'delta_t' is not used.
+     * This function computes a predicted state of one filter.
      */
-    cv::Rect2f Predict(float delta_t = 0.033f);
+    cv::Rect2f Predict(int32_t filter, float delta_t = 0.033f);
+
+    cv::Rect2f GetPredicted(int32_t filter) const;
 
     /*
      * This function updates the predicted state from the measurement.
      */
-    cv::Rect2f Correct(const cv::Rect2f &detect_rect);
+    cv::Rect2f Correct(int32_t filter, const cv::Rect2f &detect_rect);
 
   private:
-    struct kalmanfilter1d32i {
-        int32_t X[2];
-        int32_t P[2][2];
-        int32_t Q[2][2];
-        int32_t R;
-
-        int32_t Pk[2][2]; // buffer to copy from Pk-1 to Pk
-        int32_t Xk[2];    // buffer to copy form Xk-1 to Xk
-    };
-
-    void kalmanfilter1d32i_init(kalmanfilter1d32i *kf, int32_t *z, int32_t var);
-    void kalmanfilter1d32i_predict_phase(kalmanfilter1d32i *kf, float dt);
-    void kalmanfilter1d32i_update_phase(kalmanfilter1d32i *kf, int32_t z, int32_t *x);
-    void kalmanfilter1d32i_filter(kalmanfilter1d32i *kf, int32_t *z, int32_t dt, int32_t *x);
-
-    kalmanfilter1d32i kfX;
-    kalmanfilter1d32i kfY;
-    kalmanfilter1d32i kfRX;
-    kalmanfilter1d32i kfRY;
-
-    float noise_ratio_coordinates_;
-    float noise_ratio_rect_size_;
-    float delta_t_;
+    // Centers and half sizes of boxes scaled by 2^KALMAN_FILTER_NSHIFT
+    KalmanFilterBank<8, 4> filters_;
+    std::vector<float> delta_t_;
 };
 
 }; // namespace vas
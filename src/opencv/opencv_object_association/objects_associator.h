@@ -9,6 +9,8 @@
 
 #include "tracklet.h"
 
+#include "linear_assignment.h"
+
 #include <opencv2/opencv.hpp>
 
 namespace vas {
@@ -37,6 +39,9 @@ class ObjectsAssociator {
     float kRgbHistDistScale_;
     float kNormCenterDistScale_;
     float kNormShapeDistScale_;
+
+    LinearAssignmentSolver assignment_solver_;
+    std::vector<float> tracklet_prices_;
 };
 
 }; // namespace ot
@@ -35,6 +35,7 @@ int32_t Tracker::RemoveObject(const int32_t id) {
 
     for (auto tracklet = tracklets_.begin(); tracklet != tracklets_.end(); ++tracklet) {
         if ((*tracklet)->id == id) {
+            kalman_filters_.Remove((*tracklet)->kalman_filter);
             tracklet = tracklets_.erase(tracklet);
             return 0;
         }
@@ -45,6 +46,7 @@ int32_t Tracker::RemoveObject(const int32_t id) {
 void Tracker::Reset(void) {
     frame_count_ = 0;
     tracklets_.clear();
+    kalman_filters_.Clear();
 }
 
 int32_t Tracker::GetFrameCount(void) const {
@@ -87,6 +89,7 @@ void Tracker::RemoveOutOfBoundTracklets(int32_t input_width, int32_t input_heigh
             is_filtered ? (*tracklet)->trajectory_filtered.back() : (*tracklet)->trajectory.back();
         if ((image_region & object_region).area() / object_region.area() <
             min_region_ratio_in_boundary_) { // only 10% is in image boundary
+            kalman_filters_.Remove((*tracklet)->kalman_filter);
             tracklet = tracklets_.erase(tracklet);
         } else {
             ++tracklet;
@@ -97,6 +100,7 @@ void Tracker::RemoveOutOfBoundTracklets(int32_t input_width, int32_t input_heigh
 void Tracker::RemoveDeadTracklets() {
     for (auto tracklet = tracklets_.begin(); tracklet != tracklets_.end();) {
         if ((*tracklet)->status == ST_DEAD) {
+            kalman_filters_.Remove((*tracklet)->kalman_filter);
             tracklet = tracklets_.erase(tracklet);
         } else {
             ++tracklet;
@@ -104,10 +108,23 @@ void Tracker::RemoveDeadTracklets() {
     }
 }
 
+void Tracker::RenewTrackletWithMotion(Tracklet *tracklet, const cv::Rect2f &bounding_box) {
+    float velo_x = bounding_box.x - tracklet->trajectory.back().x;
+    float velo_y = bounding_box.y - tracklet->trajectory.back().y;
+    cv::Rect rect_predict(bounding_box.x + velo_x / 3, bounding_box.y + velo_y / 3, bounding_box.width,
+                          bounding_box.height);
+
+    tracklet->RenewTrajectory(bounding_box);
+    kalman_filters_.Reset(tracklet->kalman_filter, bounding_box);
+    kalman_filters_.Predict(tracklet->kalman_filter);
+    kalman_filters_.Correct(tracklet->kalman_filter, rect_predict);
+}
+
 bool Tracker::RemoveOneLostTracklet() {
     for (auto tracklet = tracklets_.begin(); tracklet != tracklets_.end();) {
         if ((*tracklet)->status == ST_LOST) {
             // The first tracklet is the oldest
+            kalman_filters_.Remove((*tracklet)->kalman_filter);
             tracklet = tracklets_.erase(tracklet);
             return true;
         } else {
@@ -128,8 +145,9 @@ int32_t Tracker::TrackObjects(cv::Size frame_size, const std::vector<Detection>
 
     // KALMAN_PREDICTION
     // Predict tracklets state
+    kalman_filters_.PredictAll(delta_t);
     for (auto &tracklet : tracklets_) {
-        cv::Rect2f predicted_rect = tracklet->kalman_filter->Predict(delta_t);
+        cv::Rect2f predicted_rect = kalman_filters_.GetPredicted(tracklet->kalman_filter);
         tracklet->trajectory.push_back(predicted_rect);
         tracklet->trajectory_filtered.push_back(predicted_rect);
         tracklet->association_delta_t += delta_t;
@@ -186,7 +204,7 @@ int32_t Tracker::TrackObjects(cv::Size frame_size, const std::vector<Detection>
                     tracklet->age = 0;
                 } else {
                     tracklet->trajectory_filtered.back() =
-                        tracklet->kalman_filter->Correct(tracklet->trajectory.back());
+                        kalman_filters_.Correct(tracklet->kalman_filter, tracklet->trajectory.back());
                 }
             }
 
@@ -214,7 +232,7 @@ int32_t Tracker::TrackObjects(cv::Size frame_size, const std::vector<Detection>
                 if (tracklet->status == ST_NEW) {
                     tracklet->trajectory.back() = d_bounding_box;
                     tracklet->trajectory_filtered.back() =
-                        tracklet->kalman_filter->Correct(tracklet->trajectory.back());
+                        kalman_filters_.Correct(tracklet->kalman_filter, tracklet->trajectory.back());
                     tracklet->birth_count += 1;
                     if (tracklet->birth_count >= kMinBirthCount) {
                         tracklet->status = ST_TRACKED;
@@ -222,9 +240,9 @@ int32_t Tracker::TrackObjects(cv::Size frame_size, const std::vector<Detection>
                 } else if (tracklet->status == ST_TRACKED) {
                     tracklet->trajectory.back() = d_bounding_box;
                     tracklet->trajectory_filtered.back() =
-                        tracklet->kalman_filter->Correct(tracklet->trajectory.back());
+                        kalman_filters_.Correct(tracklet->kalman_filter, tracklet->trajectory.back());
                 } else if (tracklet->status == ST_LOST) {
-                    tracklet->RenewTrajectory(d_bounding_box);
+                    RenewTrackletWithMotion(tracklet.get(), d_bounding_box);
                     tracklet->status = ST_TRACKED;
                 } else // Association failure
                 {
@@ -286,7 +304,7 @@ int32_t Tracker::TrackObjects(cv::Size frame_size, const std::vector<Detection>
 
             const cv::Rect2f &bounding_box = detections[d].rect & image_boundary;
             tracklet->InitTrajectory(bounding_box);
-            tracklet->kalman_filter.reset(new KalmanFilterNoOpencv(bounding_box));
+            tracklet->kalman_filter = kalman_filters_.Add(bounding_box);
             if (!detections[d].feature.empty())
                 tracklet->rgb_features.push_back(detections[d].feature);
 
@@ -93,6 +93,10 @@ class Tracker {
     void RemoveDeadTracklets();
     bool RemoveOneLostTracklet();
 
+    // Restarts trajectory and Kalman filter of a lost tracklet found again, filter gets motion since the tracklet
+    // was lost
+    void RenewTrackletWithMotion(Tracklet *tracklet, const cv::Rect2f &bounding_box);
+
   protected:
     int32_t next_id_;
     int32_t frame_count_;
@@ -101,6 +105,7 @@ class Tracker {
 
     ObjectsAssociator associator_;
     std::vector<std::shared_ptr<Tracklet>> tracklets_;
+    KalmanFilterNoOpencvBank kalman_filters_;
 
   public:
     explicit Tracker(vas::ot::Tracker::InitParameters init_param);
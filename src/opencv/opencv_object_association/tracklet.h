@@ -56,13 +56,14 @@ class Tracklet {
     float occlusion_ratio;
     float association_delta_t;
     int32_t association_fail_count;
+    float association_price; // Warm start of association solver
+    int32_t kalman_filter;   // Index of Kalman filter in the tracker's bank
 
     std::deque<cv::Rect2f> trajectory;
     std::deque<cv::Rect2f> trajectory_filtered;
 
     int32_t birth_count;
     std::deque<cv::Mat> rgb_features;
-    std::unique_ptr<KalmanFilterNoOpencv> kalman_filter;
 };
 
 using ZeroTermChistTracklet = Tracklet;
@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+/**
+ * Time a single writer thread spent in calls (e.g. blocking pushes downstream), including the call in progress, read
+ * by other threads without locks. Total time and start of the call in progress are updated under a sequence counter
+ * which is odd while they change, so readers retry instead of seeing a call both completed and in progress. Clock is
+ * read inside the update and the read, so totals read one after another never decrease.
+ */
+class BusyTimeCounter {
+  public:
+    void Begin() {
+        _sequence++;
+        _start_ns = Now();
+        _sequence++;
+    }
+
+    void End() {
+        _sequence++;
+        _total_ns += static_cast<uint64_t>(Now() - _start_ns);
+        _start_ns = kIdle;
+        _sequence++;
+    }
+
+    /**
+     * Returns time spent in completed calls and in the call in progress, in nanoseconds
+     */
+    uint64_t Total() const {
+        while (true) {
+            const uint64_t sequence = _sequence;
+            if (sequence & 1)
+                continue;
+            const uint64_t total = _total_ns;
+            const int64_t start = _start_ns;
+            const int64_t now = start == kIdle ? 0 : Now();
+            if (sequence != _sequence)
+                continue;
+            return start == kIdle ? total : total + static_cast<uint64_t>(now - start);
+        }
+    }
+
+  private:
+    static constexpr int64_t kIdle = -1;
+
+    static int64_t Now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    std::atomic<uint64_t> _sequence{0};
+    std::atomic<uint64_t> _total_ns{0};
+    std::atomic<int64_t> _start_ns{kIdle};
+};
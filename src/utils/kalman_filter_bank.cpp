@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "kalman_filter_bank.h"
+
+// avx512f implies FMA, contracted x + w * v would change truncated fixed-point results, so it is not a target
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(_WIN32)
+#define KALMAN_FILTER_BANK_MULTIVERSION __attribute__((target_clones("avx2", "default")))
+#else
+#define KALMAN_FILTER_BANK_MULTIVERSION
+#endif
+
+namespace {
+
+/**
+ * x(k) = F x(k-1) and P(k) = A P(k-1) A' + Q with F = [1 w; 0 1], A = [1 1; 0 1]. Products are computed in float and
+ * truncated to int32 after each step, as in the scalar fixed-point filter.
+ */
+KALMAN_FILTER_BANK_MULTIVERSION
+void predictCoordinate(int32_t *__restrict x0, int32_t *__restrict x1, int32_t *__restrict p00,
+                       int32_t *__restrict p01, int32_t *__restrict p10, int32_t *__restrict p11,
+                       int32_t *__restrict xk0, int32_t *__restrict xk1, int32_t *__restrict pk00,
+                       int32_t *__restrict pk01, int32_t *__restrict pk10, int32_t *__restrict pk11,
+                       const int32_t *__restrict q0, const int32_t *__restrict q1, size_t size,
+                       float velocity_weight) {
+    for (size_t k = 0; k < size; k++) {
+        const int32_t position = static_cast<int32_t>(static_cast<float>(x0[k]) + velocity_weight * x1[k]);
+        const int32_t velocity = static_cast<int32_t>(static_cast<float>(x1[k]));
+
+        const float p10_k = static_cast<float>(p10[k]);
+        const float p11_k = static_cast<float>(p11[k]);
+        const int32_t ap00 = static_cast<int32_t>(p00[k] + p10_k);
+        const int32_t ap01 = static_cast<int32_t>(p01[k] + p11_k);
+        const int32_t ap10 = static_cast<int32_t>(p10_k);
+        const int32_t ap11 = static_cast<int32_t>(p11_k);
+
+        const int32_t pk00_k = static_cast<int32_t>(ap00 + static_cast<float>(ap01)) + q0[k];
+        const int32_t pk01_k = static_cast<int32_t>(static_cast<float>(ap01));
+        const int32_t pk10_k = static_cast<int32_t>(ap10 + static_cast<float>(ap11));
+        const int32_t pk11_k = static_cast<int32_t>(static_cast<float>(ap11)) + q1[k];
+
+        xk0[k] = x0[k] = position;
+        xk1[k] = x1[k] = velocity;
+        pk00[k] = p00[k] = pk00_k;
+        pk01[k] = p01[k] = pk01_k;
+        pk10[k] = p10[k] = pk10_k;
+        pk11[k] = p11[k] = pk11_k;
+    }
+}
+
+} // namespace
+
+void FixedPointKalmanCoordinate::resize(size_t size) {
+    for (size_t i = 0; i < 2; i++) {
+        x[i].resize(size);
+        xk[i].resize(size);
+        q[i].resize(size);
+        for (size_t j = 0; j < 2; j++) {
+            p[i][j].resize(size);
+            pk[i][j].resize(size);
+        }
+    }
+    r.resize(size);
+}
+
+void FixedPointKalmanCoordinate::reset(size_t filter, int32_t position) {
+    for (size_t i = 0; i < 2; i++) {
+        x[i][filter] = 0;
+        xk[i][filter] = 0;
+        q[i][filter] = 0;
+        for (size_t j = 0; j < 2; j++) {
+            p[i][j][filter] = 0;
+            pk[i][j][filter] = 0;
+        }
+    }
+    r[filter] = 0;
+    x[0][filter] = position;
+}
+
+void FixedPointKalmanCoordinate::predict(size_t begin, size_t end, float velocity_weight) {
+    if (begin >= end)
+        return;
+    predictCoordinate(&x[0][begin], &x[1][begin], &p[0][0][begin], &p[0][1][begin], &p[1][0][begin],
+                      &p[1][1][begin], &xk[0][begin], &xk[1][begin], &pk[0][0][begin], &pk[0][1][begin],
+                      &pk[1][0][begin], &pk[1][1][begin], &q[0][begin], &q[1][begin], end - begin, velocity_weight);
+}
+
+/**
+ * Update divides by innovation variance in integer arithmetic, it runs only for matched objects and is not vectorized
+ */
+int32_t FixedPointKalmanCoordinate::update(size_t filter, int32_t measurement) {
+    const int32_t predicted_position = xk[0][filter];
+    if (predicted_position == 0 && pk[0][0][filter] == 0)
+        return measurement;
+
+    const int32_t residual = measurement - predicted_position;
+    const int32_t innovation_var = pk[0][0][filter] + r[filter];
+    if (innovation_var == 0)
+        return measurement;
+
+    // Gain is K / innovation_var, division is postponed to keep precision
+    const int32_t k0 = pk[0][0][filter];
+    const int32_t k1 = pk[1][0][filter];
+    x[0][filter] = predicted_position + k0 * residual / innovation_var;
+    x[1][filter] = xk[1][filter] + k1 * residual / innovation_var;
+
+    // P = (I - K H) Pk, in double to avoid int32 overflow
+    const double s = innovation_var;
+    p[0][0][filter] = static_cast<int32_t>((innovation_var - k0) * static_cast<double>(pk[0][0][filter]) / s);
+    p[0][1][filter] = static_cast<int32_t>((innovation_var - k0) * static_cast<double>(pk[0][1][filter]) / s);
+    p[1][0][filter] = static_cast<int32_t>((-k1 * static_cast<double>(pk[0][0][filter]) +
+                                            innovation_var * static_cast<double>(pk[1][0][filter])) /
+                                           s);
+    p[1][1][filter] = static_cast<int32_t>((-k1 * static_cast<double>(pk[0][1][filter]) +
+                                            innovation_var * static_cast<double>(pk[1][1][filter])) /
+                                           s);
+    return x[0][filter];
+}
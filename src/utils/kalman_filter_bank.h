@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * One coordinate of many fixed-point constant velocity Kalman filters, stored as structure of arrays.
+ *
+ * State of a filter is position and velocity of the coordinate, process noise covariance is diagonal and only the
+ * position is measured.
+ */
+struct FixedPointKalmanCoordinate {
+    // Estimated state [position, velocity] and its covariance
+    std::vector<int32_t> x[2];
+    std::vector<int32_t> p[2][2];
+    // State and covariance of the last prediction
+    std::vector<int32_t> xk[2];
+    std::vector<int32_t> pk[2][2];
+    // Diagonal of process noise covariance, measurement noise variance
+    std::vector<int32_t> q[2];
+    std::vector<int32_t> r;
+
+    void resize(size_t size);
+    // Zeroes filter and sets its position
+    void reset(size_t filter, int32_t position);
+    // Predicts filters [begin, end), position advances by velocity * velocity_weight
+    void predict(size_t begin, size_t end, float velocity_weight);
+    // Corrects prediction of filter with measured position, returns estimated position
+    int32_t update(size_t filter, int32_t measurement);
+};
+
+/**
+ * Bank of fixed-point constant velocity Kalman filters sized at compile time.
+ *
+ * State of each filter is a position and a velocity of every measured coordinate, coordinates are independent, so
+ * each of them is kept as FixedPointKalmanCoordinate and covariance as 2x2 blocks. Filters of all objects are
+ * predicted in one vectorized loop per coordinate, objects keep only index of their filter. Removed filters are zeroed
+ * and reused by next add().
+ */
+template <size_t STATE_DIM, size_t MEASUREMENT_DIM>
+class KalmanFilterBank {
+    static_assert(STATE_DIM == 2 * MEASUREMENT_DIM, "State must be position and velocity of each measured coordinate");
+
+  public:
+    using Measurement = std::array<int32_t, MEASUREMENT_DIM>;
+    using VelocityWeights = std::array<float, MEASUREMENT_DIM>;
+
+    // Creates filter at position with zero velocity, covariance and noises, returns its index
+    size_t add(const Measurement &position) {
+        size_t filter;
+        if (free_filters.empty()) {
+            filter = filters_num++;
+            for (auto &coordinate : coordinates)
+                coordinate.resize(filters_num);
+        } else {
+            filter = free_filters.back();
+            free_filters.pop_back();
+        }
+        reset(filter, position);
+        return filter;
+    }
+
+    void reset(size_t filter, const Measurement &position) {
+        for (size_t c = 0; c < MEASUREMENT_DIM; c++)
+            coordinates[c].reset(filter, position[c]);
+    }
+
+    void remove(size_t filter) {
+        for (auto &coordinate : coordinates)
+            coordinate.reset(filter, 0);
+        free_filters.push_back(filter);
+    }
+
+    void clear() {
+        for (auto &coordinate : coordinates)
+            coordinate.resize(0);
+        free_filters.clear();
+        filters_num = 0;
+    }
+
+    void setProcessNoise(size_t filter, size_t coordinate, int32_t position_noise, int32_t velocity_noise) {
+        coordinates[coordinate].q[0][filter] = position_noise;
+        coordinates[coordinate].q[1][filter] = velocity_noise;
+    }
+
+    void setMeasurementNoise(size_t filter, int32_t noise) {
+        for (auto &coordinate : coordinates)
+            coordinate.r[filter] = noise;
+    }
+
+    // Predicts all filters
+    void predict(const VelocityWeights &velocity_weights) {
+        for (size_t c = 0; c < MEASUREMENT_DIM; c++)
+            coordinates[c].predict(0, filters_num, velocity_weights[c]);
+    }
+
+    void predict(size_t filter, const VelocityWeights &velocity_weights) {
+        for (size_t c = 0; c < MEASUREMENT_DIM; c++)
+            coordinates[c].predict(filter, filter + 1, velocity_weights[c]);
+    }
+
+    int32_t predicted(size_t filter, size_t coordinate) const {
+        return coordinates[coordinate].xk[0][filter];
+    }
+
+    // Corrects last prediction of filter, returns estimated positions
+    Measurement update(size_t filter, const Measurement &measurement) {
+        Measurement estimate;
+        for (size_t c = 0; c < MEASUREMENT_DIM; c++)
+            estimate[c] = coordinates[c].update(filter, measurement[c]);
+        return estimate;
+    }
+
+  private:
+    std::array<FixedPointKalmanCoordinate, MEASUREMENT_DIM> coordinates;
+    std::vector<size_t> free_filters;
+    size_t filters_num = 0;
+};
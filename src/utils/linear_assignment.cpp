@@ -0,0 +1,200 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "linear_assignment.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+constexpr double UNREACHED = std::numeric_limits<double>::infinity();
+constexpr int NONE = -1;
+} // namespace
+
+const std::vector<int> &LinearAssignmentSolver::solve(const float *cost, size_t rows, size_t cols,
+                                                      float unassigned_cost, float *col_prices) {
+    if (!std::isfinite(unassigned_cost))
+        throw std::invalid_argument("Cost of unassigned row must be finite");
+
+    this->rows = rows;
+    this->cols = cols;
+    init(cost, unassigned_cost, col_prices);
+
+    for (size_t row = 0; row < rows; row++) {
+        if (row_to_col[row] == NONE)
+            augment(row, findAugmentingPath(row, cost, unassigned_cost));
+    }
+
+    assignment.resize(rows);
+    for (size_t row = 0; row < rows; row++)
+        assignment[row] = static_cast<size_t>(row_to_col[row]) < cols ? row_to_col[row] : NONE;
+    if (col_prices) {
+        for (size_t col = 0; col < cols; col++)
+            col_prices[col] = static_cast<float>(col_price[col]);
+    }
+    return assignment;
+}
+
+void LinearAssignmentSolver::init(const float *cost, float unassigned_cost, const float *col_prices) {
+    const size_t total_cols = cols + rows;
+
+    row_begin.resize(rows + 1);
+    row_cols.clear();
+    for (size_t row = 0; row < rows; row++) {
+        row_begin[row] = row_cols.size();
+        const float *row_cost = cost + row * cols;
+        for (size_t col = 0; col < cols; col++) {
+            if (row_cost[col] < FORBIDDEN)
+                row_cols.push_back(static_cast<unsigned>(col));
+        }
+    }
+    row_begin[rows] = row_cols.size();
+
+    // Solution is optimal when prices of all columns are non-positive and free columns have zero price
+    col_price.assign(total_cols, 0.0);
+    if (col_prices) {
+        for (size_t col = 0; col < cols; col++)
+            col_price[col] = std::min(static_cast<double>(col_prices[col]), 0.0);
+    }
+    row_price.resize(rows);
+    row_to_col.assign(rows, NONE);
+    col_to_row.assign(total_cols, NONE);
+    distance.assign(total_cols, UNREACHED);
+    predecessor.assign(total_cols, NONE);
+    scanned.assign(total_cols, 0);
+
+    // Assign rows to columns of the lowest reduced cost if they are not taken yet
+    const auto cheapest_col = [&](size_t row) {
+        size_t best_col = unassignedColumn(row);
+        double best = unassigned_cost - col_price[best_col];
+        for (size_t k = row_begin[row]; k < row_begin[row + 1]; k++) {
+            const size_t col = row_cols[k];
+            const double reduced = cost[row * cols + col] - col_price[col];
+            if (reduced <= best) {
+                best = reduced;
+                best_col = col;
+            }
+        }
+        row_price[row] = best;
+        return best_col;
+    };
+    for (size_t row = 0; row < rows; row++) {
+        const size_t col = cheapest_col(row);
+        if (col_to_row[col] == NONE) {
+            col_to_row[col] = row;
+            row_to_col[row] = col;
+        }
+    }
+    if (!col_prices)
+        return;
+
+    // Warm start prices of columns left free are reset to zero, rows which are no longer assigned to their cheapest
+    // column release it, until prices and assignment are consistent
+    for (size_t col = 0; col < cols; col++) {
+        if (col_to_row[col] == NONE)
+            col_price[col] = 0.0;
+    }
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (size_t row = 0; row < rows; row++) {
+            const int assigned = row_to_col[row];
+            const size_t col = cheapest_col(row);
+            if (assigned == NONE || static_cast<size_t>(assigned) == col)
+                continue;
+            const double assigned_cost =
+                static_cast<size_t>(assigned) < cols ? cost[row * cols + assigned] : unassigned_cost;
+            if (assigned_cost - col_price[assigned] <= row_price[row])
+                continue;
+            row_to_col[row] = NONE;
+            col_to_row[assigned] = NONE;
+            col_price[assigned] = 0.0;
+            changed = true;
+        }
+    }
+}
+
+size_t LinearAssignmentSolver::findAugmentingPath(size_t row, const float *cost, float unassigned_cost) {
+    scanned_rows.clear();
+    scanned_cols.clear();
+    frontier.clear();
+
+    const auto relax = [&](size_t col, double path_cost, size_t from_row) {
+        if (distance[col] == UNREACHED)
+            frontier.push_back(col);
+        else if (path_cost >= distance[col])
+            return;
+        distance[col] = path_cost;
+        predecessor[col] = static_cast<int>(from_row);
+    };
+
+    // Dijkstra search over reduced costs, which are non-negative for all assigned rows
+    double min_distance = 0.0;
+    size_t sink = 0;
+    for (size_t current = row;;) {
+        scanned_rows.push_back(current);
+        const double current_price = row_price[current];
+        const float *row_cost = cost + current * cols;
+        for (size_t k = row_begin[current]; k < row_begin[current + 1]; k++) {
+            const size_t col = row_cols[k];
+            if (!scanned[col])
+                relax(col, min_distance + row_cost[col] - current_price - col_price[col], current);
+        }
+        const size_t own_col = unassignedColumn(current);
+        if (!scanned[own_col])
+            relax(own_col, min_distance + unassigned_cost - current_price - col_price[own_col], current);
+
+        // Frontier is never empty: "unassigned" column of the searched row is free until the path is found
+        size_t closest = 0;
+        for (size_t k = 1; k < frontier.size(); k++) {
+            const double d = distance[frontier[k]];
+            const double best = distance[frontier[closest]];
+            if (d < best || (d == best && col_to_row[frontier[k]] == NONE))
+                closest = k;
+        }
+        const size_t col = frontier[closest];
+        frontier[closest] = frontier.back();
+        frontier.pop_back();
+
+        min_distance = distance[col];
+        scanned[col] = 1;
+        scanned_cols.push_back(col);
+        if (col_to_row[col] == NONE) {
+            sink = col;
+            break;
+        }
+        current = col_to_row[col];
+    }
+
+    // Update prices, so reduced costs stay non-negative and edges of new assignment are tight
+    row_price[row] += min_distance;
+    for (size_t k = 1; k < scanned_rows.size(); k++) {
+        const size_t scanned_row = scanned_rows[k];
+        row_price[scanned_row] += min_distance - distance[row_to_col[scanned_row]];
+    }
+    for (size_t col : scanned_cols)
+        col_price[col] -= min_distance - distance[col];
+
+    for (size_t col : scanned_cols) {
+        distance[col] = UNREACHED;
+        scanned[col] = 0;
+    }
+    for (size_t col : frontier)
+        distance[col] = UNREACHED;
+    return sink;
+}
+
+void LinearAssignmentSolver::augment(size_t row, size_t sink) {
+    for (size_t col = sink;;) {
+        const int path_row = predecessor[col];
+        col_to_row[col] = path_row;
+        const int previous_col = row_to_col[path_row];
+        row_to_col[path_row] = static_cast<int>(col);
+        if (static_cast<size_t>(path_row) == row)
+            break;
+        col = previous_col;
+    }
+}
@@ -0,0 +1,74 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+/**
+ * Rectangular linear assignment solver (shortest augmenting path method of Jonker and Volgenant).
+ *
+ * Finds assignment of rows to columns minimizing sum of costs of assigned pairs plus unassigned_cost for each row
+ * left unassigned. Pairs with infinite cost are forbidden, they are skipped by the solver, so gated (sparse) cost
+ * matrices are solved faster than dense ones. Each pair costing more than unassigned_cost is never assigned.
+ *
+ * Working memory is kept in the solver and reused, so no allocations are made once the solver has seen the largest
+ * problem. Column prices (dual variables) of a solution may be passed to the next solve as a warm start: when
+ * columns are tracks and previous frame's prices are passed, most rows are assigned by the initial reduction and
+ * only a few augmenting paths have to be found.
+ */
+class LinearAssignmentSolver {
+  public:
+    static constexpr float FORBIDDEN = std::numeric_limits<float>::infinity();
+
+    /**
+     * Solves assignment problem.
+     *
+     * @param[in] cost - row-major rows x cols cost matrix, FORBIDDEN entries mark pairs which can not be assigned.
+     * @param[in] rows - number of rows.
+     * @param[in] cols - number of columns.
+     * @param[in] unassigned_cost - cost of leaving a row unassigned, must be finite.
+     * @param[in,out] col_prices - optional array of cols column prices used as warm start, replaced with prices of
+     * the solution. Any values (e.g. zeros for new columns) give optimal solution.
+     *
+     * @return column assigned to each row, -1 for unassigned rows.
+     *
+     * @throw std::invalid_argument if unassigned_cost is not finite.
+     */
+    const std::vector<int> &solve(const float *cost, size_t rows, size_t cols, float unassigned_cost,
+                                  float *col_prices = nullptr);
+
+  private:
+    // Column of own "unassigned" of a row, such column is connected only to its row
+    size_t unassignedColumn(size_t row) const {
+        return cols + row;
+    }
+    void init(const float *cost, float unassigned_cost, const float *col_prices);
+    // Returns column ending shortest augmenting path from free row, updates prices
+    size_t findAugmentingPath(size_t row, const float *cost, float unassigned_cost);
+    void augment(size_t row, size_t sink);
+
+    size_t rows = 0;
+    size_t cols = 0;
+
+    // Finite entries of cost matrix in CSR layout
+    std::vector<size_t> row_begin;
+    std::vector<unsigned> row_cols;
+
+    // Dual variables, real columns are followed by "unassigned" columns
+    std::vector<double> row_price, col_price;
+    std::vector<int> row_to_col, col_to_row;
+
+    // Shortest path search state, reset only for touched columns
+    std::vector<double> distance;
+    std::vector<int> predecessor;
+    std::vector<char> scanned;
+    std::vector<size_t> scanned_rows, scanned_cols, frontier;
+
+    std::vector<int> assignment;
+};
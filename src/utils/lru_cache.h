@@ -54,6 +54,16 @@ class LRUCache {
         return key_it->second->value;
     }
 
+    // Returns nullptr if key is absent, otherwise key becomes recently used
+    Value_T *find(const Key_T &key) {
+        auto key_it = keys.find(key);
+        if (key_it == keys.end())
+            return nullptr;
+
+        make_recently_used(key_it->second);
+        return &key_it->second->value;
+    }
+
     void put(Key_T key, Value_T value = {}) {
         auto key_it = keys.find(key);
         if (key_it == keys.end()) {
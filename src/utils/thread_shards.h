@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * Shards of an owner object written by many threads without locks, each thread gets own shard on first access.
+ * The shard of the calling thread is found in a thread local table at the owner's slot. Slots of destroyed owners
+ * are reused and their entries are replaced, so the tables are as long as the number of owners alive at once.
+ * The mutex is taken only to register a new shard and by for_each().
+ */
+template <typename Shard>
+class ThreadShards {
+  public:
+    ThreadShards() {
+        Slots &slots = registry();
+        std::lock_guard<std::mutex> guard(slots.mutex);
+        if (slots.free.empty()) {
+            _slot = slots.generations.size();
+            slots.generations.push_back(0);
+        } else {
+            _slot = slots.free.back();
+            slots.free.pop_back();
+        }
+        _generation = slots.generations[_slot];
+    }
+
+    ~ThreadShards() {
+        Slots &slots = registry();
+        std::lock_guard<std::mutex> guard(slots.mutex);
+        // entries left in thread local tables no longer match the slot
+        slots.generations[_slot]++;
+        slots.free.push_back(_slot);
+    }
+
+    ThreadShards(const ThreadShards &) = delete;
+    ThreadShards &operator=(const ThreadShards &) = delete;
+
+    /**
+     * Returns shard of the calling thread
+     * @param init called for a new shard before it is registered
+     */
+    template <typename Init>
+    Shard &local(Init &&init) {
+        auto &table = local_table();
+        if (_slot < table.size() && table[_slot].shard && table[_slot].generation == _generation)
+            return *table[_slot].shard;
+
+        auto shard = std::make_unique<Shard>();
+        init(*shard);
+        if (table.size() <= _slot)
+            table.resize(_slot + 1);
+        table[_slot] = {_generation, shard.get()};
+        std::lock_guard<std::mutex> guard(_mutex);
+        _shards.push_back(std::move(shard));
+        return *_shards.back();
+    }
+
+    Shard &local() {
+        return local([](Shard &) {});
+    }
+
+    // Calls func for shards of all threads in order of registration
+    template <typename Func>
+    void for_each(Func &&func) {
+        std::lock_guard<std::mutex> guard(_mutex);
+        for (auto &shard : _shards)
+            func(*shard);
+    }
+
+  private:
+    struct Slots {
+        std::mutex mutex;
+        std::vector<uint64_t> generations;
+        std::vector<size_t> free;
+    };
+    struct Entry {
+        uint64_t generation = 0;
+        Shard *shard = nullptr;
+    };
+
+    static Slots &registry() {
+        // never destroyed, owners may be destroyed after static objects
+        static Slots *slots = new Slots();
+        return *slots;
+    }
+
+    static std::vector<Entry> &local_table() {
+        thread_local std::vector<Entry> table;
+        return table;
+    }
+
+    size_t _slot;
+    uint64_t _generation;
+    std::mutex _mutex;
+    std::vector<std::unique_ptr<Shard>> _shards;
+};
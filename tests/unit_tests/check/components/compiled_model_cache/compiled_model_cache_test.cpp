@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "compiled_model_cache.h"
+
+#include <gtest/gtest.h>
+#include <openvino/op/ops.hpp>
+#include <openvino/openvino.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Model multiplying input of 'shape' by 'weight'
+std::shared_ptr<ov::Model> tiny_model(const ov::Shape &shape = {1, 3, 4, 4}, float weight = 2.0f) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto weights = ov::op::v0::Constant::create(ov::element::f32, {1}, {weight});
+    auto multiply = std::make_shared<ov::op::v1::Multiply>(input, weights);
+    auto result = std::make_shared<ov::op::v0::Result>(multiply);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{input}, "tiny");
+}
+
+class CompiledModelCacheTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        directory = fs::temp_directory_path() /
+                    ("compiled_model_cache_test-" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) +
+                     "-" + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        fs::remove_all(directory);
+    }
+
+    void TearDown() override {
+        fs::remove_all(directory);
+    }
+
+    fs::path directory;
+    ov::Core core;
+};
+
+} // namespace
+
+TEST_F(CompiledModelCacheTest, KeyDependsOnModelDeviceAndParams) {
+    const ov::AnyMap params = {ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY)};
+    const std::string key = CompiledModelCache::MakeKey(tiny_model(), "CPU", params);
+
+    EXPECT_EQ(CompiledModelCache::MakeKey(tiny_model(), "CPU", params), key);
+    EXPECT_NE(CompiledModelCache::MakeKey(tiny_model({1, 3, 8, 8}), "CPU", params), key);
+    EXPECT_NE(CompiledModelCache::MakeKey(tiny_model({1, 3, 4, 4}, 3.0f), "CPU", params), key);
+    EXPECT_NE(CompiledModelCache::MakeKey(tiny_model(), "GPU", params), key);
+    EXPECT_NE(CompiledModelCache::MakeKey(tiny_model(), "CPU", {}), key);
+    EXPECT_NE(CompiledModelCache::MakeKey(
+                  tiny_model(), "CPU", {ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT)}),
+              key);
+}
+
+TEST_F(CompiledModelCacheTest, BlobPathIsInDirectoryAndNamedByModelAndKey) {
+    CompiledModelCache cache(directory.string());
+    const fs::path blob_path = cache.GetBlobPath("/models/FP32/detection.xml", "0123abcd");
+    EXPECT_EQ(blob_path.parent_path(), directory);
+    EXPECT_EQ(blob_path.filename(), "detection-0123abcd.blob");
+}
+
+TEST_F(CompiledModelCacheTest, ImportsExportedModel) {
+    CompiledModelCache cache(directory.string());
+    const auto model = tiny_model();
+    const std::string blob_path = cache.GetBlobPath("tiny.xml", CompiledModelCache::MakeKey(model, "CPU", {}));
+
+    // Miss, blob is not exported yet and directory does not exist
+    bool imported_called = false;
+    EXPECT_FALSE(cache.Import(blob_path, [&](std::istream &) { imported_called = true; }));
+    EXPECT_FALSE(imported_called);
+
+    cache.Export(blob_path, core.compile_model(model, "CPU"));
+    ASSERT_TRUE(fs::exists(blob_path));
+    // Temporary file is renamed to the blob
+    EXPECT_EQ(std::distance(fs::directory_iterator(directory), fs::directory_iterator()), 1);
+
+    // Hit, imported model computes the same as the compiled one
+    ov::CompiledModel imported;
+    ASSERT_TRUE(cache.Import(blob_path, [&](std::istream &blob) { imported = core.import_model(blob, "CPU"); }));
+    ov::InferRequest request = imported.create_infer_request();
+    ov::Tensor input = request.get_input_tensor();
+    std::fill_n(input.data<float>(), input.get_size(), 1.5f);
+    request.infer();
+    const ov::Tensor output = request.get_output_tensor();
+    ASSERT_EQ(output.get_size(), input.get_size());
+    for (size_t i = 0; i < output.get_size(); i++)
+        ASSERT_FLOAT_EQ(output.data<float>()[i], 3.0f);
+}
+
+TEST_F(CompiledModelCacheTest, CorruptBlobIsRemovedAndRecompiled) {
+    CompiledModelCache cache(directory.string());
+    const auto model = tiny_model();
+    const std::string blob_path = cache.GetBlobPath("tiny.xml", CompiledModelCache::MakeKey(model, "CPU", {}));
+    fs::create_directories(directory);
+    {
+        std::ofstream blob(blob_path, std::ios::binary);
+        blob << "not a compiled model";
+    }
+
+    ov::CompiledModel imported;
+    EXPECT_FALSE(cache.Import(blob_path, [&](std::istream &blob) { imported = core.import_model(blob, "CPU"); }));
+    EXPECT_FALSE(fs::exists(blob_path));
+
+    // Blob exported after the fallback compilation is imported next time
+    cache.Export(blob_path, core.compile_model(model, "CPU"));
+    EXPECT_TRUE(cache.Import(blob_path, [&](std::istream &blob) { imported = core.import_model(blob, "CPU"); }));
+}
+
+TEST_F(CompiledModelCacheTest, StaleBlobOfChangedModelIsNotImported) {
+    CompiledModelCache cache(directory.string());
+    const auto model = tiny_model();
+    const std::string blob_path = cache.GetBlobPath("tiny.xml", CompiledModelCache::MakeKey(model, "CPU", {}));
+    cache.Export(blob_path, core.compile_model(model, "CPU"));
+
+    // Same model file reshaped or with other weights is another blob
+    for (const auto &changed : {tiny_model({1, 3, 8, 8}), tiny_model({1, 3, 4, 4}, 3.0f)}) {
+        const std::string changed_path =
+            cache.GetBlobPath("tiny.xml", CompiledModelCache::MakeKey(changed, "CPU", {}));
+        EXPECT_NE(changed_path, blob_path);
+        EXPECT_FALSE(cache.Import(changed_path, [](std::istream &) { FAIL() << "stale blob is imported"; }));
+    }
+    EXPECT_TRUE(fs::exists(blob_path));
+}
+
+TEST_F(CompiledModelCacheTest, ModelsWithAutomaticBatchingAreNotSupported) {
+    const ov::AnyMap throughput = {ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT)};
+    const ov::AnyMap latency = {ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY)};
+    ov::AnyMap no_auto_batching = throughput;
+    no_auto_batching.insert(ov::hint::allow_auto_batching(false));
+
+    EXPECT_TRUE(CompiledModelCache::IsSupported("CPU", {}));
+    EXPECT_TRUE(CompiledModelCache::IsSupported("CPU", throughput));
+    EXPECT_TRUE(CompiledModelCache::IsSupported("GPU", {}));
+    EXPECT_TRUE(CompiledModelCache::IsSupported("GPU", latency));
+    EXPECT_TRUE(CompiledModelCache::IsSupported("GPU.1", no_auto_batching));
+    EXPECT_FALSE(CompiledModelCache::IsSupported("BATCH:GPU(4)", {}));
+    EXPECT_FALSE(CompiledModelCache::IsSupported("GPU", throughput));
+    EXPECT_FALSE(CompiledModelCache::IsSupported("GPU.0", throughput));
+}
@@ -0,0 +1,267 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "deep_sort_kalman.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace DeepSortWrapper;
+
+namespace {
+
+constexpr size_t N = 8; // state: x, y, aspect ratio, height and their velocities
+constexpr size_t M = 4; // measurement: x, y, aspect ratio, height
+
+template <size_t R, size_t C>
+using Matrix = std::array<std::array<double, C>, R>;
+
+template <size_t R, size_t K, size_t C>
+Matrix<R, C> Multiply(const Matrix<R, K> &a, const Matrix<K, C> &b) {
+    Matrix<R, C> result = {};
+    for (size_t i = 0; i < R; i++)
+        for (size_t j = 0; j < C; j++)
+            for (size_t k = 0; k < K; k++)
+                result[i][j] += a[i][k] * b[k][j];
+    return result;
+}
+
+template <size_t R, size_t C>
+Matrix<C, R> Transpose(const Matrix<R, C> &a) {
+    Matrix<C, R> result = {};
+    for (size_t i = 0; i < R; i++)
+        for (size_t j = 0; j < C; j++)
+            result[j][i] = a[i][j];
+    return result;
+}
+
+template <size_t S>
+Matrix<S, S> Inverse(Matrix<S, S> a) {
+    Matrix<S, S> result = {};
+    for (size_t i = 0; i < S; i++)
+        result[i][i] = 1.0;
+    for (size_t col = 0; col < S; col++) {
+        size_t pivot = col;
+        for (size_t row = col + 1; row < S; row++)
+            if (std::abs(a[row][col]) > std::abs(a[pivot][col]))
+                pivot = row;
+        std::swap(a[col], a[pivot]);
+        std::swap(result[col], result[pivot]);
+        const double scale = a[col][col];
+        for (size_t j = 0; j < S; j++) {
+            a[col][j] /= scale;
+            result[col][j] /= scale;
+        }
+        for (size_t row = 0; row < S; row++) {
+            if (row == col)
+                continue;
+            const double factor = a[row][col];
+            for (size_t j = 0; j < S; j++) {
+                a[row][j] -= factor * a[col][j];
+                result[row][j] -= factor * result[col][j];
+            }
+        }
+    }
+    return result;
+}
+
+// Dense 8x8 Deep SORT Kalman filter as implemented per track before the filter bank
+struct DenseFilter {
+    static constexpr double STD_WEIGHT_POSITION = 1.0 / 20.0;
+    static constexpr double STD_WEIGHT_VELOCITY = 1.0 / 160.0;
+
+    Matrix<N, 1> mean = {};
+    Matrix<N, N> covariance = {};
+
+    explicit DenseFilter(const cv::Rect_<float> &bbox) {
+        mean[0][0] = bbox.x + bbox.width / 2.0;
+        mean[1][0] = bbox.y + bbox.height / 2.0;
+        mean[2][0] = bbox.width / bbox.height;
+        mean[3][0] = bbox.height;
+        for (size_t i = 0; i < N; i++)
+            covariance[i][i] = (i < M ? 2.0 * STD_WEIGHT_POSITION : 10.0 * STD_WEIGHT_VELOCITY) * bbox.height;
+        covariance[2][2] = 1e-2;
+        covariance[6][6] = 1e-5;
+    }
+
+    void predict() {
+        Matrix<N, N> f = {};
+        for (size_t i = 0; i < N; i++)
+            f[i][i] = 1.0;
+        for (size_t i = 0; i < M; i++)
+            f[i][i + M] = 1.0;
+        mean = Multiply(f, mean);
+
+        const double height = mean[3][0];
+        Matrix<N, N> q = {};
+        for (size_t i = 0; i < N; i++) {
+            const double std = (i < M ? STD_WEIGHT_POSITION : STD_WEIGHT_VELOCITY) * height;
+            q[i][i] = std * std;
+        }
+        q[2][2] = 1e-2;
+        q[6][6] = 1e-5;
+
+        covariance = Multiply(Multiply(f, covariance), Transpose(f));
+        for (size_t i = 0; i < N; i++)
+            for (size_t j = 0; j < N; j++)
+                covariance[i][j] += q[i][j];
+    }
+
+    void update(const cv::Rect_<float> &bbox) {
+        Matrix<M, N> h = {};
+        for (size_t i = 0; i < M; i++)
+            h[i][i] = 1.0;
+
+        const double position_std = STD_WEIGHT_POSITION * bbox.height;
+        Matrix<M, M> r = {};
+        for (size_t i = 0; i < M; i++)
+            r[i][i] = position_std * position_std;
+        r[2][2] = 1e-1;
+
+        Matrix<M, 1> z = {};
+        z[0][0] = bbox.x + bbox.width / 2.0;
+        z[1][0] = bbox.y + bbox.height / 2.0;
+        z[2][0] = bbox.width / bbox.height;
+        z[3][0] = bbox.height;
+
+        auto s = Multiply(Multiply(h, covariance), Transpose(h));
+        for (size_t i = 0; i < M; i++)
+            for (size_t j = 0; j < M; j++)
+                s[i][j] += r[i][j];
+        const auto k = Multiply(Multiply(covariance, Transpose(h)), Inverse(s));
+        auto y = Multiply(h, mean);
+        for (size_t i = 0; i < M; i++)
+            y[i][0] = z[i][0] - y[i][0];
+
+        const auto correction = Multiply(k, y);
+        for (size_t i = 0; i < N; i++)
+            mean[i][0] += correction[i][0];
+        const auto kh_covariance = Multiply(Multiply(k, h), covariance);
+        for (size_t i = 0; i < N; i++)
+            for (size_t j = 0; j < N; j++)
+                covariance[i][j] -= kh_covariance[i][j];
+    }
+
+    cv::Rect_<float> bbox() const {
+        const double height = mean[3][0];
+        const double width = mean[2][0] * height;
+        return cv::Rect_<float>(static_cast<float>(mean[0][0] - width / 2.0),
+                                static_cast<float>(mean[1][0] - height / 2.0), static_cast<float>(width),
+                                static_cast<float>(height));
+    }
+};
+
+void ExpectNear(const cv::Rect_<float> &actual, const cv::Rect_<float> &expected) {
+    const float tolerance = 1e-3f * std::max(1.0f, expected.height);
+    EXPECT_NEAR(actual.x, expected.x, tolerance);
+    EXPECT_NEAR(actual.y, expected.y, tolerance);
+    EXPECT_NEAR(actual.width, expected.width, tolerance);
+    EXPECT_NEAR(actual.height, expected.height, tolerance);
+}
+
+} // namespace
+
+TEST(KalmanBankTest, InitialBoxIsDetection) {
+    KalmanBank bank;
+    const cv::Rect_<float> bbox(10.0f, 20.0f, 30.0f, 60.0f);
+    const size_t slot = bank.add(bbox);
+    ExpectNear(bank.bbox(slot), bbox);
+}
+
+TEST(KalmanBankTest, MatchesDenseFilter) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> position(0.0f, 1000.0f);
+    std::uniform_real_distribution<float> size(20.0f, 200.0f);
+    std::uniform_real_distribution<float> step(-5.0f, 5.0f);
+    std::bernoulli_distribution detected(0.7);
+
+    constexpr size_t TRACKS = 16;
+    KalmanBank bank;
+    std::vector<DenseFilter> references;
+    std::vector<size_t> slots;
+    std::vector<cv::Rect_<float>> boxes;
+    for (size_t i = 0; i < TRACKS; i++) {
+        boxes.emplace_back(position(rng), position(rng), size(rng) / 2.0f, size(rng));
+        slots.push_back(bank.add(boxes.back()));
+        references.emplace_back(boxes.back());
+    }
+
+    for (int frame = 0; frame < 50; frame++) {
+        for (size_t i = 0; i < TRACKS; i++)
+            bank.schedule(slots[i]);
+        bank.predict();
+        for (size_t i = 0; i < TRACKS; i++) {
+            references[i].predict();
+            ExpectNear(bank.bbox(slots[i]), references[i].bbox());
+        }
+
+        // objects move with constant velocity of their own, some detections are missed
+        for (size_t i = 0; i < TRACKS; i++) {
+            boxes[i].x += 2.0f + step(rng);
+            boxes[i].y += 1.0f + step(rng);
+            boxes[i].height += 0.1f * step(rng);
+            if (!detected(rng))
+                continue;
+            bank.update(slots[i], boxes[i]);
+            references[i].update(boxes[i]);
+            ExpectNear(bank.bbox(slots[i]), references[i].bbox());
+        }
+    }
+}
+
+TEST(KalmanBankTest, OnlyScheduledFiltersArePredicted) {
+    KalmanBank bank;
+    const size_t moving = bank.add(cv::Rect_<float>(0.0f, 0.0f, 10.0f, 20.0f));
+    const size_t still = bank.add(cv::Rect_<float>(100.0f, 100.0f, 10.0f, 20.0f));
+    DenseFilter moving_reference(cv::Rect_<float>(0.0f, 0.0f, 10.0f, 20.0f));
+    DenseFilter still_reference(cv::Rect_<float>(100.0f, 100.0f, 10.0f, 20.0f));
+
+    // gain velocity on both
+    for (int frame = 1; frame <= 3; frame++) {
+        const cv::Rect_<float> moving_box(frame * 5.0f, 0.0f, 10.0f, 20.0f);
+        const cv::Rect_<float> still_box(100.0f + frame * 5.0f, 100.0f, 10.0f, 20.0f);
+        bank.schedule(moving);
+        bank.schedule(still);
+        bank.predict();
+        bank.update(moving, moving_box);
+        bank.update(still, still_box);
+        moving_reference.predict();
+        moving_reference.update(moving_box);
+        still_reference.predict();
+        still_reference.update(still_box);
+    }
+
+    const cv::Rect_<float> still_before = bank.bbox(still);
+    bank.schedule(moving);
+    bank.predict();
+    moving_reference.predict();
+    ExpectNear(bank.bbox(moving), moving_reference.bbox());
+    ExpectNear(bank.bbox(still), still_before);
+}
+
+TEST(KalmanBankTest, RemovedSlotIsReusedWithFreshState) {
+    KalmanBank bank;
+    const size_t first = bank.add(cv::Rect_<float>(0.0f, 0.0f, 10.0f, 20.0f));
+    bank.schedule(first);
+    bank.predict();
+    bank.update(first, cv::Rect_<float>(50.0f, 0.0f, 10.0f, 20.0f));
+    bank.remove(first);
+
+    const cv::Rect_<float> bbox(300.0f, 200.0f, 40.0f, 80.0f);
+    const size_t reused = bank.add(bbox);
+    EXPECT_EQ(reused, first);
+
+    DenseFilter reference(bbox);
+    bank.schedule(reused);
+    bank.predict();
+    reference.predict();
+    ExpectNear(bank.bbox(reused), reference.bbox());
+}
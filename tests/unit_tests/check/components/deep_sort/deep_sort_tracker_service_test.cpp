@@ -0,0 +1,153 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "deep_sort_tracker.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace DeepSortWrapper;
+
+namespace {
+
+constexpr auto LONG_TIMEOUT = std::chrono::seconds(5);
+
+// Tracker of a stream sharing the service, frames without detections are tracked on own thread
+class Stream {
+  public:
+    Stream(const std::shared_ptr<DeepSortTrackerService> &service, std::chrono::milliseconds batch_timeout)
+        : service_(service), tracker_(DEFAULT_MAX_IOU_DISTANCE, DEFAULT_MAX_AGE, DEFAULT_N_INIT,
+                                      DEFAULT_MAX_COSINE_DISTANCE, DEFAULT_NN_BUDGET,
+                                      "batch_timeout=" + std::to_string(batch_timeout.count()), nullptr, service) {
+    }
+
+    ~Stream() {
+        if (thread_.joinable())
+            thread_.join();
+    }
+
+    // Tracks frame on the stream's thread, the future is ready once the frame is tracked
+    std::future<void> submit() {
+        if (thread_.joinable())
+            thread_.join();
+        auto done = std::make_shared<std::promise<void>>();
+        auto future = done->get_future();
+        thread_ = std::thread([this, done] {
+            service_->track(tracker_);
+            done->set_value();
+        });
+        return future;
+    }
+
+    // Tracks frame on the calling thread
+    void track() {
+        service_->track(tracker_);
+    }
+
+    DeepSortTracker &tracker() {
+        return tracker_;
+    }
+
+  private:
+    std::shared_ptr<DeepSortTrackerService> service_;
+    DeepSortTracker tracker_;
+    std::thread thread_;
+};
+
+bool Ready(std::future<void> &future, std::chrono::milliseconds wait = std::chrono::milliseconds(0)) {
+    return future.wait_for(wait) == std::future_status::ready;
+}
+
+// Both streams track a frame, so the service waits for them
+void Activate(Stream &first, Stream &second) {
+    first.submit().wait();
+    auto second_frame = second.submit();
+    ASSERT_FALSE(Ready(second_frame, std::chrono::milliseconds(200))) << "frame doesn't wait for active stream";
+    first.submit().wait();
+    ASSERT_TRUE(Ready(second_frame, LONG_TIMEOUT));
+}
+
+template <typename Function>
+std::chrono::milliseconds Measure(Function &&function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+}
+
+} // namespace
+
+TEST(DeepSortTrackerServiceTest, FrameWaitsForOtherActiveStream) {
+    auto service = DeepSortTrackerService::get("barrier");
+    Stream first(service, LONG_TIMEOUT);
+    Stream second(service, LONG_TIMEOUT);
+
+    // first frame of a stream which hasn't started yet is not held
+    auto first_frame = first.submit();
+    ASSERT_TRUE(Ready(first_frame, LONG_TIMEOUT));
+
+    // both streams are active now, so a frame of one waits for the other one
+    auto second_frame = second.submit();
+    EXPECT_FALSE(Ready(second_frame, std::chrono::milliseconds(200)));
+
+    first_frame = first.submit();
+    EXPECT_TRUE(Ready(first_frame, LONG_TIMEOUT));
+    EXPECT_TRUE(Ready(second_frame, LONG_TIMEOUT));
+}
+
+TEST(DeepSortTrackerServiceTest, StoppedStreamIsNotWaitedFor) {
+    auto service = DeepSortTrackerService::get("stopped");
+    Stream first(service, LONG_TIMEOUT);
+    Stream second(service, LONG_TIMEOUT);
+    Activate(first, second);
+
+    // waiting frame is released by EOS of the other stream
+    auto second_frame = second.submit();
+    EXPECT_FALSE(Ready(second_frame, std::chrono::milliseconds(200)));
+    first.tracker().stream_stopped();
+    EXPECT_TRUE(Ready(second_frame, LONG_TIMEOUT));
+
+    // and further frames are not held until the stream restarts
+    second_frame = second.submit();
+    EXPECT_TRUE(Ready(second_frame, LONG_TIMEOUT / 2));
+}
+
+TEST(DeepSortTrackerServiceTest, StreamMissingBatchIsNotWaitedForUntilItsNextFrame) {
+    constexpr auto timeout = std::chrono::milliseconds(500);
+    auto service = DeepSortTrackerService::get("stalled");
+    Stream first(service, timeout);
+    Stream second(service, timeout);
+    Activate(first, second);
+
+    // second stream stalls: one batch timeout for the first stream, then no wait
+    EXPECT_GE(Measure([&] { first.submit().wait(); }), timeout);
+    EXPECT_LT(Measure([&] { first.submit().wait(); }), timeout);
+}
+
+TEST(DeepSortTrackerServiceTest, StreamsOnSameThreadDoNotWaitForEachOther) {
+    auto service = DeepSortTrackerService::get("tee");
+    Stream first(service, LONG_TIMEOUT);
+    Stream second(service, LONG_TIMEOUT);
+
+    // tee branches without queues track frames one after another on the streaming thread
+    const auto elapsed = Measure([&] {
+        for (int frame = 0; frame < 10; frame++) {
+            first.track();
+            second.track();
+        }
+    });
+    EXPECT_LT(elapsed, LONG_TIMEOUT);
+}
+
+TEST(DeepSortTrackerServiceTest, ServiceIsSharedByInstanceId) {
+    auto service = DeepSortTrackerService::get("shared");
+    EXPECT_EQ(DeepSortTrackerService::get("shared"), service);
+    EXPECT_NE(DeepSortTrackerService::get("other"), service);
+}
@@ -0,0 +1,253 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "deep_sort_tracker.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace DeepSortWrapper {
+
+/**
+ * Tracks detections of frames without regions and reads boxes of the tracks
+ */
+class DeepSortTrackerTest : public ::testing::Test {
+  protected:
+    static void Track(DeepSortTracker &tracker, const std::vector<cv::Rect_<float>> &boxes) {
+        for (const auto &bbox : boxes)
+            tracker.detections_.emplace_back(bbox, 1.0f, FEATURE);
+        tracker.track_detections();
+        tracker.detections_.clear();
+    }
+
+    static std::vector<cv::Rect_<float>> TrackBoxes(const DeepSortTracker &tracker) {
+        std::vector<cv::Rect_<float>> boxes;
+        for (const auto &track : tracker.tracks_)
+            boxes.push_back(track->to_bbox());
+        return boxes;
+    }
+
+    // Adds track initialized with the first feature and updated with the other ones
+    static Track &AddTrack(DeepSortTracker &tracker, const cv::Rect_<float> &bbox,
+                           const std::vector<std::vector<float>> &features) {
+        tracker.tracks_.push_back(std::make_unique<Track>(*tracker.kalman_bank_, bbox, tracker.next_id_++,
+                                                          tracker.n_init_, tracker.max_age_, tracker.nn_budget_,
+                                                          features.front()));
+        for (size_t i = 1; i < features.size(); i++)
+            tracker.tracks_.back()->add_feature(features[i]);
+        return *tracker.tracks_.back();
+    }
+
+    static cv::Mat_<float> CostMatrix(DeepSortTracker &tracker, const std::vector<Detection> &detections) {
+        return tracker.build_cost_matrix(detections);
+    }
+
+    // Same appearance in all frames, so detections are associated by boxes
+    static const std::vector<float> FEATURE;
+
+    // Boxes of an object moving right, overlapping enough to pass the IoU gate
+    const cv::Rect_<float> first{100.0f, 100.0f, 50.0f, 100.0f};
+    const cv::Rect_<float> second{105.0f, 100.0f, 50.0f, 100.0f};
+};
+
+const std::vector<float> DeepSortTrackerTest::FEATURE = {1.0f, 0.0f, 0.0f, 0.0f};
+
+namespace {
+
+void ExpectNear(const cv::Rect_<float> &actual, const cv::Rect_<float> &expected) {
+    const float tolerance = 1e-3f * std::max(1.0f, expected.height);
+    EXPECT_NEAR(actual.x, expected.x, tolerance);
+    EXPECT_NEAR(actual.y, expected.y, tolerance);
+    EXPECT_NEAR(actual.width, expected.width, tolerance);
+    EXPECT_NEAR(actual.height, expected.height, tolerance);
+}
+
+std::vector<float> Normalized(std::vector<float> feature) {
+    double norm = 0;
+    for (float value : feature)
+        norm += value * value;
+    for (float &value : feature)
+        value = static_cast<float>(value / std::sqrt(norm));
+    return feature;
+}
+
+std::vector<float> RandomFeature(std::mt19937 &rng, size_t dim) {
+    std::normal_distribution<float> distribution;
+    std::vector<float> feature(dim);
+    for (float &value : feature)
+        value = distribution(rng);
+    return Normalized(feature);
+}
+
+// Same feature with some noise, its cosine distance to the original one is about 0.1
+std::vector<float> NoisyFeature(std::mt19937 &rng, const std::vector<float> &feature) {
+    std::vector<float> noise = RandomFeature(rng, feature.size());
+    for (size_t i = 0; i < feature.size(); i++)
+        noise[i] = feature[i] + 0.5f * noise[i];
+    return Normalized(noise);
+}
+
+/**
+ * Cost of detection and track computed pair by pair from the last nn_budget features of the track, as in the
+ * original Deep SORT
+ */
+float ReferenceCost(const Detection &detection, const cv::Rect_<float> &track_bbox,
+                    const std::vector<std::vector<float>> &features, int nn_budget, float max_cosine_distance) {
+    const float intersection = (detection.bbox & track_bbox).area();
+    const float iou = intersection / (detection.bbox.area() + track_bbox.area() - intersection);
+    if (iou < DEFAULT_MAX_IOU_DISTANCE)
+        return LinearAssignmentSolver::FORBIDDEN;
+
+    const size_t first = features.size() - std::min(features.size(), static_cast<size_t>(nn_budget));
+    float min_cosine_distance = 1.0f;
+    for (size_t i = first; i < features.size(); i++) {
+        if (features[i].size() != detection.feature.size())
+            continue;
+        double dot = 0;
+        for (size_t k = 0; k < features[i].size(); k++)
+            dot += features[i][k] * detection.feature[k];
+        min_cosine_distance = std::min(min_cosine_distance, 1.0f - static_cast<float>(dot));
+    }
+    if (min_cosine_distance > max_cosine_distance)
+        return LinearAssignmentSolver::FORBIDDEN;
+
+    const float cost = 0.5f * (1.0f - iou) + 0.5f * min_cosine_distance;
+    return cost < MAX_ASSIGNMENT_COST ? cost : LinearAssignmentSolver::FORBIDDEN;
+}
+
+} // namespace
+
+TEST_F(DeepSortTrackerTest, OwnTrackerPredictsOnlyMatchedTracks) {
+    DeepSortTracker tracker;
+    KalmanBank reference;
+    const size_t slot = reference.add(first);
+
+    Track(tracker, {first});
+    ASSERT_EQ(TrackBoxes(tracker).size(), 1u);
+    ExpectNear(TrackBoxes(tracker)[0], first);
+
+    // matched track is predicted right before correction
+    Track(tracker, {second});
+    reference.schedule(slot);
+    reference.predict();
+    reference.update(slot, second);
+    ASSERT_EQ(TrackBoxes(tracker).size(), 1u);
+    const cv::Rect_<float> corrected = TrackBoxes(tracker)[0];
+    ExpectNear(corrected, reference.bbox(slot));
+    EXPECT_GT(corrected.x, first.x);
+
+    // unmatched track keeps its last corrected box
+    Track(tracker, {});
+    ASSERT_EQ(TrackBoxes(tracker).size(), 1u);
+    ExpectNear(TrackBoxes(tracker)[0], corrected);
+}
+
+TEST_F(DeepSortTrackerTest, ServiceTrackerPredictsAllTracksBeforeAssociation) {
+    DeepSortTracker tracker(DEFAULT_MAX_IOU_DISTANCE, DEFAULT_MAX_AGE, DEFAULT_N_INIT, DEFAULT_MAX_COSINE_DISTANCE,
+                            DEFAULT_NN_BUDGET, "", nullptr,
+                            DeepSortTrackerService::get("ServiceTrackerPredictsAllTracksBeforeAssociation"));
+    KalmanBank reference;
+    const size_t slot = reference.add(first);
+
+    Track(tracker, {first});
+    Track(tracker, {second});
+    reference.schedule(slot);
+    reference.predict();
+    reference.update(slot, second);
+    ASSERT_EQ(TrackBoxes(tracker).size(), 1u);
+    const cv::Rect_<float> corrected = TrackBoxes(tracker)[0];
+    ExpectNear(corrected, reference.bbox(slot));
+
+    // unmatched track moves on with its velocity
+    Track(tracker, {});
+    reference.schedule(slot);
+    reference.predict();
+    ASSERT_EQ(TrackBoxes(tracker).size(), 1u);
+    ExpectNear(TrackBoxes(tracker)[0], reference.bbox(slot));
+    EXPECT_GT(TrackBoxes(tracker)[0].x, corrected.x);
+}
+
+TEST_F(DeepSortTrackerTest, CostMatrixMatchesPerTrackDistances) {
+    constexpr int nn_budget = 3;
+    constexpr float max_cosine_distance = 0.3f;
+    // not a multiple of vectorized lanes of the dot product
+    constexpr size_t dim = 37;
+    DeepSortTracker tracker(DEFAULT_MAX_IOU_DISTANCE, DEFAULT_MAX_AGE, DEFAULT_N_INIT, max_cosine_distance, nn_budget);
+    std::mt19937 rng(7);
+
+    // 1, 3, 5 and 7 features were added to the tracks, first features of the last two are evicted from galleries
+    std::vector<std::vector<std::vector<float>>> track_features(4);
+    std::vector<Detection> detections;
+    for (size_t trk = 0; trk < track_features.size(); trk++) {
+        for (size_t i = 0; i < 2 * trk + 1; i++)
+            track_features[trk].push_back(RandomFeature(rng, dim));
+        const cv::Rect_<float> bbox(100.0f + 200.0f * trk, 100.0f, 60.0f, 120.0f);
+        AddTrack(tracker, bbox, track_features[trk]);
+
+        // shifted boxes pass IoU gate except the last one
+        const std::vector<float> shifts = {0.0f, 2.0f, 5.0f, 8.0f, 30.0f};
+        for (size_t i = 0; i < track_features[trk].size(); i++) {
+            for (float shift : shifts)
+                detections.emplace_back(bbox + cv::Point_<float>(shift, 0.0f), 1.0f,
+                                        NoisyFeature(rng, track_features[trk][i]));
+        }
+        // unknown appearance, no feature and feature of other size
+        detections.emplace_back(bbox, 1.0f, RandomFeature(rng, dim));
+        detections.emplace_back(bbox, 1.0f, std::vector<float>());
+        detections.emplace_back(bbox, 1.0f, RandomFeature(rng, dim / 2));
+    }
+
+    const cv::Mat_<float> cost_matrix = CostMatrix(tracker, detections);
+    ASSERT_EQ(cost_matrix.rows, static_cast<int>(detections.size()));
+    ASSERT_EQ(cost_matrix.cols, static_cast<int>(track_features.size()));
+    int allowed = 0;
+    for (size_t trk = 0; trk < track_features.size(); trk++) {
+        const cv::Rect_<float> track_bbox = tracker.tracks_[trk]->to_bbox();
+        for (size_t det = 0; det < detections.size(); det++) {
+            SCOPED_TRACE(::testing::Message() << "Detection " << det << ", track " << trk);
+            const float expected =
+                ReferenceCost(detections[det], track_bbox, track_features[trk], nn_budget, max_cosine_distance);
+            if (expected == LinearAssignmentSolver::FORBIDDEN) {
+                EXPECT_EQ(cost_matrix(det, trk), LinearAssignmentSolver::FORBIDDEN);
+            } else {
+                EXPECT_NEAR(cost_matrix(det, trk), expected, 1e-5f);
+                allowed++;
+            }
+        }
+    }
+    // detections of 1 + 3 + 3 + 3 features kept in galleries match their tracks when shifted by up to 8 pixels
+    EXPECT_EQ(allowed, 10 * 4);
+}
+
+TEST_F(DeepSortTrackerTest, EvictedFeaturesAreNotCompared) {
+    DeepSortTracker tracker(DEFAULT_MAX_IOU_DISTANCE, DEFAULT_MAX_AGE, DEFAULT_N_INIT, DEFAULT_MAX_COSINE_DISTANCE, 2);
+    const std::vector<std::vector<float>> basis = {{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}};
+    Track &track = AddTrack(tracker, first, basis);
+    EXPECT_EQ(track.features().size(), 2u);
+    EXPECT_EQ(track.features().dim(), 4u);
+
+    const std::vector<Detection> detections = {{first, 1.0f, basis[0]}, {first, 1.0f, basis[1]},
+                                               {first, 1.0f, basis[2]}};
+    const cv::Mat_<float> cost_matrix = CostMatrix(tracker, detections);
+    EXPECT_EQ(cost_matrix(0, 0), LinearAssignmentSolver::FORBIDDEN);
+    EXPECT_NEAR(cost_matrix(1, 0), 0.0f, 1e-5f);
+    EXPECT_NEAR(cost_matrix(2, 0), 0.0f, 1e-5f);
+
+    // feature of other size restarts the gallery
+    track.add_feature({0, 0, 0, 0, 1});
+    EXPECT_EQ(track.features().size(), 1u);
+    EXPECT_EQ(track.features().dim(), 5u);
+    const cv::Mat_<float> restarted = CostMatrix(tracker, {{first, 1.0f, basis[2]}, {first, 1.0f, {0, 0, 0, 0, 1}}});
+    EXPECT_EQ(restarted(0, 0), LinearAssignmentSolver::FORBIDDEN);
+    EXPECT_NEAR(restarted(1, 0), 0.0f, 1e-5f);
+}
+
+} // namespace DeepSortWrapper
@@ -0,0 +1,171 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "frame_admission.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+// Time a waiting thread is expected to stay blocked
+constexpr auto BLOCKED_FOR = std::chrono::milliseconds(50);
+
+FrameAdmission make_admission(size_t max_frames_in_flight, bool latency_policy) {
+    FrameAdmission admission;
+    admission.max_frames_in_flight = max_frames_in_flight;
+    admission.latency_policy = latency_policy;
+    return admission;
+}
+
+} // namespace
+
+TEST(FrameAdmissionTest, MaxFramesInFlightByPolicy) {
+    // configured limit is used with both policies
+    EXPECT_EQ(FrameAdmission::MaxFramesInFlight(5, false, 4, 8, 1), 5u);
+    EXPECT_EQ(FrameAdmission::MaxFramesInFlight(5, true, 4, 8, 1), 5u);
+    // throughput policy does not limit frames
+    EXPECT_EQ(FrameAdmission::MaxFramesInFlight(0, false, 4, 8, 1), 0u);
+    // latency policy fills all requests, skipped frames included, and one more
+    EXPECT_EQ(FrameAdmission::MaxFramesInFlight(0, true, 4, 8, 1), 33u);
+    EXPECT_EQ(FrameAdmission::MaxFramesInFlight(0, true, 2, 1, 3), 7u);
+}
+
+TEST(FrameAdmissionTest, BlockedDownstreamIsNotAdmitted) {
+    auto no_pts = []() -> uint64_t { return 0; };
+    EXPECT_FALSE(make_admission(0, false).CanAdmit(true, 0, 0, no_pts));
+    EXPECT_FALSE(make_admission(0, true).CanAdmit(true, 0, 0, no_pts));
+    EXPECT_FALSE(make_admission(8, true).CanAdmit(true, 1, 0, no_pts));
+}
+
+TEST(FrameAdmissionTest, FramesBelowLimitAreAdmitted) {
+    int latest_pts_calls = 0;
+    auto latest_pts = [&]() -> uint64_t {
+        latest_pts_calls++;
+        return 0;
+    };
+    EXPECT_TRUE(make_admission(0, false).CanAdmit(false, 1000, 100, latest_pts));
+    EXPECT_TRUE(make_admission(4, false).CanAdmit(false, 3, 100, latest_pts));
+    EXPECT_TRUE(make_admission(4, true).CanAdmit(false, 3, 100, latest_pts));
+    // presentation times of queued frames are looked up only at the limit
+    EXPECT_EQ(latest_pts_calls, 0);
+}
+
+TEST(FrameAdmissionTest, ThroughputPolicyWaitsAtLimit) {
+    auto latest_pts = []() -> uint64_t { return 1000; };
+    EXPECT_FALSE(make_admission(4, false).CanAdmit(false, 4, 100, latest_pts));
+    EXPECT_FALSE(make_admission(4, false).CanAdmit(false, 5, 100, latest_pts));
+}
+
+TEST(FrameAdmissionTest, LatencyPolicyAdmitsEarlierFramesAtLimit) {
+    auto latest_pts = []() -> uint64_t { return 1000; };
+    const FrameAdmission admission = make_admission(4, true);
+    EXPECT_TRUE(admission.CanAdmit(false, 4, 999, latest_pts));
+    EXPECT_TRUE(admission.CanAdmit(false, 4, 1000, latest_pts));
+    EXPECT_FALSE(admission.CanAdmit(false, 4, 1001, latest_pts));
+    // frame without presentation time waits
+    EXPECT_FALSE(admission.CanAdmit(false, 4, UINT64_MAX, latest_pts));
+}
+
+TEST(FrameAdmissionTest, AdmittedFrameDoesNotReleaseLocks) {
+    std::mutex mutex, output_mutex;
+    std::condition_variable cv;
+    std::unique_lock<std::mutex> lock(mutex);
+    std::unique_lock<std::mutex> output_lock(output_mutex);
+    int checks = 0;
+    WaitForAdmission(lock, output_lock, cv, [&] {
+        checks++;
+        return true;
+    });
+    EXPECT_EQ(checks, 1);
+    EXPECT_TRUE(lock.owns_lock());
+    EXPECT_TRUE(output_lock.owns_lock());
+}
+
+TEST(FrameAdmissionTest, WaitReleasesInstanceLockUntilFrameLeaves) {
+    std::mutex mutex, output_mutex;
+    std::condition_variable cv;
+    const FrameAdmission admission = make_admission(2, false);
+    size_t frames_in_flight = 2; // guarded by output_mutex
+    std::atomic<bool> admitted{false};
+
+    std::thread streaming([&] {
+        std::unique_lock<std::mutex> lock(mutex);
+        std::unique_lock<std::mutex> output_lock(output_mutex);
+        WaitForAdmission(lock, output_lock, cv, [&] {
+            return admission.CanAdmit(false, frames_in_flight, 0, []() -> uint64_t { return 0; });
+        });
+        EXPECT_TRUE(lock.owns_lock());
+        EXPECT_TRUE(output_lock.owns_lock());
+        frames_in_flight++;
+        admitted = true;
+    });
+
+    std::this_thread::sleep_for(BLOCKED_FOR);
+    EXPECT_FALSE(admitted);
+    {
+        // other streams are not blocked on the instance lock meanwhile
+        std::unique_lock<std::mutex> lock(mutex, std::try_to_lock);
+        EXPECT_TRUE(lock.owns_lock());
+        // notification without a frame leaving does not admit
+        std::lock_guard<std::mutex> output_lock(output_mutex);
+        cv.notify_all();
+    }
+    std::this_thread::sleep_for(BLOCKED_FOR);
+    EXPECT_FALSE(admitted);
+
+    {
+        std::lock_guard<std::mutex> output_lock(output_mutex);
+        frames_in_flight--;
+        cv.notify_all();
+    }
+    streaming.join();
+    EXPECT_TRUE(admitted);
+    EXPECT_EQ(frames_in_flight, 2u);
+}
+
+TEST(FrameAdmissionTest, ConditionIsCheckedAgainAfterInstanceLockIsTaken) {
+    std::mutex mutex, output_mutex;
+    std::condition_variable cv;
+    bool can_admit = false; // guarded by output_mutex
+    std::atomic<bool> admitted{false};
+
+    std::unique_lock<std::mutex> instance_lock(mutex, std::defer_lock);
+    std::thread streaming([&] {
+        std::unique_lock<std::mutex> lock(mutex);
+        std::unique_lock<std::mutex> output_lock(output_mutex);
+        WaitForAdmission(lock, output_lock, cv, [&] { return can_admit; });
+        admitted = true;
+    });
+
+    std::this_thread::sleep_for(BLOCKED_FOR);
+    // the slot is taken back while the waiter is woken up and waits for the instance lock
+    instance_lock.lock();
+    {
+        std::lock_guard<std::mutex> output_lock(output_mutex);
+        can_admit = true;
+        cv.notify_all();
+    }
+    std::this_thread::sleep_for(BLOCKED_FOR);
+    {
+        std::lock_guard<std::mutex> output_lock(output_mutex);
+        can_admit = false;
+    }
+    instance_lock.unlock();
+    std::this_thread::sleep_for(BLOCKED_FOR);
+    EXPECT_FALSE(admitted);
+
+    {
+        std::lock_guard<std::mutex> output_lock(output_mutex);
+        can_admit = true;
+        cv.notify_all();
+    }
+    streaming.join();
+    EXPECT_TRUE(admitted);
+}
@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "label_atlas.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/imgproc.hpp>
+
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Font {
+    int fonttype;
+    double fontscale;
+    int thick;
+};
+
+const std::vector<Font> FONTS = {
+    {cv::FONT_HERSHEY_SIMPLEX, 0.5, 1},
+    {cv::FONT_HERSHEY_TRIPLEX, 1.0, 2},
+    {cv::FONT_HERSHEY_COMPLEX | cv::FONT_ITALIC, 1.5, 3},
+    {cv::FONT_HERSHEY_SCRIPT_COMPLEX | cv::FONT_ITALIC, 2.0, 5},
+    {cv::FONT_HERSHEY_PLAIN, 3.0, 9},
+};
+
+// Glyphs above cap line and below base line of the font
+const std::vector<std::string> TEXTS = {"person 0.97", "{Wjg|}", "([@$_])", "A"};
+
+cv::Mat random_plane(int type) {
+    cv::Mat plane(120, 160, type);
+    cv::randu(plane, cv::Scalar::all(0), cv::Scalar::all(256));
+    return plane;
+}
+
+// Origins inside the plane and near its borders, so text is clipped by any side
+std::vector<cv::Point> origins(const cv::Mat &plane) {
+    return {{10, 60}, {-20, 10}, {plane.cols - 30, plane.rows - 3}, {5, plane.rows + 5}};
+}
+
+// cv::putText on a plane bordered enough to draw the text unclipped. Lines clipped by cv::putText at the plane border
+// may be rasterized a pixel off, while the mask is clipped after rasterization.
+cv::Mat put_text(const cv::Mat &plane, const std::string &text, cv::Point origin, const Font &font,
+                 const cv::Scalar &color) {
+    constexpr int border = 200;
+    cv::Mat bordered;
+    cv::copyMakeBorder(plane, bordered, border, border, border, border, cv::BORDER_CONSTANT);
+    cv::putText(bordered, text, origin + cv::Point(border, border), font.fonttype, font.fontscale, color, font.thick);
+    return bordered(cv::Rect(border, border, plane.cols, plane.rows)).clone();
+}
+
+void expect_same_as_put_text(int type, const cv::Scalar &color) {
+    const cv::Mat background = random_plane(type);
+    LabelAtlas atlas;
+    for (const Font &font : FONTS) {
+        for (const std::string &text : TEXTS) {
+            for (const cv::Point &origin : origins(background)) {
+                const cv::Mat expected = put_text(background, text, origin, font, color);
+                cv::Mat plane = background.clone();
+                const auto label =
+                    atlas.get(render::Text(text, origin, font.fonttype, font.fontscale, color, font.thick));
+                blend_mask(plane, label->luma, origin, color);
+                ASSERT_EQ(cv::norm(plane, expected, cv::NORM_INF), 0.0)
+                    << "'" << text << "' font " << font.fonttype << " scale " << font.fontscale << " thickness "
+                    << font.thick << " at " << origin;
+            }
+        }
+    }
+}
+
+} // namespace
+
+TEST(LabelAtlasTest, BlendedMaskMatchesPutTextOnPlane) {
+    expect_same_as_put_text(CV_8UC1, cv::Scalar(200));
+}
+
+TEST(LabelAtlasTest, BlendedMaskMatchesPutTextOnInterleavedPlane) {
+    expect_same_as_put_text(CV_8UC2, cv::Scalar(40, 220));
+}
+
+TEST(LabelAtlasTest, MasksAreCroppedToDrawnPixels) {
+    LabelAtlas atlas;
+    for (const Font &font : FONTS) {
+        for (const std::string &text : TEXTS) {
+            const auto label =
+                atlas.get(render::Text(text, {}, font.fonttype, font.fontscale, cv::Scalar(255), font.thick));
+            int baseline = 0;
+            EXPECT_EQ(label->text_size, cv::getTextSize(text, font.fonttype, font.fontscale, font.thick, &baseline));
+            EXPECT_EQ(label->baseline, baseline);
+            for (const TextMask *mask : {&label->luma, &label->chroma}) {
+                const cv::Mat &alpha = mask->alpha;
+                ASSERT_FALSE(alpha.empty()) << text;
+                EXPECT_GT(cv::countNonZero(alpha.row(0)), 0) << text;
+                EXPECT_GT(cv::countNonZero(alpha.row(alpha.rows - 1)), 0) << text;
+                EXPECT_GT(cv::countNonZero(alpha.col(0)), 0) << text;
+                EXPECT_GT(cv::countNonZero(alpha.col(alpha.cols - 1)), 0) << text;
+            }
+        }
+    }
+}
+
+TEST(LabelAtlasTest, TextWithoutGlyphsLeavesPlaneUnchanged) {
+    const cv::Mat background = random_plane(CV_8UC1);
+    LabelAtlas atlas;
+    const auto label = atlas.get(render::Text("   ", {}, cv::FONT_HERSHEY_SIMPLEX, 1.0, cv::Scalar(255), 2));
+    EXPECT_TRUE(label->luma.alpha.empty());
+    EXPECT_TRUE(label->chroma.alpha.empty());
+
+    cv::Mat plane = background.clone();
+    blend_mask(plane, label->luma, {20, 50}, cv::Scalar(255));
+    EXPECT_EQ(cv::norm(plane, background, cv::NORM_INF), 0.0);
+}
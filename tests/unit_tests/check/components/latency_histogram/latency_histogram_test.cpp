@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "latency_histogram.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Largest relative width of a bucket above the sub-bucket range
+constexpr double MAX_RELATIVE_ERROR = 1.0 / LatencyHistogram::SUB_BUCKET_HALF;
+
+std::vector<uint64_t> random_latencies(size_t count, unsigned seed) {
+    // Log-uniform from 10 ns to 10 s, as latencies of a pipeline spread over orders of magnitude
+    std::mt19937_64 generator(seed);
+    std::uniform_real_distribution<double> exponent(1.0, 10.0);
+    std::vector<uint64_t> values(count);
+    for (auto &value : values)
+        value = static_cast<uint64_t>(std::pow(10.0, exponent(generator)));
+    return values;
+}
+
+} // namespace
+
+TEST(LatencyHistogramTest, BucketsCoverValuesWithBoundedError) {
+    size_t previous_index = 0;
+    for (uint64_t value = 0; value < (1ull << 20); value += 1 + value / 256) {
+        const size_t index = LatencyHistogram::bucket_index(value);
+        ASSERT_LT(index, LatencyHistogram::BUCKET_COUNT);
+        ASSERT_GE(index, previous_index);
+        EXPECT_LE(LatencyHistogram::bucket_lowest_value(index), value);
+        EXPECT_GE(LatencyHistogram::bucket_highest_value(index), value);
+        const uint64_t width =
+            LatencyHistogram::bucket_highest_value(index) - LatencyHistogram::bucket_lowest_value(index);
+        EXPECT_LE(width, std::max<uint64_t>(1, value) * MAX_RELATIVE_ERROR) << value;
+        previous_index = index;
+    }
+    EXPECT_EQ(LatencyHistogram::bucket_index(LatencyHistogram::MAX_VALUE), LatencyHistogram::BUCKET_COUNT - 1);
+    EXPECT_EQ(LatencyHistogram::bucket_index(UINT64_MAX), LatencyHistogram::BUCKET_COUNT - 1);
+}
+
+TEST(LatencyHistogramTest, PercentilesMatchSortedValues) {
+    std::vector<uint64_t> values = random_latencies(100000, 1);
+    LatencyHistogram histogram;
+    for (uint64_t value : values)
+        histogram.record(value);
+    std::sort(values.begin(), values.end());
+
+    EXPECT_EQ(histogram.count(), values.size());
+    EXPECT_EQ(histogram.min(), values.front());
+    EXPECT_EQ(histogram.max(), values.back());
+    for (double percentile : {0.0, 1.0, 10.0, 50.0, 90.0, 99.0, 99.9, 99.99, 100.0}) {
+        const size_t rank = std::max<size_t>(1, static_cast<size_t>(percentile / 100.0 * values.size() + 0.5));
+        const uint64_t exact = values[rank - 1];
+        // Highest value equivalent to the exact one is reported
+        const uint64_t reported = histogram.value_at_percentile(percentile);
+        EXPECT_GE(reported, exact) << percentile;
+        EXPECT_LE(reported, exact + exact * MAX_RELATIVE_ERROR) << percentile;
+    }
+}
+
+TEST(LatencyHistogramTest, EmptyAndMergedHistograms) {
+    LatencyHistogram empty;
+    EXPECT_EQ(empty.count(), 0u);
+    EXPECT_EQ(empty.min(), 0u);
+    EXPECT_EQ(empty.max(), 0u);
+    EXPECT_EQ(empty.mean(), 0.0);
+    EXPECT_EQ(empty.value_at_percentile(50), 0u);
+
+    LatencyHistogram first, second;
+    for (uint64_t value : {100, 200, 300})
+        first.record(value);
+    for (uint64_t value : {50, 1000})
+        second.record(value);
+    first.add(second);
+    first.add(empty);
+    EXPECT_EQ(first.count(), 5u);
+    EXPECT_EQ(first.min(), 50u);
+    EXPECT_EQ(first.max(), 1000u);
+    EXPECT_DOUBLE_EQ(first.mean(), 330.0);
+}
+
+TEST(ConcurrentLatencyHistogramTest, CollectsValuesOfAllThreads) {
+    constexpr size_t threads_num = 8;
+    const std::vector<uint64_t> values = random_latencies(20000, 2);
+    LatencyHistogram expected;
+    for (size_t i = 0; i < threads_num; i++) {
+        for (uint64_t value : values)
+            expected.record(value);
+    }
+
+    ConcurrentLatencyHistogram recorder;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threads_num; i++) {
+        threads.emplace_back([&] {
+            for (uint64_t value : values)
+                recorder.record(value);
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    const LatencyHistogram collected = recorder.collect();
+    EXPECT_EQ(collected.count(), expected.count());
+    EXPECT_EQ(collected.min(), expected.min());
+    EXPECT_EQ(collected.max(), expected.max());
+    EXPECT_DOUBLE_EQ(collected.mean(), expected.mean());
+    for (size_t i = 0; i < LatencyHistogram::BUCKET_COUNT; i++)
+        ASSERT_EQ(collected.bucket_count(i), expected.bucket_count(i)) << i;
+
+    // Values are moved out by collect
+    EXPECT_EQ(recorder.collect().count(), 0u);
+}
+
+TEST(ConcurrentLatencyHistogramTest, RecorderCreatedAfterDestroyedOneStartsEmpty) {
+    // Recorders are created and destroyed on the same thread, e.g. by pipeline restarts
+    for (uint64_t round = 1; round <= 100; round++) {
+        ConcurrentLatencyHistogram first;
+        ConcurrentLatencyHistogram second;
+        first.record(round);
+        second.record(round * 1000);
+        second.record(round * 1000);
+
+        const LatencyHistogram first_collected = first.collect();
+        EXPECT_EQ(first_collected.count(), 1u);
+        EXPECT_EQ(first_collected.max(), round);
+        const LatencyHistogram second_collected = second.collect();
+        EXPECT_EQ(second_collected.count(), 2u);
+        EXPECT_EQ(second_collected.min(), round * 1000);
+    }
+}
@@ -0,0 +1,218 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "hungarian_wrap.h"
+#include "linear_assignment.h"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr float UNASSIGNED_COST = 1.0f;
+
+// Total cost of assignment, negative if assignment is not valid
+double AssignmentCost(const std::vector<float> &cost, size_t rows, size_t cols, float unassigned_cost,
+                      const std::vector<int> &assignment) {
+    double total = 0;
+    std::vector<bool> used(cols, false);
+    for (size_t row = 0; row < rows; row++) {
+        const int col = assignment[row];
+        if (col < 0) {
+            total += unassigned_cost;
+            continue;
+        }
+        if (used[col] || !(cost[row * cols + col] < LinearAssignmentSolver::FORBIDDEN))
+            return -1;
+        used[col] = true;
+        total += cost[row * cols + col];
+    }
+    return total;
+}
+
+double BruteForceCost(const std::vector<float> &cost, size_t rows, size_t cols, float unassigned_cost) {
+    double best = INFINITY;
+    std::vector<bool> used(cols, false);
+    std::function<void(size_t, double)> search = [&](size_t row, double total) {
+        if (row == rows) {
+            best = std::min(best, total);
+            return;
+        }
+        search(row + 1, total + unassigned_cost);
+        for (size_t col = 0; col < cols; col++) {
+            if (used[col] || !(cost[row * cols + col] < LinearAssignmentSolver::FORBIDDEN))
+                continue;
+            used[col] = true;
+            search(row + 1, total + cost[row * cols + col]);
+            used[col] = false;
+        }
+    };
+    search(0, 0);
+    return best;
+}
+
+// Detections x tracks costs of moving objects: normalized distance gated at UNASSIGNED_COST
+struct Scene {
+    std::mt19937 rng;
+    std::vector<float> x, y;
+
+    Scene(size_t objects_num, unsigned seed) : rng(seed), x(objects_num), y(objects_num) {
+        std::uniform_real_distribution<float> position(0.f, 1920.f);
+        for (size_t i = 0; i < objects_num; i++) {
+            x[i] = position(rng);
+            y[i] = position(rng) * 0.5625f;
+        }
+    }
+
+    std::vector<float> NextFrameCosts() {
+        std::normal_distribution<float> motion(0.f, 3.f);
+        const size_t n = x.size();
+        std::vector<float> detection_x(n), detection_y(n);
+        for (size_t i = 0; i < n; i++) {
+            detection_x[i] = x[i] + motion(rng);
+            detection_y[i] = y[i] + motion(rng);
+        }
+        std::vector<float> cost(n * n);
+        for (size_t d = 0; d < n; d++) {
+            for (size_t t = 0; t < n; t++) {
+                const float distance = std::hypot(detection_x[d] - x[t], detection_y[d] - y[t]) / 40.f;
+                cost[d * n + t] = distance < UNASSIGNED_COST ? distance : LinearAssignmentSolver::FORBIDDEN;
+            }
+        }
+        x = detection_x;
+        y = detection_y;
+        return cost;
+    }
+};
+
+// HungarianAlgo solves square problem, rows are extended with "unassigned" columns as in ObjectsAssociator
+std::vector<int> SolveWithHungarian(const std::vector<float> &cost, size_t rows, size_t cols, float unassigned_cost) {
+    cv::Mat_<float> table(static_cast<int>(rows), static_cast<int>(cols + rows));
+    table = unassigned_cost + 1.0f;
+    for (size_t row = 0; row < rows; row++) {
+        for (size_t col = 0; col < cols; col++) {
+            if (cost[row * cols + col] < LinearAssignmentSolver::FORBIDDEN)
+                table(row, col) = cost[row * cols + col];
+        }
+        table(row, cols + row) = unassigned_cost;
+    }
+    cv::Mat_<uint8_t> assignment_table = vas::ot::HungarianAlgo(table).Solve();
+
+    std::vector<int> assignment(rows, -1);
+    for (size_t row = 0; row < rows; row++) {
+        for (size_t col = 0; col < cols; col++) {
+            if (assignment_table(row, col))
+                assignment[row] = col;
+        }
+    }
+    return assignment;
+}
+
+} // namespace
+
+TEST(LinearAssignmentTest, MatchesBruteForce) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> value(-1.f, 2.f);
+    LinearAssignmentSolver solver;
+    for (int i = 0; i < 3000; i++) {
+        const size_t rows = rng() % 7;
+        const size_t cols = rng() % 7;
+        std::vector<float> cost(rows * cols);
+        for (auto &c : cost)
+            c = rng() % 3 ? std::round(value(rng) * 4) / 4 : LinearAssignmentSolver::FORBIDDEN;
+        const float unassigned_cost = std::round(value(rng) * 4) / 4 + 1;
+        std::vector<float> prices(cols);
+        for (auto &p : prices)
+            p = std::round(value(rng) * 4) / 4;
+
+        const auto &assignment =
+            solver.solve(cost.data(), rows, cols, unassigned_cost, i % 2 ? prices.data() : nullptr);
+        EXPECT_NEAR(AssignmentCost(cost, rows, cols, unassigned_cost, assignment),
+                    BruteForceCost(cost, rows, cols, unassigned_cost), 1e-5)
+            << "iteration " << i;
+    }
+}
+
+TEST(LinearAssignmentTest, UnassignedCostLimitsAssignment) {
+    // 0 -> 0 is cheaper alone, but assigning 1 -> 0 and leaving 0 unassigned costs less in total
+    const std::vector<float> cost = {0.4f, LinearAssignmentSolver::FORBIDDEN, 0.1f, 0.9f};
+    LinearAssignmentSolver solver;
+    EXPECT_EQ(solver.solve(cost.data(), 2, 2, 0.5f), (std::vector<int>{-1, 0}));
+    EXPECT_EQ(solver.solve(cost.data(), 2, 2, 2.0f), (std::vector<int>{0, 1}));
+    EXPECT_EQ(solver.solve(cost.data(), 2, 0, 2.0f), (std::vector<int>{-1, -1}));
+    EXPECT_TRUE(solver.solve(cost.data(), 0, 2, 2.0f).empty());
+    EXPECT_THROW(solver.solve(cost.data(), 2, 2, LinearAssignmentSolver::FORBIDDEN), std::invalid_argument);
+}
+
+TEST(LinearAssignmentTest, MatchesHungarianWithWarmStart) {
+    constexpr size_t objects_num = 60;
+    Scene scene(objects_num, 1);
+    LinearAssignmentSolver solver;
+    std::vector<float> prices(objects_num, 0.f);
+    for (int frame = 0; frame < 10; frame++) {
+        const auto cost = scene.NextFrameCosts();
+        const double expected = AssignmentCost(cost, objects_num, objects_num, UNASSIGNED_COST,
+                                               SolveWithHungarian(cost, objects_num, objects_num, UNASSIGNED_COST));
+        const auto &assignment = solver.solve(cost.data(), objects_num, objects_num, UNASSIGNED_COST, prices.data());
+        // HungarianAlgo rounds costs to 1/1024
+        EXPECT_NEAR(AssignmentCost(cost, objects_num, objects_num, UNASSIGNED_COST, assignment), expected,
+                    objects_num / 1024.0)
+            << "frame " << frame;
+    }
+}
+
+// Micro-benchmark, run with --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*
+TEST(LinearAssignmentBenchmark, DISABLED_DenseScene) {
+    constexpr int frames = 10;
+    for (size_t objects_num : {100, 250, 500}) {
+        Scene scene(objects_num, 42);
+        std::vector<std::vector<float>> costs;
+        for (int frame = 0; frame < frames; frame++)
+            costs.push_back(scene.NextFrameCosts());
+
+        double hungarian_cost = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (const auto &cost : costs)
+            hungarian_cost += AssignmentCost(cost, objects_num, objects_num, UNASSIGNED_COST,
+                                             SolveWithHungarian(cost, objects_num, objects_num, UNASSIGNED_COST));
+        const std::chrono::duration<double, std::milli> hungarian_time = std::chrono::steady_clock::now() - start;
+
+        LinearAssignmentSolver solver;
+        double solver_cost = 0;
+        start = std::chrono::steady_clock::now();
+        for (const auto &cost : costs)
+            solver_cost += AssignmentCost(cost, objects_num, objects_num, UNASSIGNED_COST,
+                                          solver.solve(cost.data(), objects_num, objects_num, UNASSIGNED_COST));
+        const std::chrono::duration<double, std::milli> solver_time = std::chrono::steady_clock::now() - start;
+
+        std::vector<float> prices(objects_num, 0.f);
+        double warm_cost = 0;
+        start = std::chrono::steady_clock::now();
+        for (const auto &cost : costs)
+            warm_cost += AssignmentCost(cost, objects_num, objects_num, UNASSIGNED_COST,
+                                        solver.solve(cost.data(), objects_num, objects_num, UNASSIGNED_COST,
+                                                     prices.data()));
+        const std::chrono::duration<double, std::milli> warm_time = std::chrono::steady_clock::now() - start;
+
+        EXPECT_LE(solver_cost, hungarian_cost + frames * objects_num / 1024.0);
+        EXPECT_NEAR(warm_cost, solver_cost, 1e-3);
+        std::cout << objects_num << " objects: HungarianAlgo " << hungarian_time.count() / frames
+                  << " ms, LinearAssignmentSolver " << solver_time.count() / frames << " ms, warm start "
+                  << warm_time.count() / frames << " ms" << std::endl;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "Running Components::LinearAssignment from " << __FILE__ << std::endl;
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "partial_batch_deadline.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace std::chrono_literals;
+using Clock = std::chrono::steady_clock;
+
+/**
+ * Dispatcher thread recording when each deadline expired, as OpenVINOImageInference::BatchDispatcherFunction
+ */
+class Dispatcher {
+  public:
+    Dispatcher() : thread([this] { Run(); }) {
+    }
+
+    ~Dispatcher() {
+        Stop();
+    }
+
+    void Stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            deadline.Stop();
+        }
+        if (thread.joinable())
+            thread.join();
+    }
+
+    std::vector<Clock::time_point> Expired() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return expired;
+    }
+
+    std::mutex mutex;
+    PartialBatchDeadline deadline;
+
+  private:
+    void Run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (deadline.Wait(lock))
+            expired.push_back(Clock::now());
+    }
+
+    std::vector<Clock::time_point> expired;
+    std::thread thread;
+};
+
+} // namespace
+
+TEST(PartialBatchDeadlineTest, ExpiresAfterLatency) {
+    Dispatcher dispatcher;
+    const auto armed = Clock::now();
+    {
+        std::lock_guard<std::mutex> lock(dispatcher.mutex);
+        dispatcher.deadline.Arm(std::chrono::microseconds(30ms));
+    }
+    std::this_thread::sleep_for(150ms);
+    const auto expired = dispatcher.Expired();
+    ASSERT_EQ(expired.size(), 1u);
+    EXPECT_GE(expired[0] - armed, 30ms);
+}
+
+TEST(PartialBatchDeadlineTest, ArmedDeadlineIsKept) {
+    Dispatcher dispatcher;
+    const auto armed = Clock::now();
+    {
+        std::lock_guard<std::mutex> lock(dispatcher.mutex);
+        dispatcher.deadline.Arm(std::chrono::microseconds(50ms));
+    }
+    // next frames of the same batch do not postpone its deadline
+    for (int i = 0; i < 2; i++) {
+        std::this_thread::sleep_for(15ms);
+        std::lock_guard<std::mutex> lock(dispatcher.mutex);
+        dispatcher.deadline.Arm(std::chrono::microseconds(50ms));
+    }
+    std::this_thread::sleep_for(150ms);
+    const auto expired = dispatcher.Expired();
+    ASSERT_EQ(expired.size(), 1u);
+    EXPECT_LT(expired[0] - armed, 100ms);
+}
+
+TEST(PartialBatchDeadlineTest, DisarmedDeadlineDoesNotExpire) {
+    Dispatcher dispatcher;
+    {
+        std::lock_guard<std::mutex> lock(dispatcher.mutex);
+        dispatcher.deadline.Arm(std::chrono::microseconds(30ms));
+        // batch is filled and started by size
+        dispatcher.deadline.Disarm();
+    }
+    std::this_thread::sleep_for(100ms);
+    EXPECT_TRUE(dispatcher.Expired().empty());
+}
+
+TEST(PartialBatchDeadlineTest, DeadlineArmedAgainWhileWaitingIsWaitedFor) {
+    Dispatcher dispatcher;
+    {
+        std::lock_guard<std::mutex> lock(dispatcher.mutex);
+        dispatcher.deadline.Arm(std::chrono::microseconds(30ms));
+    }
+    std::this_thread::sleep_for(10ms);
+    Clock::time_point rearmed;
+    {
+        // batch is started by size and the next one gets its first frame
+        std::lock_guard<std::mutex> lock(dispatcher.mutex);
+        dispatcher.deadline.Disarm();
+        rearmed = Clock::now();
+        dispatcher.deadline.Arm(std::chrono::microseconds(60ms));
+    }
+    std::this_thread::sleep_for(200ms);
+    const auto expired = dispatcher.Expired();
+    ASSERT_EQ(expired.size(), 1u);
+    EXPECT_GE(expired[0] - rearmed, 60ms);
+}
+
+TEST(PartialBatchDeadlineTest, ExpiresForEachBatch) {
+    Dispatcher dispatcher;
+    for (int i = 0; i < 3; i++) {
+        {
+            std::lock_guard<std::mutex> lock(dispatcher.mutex);
+            dispatcher.deadline.Arm(std::chrono::microseconds(10ms));
+        }
+        std::this_thread::sleep_for(60ms);
+        EXPECT_EQ(dispatcher.Expired().size(), static_cast<size_t>(i + 1));
+    }
+}
+
+TEST(PartialBatchDeadlineTest, StopWakesUpWaitingDispatcher) {
+    Dispatcher dispatcher;
+    {
+        std::lock_guard<std::mutex> lock(dispatcher.mutex);
+        dispatcher.deadline.Arm(std::chrono::microseconds(10s));
+    }
+    const auto stop_start = Clock::now();
+    dispatcher.Stop();
+    EXPECT_LT(Clock::now() - stop_start, 1s);
+    EXPECT_TRUE(dispatcher.Expired().empty());
+}
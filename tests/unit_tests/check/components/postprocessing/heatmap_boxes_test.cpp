@@ -135,3 +135,39 @@ TEST_F(HeatMapBoxesConverterTest, CanCovert) {
         ASSERT_NEAR(confidence, 0.88393, 0.0001);
     }
 }
+
+TEST_F(HeatMapBoxesConverterTest, DetectionsMatchTensors) {
+    HeatMapBoxesConverter post_proc(CreateInitializer(), _confidence_threshold);
+    auto blob = GetTestBlob();
+    blob->SetDims(_output_dims);
+
+    OutputBlobs blobs_map{{"output_layer_name", blob}};
+    DetectionsTable detections = post_proc.convertToDetections(blobs_map);
+    TensorsTable tensors = post_proc.convert(blobs_map);
+
+    ASSERT_EQ(detections.detections.size(), tensors.size());
+    ASSERT_EQ(detections.tensors.size(), tensors.size());
+    ASSERT_EQ(detections.detections[0].size(), tensors[0].size());
+    for (size_t i = 0; i < tensors[0].size(); i++) {
+        const DetectionRecord &detection = detections.detections[0][i];
+        const GstStructure *bbox = tensors[0][i][DETECTION_TENSOR_ID];
+        EXPECT_TRUE(detections.tensors[0][i].empty());
+        EXPECT_STREQ(gst_structure_get_name(bbox), "detection");
+
+        double x_min, y_min, x_max, y_max, confidence;
+        int label_id;
+        gst_structure_get_double(bbox, "x_min", &x_min);
+        gst_structure_get_double(bbox, "x_max", &x_max);
+        gst_structure_get_double(bbox, "y_min", &y_min);
+        gst_structure_get_double(bbox, "y_max", &y_max);
+        gst_structure_get_double(bbox, "confidence", &confidence);
+        gst_structure_get_int(bbox, "label_id", &label_id);
+        EXPECT_DOUBLE_EQ(detection.x_min, x_min);
+        EXPECT_DOUBLE_EQ(detection.x_max, x_max);
+        EXPECT_DOUBLE_EQ(detection.y_min, y_min);
+        EXPECT_DOUBLE_EQ(detection.y_max, y_max);
+        EXPECT_DOUBLE_EQ(detection.confidence, confidence);
+        EXPECT_EQ(detection.label_id, label_id);
+        EXPECT_EQ(detection.label == 0, !gst_structure_has_field(bbox, "label"));
+    }
+}
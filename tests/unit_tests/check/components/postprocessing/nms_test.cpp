@@ -0,0 +1,155 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "common/post_processor/converters/to_roi/nms.h"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace post_processing;
+
+namespace {
+
+struct Candidate {
+    float x, y, w, h, confidence;
+    uint32_t label_id;
+    size_t index;
+};
+
+// Previous implementation of BlobToROIConverter::runNms: sort, then erase suppressed candidates
+std::vector<size_t> ReferenceNms(std::vector<Candidate> candidates, float iou_threshold, bool class_aware) {
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [](const Candidate &a, const Candidate &b) { return a.confidence > b.confidence; });
+    for (auto first = candidates.begin(); first != candidates.end(); ++first) {
+        for (auto other = first + 1; other != candidates.end();) {
+            const float inter_width = std::min(first->x + first->w, other->x + other->w) - std::max(first->x, other->x);
+            const float inter_height =
+                std::min(first->y + first->h, other->y + other->h) - std::max(first->y, other->y);
+            if (inter_width <= 0 || inter_height <= 0 || (class_aware && first->label_id != other->label_id)) {
+                ++other;
+                continue;
+            }
+            const float inter_area = inter_width * inter_height;
+            const float union_area = first->w * first->h + other->w * other->h - inter_area;
+            if (inter_area / union_area > iou_threshold)
+                other = candidates.erase(other);
+            else
+                ++other;
+        }
+    }
+    std::vector<size_t> kept;
+    for (const auto &candidate : candidates)
+        kept.push_back(candidate.index);
+    return kept;
+}
+
+// YOLOv8-like proposals: clusters of overlapping boxes around objects plus background noise
+std::vector<Candidate> GenerateProposals(size_t count, size_t objects_num, uint32_t classes, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> position(0.f, 600.f), size(8.f, 160.f), confidence(0.01f, 1.f);
+    std::normal_distribution<float> jitter(0.f, 4.f);
+
+    std::vector<Candidate> objects(objects_num);
+    for (auto &object : objects)
+        object = {position(rng), position(rng), size(rng), size(rng), 0.f, static_cast<uint32_t>(rng() % classes), 0};
+
+    std::vector<Candidate> proposals(count);
+    for (size_t i = 0; i < count; i++) {
+        if (i % 4 == 0) {
+            proposals[i] = {position(rng), position(rng), size(rng), size(rng), confidence(rng),
+                            static_cast<uint32_t>(rng() % classes), i};
+        } else {
+            const auto &object = objects[rng() % objects_num];
+            proposals[i] = {object.x + jitter(rng),  object.y + jitter(rng), object.w + jitter(rng),
+                            object.h + jitter(rng),  confidence(rng),        object.label_id,
+                            i};
+        }
+    }
+    return proposals;
+}
+
+std::vector<size_t> RunEngine(NmsEngine &nms, const std::vector<Candidate> &candidates,
+                              const NmsEngine::Options &options) {
+    nms.clear();
+    for (const auto &c : candidates)
+        nms.add(c.x, c.y, c.w, c.h, c.confidence, c.label_id);
+    return nms.run(options);
+}
+
+} // namespace
+
+TEST(NmsEngineTest, MatchesReferenceImplementation) {
+    NmsEngine nms;
+    for (unsigned seed = 0; seed < 20; seed++) {
+        const auto candidates = GenerateProposals(50 + seed * 37, 1 + seed % 7, 3, seed);
+        for (bool class_aware : {false, true}) {
+            NmsEngine::Options options;
+            options.iou_threshold = 0.45f;
+            options.class_aware = class_aware;
+            EXPECT_EQ(RunEngine(nms, candidates, options), ReferenceNms(candidates, 0.45f, class_aware))
+                << "seed " << seed << ", class_aware " << class_aware;
+        }
+    }
+}
+
+TEST(NmsEngineTest, ClassAwareKeepsOverlappingBoxesOfDifferentClasses) {
+    NmsEngine nms;
+    nms.add(10, 10, 100, 100, 0.9f, 0);
+    nms.add(12, 12, 100, 100, 0.8f, 1);
+    nms.add(11, 11, 100, 100, 0.7f, 0);
+
+    NmsEngine::Options options;
+    options.iou_threshold = 0.5f;
+    EXPECT_EQ(nms.run(options), (std::vector<size_t>{0}));
+
+    options.class_aware = true;
+    EXPECT_EQ(nms.run(options), (std::vector<size_t>{0, 1}));
+}
+
+TEST(NmsEngineTest, TopKLimitsCandidates) {
+    NmsEngine nms;
+    for (int i = 0; i < 100; i++)
+        nms.add(i * 20.f, 0, 10, 10, i / 100.f, 0); // no overlaps
+
+    NmsEngine::Options options;
+    options.top_k = 5;
+    EXPECT_EQ(nms.run(options), (std::vector<size_t>{99, 98, 97, 96, 95}));
+}
+
+TEST(NmsEngineTest, EmptyInput) {
+    NmsEngine nms;
+    EXPECT_TRUE(nms.run(NmsEngine::Options()).empty());
+}
+
+// Micro-benchmark, run with --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*
+TEST(NmsEngineBenchmark, DISABLED_YoloV8Proposals) {
+    constexpr int iterations = 20;
+    const auto candidates = GenerateProposals(8400, 40, 80, 42);
+    NmsEngine::Options options;
+    options.iou_threshold = 0.45f;
+
+    NmsEngine nms;
+    std::vector<size_t> kept;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+        kept = RunEngine(nms, candidates, options);
+    const std::chrono::duration<double, std::milli> engine_time = std::chrono::steady_clock::now() - start;
+
+    std::vector<size_t> reference_kept;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+        reference_kept = ReferenceNms(candidates, options.iou_threshold, false);
+    const std::chrono::duration<double, std::milli> reference_time = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(kept, reference_kept);
+    std::cout << candidates.size() << " candidates, " << kept.size() << " kept: NmsEngine "
+              << engine_time.count() / iterations << " ms, sort+erase " << reference_time.count() / iterations
+              << " ms" << std::endl;
+}
@@ -0,0 +1,301 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "common/post_processor/converters/to_roi/yolo_v8.h"
+#include <dlstreamer/gst/videoanalytics/tensor.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace InferenceBackend;
+using namespace post_processing;
+
+namespace {
+
+class VectorBlob : public OutputBlob {
+    std::vector<float> _data;
+    std::vector<size_t> _dims;
+
+  public:
+    VectorBlob(std::vector<float> data, std::vector<size_t> dims) : _data(std::move(data)), _dims(std::move(dims)) {
+    }
+
+    const std::vector<size_t> &GetDims() const override {
+        return _dims;
+    }
+
+    const void *GetData() const override {
+        return _data.data();
+    }
+
+    Layout GetLayout() const override {
+        return Layout::ANY;
+    }
+
+    Precision GetPrecision() const override {
+        return Precision::FP32;
+    }
+};
+
+// Segmentation mask of detected object: dims are {width, height}
+struct Mask {
+    std::vector<guint> dims;
+    GVA::Tensor::Precision precision;
+    std::vector<float> probabilities; // scaled to [0, 1] for U8 mask
+    cv::Mat mat;
+};
+
+} // namespace
+
+struct YOLOv8SegConverterTest : public testing::Test {
+  protected:
+    static constexpr size_t INPUT_SIZE = 64;
+    static constexpr size_t MASK_SIZE = INPUT_SIZE / 4;
+    static constexpr size_t CLASS_COUNT = 2;
+    static constexpr size_t MASK_COUNT = 3;
+    static constexpr size_t PROPOSAL_COUNT = 8;
+
+    OutputBlobs _blobs;
+
+    BlobToMetaConverter::Initializer CreateInitializer(const char *mask_precision, const char *mask_resolution) {
+        GstStructure *model_proc_output_info = gst_structure_new_empty("ANY");
+        if (mask_precision)
+            gst_structure_set(model_proc_output_info, "mask_precision", G_TYPE_STRING, mask_precision, NULL);
+        if (mask_resolution)
+            gst_structure_set(model_proc_output_info, "mask_resolution", G_TYPE_STRING, mask_resolution, NULL);
+
+        BlobToMetaConverter::Initializer initializer;
+        initializer.model_name = "yolo_v8_seg_test";
+        initializer.outputs_info = {{"boxes", _blobs["boxes"]->GetDims()}, {"masks", _blobs["masks"]->GetDims()}};
+        initializer.input_image_info.batch_size = 1;
+        initializer.input_image_info.width = INPUT_SIZE;
+        initializer.input_image_info.height = INPUT_SIZE;
+        initializer.model_proc_output_info = GstStructureUniquePtr(model_proc_output_info, gst_structure_free);
+        return initializer;
+    }
+
+    void SetUp() override {
+        std::mt19937 generator(7);
+        std::uniform_real_distribution<float> values(-4.0f, 4.0f);
+
+        std::vector<float> masks(MASK_COUNT * MASK_SIZE * MASK_SIZE);
+        for (float &value : masks)
+            value = values(generator);
+
+        // [1, 4 + classes + masks, proposals], two objects in different corners, other proposals have zero scores
+        const size_t object_size = 4 + CLASS_COUNT + MASK_COUNT;
+        std::vector<float> boxes(object_size * PROPOSAL_COUNT, 0.0f);
+        auto set = [&](size_t proposal, std::vector<float> channels) {
+            for (size_t c = 0; c < channels.size(); c++)
+                boxes[c * PROPOSAL_COUNT + proposal] = channels[c];
+            for (size_t m = 0; m < MASK_COUNT; m++)
+                boxes[(4 + CLASS_COUNT + m) * PROPOSAL_COUNT + proposal] = values(generator);
+        };
+        set(1, {24, 24, 16, 24, 0.9f, 0.1f});
+        set(5, {48, 42, 20, 12, 0.2f, 0.8f});
+
+        _blobs["boxes"] =
+            std::make_shared<VectorBlob>(std::move(boxes), std::vector<size_t>{1, object_size, PROPOSAL_COUNT});
+        _blobs["masks"] = std::make_shared<VectorBlob>(std::move(masks),
+                                                       std::vector<size_t>{1, MASK_COUNT, MASK_SIZE, MASK_SIZE});
+    }
+
+    std::vector<Mask> Convert(const char *mask_precision, const char *mask_resolution = nullptr) {
+        YOLOv8SegConverter converter(CreateInitializer(mask_precision, mask_resolution), 0.5, 0.5);
+        DetectionsTable detections = converter.convertToDetections(_blobs);
+
+        std::vector<Mask> masks;
+        for (const auto &tensors : detections.tensors.at(0)) {
+            EXPECT_EQ(tensors.size(), 1u);
+            GVA::Tensor tensor(tensors.at(0));
+            EXPECT_EQ(tensor.format(), "segmentation_mask");
+
+            Mask mask{tensor.dims(), tensor.precision(), {}, {}};
+            if (mask.precision == GVA::Tensor::Precision::U8) {
+                for (uint8_t value : tensor.data<uint8_t>())
+                    mask.probabilities.push_back(value / 255.0f);
+            } else {
+                mask.probabilities = tensor.data<float>();
+            }
+            mask.mat = cv::Mat(mask.dims.at(1), mask.dims.at(0), CV_32F, mask.probabilities.data());
+            EXPECT_EQ(mask.probabilities.size(), mask.mat.total());
+            masks.push_back(std::move(mask));
+        }
+        return masks;
+    }
+};
+
+TEST_F(YOLOv8SegConverterTest, U8MasksMatchFloatMasks) {
+    const std::vector<Mask> float_masks = Convert(nullptr);
+    const std::vector<Mask> u8_masks = Convert("U8");
+
+    ASSERT_EQ(float_masks.size(), 2u);
+    ASSERT_EQ(u8_masks.size(), float_masks.size());
+    for (size_t i = 0; i < float_masks.size(); i++) {
+        EXPECT_EQ(float_masks[i].precision, GVA::Tensor::Precision::FP32);
+        EXPECT_EQ(u8_masks[i].precision, GVA::Tensor::Precision::U8);
+        // masks stay at prototype resolution of the box crop
+        EXPECT_EQ(float_masks[i].dims, (std::vector<guint>{i == 0 ? 4u : 5u, i == 0 ? 6u : 3u}));
+        ASSERT_EQ(u8_masks[i].dims, float_masks[i].dims);
+        for (size_t j = 0; j < float_masks[i].probabilities.size(); j++)
+            EXPECT_NEAR(u8_masks[i].probabilities[j], float_masks[i].probabilities[j], 0.5f / 255 + 1e-6f);
+    }
+}
+
+TEST_F(YOLOv8SegConverterTest, BoxResolutionMasksAreResizedFloatMasks) {
+    const std::vector<Mask> prototype_masks = Convert("FP32", "prototype");
+    const std::vector<Mask> float_masks = Convert("FP32", "box");
+    const std::vector<Mask> u8_masks = Convert("U8", "box");
+
+    ASSERT_EQ(prototype_masks.size(), 2u);
+    ASSERT_EQ(float_masks.size(), prototype_masks.size());
+    ASSERT_EQ(u8_masks.size(), prototype_masks.size());
+    const std::vector<std::vector<guint>> box_sizes = {{16, 24}, {20, 12}};
+    for (size_t i = 0; i < prototype_masks.size(); i++) {
+        ASSERT_EQ(float_masks[i].dims, box_sizes[i]);
+        ASSERT_EQ(u8_masks[i].dims, box_sizes[i]);
+
+        cv::Mat expected;
+        cv::resize(prototype_masks[i].mat, expected, float_masks[i].mat.size(), 0, 0, cv::INTER_LINEAR);
+        EXPECT_LE(cv::norm(float_masks[i].mat, expected, cv::NORM_INF), 1e-6);
+        EXPECT_LE(cv::norm(u8_masks[i].mat, expected, cv::NORM_INF), 0.5 / 255 + 1e-6);
+    }
+}
+
+TEST_F(YOLOv8SegConverterTest, InvalidMaskFieldsInModelProc) {
+    EXPECT_THROW(YOLOv8SegConverter(CreateInitializer("FP16", nullptr), 0.5, 0.5), std::invalid_argument);
+    EXPECT_THROW(YOLOv8SegConverter(CreateInitializer(nullptr, "image"), 0.5, 0.5), std::invalid_argument);
+}
+
+namespace {
+
+// Previous implementation of YOLOv8Converter::parseOutputBlob: output is transposed to [N, C] and best class of each
+// proposal is found by cv::minMaxLoc
+std::vector<DetectionRecord> ReferenceDetections(const float *data, size_t object_size, size_t proposal_count,
+                                                 double confidence_threshold, bool oob, size_t input_width,
+                                                 size_t input_height) {
+    cv::Mat outputs(object_size, proposal_count, CV_32F, const_cast<float *>(data));
+    cv::transpose(outputs, outputs);
+
+    std::vector<DetectionRecord> detections;
+    for (size_t i = 0; i < proposal_count; ++i) {
+        const float *output_data = outputs.ptr<float>(i);
+        cv::Mat scores(1, object_size - YOLOV8_OFFSET_CS - (oob ? 1 : 0), CV_32FC1,
+                       const_cast<float *>(output_data + YOLOV8_OFFSET_CS));
+        cv::Point class_id;
+        double max_class_score;
+        cv::minMaxLoc(scores, 0, &max_class_score, 0, &class_id);
+        if (max_class_score > confidence_threshold) {
+            const double w = output_data[YOLOV8_OFFSET_W] / input_width;
+            const double h = output_data[YOLOV8_OFFSET_H] / input_height;
+            DetectionRecord detection;
+            detection.x_min = output_data[YOLOV8_OFFSET_X] / input_width - w / 2;
+            detection.y_min = output_data[YOLOV8_OFFSET_Y] / input_height - h / 2;
+            detection.x_max = detection.x_min + w;
+            detection.y_max = detection.y_min + h;
+            detection.rotation = oob ? output_data[object_size - 1] : 0;
+            detection.confidence = max_class_score;
+            detection.label_id = class_id.x;
+            detections.push_back(detection);
+        }
+    }
+    return detections;
+}
+
+void SortByConfidence(std::vector<DetectionRecord> &detections) {
+    std::sort(detections.begin(), detections.end(), [](const DetectionRecord &a, const DetectionRecord &b) {
+        return a.confidence != b.confidence ? a.confidence > b.confidence : a.x_min < b.x_min;
+    });
+}
+
+} // namespace
+
+struct YOLOv8ConverterTest : public testing::Test {
+  protected:
+    static constexpr size_t INPUT_SIZE = 640;
+    static constexpr size_t BATCH_SIZE = 2;
+    static constexpr size_t CLASS_COUNT = 5;
+    static constexpr size_t PROPOSAL_COUNT = 300;
+    static constexpr double CONFIDENCE_THRESHOLD = 0.5;
+
+    BlobToMetaConverter::Initializer CreateInitializer(const std::vector<size_t> &dims) {
+        BlobToMetaConverter::Initializer initializer;
+        initializer.model_name = "yolo_v8_test";
+        initializer.outputs_info = {{"output0", dims}};
+        initializer.input_image_info.batch_size = BATCH_SIZE;
+        initializer.input_image_info.width = INPUT_SIZE;
+        initializer.input_image_info.height = INPUT_SIZE;
+        initializer.model_proc_output_info = GstStructureUniquePtr(gst_structure_new_empty("ANY"), gst_structure_free);
+        return initializer;
+    }
+
+    // Synthetic [B, 4 + classes (+ angle), N] output, some proposals have several classes with the best score
+    static std::vector<float> CreateOutput(size_t object_size) {
+        std::mt19937 generator(11);
+        std::uniform_real_distribution<float> coordinates(0.0f, float(INPUT_SIZE));
+        std::uniform_real_distribution<float> scores(0.0f, 1.0f);
+
+        std::vector<float> output(BATCH_SIZE * object_size * PROPOSAL_COUNT);
+        for (size_t b = 0; b < BATCH_SIZE; b++) {
+            float *data = output.data() + b * object_size * PROPOSAL_COUNT;
+            for (size_t i = 0; i < PROPOSAL_COUNT; i++) {
+                for (size_t c = 0; c < object_size; c++)
+                    data[c * PROPOSAL_COUNT + i] = c < YOLOV8_OFFSET_CS ? coordinates(generator) : scores(generator);
+                if (i % 7 == 0) {
+                    const float best = 1.0f + 0.001f * i;
+                    data[(YOLOV8_OFFSET_CS + 1) * PROPOSAL_COUNT + i] = best;
+                    data[(YOLOV8_OFFSET_CS + 3) * PROPOSAL_COUNT + i] = best;
+                }
+            }
+        }
+        return output;
+    }
+
+    // Converts output with NMS disabled and compares all detections with the previous transpose path
+    template <typename Converter>
+    void ExpectReferenceDetections(size_t object_size, bool oob) {
+        const std::vector<size_t> dims = {BATCH_SIZE, object_size, PROPOSAL_COUNT};
+        const std::vector<float> output = CreateOutput(object_size);
+        OutputBlobs blobs{{"output0", std::make_shared<VectorBlob>(output, dims)}};
+
+        // IoU never exceeds 1, so no candidate is suppressed
+        Converter converter(CreateInitializer(dims), CONFIDENCE_THRESHOLD, 1.0);
+        DetectionsTable detections = converter.convertToDetections(blobs);
+        ASSERT_EQ(detections.detections.size(), BATCH_SIZE);
+
+        for (size_t b = 0; b < BATCH_SIZE; b++) {
+            SCOPED_TRACE(::testing::Message() << "Batch: " << b);
+            std::vector<DetectionRecord> expected =
+                ReferenceDetections(output.data() + b * object_size * PROPOSAL_COUNT, object_size, PROPOSAL_COUNT,
+                                    CONFIDENCE_THRESHOLD, oob, INPUT_SIZE, INPUT_SIZE);
+            std::vector<DetectionRecord> actual = detections.detections[b];
+            ASSERT_GT(expected.size(), PROPOSAL_COUNT / 4);
+            ASSERT_EQ(actual.size(), expected.size());
+            SortByConfidence(expected);
+            SortByConfidence(actual);
+            for (size_t i = 0; i < expected.size(); i++) {
+                EXPECT_EQ(actual[i].label_id, expected[i].label_id);
+                EXPECT_DOUBLE_EQ(actual[i].confidence, expected[i].confidence);
+                EXPECT_NEAR(actual[i].x_min, expected[i].x_min, 1e-6);
+                EXPECT_NEAR(actual[i].y_min, expected[i].y_min, 1e-6);
+                EXPECT_NEAR(actual[i].x_max, expected[i].x_max, 1e-6);
+                EXPECT_NEAR(actual[i].y_max, expected[i].y_max, 1e-6);
+                EXPECT_DOUBLE_EQ(actual[i].rotation, expected[i].rotation);
+            }
+        }
+    }
+};
+
+TEST_F(YOLOv8ConverterTest, DetectionsMatchTransposedScan) {
+    ExpectReferenceDetections<YOLOv8Converter>(YOLOV8_OFFSET_CS + CLASS_COUNT, false);
+}
+
+TEST_F(YOLOv8ConverterTest, OrientedDetectionsMatchTransposedScan) {
+    ExpectReferenceDetections<YOLOv8ObbConverter>(YOLOV8_OFFSET_CS + CLASS_COUNT + 1, true);
+}
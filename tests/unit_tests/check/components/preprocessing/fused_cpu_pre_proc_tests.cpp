@@ -0,0 +1,174 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "inference_backend/pre_proc.h"
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+using namespace InferenceBackend;
+
+namespace {
+
+constexpr uint32_t SRC_WIDTH = 194;
+constexpr uint32_t SRC_HEIGHT = 122;
+constexpr uint32_t DST_SIZE = 64;
+// Fused path converts samples with the same fixed-point arithmetic, only rounding of intermediate results differs
+constexpr int MAX_DIFF = 2;
+
+struct SourceImage {
+    std::vector<uint8_t> data;
+    Image image;
+};
+
+SourceImage CreateSourceImage(int format) {
+    SourceImage src;
+    src.image.type = MemoryType::SYSTEM;
+    src.image.format = format;
+    src.image.width = SRC_WIDTH;
+    src.image.height = SRC_HEIGHT;
+
+    switch (format) {
+    case FOURCC_NV12:
+        src.data.resize(SRC_WIDTH * SRC_HEIGHT * 3 / 2);
+        src.image.planes[0] = src.data.data();
+        src.image.planes[1] = src.data.data() + SRC_WIDTH * SRC_HEIGHT;
+        src.image.stride[0] = src.image.stride[1] = SRC_WIDTH;
+        break;
+    case FOURCC_I420:
+        src.data.resize(SRC_WIDTH * SRC_HEIGHT * 3 / 2);
+        src.image.planes[0] = src.data.data();
+        src.image.planes[1] = src.data.data() + SRC_WIDTH * SRC_HEIGHT;
+        src.image.planes[2] = src.image.planes[1] + SRC_WIDTH * SRC_HEIGHT / 4;
+        src.image.stride[0] = SRC_WIDTH;
+        src.image.stride[1] = src.image.stride[2] = SRC_WIDTH / 2;
+        break;
+    default:
+        src.data.resize(SRC_WIDTH * SRC_HEIGHT * 4);
+        src.image.planes[0] = src.data.data();
+        src.image.stride[0] = SRC_WIDTH * 4;
+        break;
+    }
+
+    // smooth gradient with some noise, so both interpolation and saturation are exercised
+    std::srand(42);
+    for (size_t i = 0; i < src.data.size(); i++)
+        src.data[i] = static_cast<uint8_t>((i * 7 / 5 + std::rand() % 32) % 256);
+    return src;
+}
+
+// Converts to FOURCC_RGBP for uint8_t samples and to FOURCC_RGBP_F32 for float samples
+template <typename T = uint8_t>
+std::vector<T> Convert(ImagePreprocessorType type, const Image &src, const InputImageLayerDesc::Ptr &desc,
+                       ImageTransformationParams::Ptr transform) {
+    std::vector<T> result(DST_SIZE * DST_SIZE * 3, static_cast<T>(0xAA));
+    Image dst;
+    dst.type = MemoryType::SYSTEM;
+    dst.format = std::is_same<T, float>::value ? FOURCC_RGBP_F32 : FOURCC_RGBP;
+    dst.width = DST_SIZE;
+    dst.height = DST_SIZE;
+    for (int i = 0; i < 3; i++) {
+        dst.planes[i] = reinterpret_cast<uint8_t *>(result.data() + i * DST_SIZE * DST_SIZE);
+        dst.stride[i] = DST_SIZE * sizeof(T);
+    }
+
+    std::unique_ptr<ImagePreprocessor> pre_proc(ImagePreprocessor::Create(type, ""));
+    pre_proc->Convert(src, dst, desc, transform);
+    return result;
+}
+
+template <typename T = uint8_t>
+void CompareWithOpenCV(int format, const InputImageLayerDesc::Ptr &desc) {
+    SourceImage src = CreateSourceImage(format);
+    src.image.rect = {10, 6, 160, 100};
+
+    auto opencv_transform = std::make_shared<ImageTransformationParams>();
+    auto fused_transform = std::make_shared<ImageTransformationParams>();
+    // OpenCV pre-processor writes FOURCC_RGBP_F32 only from floating point images, so U8 output is the reference
+    const auto expected = Convert(ImagePreprocessorType::OPENCV, src.image, desc, opencv_transform);
+    const auto actual = Convert<T>(ImagePreprocessorType::FUSED_CPU, src.image, desc, fused_transform);
+
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++)
+        ASSERT_LE(std::abs(expected[i] - actual[i]), MAX_DIFF) << "at plane " << i / (DST_SIZE * DST_SIZE)
+                                                               << ", offset " << i % (DST_SIZE * DST_SIZE);
+
+    EXPECT_EQ(opencv_transform->WasResize(), fused_transform->WasResize());
+    EXPECT_DOUBLE_EQ(opencv_transform->resize_scale_x, fused_transform->resize_scale_x);
+    EXPECT_DOUBLE_EQ(opencv_transform->resize_scale_y, fused_transform->resize_scale_y);
+    EXPECT_EQ(opencv_transform->padding_size_x, fused_transform->padding_size_x);
+    EXPECT_EQ(opencv_transform->padding_size_y, fused_transform->padding_size_y);
+}
+
+// Normalization is applied by the model pre-processing, not by image pre-processors
+InputImageLayerDesc::Ptr NormalizedPaddingDesc() {
+    return std::make_shared<InputImageLayerDesc>(
+        InputImageLayerDesc::Resize::ASPECT_RATIO_PAD, InputImageLayerDesc::Crop::NO,
+        InputImageLayerDesc::ColorSpace::RGB, InputImageLayerDesc::RangeNormalization(0, 1),
+        InputImageLayerDesc::DistribNormalization(std::vector<double>{0.485, 0.456, 0.406},
+                                                  std::vector<double>{0.229, 0.224, 0.225}),
+        InputImageLayerDesc::Padding(4, std::vector<double>{114, 0, 255}));
+}
+
+} // namespace
+
+class FusedCPUPreProcTest : public testing::TestWithParam<int> {};
+
+TEST_P(FusedCPUPreProcTest, PlainResizeMatchesOpenCV) {
+    CompareWithOpenCV(GetParam(), nullptr);
+}
+
+TEST_P(FusedCPUPreProcTest, AspectRatioRGBMatchesOpenCV) {
+    auto desc = std::make_shared<InputImageLayerDesc>(
+        InputImageLayerDesc::Resize::ASPECT_RATIO, InputImageLayerDesc::Crop::NO, InputImageLayerDesc::ColorSpace::RGB);
+    CompareWithOpenCV(GetParam(), desc);
+}
+
+TEST_P(FusedCPUPreProcTest, PaddingMatchesOpenCV) {
+    auto desc = std::make_shared<InputImageLayerDesc>(
+        InputImageLayerDesc::Resize::ASPECT_RATIO_PAD, InputImageLayerDesc::Crop::NO,
+        InputImageLayerDesc::ColorSpace::BGR, InputImageLayerDesc::RangeNormalization(),
+        InputImageLayerDesc::DistribNormalization(), InputImageLayerDesc::Padding(4, std::vector<double>{114, 0, 255}));
+    CompareWithOpenCV(GetParam(), desc);
+}
+
+TEST_P(FusedCPUPreProcTest, F32PlainResizeMatchesOpenCV) {
+    CompareWithOpenCV<float>(GetParam(), nullptr);
+}
+
+TEST_P(FusedCPUPreProcTest, F32NormalizedPaddingMatchesOpenCV) {
+    CompareWithOpenCV<float>(GetParam(), NormalizedPaddingDesc());
+}
+
+TEST_P(FusedCPUPreProcTest, F32HoldsSamplesOfU8) {
+    SourceImage src = CreateSourceImage(GetParam());
+    src.image.rect = {10, 6, 160, 100};
+    const auto desc = NormalizedPaddingDesc();
+    const auto samples = Convert(ImagePreprocessorType::FUSED_CPU, src.image, desc, nullptr);
+    const auto actual = Convert<float>(ImagePreprocessorType::FUSED_CPU, src.image, desc, nullptr);
+
+    ASSERT_EQ(samples.size(), actual.size());
+    for (size_t i = 0; i < samples.size(); i++)
+        ASSERT_EQ(static_cast<float>(samples[i]), actual[i]) << "at plane " << i / (DST_SIZE * DST_SIZE)
+                                                             << ", offset " << i % (DST_SIZE * DST_SIZE);
+}
+
+TEST(FusedCPUPreProcFallbackTest, CropTypeFallsBackToOpenCV) {
+    auto desc = std::make_shared<InputImageLayerDesc>(InputImageLayerDesc::Resize::ASPECT_RATIO,
+                                                      InputImageLayerDesc::Crop::CENTRAL,
+                                                      InputImageLayerDesc::ColorSpace::BGR);
+    SourceImage src = CreateSourceImage(FOURCC_NV12);
+    const auto expected = Convert(ImagePreprocessorType::OPENCV, src.image, desc, nullptr);
+    const auto actual = Convert(ImagePreprocessorType::FUSED_CPU, src.image, desc, nullptr);
+    ASSERT_EQ(expected, actual);
+}
+
+INSTANTIATE_TEST_SUITE_P(FusedCPUPreProc, FusedCPUPreProcTest,
+                         testing::Values(FOURCC_NV12, FOURCC_I420, FOURCC_BGRX));
@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "worker_pool.h"
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST(WorkerPoolTest, EachIndexIsProcessedOnce) {
+    WorkerPool pool(4);
+    for (size_t count = 0; count < 32; count++) {
+        std::vector<std::atomic_int> calls(count);
+        pool.ParallelFor(count, [&](size_t i) { calls[i]++; });
+        for (size_t i = 0; i < count; i++)
+            ASSERT_EQ(calls[i], 1) << "count " << count << ", index " << i;
+    }
+}
+
+TEST(WorkerPoolTest, ExceptionIsRethrownAfterAllIndicesFinished) {
+    WorkerPool pool(3);
+    std::atomic_int calls{0};
+    EXPECT_THROW(pool.ParallelFor(16,
+                                  [&](size_t i) {
+                                      calls++;
+                                      if (i == 7)
+                                          throw std::runtime_error("conversion failed");
+                                  }),
+                 std::runtime_error);
+    EXPECT_EQ(calls, 16);
+
+    // pool stays usable after failed job
+    calls = 0;
+    pool.ParallelFor(8, [&](size_t) { calls++; });
+    EXPECT_EQ(calls, 8);
+}
+
+TEST(WorkerPoolTest, SingleThreadPoolRunsInCaller) {
+    WorkerPool pool(1);
+    EXPECT_EQ(pool.GetSize(), 1u);
+    std::vector<int> order;
+    pool.ParallelFor(5, [&](size_t i) { order.push_back(static_cast<int>(i)); });
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+TEST(WorkerPoolTest, SharedPoolIsReusedWhileInUse) {
+    auto pool = WorkerPool::GetShared(3);
+    EXPECT_EQ(pool->GetSize(), 3u);
+    EXPECT_EQ(WorkerPool::GetShared(3), pool);
+    EXPECT_NE(WorkerPool::GetShared(2), pool);
+
+    // registry doesn't keep pools alive
+    pool.reset();
+    EXPECT_EQ(WorkerPool::GetShared(3).use_count(), 1);
+}
+
+TEST(WorkerPoolTest, JobSubmittedToBusyPoolRunsInCaller) {
+    WorkerPool pool(4);
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool started = false;
+    bool release = false;
+
+    std::thread busy([&] {
+        pool.ParallelFor(2, [&](size_t) {
+            std::unique_lock<std::mutex> lock(mutex);
+            started = true;
+            cv.notify_all();
+            cv.wait(lock, [&] { return release; });
+        });
+    });
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] { return started; });
+    }
+
+    const auto caller = std::this_thread::get_id();
+    std::atomic_int calls_in_caller{0};
+    pool.ParallelFor(8, [&](size_t) {
+        if (std::this_thread::get_id() == caller)
+            calls_in_caller++;
+    });
+    EXPECT_EQ(calls_in_caller, 8);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        release = true;
+    }
+    cv.notify_all();
+    busy.join();
+}
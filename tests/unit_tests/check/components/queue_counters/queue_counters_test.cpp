@@ -0,0 +1,59 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "queue_counters.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+QueueCounters Counters(uint64_t batches, uint64_t batched_frames, uint64_t free_request_wait, uint64_t admission_wait,
+                       uint64_t downstream_wait) {
+    QueueCounters counters;
+    counters.batches = batches;
+    counters.batched_frames = batched_frames;
+    counters.free_request_wait = free_request_wait;
+    counters.admission_wait = admission_wait;
+    counters.downstream_wait = downstream_wait;
+    return counters;
+}
+
+void ExpectCounters(const QueueCounters &counters, const QueueCounters &expected) {
+    EXPECT_EQ(counters.batches, expected.batches);
+    EXPECT_EQ(counters.batched_frames, expected.batched_frames);
+    EXPECT_EQ(counters.free_request_wait, expected.free_request_wait);
+    EXPECT_EQ(counters.admission_wait, expected.admission_wait);
+    EXPECT_EQ(counters.downstream_wait, expected.downstream_wait);
+}
+
+} // namespace
+
+TEST(QueueCountersTest, FirstSampleIsCountedFromZero) {
+    const QueueCounters counters = Counters(3, 10, 100, 200, 300);
+    ExpectCounters(counters.since(QueueCounters()), counters);
+}
+
+TEST(QueueCountersTest, ReportsDifferencesOfConsecutiveSamples) {
+    const QueueCounters previous = Counters(3, 10, 100, 200, 300);
+    ExpectCounters(Counters(5, 16, 150, 200, 1300).since(previous), Counters(2, 6, 50, 0, 1000));
+}
+
+TEST(QueueCountersTest, CounterGoingBackDoesNotResetOthers) {
+    const QueueCounters previous = Counters(3, 10, 100, 200, 300);
+    ExpectCounters(Counters(5, 16, 150, 250, 299).since(previous), Counters(2, 6, 50, 50, 0));
+}
+
+TEST(QueueCountersTest, RestartedCountersAreClampedAtZero) {
+    const QueueCounters previous = Counters(300, 1000, 10000, 20000, 30000);
+    ExpectCounters(Counters(2, 4, 50, 0, 60).since(previous), QueueCounters());
+}
+
+TEST(QueueCountersTest, CounterDeltaNeverWraps) {
+    EXPECT_EQ(counter_delta(10, 7), 3u);
+    EXPECT_EQ(counter_delta(7, 7), 0u);
+    EXPECT_EQ(counter_delta(7, 10), 0u);
+    EXPECT_EQ(counter_delta(0, UINT64_MAX), 0u);
+}
@@ -0,0 +1,167 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "vas/components/ot/mtt/spatial_rgb_histogram.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/imgproc.hpp>
+
+#include <cstring>
+#include <vector>
+
+namespace {
+
+constexpr int32_t kWidth = 242;
+constexpr int32_t kHeight = 180;
+
+// Rows of planes are padded, a sampled padding byte changes colors of the histograms
+constexpr uint8_t kPadding = 0xff;
+
+// Similarity of histograms of the same roi sampled by nearest pixels and resized with bilinear interpolation
+constexpr float kMinResizedSimilarity = 0.85f;
+
+struct HistogramConfig {
+    int32_t canonical_patch_size;
+    int32_t spatial_bin_size;
+    int32_t spatial_bin_stride;
+    int32_t rgb_bin_size;
+};
+
+// Configuration of the tracker and configuration with overlapping spatial bins
+const std::vector<HistogramConfig> kConfigs = {{64, 32, 32, 32}, {16, 8, 4, 32}};
+
+// Odd offsets and sizes, rois partially and fully out of the image
+const std::vector<cv::Rect> kRois = {
+    {5, 7, 33, 41}, {1, 3, 64, 64},     {37, 19, 121, 155},      {kWidth - 31, kHeight - 13, 31, 13}, {11, 9, 200, 170},
+    {3, 1, 9, 17},  {-7, 101, 40, 200}, {0, 0, kWidth, kHeight}, {kWidth + 5, 0, 10, 10}};
+
+// Blocks of colors spread over the whole RGB cube
+cv::Mat BgrImage() {
+    cv::Mat bgr(kHeight, kWidth, CV_8UC3);
+    for (int32_t y = 0; y < kHeight; ++y) {
+        for (int32_t x = 0; x < kWidth; ++x) {
+            const int32_t bx = x / 16;
+            const int32_t by = y / 16;
+            bgr.at<cv::Vec3b>(y, x) = cv::Vec3b((bx * 53 + by * 29) % 256, (bx * 101 + by * 71) % 256,
+                                                (bx * 17 + by * 131) % 256);
+        }
+    }
+    return bgr;
+}
+
+/**
+ * YUV image in separate planes with padded rows together with its conversion to BGR by cv::cvtColor
+ */
+struct YuvImage {
+    std::vector<uint8_t> y;
+    std::vector<uint8_t> u;
+    std::vector<uint8_t> v;
+    vas::ImagePlanes planes;
+    cv::Mat bgr;
+};
+
+YuvImage MakeYuvImage(vas::ColorFormat format) {
+    cv::Mat i420;
+    cv::cvtColor(BgrImage(), i420, cv::COLOR_BGR2YUV_I420);
+    const int32_t chroma_width = kWidth / 2;
+    const int32_t chroma_height = kHeight / 2;
+    const uint8_t *y_src = i420.ptr<uint8_t>();
+    const uint8_t *u_src = y_src + kWidth * kHeight;
+    const uint8_t *v_src = u_src + chroma_width * chroma_height;
+
+    YuvImage image;
+    image.planes.width = kWidth;
+    image.planes.height = kHeight;
+    image.planes.y_stride = kWidth + 10;
+    image.y.assign(image.planes.y_stride * kHeight, kPadding);
+    for (int32_t row = 0; row < kHeight; ++row)
+        std::memcpy(&image.y[row * image.planes.y_stride], y_src + row * kWidth, kWidth);
+    image.planes.y = image.y.data();
+
+    if (format == vas::ColorFormat::NV12) {
+        cv::Mat nv12(kHeight * 3 / 2, kWidth, CV_8UC1);
+        std::memcpy(nv12.ptr<uint8_t>(), y_src, kWidth * kHeight);
+        image.planes.uv_stride = kWidth + 6;
+        image.u.assign(image.planes.uv_stride * chroma_height, kPadding);
+        for (int32_t row = 0; row < chroma_height; ++row) {
+            uint8_t *uv = nv12.ptr<uint8_t>(kHeight + row);
+            for (int32_t x = 0; x < chroma_width; ++x) {
+                uv[2 * x] = u_src[row * chroma_width + x];
+                uv[2 * x + 1] = v_src[row * chroma_width + x];
+            }
+            std::memcpy(&image.u[row * image.planes.uv_stride], uv, kWidth);
+        }
+        image.planes.u = image.u.data();
+        cv::cvtColor(nv12, image.bgr, cv::COLOR_YUV2BGR_NV12);
+    } else {
+        image.planes.uv_stride = chroma_width + 7;
+        image.u.assign(image.planes.uv_stride * chroma_height, kPadding);
+        image.v.assign(image.planes.uv_stride * chroma_height, kPadding);
+        for (int32_t row = 0; row < chroma_height; ++row) {
+            std::memcpy(&image.u[row * image.planes.uv_stride], u_src + row * chroma_width, chroma_width);
+            std::memcpy(&image.v[row * image.planes.uv_stride], v_src + row * chroma_width, chroma_width);
+        }
+        image.planes.u = image.u.data();
+        image.planes.v = image.v.data();
+        cv::cvtColor(i420, image.bgr, cv::COLOR_YUV2BGR_I420);
+    }
+    return image;
+}
+
+// Canonical patch of roi sampled at the same pixels as ComputeFromYuv does
+cv::Mat SampleNearest(const cv::Mat &bgr, const cv::Rect &roi, int32_t patch_size) {
+    cv::Mat patch(patch_size, patch_size, CV_8UC3);
+    for (int32_t py = 0; py < patch_size; ++py) {
+        const int32_t y = roi.y + (2 * py + 1) * roi.height / (2 * patch_size);
+        for (int32_t px = 0; px < patch_size; ++px) {
+            const int32_t x = roi.x + (2 * px + 1) * roi.width / (2 * patch_size);
+            patch.at<cv::Vec3b>(py, px) = bgr.at<cv::Vec3b>(y, x);
+        }
+    }
+    return patch;
+}
+
+void ExpectSameAsCvtColor(vas::ColorFormat format) {
+    const YuvImage image = MakeYuvImage(format);
+    const cv::Rect image_rect(0, 0, kWidth, kHeight);
+    for (const HistogramConfig &config : kConfigs) {
+        vas::ot::SpatialRgbHistogram histogram(config.canonical_patch_size, config.spatial_bin_size,
+                                               config.spatial_bin_stride, config.rgb_bin_size);
+        std::vector<cv::Mat> hists;
+        histogram.ComputeFromYuv(image.planes, format, kRois, &hists);
+        ASSERT_EQ(hists.size(), kRois.size());
+
+        for (size_t r = 0; r < kRois.size(); ++r) {
+            const cv::Rect roi = kRois[r] & image_rect;
+            ASSERT_EQ(hists[r].cols, histogram.FeatureSize()) << kRois[r];
+            if (roi.empty()) {
+                EXPECT_EQ(cv::countNonZero(hists[r]), 0) << kRois[r];
+                continue;
+            }
+
+            // Same pixels converted by cv::cvtColor give the same histogram
+            cv::Mat expected;
+            histogram.Compute(SampleNearest(image.bgr, roi, config.canonical_patch_size), &expected);
+            EXPECT_LE(cv::norm(hists[r], expected, cv::NORM_INF), 1e-4) << kRois[r];
+
+            // Patch resized from the whole roi differs by sampling only
+            cv::Mat resized;
+            histogram.Compute(image.bgr(roi), &resized);
+            EXPECT_GE(vas::ot::RgbHistogram::ComputeSimilarity(hists[r], resized), kMinResizedSimilarity)
+                << kRois[r] << " patch size " << config.canonical_patch_size;
+        }
+    }
+}
+
+} // namespace
+
+TEST(SpatialRgbHistogramTest, Nv12HistogramsMatchCvtColor) {
+    ExpectSameAsCvtColor(vas::ColorFormat::NV12);
+}
+
+TEST(SpatialRgbHistogramTest, I420HistogramsMatchCvtColor) {
+    ExpectSameAsCvtColor(vas::ColorFormat::I420);
+}
@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "inference_backend/stage_timer.h"
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace InferenceBackend;
+using json = nlohmann::json;
+
+namespace {
+
+constexpr std::chrono::milliseconds REPORT_INTERVAL(1000);
+
+size_t StageIndex(Stage stage) {
+    return static_cast<size_t>(stage);
+}
+
+// Records stage of the given duration measured by steady clock
+void RecordSleep(StageTimer &timer, Stage stage, std::chrono::milliseconds duration) {
+    const uint64_t begin = StageTimer::Ticks();
+    std::this_thread::sleep_for(duration);
+    timer.Record(stage, begin, StageTimer::Ticks());
+}
+
+} // namespace
+
+TEST(StageTimerTest, CollectSummarizesRecordedStages) {
+    StageTimer timer("model", REPORT_INTERVAL, false);
+    RecordSleep(timer, Stage::INFER, std::chrono::milliseconds(20));
+    RecordSleep(timer, Stage::INFER, std::chrono::milliseconds(10));
+    { StageScope scope(&timer, Stage::PREPROC); }
+    { StageScope scope(nullptr, Stage::PUSH); }
+
+    const StageTimer::Summary summary = timer.Collect();
+    const auto &infer = summary.stages[StageIndex(Stage::INFER)];
+    EXPECT_EQ(infer.count, 2u);
+    EXPECT_GE(infer.total_ms, 29.0);
+    EXPECT_GE(infer.max_ms, 19.0);
+    EXPECT_LE(infer.max_ms, infer.total_ms);
+    EXPECT_EQ(summary.stages[StageIndex(Stage::PREPROC)].count, 1u);
+    EXPECT_EQ(summary.stages[StageIndex(Stage::PUSH)].count, 0u);
+    EXPECT_GE(summary.interval_ms, infer.total_ms);
+
+    // Counters are drained by collect
+    const StageTimer::Summary next = timer.Collect();
+    for (const auto &stage : next.stages) {
+        EXPECT_EQ(stage.count, 0u);
+        EXPECT_EQ(stage.total_ms, 0.0);
+        EXPECT_EQ(stage.max_ms, 0.0);
+    }
+}
+
+TEST(StageTimerTest, CollectsStagesOfAllThreads) {
+    constexpr size_t threads_num = 8;
+    constexpr uint64_t records_num = 10000;
+    StageTimer timer("model", REPORT_INTERVAL, false);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threads_num; i++) {
+        threads.emplace_back([&timer, i] {
+            const Stage stage = static_cast<Stage>(i % STAGE_COUNT);
+            for (uint64_t n = 0; n < records_num; n++)
+                timer.Record(stage, 100, 100 + n % 10);
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    const StageTimer::Summary summary = timer.Collect();
+    for (size_t i = 0; i < STAGE_COUNT; i++) {
+        const uint64_t threads_of_stage = threads_num / STAGE_COUNT + (i < threads_num % STAGE_COUNT ? 1 : 0);
+        EXPECT_EQ(summary.stages[i].count, threads_of_stage * records_num) << StageName(static_cast<Stage>(i));
+    }
+}
+
+TEST(StageTimerTest, TimerCreatedAfterDestroyedOneStartsEmpty) {
+    // Timers are created and destroyed on the same thread, e.g. by pipeline restarts
+    for (uint64_t round = 1; round <= 100; round++) {
+        StageTimer first("first", REPORT_INTERVAL, false);
+        StageTimer second("second", REPORT_INTERVAL, round % 2 == 0);
+        first.Record(Stage::MAP, 0, 1);
+        second.Record(Stage::ATTACH, 0, 1);
+        second.Record(Stage::ATTACH, 0, 1);
+
+        const StageTimer::Summary first_summary = first.Collect();
+        EXPECT_EQ(first_summary.stages[StageIndex(Stage::MAP)].count, 1u);
+        EXPECT_EQ(first_summary.stages[StageIndex(Stage::ATTACH)].count, 0u);
+        const StageTimer::Summary second_summary = second.Collect();
+        EXPECT_EQ(second_summary.stages[StageIndex(Stage::MAP)].count, 0u);
+        EXPECT_EQ(second_summary.stages[StageIndex(Stage::ATTACH)].count, 2u);
+    }
+}
+
+TEST(StageTimerTest, WritesChromeTrace) {
+    constexpr size_t threads_num = 3;
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "stage_timer_trace.json";
+    StageTimer timer("model \"quoted\"", REPORT_INTERVAL, true);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threads_num; i++) {
+        threads.emplace_back([&timer] {
+            RecordSleep(timer, Stage::PREPROC, std::chrono::milliseconds(1));
+            RecordSleep(timer, Stage::INFER, std::chrono::milliseconds(2));
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+    timer.WriteChromeTrace(path.string());
+
+    std::ifstream file(path);
+    const json trace = json::parse(file);
+    std::filesystem::remove(path);
+
+    EXPECT_EQ(trace["displayTimeUnit"], "ms");
+    const json &events = trace["traceEvents"];
+    ASSERT_TRUE(events.is_array());
+    std::set<int> tids;
+    std::multiset<std::string> stages;
+    for (const json &event : events) {
+        if (event["ph"] == "M") {
+            if (event["name"] == "process_name") {
+                EXPECT_EQ(event["args"]["name"], "model \"quoted\"");
+            }
+            continue;
+        }
+        EXPECT_EQ(event["ph"], "X");
+        EXPECT_GE(event["ts"].get<double>(), 0.0);
+        EXPECT_GE(event["dur"].get<double>(), 900.0);
+        tids.insert(event["tid"].get<int>());
+        stages.insert(event["name"].get<std::string>());
+    }
+    EXPECT_EQ(tids.size(), threads_num);
+    EXPECT_EQ(stages.count("preproc"), threads_num);
+    EXPECT_EQ(stages.count("infer"), threads_num);
+}
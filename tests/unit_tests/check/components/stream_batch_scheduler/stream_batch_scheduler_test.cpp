@@ -0,0 +1,216 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "stream_batch_scheduler.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace {
+
+// Time a blocked call is expected to stay blocked
+constexpr auto BLOCKED_FOR = std::chrono::milliseconds(50);
+
+/**
+ * Task blocking the scheduler's thread until released, so tasks are queued while it runs
+ */
+class Gate {
+  public:
+    StreamBatchScheduler::Task Task() {
+        return [this] {
+            std::unique_lock<std::mutex> lock(mutex);
+            started = true;
+            cv.notify_all();
+            cv.wait(lock, [this] { return released; });
+        };
+    }
+
+    void WaitStarted() {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this] { return started; });
+    }
+
+    void Release() {
+        std::lock_guard<std::mutex> lock(mutex);
+        released = true;
+        cv.notify_all();
+    }
+
+  private:
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool started = false;
+    bool released = false;
+};
+
+/**
+ * Names of executed tasks in order of execution
+ */
+class Trace {
+  public:
+    StreamBatchScheduler::Task Task(const std::string &name) {
+        return [this, name] {
+            std::lock_guard<std::mutex> lock(mutex);
+            trace += trace.empty() ? name : " " + name;
+        };
+    }
+
+    std::string Get() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return trace;
+    }
+
+  private:
+    std::mutex mutex;
+    std::string trace;
+};
+
+int stream_a, stream_b, stream_c;
+const StreamBatchScheduler::StreamId A = &stream_a;
+const StreamBatchScheduler::StreamId B = &stream_b;
+const StreamBatchScheduler::StreamId C = &stream_c;
+
+} // namespace
+
+TEST(StreamBatchSchedulerTest, ServesStreamsInWeightedRoundRobin) {
+    StreamBatchScheduler scheduler(8);
+    Gate gate;
+    Trace trace;
+    scheduler.Enqueue(A, gate.Task(), 2);
+    gate.WaitStarted();
+    for (const char *name : {"a1", "a2", "a3", "a4"})
+        scheduler.Enqueue(A, trace.Task(name), 2);
+    for (const char *name : {"b1", "b2", "b3"})
+        scheduler.Enqueue(B, trace.Task(name), 1);
+    gate.Release();
+    scheduler.WaitIdle();
+
+    // the gate took one of two tasks of stream A
+    EXPECT_EQ(trace.Get(), "a1 b1 a2 a3 b2 a4 b3");
+}
+
+TEST(StreamBatchSchedulerTest, FirstStreamIsServedFromItsWeight) {
+    StreamBatchScheduler scheduler(8);
+    Gate gate;
+    Trace trace;
+    scheduler.Enqueue(A, gate.Task(), 3);
+    gate.WaitStarted();
+    scheduler.Enqueue(B, trace.Task("b1"), 1);
+    for (const char *name : {"a1", "a2", "a3"})
+        scheduler.Enqueue(A, trace.Task(name), 3);
+    gate.Release();
+    scheduler.WaitIdle();
+
+    EXPECT_EQ(trace.Get(), "a1 a2 b1 a3");
+}
+
+TEST(StreamBatchSchedulerTest, EnqueueBlocksOnlyStreamWithFullQueue) {
+    StreamBatchScheduler scheduler(2);
+    Gate gate;
+    Trace trace;
+    scheduler.Enqueue(A, gate.Task());
+    gate.WaitStarted();
+    scheduler.Enqueue(A, trace.Task("a1"));
+    scheduler.Enqueue(A, trace.Task("a2"));
+
+    std::atomic<bool> enqueued{false};
+    std::thread producer([&] {
+        scheduler.Enqueue(A, trace.Task("a3"));
+        enqueued = true;
+    });
+    std::this_thread::sleep_for(BLOCKED_FOR);
+    EXPECT_FALSE(enqueued);
+
+    // other stream is not throttled by the full queue of stream A
+    scheduler.Enqueue(B, trace.Task("b1"));
+    EXPECT_FALSE(enqueued);
+
+    gate.Release();
+    producer.join();
+    EXPECT_TRUE(enqueued);
+    scheduler.WaitIdle();
+    EXPECT_EQ(trace.Get().size(), std::string("a1 b1 a2 a3").size());
+}
+
+TEST(StreamBatchSchedulerTest, RemoveStreamBeforeCurrentKeepsServingCurrent) {
+    StreamBatchScheduler scheduler(8);
+    Gate gate;
+    Trace trace;
+    scheduler.Enqueue(A, trace.Task("a1"));
+    scheduler.Enqueue(B, trace.Task("b1"));
+    scheduler.WaitIdle();
+
+    // stream C is served last, the gate takes one of its two tasks
+    scheduler.Enqueue(C, gate.Task(), 2);
+    gate.WaitStarted();
+    scheduler.RemoveStream(A);
+    scheduler.Enqueue(B, trace.Task("b2"));
+    scheduler.Enqueue(C, trace.Task("c1"), 2);
+    scheduler.Enqueue(C, trace.Task("c2"), 2);
+    gate.Release();
+    scheduler.WaitIdle();
+
+    EXPECT_EQ(trace.Get(), "a1 b1 c1 b2 c2");
+}
+
+TEST(StreamBatchSchedulerTest, RemoveStreamExecutesItsPendingTasks) {
+    StreamBatchScheduler scheduler(8);
+    Gate gate;
+    Trace trace;
+    scheduler.Enqueue(A, gate.Task());
+    gate.WaitStarted();
+    scheduler.Enqueue(B, trace.Task("b1"));
+    scheduler.Enqueue(B, trace.Task("b2"));
+
+    std::thread remover([&] { scheduler.RemoveStream(B); });
+    std::this_thread::sleep_for(BLOCKED_FOR);
+    EXPECT_EQ(trace.Get(), "");
+    gate.Release();
+    remover.join();
+    EXPECT_EQ(trace.Get(), "b1 b2");
+
+    // removed stream registers again, remaining stream keeps being served
+    scheduler.Enqueue(B, trace.Task("b3"));
+    scheduler.Enqueue(A, trace.Task("a1"));
+    scheduler.WaitIdle();
+    EXPECT_EQ(trace.Get().size(), std::string("b1 b2 b3 a1").size());
+}
+
+TEST(StreamBatchSchedulerTest, DestructionExecutesQueuedTasks) {
+    auto scheduler = std::make_unique<StreamBatchScheduler>(8);
+    Gate gate;
+    std::atomic<int> executed{0};
+    scheduler->Enqueue(A, gate.Task());
+    gate.WaitStarted();
+    for (int i = 0; i < 3; i++) {
+        scheduler->Enqueue(A, [&] { executed++; });
+        scheduler->Enqueue(B, [&] { executed++; });
+    }
+
+    std::thread releaser([&] {
+        std::this_thread::sleep_for(BLOCKED_FOR);
+        gate.Release();
+    });
+    scheduler.reset();
+    releaser.join();
+    EXPECT_EQ(executed, 6);
+}
+
+TEST(StreamBatchSchedulerTest, FailedTaskDoesNotStopScheduler) {
+    StreamBatchScheduler scheduler(8);
+    Trace trace;
+    scheduler.Enqueue(A, [] { throw std::runtime_error("task failed"); });
+    scheduler.Enqueue(A, trace.Task("a1"));
+    scheduler.WaitIdle();
+    EXPECT_EQ(trace.Get(), "a1");
+}
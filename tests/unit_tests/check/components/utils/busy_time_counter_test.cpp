@@ -0,0 +1,76 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "busy_time_counter.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+constexpr uint64_t MS = 1000000;
+
+} // namespace
+
+TEST(BusyTimeCounterTest, CountsCompletedCalls) {
+    BusyTimeCounter counter;
+    EXPECT_EQ(counter.Total(), 0u);
+
+    counter.Begin();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    counter.End();
+    const uint64_t first = counter.Total();
+    EXPECT_GE(first, 20 * MS);
+
+    // time between calls is not counted
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(counter.Total(), first);
+
+    counter.Begin();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    counter.End();
+    EXPECT_GE(counter.Total(), first + 10 * MS);
+}
+
+TEST(BusyTimeCounterTest, CountsCallInProgress) {
+    BusyTimeCounter counter;
+    counter.Begin();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    const uint64_t first = counter.Total();
+    EXPECT_GE(first, 10 * MS);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    const uint64_t second = counter.Total();
+    EXPECT_GE(second, first + 10 * MS);
+    counter.End();
+    EXPECT_GE(counter.Total(), second);
+}
+
+TEST(BusyTimeCounterTest, TotalReadDuringCallsNeverDecreases) {
+    BusyTimeCounter counter;
+    std::atomic<bool> stop{false};
+    std::thread writer([&] {
+        while (!stop) {
+            counter.Begin();
+            counter.End();
+        }
+    });
+
+    uint64_t previous = 0;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(200);
+    uint64_t reads = 0;
+    while (std::chrono::steady_clock::now() < deadline) {
+        const uint64_t total = counter.Total();
+        ASSERT_GE(total, previous) << "after " << reads << " reads";
+        previous = total;
+        reads++;
+    }
+    stop = true;
+    writer.join();
+    EXPECT_GE(counter.Total(), previous);
+}
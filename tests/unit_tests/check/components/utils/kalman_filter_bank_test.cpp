@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "kalman_filter_bank.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+namespace {
+
+// Scalar fixed-point filter of one coordinate as implemented by per-object VAS Kalman filter
+struct ReferenceFilter {
+    int32_t x[2] = {0, 0};
+    int32_t p[2][2] = {{0, 0}, {0, 0}};
+    int32_t q[2] = {0, 0};
+    int32_t r = 0;
+    int32_t xk[2] = {0, 0};
+    int32_t pk[2][2] = {{0, 0}, {0, 0}};
+
+    void predict(float w) {
+        xk[0] = static_cast<int32_t>(1.f * x[0] + w * x[1]);
+        xk[1] = static_cast<int32_t>(0.f * x[0] + 1.f * x[1]);
+        const int32_t ap[2][2] = {{static_cast<int32_t>(1.f * p[0][0] + 1.f * p[1][0]),
+                                   static_cast<int32_t>(1.f * p[0][1] + 1.f * p[1][1])},
+                                  {static_cast<int32_t>(1.f * p[1][0]), static_cast<int32_t>(1.f * p[1][1])}};
+        pk[0][0] = static_cast<int32_t>(ap[0][0] * 1.f + ap[0][1] * 1.f) + q[0];
+        pk[0][1] = static_cast<int32_t>(ap[0][0] * 0.f + ap[0][1] * 1.f);
+        pk[1][0] = static_cast<int32_t>(ap[1][0] * 1.f + ap[1][1] * 1.f);
+        pk[1][1] = static_cast<int32_t>(ap[1][0] * 0.f + ap[1][1] * 1.f) + q[1];
+        x[0] = xk[0];
+        x[1] = xk[1];
+        for (int i = 0; i < 2; i++)
+            for (int j = 0; j < 2; j++)
+                p[i][j] = pk[i][j];
+    }
+
+    int32_t update(int32_t z) {
+        if (xk[0] == 0 && pk[0][0] == 0)
+            return z;
+        const int32_t y = z - xk[0];
+        const int32_t s = pk[0][0] + r;
+        if (s == 0)
+            return z;
+        x[0] = xk[0] + pk[0][0] * y / s;
+        x[1] = xk[1] + pk[1][0] * y / s;
+        const int32_t i_kh[2][2] = {{s - pk[0][0], 0}, {-pk[1][0], s}};
+        for (int i = 0; i < 2; i++)
+            for (int j = 0; j < 2; j++)
+                p[i][j] = static_cast<int32_t>(
+                    (i_kh[i][0] * static_cast<double>(pk[0][j]) + i_kh[i][1] * static_cast<double>(pk[1][j])) / s);
+        return x[0];
+    }
+};
+
+} // namespace
+
+TEST(KalmanFilterBankTest, MatchesScalarFilter) {
+    using Bank = KalmanFilterBank<4, 2>;
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int32_t> position(0, 16 * 1920);
+    std::uniform_int_distribution<int32_t> step(-200, 200);
+
+    Bank bank;
+    std::vector<size_t> filters;
+    std::vector<std::array<ReferenceFilter, 2>> references;
+    for (int frame = 0; frame < 200; frame++) {
+        if (filters.size() < 40) {
+            const Bank::Measurement start = {position(rng), position(rng)};
+            filters.push_back(bank.add(start));
+            references.emplace_back();
+            for (size_t c = 0; c < 2; c++) {
+                references.back()[c].x[0] = start[c];
+                references.back()[c].q[0] = references.back()[c].q[1] = 1 + frame;
+                bank.setProcessNoise(filters.back(), c, 1 + frame, 1 + frame);
+            }
+        }
+
+        const Bank::VelocityWeights weights = {0.264f, 0.f};
+        bank.predict(weights);
+        for (size_t i = 0; i < filters.size(); i++) {
+            for (size_t c = 0; c < 2; c++) {
+                references[i][c].predict(weights[c]);
+                ASSERT_EQ(bank.predicted(filters[i], c), references[i][c].xk[0]) << "frame " << frame;
+            }
+        }
+
+        for (size_t i = 0; i < filters.size(); i++) {
+            const Bank::Measurement measurement = {references[i][0].xk[0] + step(rng),
+                                                   references[i][1].xk[0] + step(rng)};
+            const int32_t noise = frame % 16;
+            bank.setMeasurementNoise(filters[i], noise);
+            const auto estimate = bank.update(filters[i], measurement);
+            for (size_t c = 0; c < 2; c++) {
+                references[i][c].r = noise;
+                EXPECT_EQ(estimate[c], references[i][c].update(measurement[c])) << "frame " << frame;
+            }
+        }
+
+        // Removed filters are reused by next add()
+        if (frame % 3 == 0) {
+            const size_t i = rng() % filters.size();
+            bank.remove(filters[i]);
+            filters.erase(filters.begin() + i);
+            references.erase(references.begin() + i);
+        }
+    }
+}
+
+TEST(KalmanFilterBankTest, ReusesRemovedFilters) {
+    KalmanFilterBank<8, 4> bank;
+    const size_t first = bank.add({1, 2, 3, 4});
+    const size_t second = bank.add({5, 6, 7, 8});
+    EXPECT_NE(first, second);
+
+    bank.remove(first);
+    EXPECT_EQ(bank.add({9, 10, 11, 12}), first);
+
+    bank.predict({0.f, 0.f, 0.f, 0.f});
+    EXPECT_EQ(bank.predicted(first, 0), 9);
+    EXPECT_EQ(bank.predicted(second, 3), 8);
+
+    bank.clear();
+    EXPECT_EQ(bank.add({0, 0, 0, 0}), 0u);
+}
@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "thread_shards.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Counter {
+    int owner = -1;
+    uint64_t value = 0;
+};
+
+uint64_t total(ThreadShards<Counter> &shards) {
+    uint64_t sum = 0;
+    shards.for_each([&](Counter &counter) { sum += counter.value; });
+    return sum;
+}
+
+} // namespace
+
+TEST(ThreadShardsTest, ThreadsGetOwnShards) {
+    constexpr int threads_num = 4;
+    ThreadShards<Counter> shards;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threads_num; i++) {
+        threads.emplace_back([&shards, i] {
+            for (int n = 0; n < 1000; n++) {
+                Counter &counter = shards.local([i](Counter &counter) { counter.owner = i; });
+                // The shard is initialized once by the thread which uses it
+                ASSERT_EQ(counter.owner, i);
+                counter.value++;
+            }
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    int shards_num = 0;
+    shards.for_each([&](Counter &counter) {
+        EXPECT_EQ(counter.value, 1000u);
+        shards_num++;
+    });
+    EXPECT_EQ(shards_num, threads_num);
+}
+
+TEST(ThreadShardsTest, ReusedSlotGetsNewShard) {
+    // Owners created in place of destroyed ones reuse their slots
+    for (int round = 0; round < 100; round++) {
+        auto first = std::make_unique<ThreadShards<Counter>>();
+        auto second = std::make_unique<ThreadShards<Counter>>();
+        first->local().value += 1;
+        second->local().value += 2;
+        second->local().value += 2;
+        EXPECT_EQ(total(*first), 1u);
+        EXPECT_EQ(total(*second), 4u);
+
+        first.reset();
+        auto third = std::make_unique<ThreadShards<Counter>>();
+        EXPECT_EQ(third->local().value, 0u);
+        third->local().value += 3;
+        EXPECT_EQ(total(*third), 3u);
+        EXPECT_EQ(total(*second), 4u);
+    }
+}
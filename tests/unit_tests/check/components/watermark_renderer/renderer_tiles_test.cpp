@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "renderer_cpu.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/core.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+// Height of tiles is 128 rows with 4 threads, the last tile is shorter
+constexpr int WIDTH = 640;
+constexpr int HEIGHT = 500;
+constexpr int DRAW_THREADS = 4;
+const std::vector<int> TILE_BORDERS = {128, 256, 384};
+
+// Exposes drawing of primitives on image planes
+template <typename RendererT>
+class TestRenderer : public RendererT {
+  public:
+    TestRenderer() : RendererT(nullptr, nullptr) {
+    }
+
+    void draw_planes(std::vector<cv::Mat> &planes, std::vector<render::Prim> prims) {
+        this->draw_backend(planes, prims);
+    }
+};
+
+// Primitives crossing each tile border and primitives inside tiles
+std::vector<render::Prim> primitives() {
+    const cv::Scalar color(200, 60, 180);
+    std::vector<render::Prim> prims;
+    for (int border : TILE_BORDERS) {
+        prims.push_back(render::Rect(cv::Rect(40, border - 30, 120, 61), color, 4));
+        prims.push_back(render::Rect(cv::Rect(41, border - 2, 33, 5), color, 1));
+        prims.push_back(render::Rect(cv::Rect(180, border - 40, 60, 90), color, 3, 0.3));
+        prims.push_back(render::Circle(cv::Point(300, border - 1), 25, color, 3));
+        prims.push_back(render::Circle(cv::Point(360, border + 3), 7, color, cv::FILLED));
+        prims.push_back(render::Line(cv::Point(400, border - 50), cv::Point(400, border + 50), color, 5));
+        prims.push_back(render::Line(cv::Point(410, border - 1), cv::Point(630, border - 1), color, 2));
+        prims.push_back(render::Line(cv::Point(420, border - 45), cv::Point(470, border + 35), color, 1));
+        prims.push_back(render::Text("person 0.97", cv::Point(480, border + 8), cv::FONT_HERSHEY_TRIPLEX, 0.8, color,
+                                     2));
+        prims.push_back(render::Text("{Wjg|}", cv::Point(500, border - 20), cv::FONT_HERSHEY_SIMPLEX, 0.5, color, 1));
+        // glyphs are below tile border, background rectangle crosses it
+        prims.push_back(render::Text("car", cv::Point(560, border + 16), cv::FONT_HERSHEY_TRIPLEX, 0.8, color, 2));
+    }
+    // inside tiles and clipped by image borders
+    prims.push_back(render::Line(cv::Point(10, 20), cv::Point(90, 60), color, 3));
+    prims.push_back(render::Rect(cv::Rect(-10, HEIGHT - 40, 100, 60), color, 2));
+    prims.push_back(render::Circle(cv::Point(WIDTH - 5, -5), 30, color, 2));
+    prims.push_back(render::Text("car", cv::Point(WIDTH - 30, HEIGHT - 2), cv::FONT_HERSHEY_PLAIN, 2.0, color, 2));
+    return prims;
+}
+
+std::vector<cv::Mat> random_planes(const std::vector<std::pair<cv::Size, int>> &formats) {
+    cv::RNG rng(5);
+    std::vector<cv::Mat> planes;
+    for (const auto &format : formats) {
+        planes.emplace_back(format.first, format.second);
+        rng.fill(planes.back(), cv::RNG::UNIFORM, 0, 256);
+    }
+    return planes;
+}
+
+template <typename RendererT>
+void expect_tiles_match_whole_image(const std::vector<std::pair<cv::Size, int>> &formats, bool text_background) {
+    const std::vector<cv::Mat> background = random_planes(formats);
+    const std::vector<render::Prim> prims = primitives();
+
+    auto draw = [&](int draw_threads) {
+        std::vector<cv::Mat> planes;
+        for (const cv::Mat &plane : background)
+            planes.push_back(plane.clone());
+        TestRenderer<RendererT> renderer;
+        renderer.enable_draw_txt_bg(text_background);
+        renderer.set_draw_threads(draw_threads);
+        renderer.draw_planes(planes, prims);
+        return planes;
+    };
+    const std::vector<cv::Mat> untiled = draw(1);
+    const std::vector<cv::Mat> tiled = draw(DRAW_THREADS);
+
+    ASSERT_EQ(tiled.size(), untiled.size());
+    for (size_t i = 0; i < tiled.size(); i++) {
+        SCOPED_TRACE(::testing::Message() << "Plane: " << i);
+        // primitives are drawn
+        EXPECT_GT(cv::norm(untiled[i], background[i], cv::NORM_L1), 0);
+        EXPECT_EQ(cv::norm(tiled[i], untiled[i], cv::NORM_INF), 0);
+    }
+}
+
+} // namespace
+
+TEST(RendererTilesTest, I420TilesMatchWholeImage) {
+    const std::vector<std::pair<cv::Size, int>> formats = {{cv::Size(WIDTH, HEIGHT), CV_8UC1},
+                                                           {cv::Size(WIDTH / 2, HEIGHT / 2), CV_8UC1},
+                                                           {cv::Size(WIDTH / 2, HEIGHT / 2), CV_8UC1}};
+    expect_tiles_match_whole_image<RendererI420>(formats, false);
+    expect_tiles_match_whole_image<RendererI420>(formats, true);
+}
+
+TEST(RendererTilesTest, NV12TilesMatchWholeImage) {
+    const std::vector<std::pair<cv::Size, int>> formats = {{cv::Size(WIDTH, HEIGHT), CV_8UC1},
+                                                           {cv::Size(WIDTH / 2, HEIGHT / 2), CV_8UC2}};
+    expect_tiles_match_whole_image<RendererNV12>(formats, false);
+    expect_tiles_match_whole_image<RendererNV12>(formats, true);
+}
+
+TEST(RendererTilesTest, BGRTilesMatchWholeImage) {
+    const std::vector<std::pair<cv::Size, int>> formats = {{cv::Size(WIDTH, HEIGHT), CV_8UC3}};
+    expect_tiles_match_whole_image<RendererBGR>(formats, false);
+    expect_tiles_match_whole_image<RendererBGR>(formats, true);
+}
@@ -0,0 +1,330 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "json_writer.h"
+
+#include "cbor_writer.h"
+#include "gva_json_meta.h"
+
+#include <gst/analytics/analytics.h>
+#include <gst/check/gstharness.h>
+#include <gst/gst.h>
+#include <gst/video/video.h>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using json = nlohmann::json;
+
+namespace {
+
+// Writes the same members into document and writer, in the same order
+struct DualWriter {
+    json document = json::object();
+    JsonWriter writer;
+
+    explicit DualWriter(int indent) : writer(indent) {
+        writer.begin_object();
+    }
+
+    template <typename T>
+    void member(const std::string &key, const T &value) {
+        document.push_back(json::object_t::value_type(key, value));
+        writer.member(key.c_str(), value);
+    }
+
+    std::string finish() {
+        writer.end_object();
+        return writer.str();
+    }
+};
+
+} // namespace
+
+TEST(JsonWriterTest, SortsKeysAndKeepsFirstDuplicate) {
+    for (int indent : {-1, 0, 4}) {
+        DualWriter dual(indent);
+        dual.member("y", 2);
+        dual.member("x", 1);
+        dual.member("tensors", 3);
+        dual.member("x", 5);
+        dual.member("a b", 7);
+        dual.member("a", 8);
+        EXPECT_EQ(dual.finish(), dual.document.dump(indent)) << "indent " << indent;
+    }
+}
+
+TEST(JsonWriterTest, MatchesNumberAndStringFormatting) {
+    for (int indent : {-1, 2}) {
+        DualWriter dual(indent);
+        dual.member("confidence", 0.8);
+        dual.member("float", static_cast<double>(0.1f));
+        dual.member("integral", 3.0);
+        dual.member("small", 1e-7);
+        dual.member("large", 1e22);
+        dual.member("negative_zero", -0.0);
+        dual.member("nan", std::nan(""));
+        dual.member("min", INT64_MIN);
+        dual.member("max", UINT64_MAX);
+        dual.member("escaped", std::string("q\"b\\s\b\f\n\r\t\x01\x7f"));
+        dual.member("utf8", std::string("\xc5\xbc\xc3\xb3\xc5\x82w"));
+        EXPECT_EQ(dual.finish(), dual.document.dump(indent)) << "indent " << indent;
+    }
+}
+
+TEST(JsonWriterTest, NestsScopesAndFragments) {
+    const json tags = json::parse(R"({"camera": {"id": 7, "zones": ["a", "b"]}, "empty": []})");
+    for (int indent : {-1, 0, 3}) {
+        json document = {{"objects", json::array()}, {"tags", tags}};
+        document["objects"].push_back({{"w", 10}, {"detection", {{"label", "car"}}}, {"tensors", json::array()}});
+        document["objects"].push_back(json::object());
+
+        JsonWriter writer(indent);
+        writer.begin_object();
+        writer.key("tags");
+        writer.fragment(tags.dump(indent));
+        writer.key("objects");
+        writer.begin_array();
+        writer.begin_object();
+        writer.member("w", 10);
+        writer.key("detection");
+        writer.begin_object();
+        writer.member("label", "car");
+        writer.end_object();
+        writer.key("tensors");
+        writer.begin_array();
+        writer.end_array();
+        writer.end_object();
+        writer.begin_object();
+        writer.end_object();
+        writer.end_array();
+        writer.end_object();
+
+        EXPECT_EQ(writer.str(), document.dump(indent)) << "indent " << indent;
+    }
+}
+
+TEST(JsonWriterTest, ReusesBufferAfterReset) {
+    JsonWriter writer;
+    writer.begin_array();
+    writer.value("first");
+    writer.end_array();
+
+    writer.reset(-1);
+    writer.begin_object();
+    writer.member("id", 1);
+    writer.end_object();
+    EXPECT_EQ(writer.str(), R"({"id":1})");
+}
+
+TEST(CborWriterTest, DecodesToEquivalentDocument) {
+    const json tags = json::parse(R"({"camera": {"id": 7, "zones": ["a", "b"]}, "empty": []})");
+    std::string encoded_tags;
+    json::to_cbor(tags, encoded_tags);
+
+    CborWriter writer;
+    writer.begin_object();
+    writer.member("y", 2);
+    writer.member("negative", -25);
+    writer.member("min", INT64_MIN);
+    writer.member("max", UINT64_MAX);
+    writer.member("confidence", 0.8);
+    writer.member("nothing", nullptr);
+    writer.member("utf8", std::string("\xc5\xbc\xc3\xb3\xc5\x82w"));
+    writer.key("tags");
+    writer.fragment(encoded_tags);
+    writer.key("objects");
+    writer.begin_array();
+    writer.begin_object();
+    writer.member("w", 10u);
+    writer.end_object();
+    writer.begin_array();
+    writer.end_array();
+    writer.end_array();
+    writer.end_object();
+
+    const json expected = {{"y", 2},
+                           {"negative", -25},
+                           {"min", INT64_MIN},
+                           {"max", UINT64_MAX},
+                           {"confidence", 0.8},
+                           {"nothing", nullptr},
+                           {"utf8", "\xc5\xbc\xc3\xb3\xc5\x82w"},
+                           {"tags", tags},
+                           {"objects", {{{"w", 10}}, json::array()}}};
+    EXPECT_EQ(json::from_cbor(writer.str()), expected);
+}
+
+TEST(CborWriterTest, WritesBytesAndShortestHeads) {
+    const float data[] = {0.25f, -1.5f, 3.0f};
+    CborWriter writer;
+    writer.begin_array();
+    writer.bytes(data, sizeof(data));
+    for (uint64_t value : {23ull, 24ull, 256ull, 65536ull, 1ull << 32})
+        writer.value(value);
+    writer.end_array();
+
+    const std::string &encoded = writer.str();
+    // Array head, byte string head, 12 bytes, then 1 + 2 + 3 + 5 + 9 bytes of integers and break
+    EXPECT_EQ(encoded.size(), 1 + 1 + sizeof(data) + 1 + 2 + 3 + 5 + 9 + 1);
+    EXPECT_EQ(static_cast<uint8_t>(encoded[1]), 0x40 | sizeof(data));
+    EXPECT_EQ(encoded.compare(2, sizeof(data), reinterpret_cast<const char *>(data), sizeof(data)), 0);
+
+    const json decoded = json::from_cbor(encoded);
+    const auto *bytes = reinterpret_cast<const uint8_t *>(data);
+    EXPECT_EQ(decoded[0], json::binary(std::vector<uint8_t>(bytes, bytes + sizeof(data))));
+    EXPECT_EQ(decoded[5], 1ull << 32);
+}
+
+namespace {
+
+constexpr int FRAME_WIDTH = 1920;
+constexpr int FRAME_HEIGHT = 1080;
+
+// Frame with detected and classified objects, classification results carry tensor data
+GstBuffer *make_frame(int objects) {
+    GstBuffer *frame = gst_buffer_new();
+    gst_buffer_add_video_meta(frame, GST_VIDEO_FRAME_FLAG_NONE, GST_VIDEO_FORMAT_BGRA, FRAME_WIDTH, FRAME_HEIGHT);
+    GstAnalyticsRelationMeta *relation_meta = gst_buffer_add_analytics_relation_meta(frame);
+    const float probabilities[] = {0.25f, 0.75f};
+    for (int i = 0; i < objects; i++) {
+        const gint x = (i % 10) * 190;
+        const gint y = (i / 10) * 100;
+        GstAnalyticsODMtd od_mtd;
+        if (!gst_analytics_relation_meta_add_od_mtd(relation_meta, g_quark_from_static_string("person"), x, y, 150, 90,
+                                                    0.9f, &od_mtd))
+            ADD_FAILURE() << "Failed to add object detection metadata";
+        GstVideoRegionOfInterestMeta *roi_meta =
+            gst_buffer_add_video_region_of_interest_meta(frame, "person", x, y, 150, 90);
+        roi_meta->id = od_mtd.id;
+
+        GstStructure *detection =
+            gst_structure_new("detection", "x_min", G_TYPE_DOUBLE, x / double(FRAME_WIDTH), "x_max", G_TYPE_DOUBLE,
+                              (x + 150) / double(FRAME_WIDTH), "y_min", G_TYPE_DOUBLE, y / double(FRAME_HEIGHT),
+                              "y_max", G_TYPE_DOUBLE, (y + 90) / double(FRAME_HEIGHT), "confidence", G_TYPE_DOUBLE,
+                              0.9, "label_id", G_TYPE_INT, 1, "precision", G_TYPE_INT, 10, NULL);
+        gst_video_region_of_interest_meta_add_param(roi_meta, detection);
+
+        GstStructure *classification = gst_structure_new(
+            "classification_layer_name:prob", "label", G_TYPE_STRING, "male", "model_name", G_TYPE_STRING,
+            "age_gender", "attribute_name", G_TYPE_STRING, "gender", "confidence", G_TYPE_DOUBLE, 0.75, "label_id",
+            G_TYPE_INT, 1, "precision", G_TYPE_INT, 10, NULL);
+        GVariant *data = g_variant_new_fixed_array(G_VARIANT_TYPE_BYTE, probabilities, sizeof(probabilities), 1);
+        gsize n_elem;
+        gst_structure_set(classification, "data_buffer", G_TYPE_VARIANT, data, "data", G_TYPE_POINTER,
+                          g_variant_get_fixed_array(data, &n_elem, 1), NULL);
+        gst_video_region_of_interest_meta_add_param(roi_meta, classification);
+    }
+    return frame;
+}
+
+GstHarness *make_harness(const char *format) {
+    GstHarness *harness = gst_harness_new("gvametaconvert");
+    gst_util_set_object_arg(G_OBJECT(harness->element), "format", format);
+    g_object_set(harness->element, "add-tensor-data", TRUE, "source", "benchmark", "tags",
+                 R"({"camera":"entrance","zone":3})", NULL);
+    gst_harness_set_src_caps_str(harness, "video/x-raw,format=BGRA,width=1920,height=1080,framerate=30/1");
+    return harness;
+}
+
+// Replaces raw FP32 tensor data of decoded CBOR message with array of numbers, as in JSON message
+void expand_tensor_data(json &value) {
+    if (value.is_array()) {
+        for (json &item : value)
+            expand_tensor_data(item);
+    } else if (value.is_object()) {
+        for (auto &[key, member] : value.items()) {
+            if (key == "data" && member.is_binary()) {
+                const auto &bytes = member.get_binary();
+                std::vector<float> values(bytes.size() / sizeof(float));
+                memcpy(values.data(), bytes.data(), values.size() * sizeof(float));
+                member = json(values);
+            } else {
+                expand_tensor_data(member);
+            }
+        }
+    }
+}
+
+} // namespace
+
+TEST(CborConverterTest, MatchesJsonMessage) {
+    GstHarness *json_harness = make_harness("json");
+    GstHarness *cbor_harness = make_harness("cbor");
+    GstBuffer *frame = make_frame(3);
+
+    GstBuffer *json_out = gst_harness_push_and_pull(json_harness, gst_buffer_copy(frame));
+    GstBuffer *cbor_out = gst_harness_push_and_pull(cbor_harness, gst_buffer_copy(frame));
+    GstGVAJSONMeta *json_meta = GST_GVA_JSON_META_GET(json_out);
+    GstGVAJSONMeta *cbor_meta = GST_GVA_JSON_META_GET(cbor_out);
+    ASSERT_NE(json_meta, nullptr);
+    ASSERT_NE(cbor_meta, nullptr);
+    EXPECT_EQ(json_meta->size, 0u);
+    ASSERT_GT(cbor_meta->size, 0u);
+
+    json decoded = json::from_cbor(cbor_meta->message, cbor_meta->message + cbor_meta->size);
+    expand_tensor_data(decoded);
+    EXPECT_EQ(decoded, json::parse(json_meta->message));
+
+    // Binary message survives buffer copy
+    GstBuffer *copy = gst_buffer_copy(cbor_out);
+    GstGVAJSONMeta *copy_meta = GST_GVA_JSON_META_GET(copy);
+    ASSERT_NE(copy_meta, nullptr);
+    ASSERT_EQ(copy_meta->size, cbor_meta->size);
+    EXPECT_EQ(memcmp(copy_meta->message, cbor_meta->message, cbor_meta->size), 0);
+
+    gst_buffer_unref(copy);
+    gst_buffer_unref(json_out);
+    gst_buffer_unref(cbor_out);
+    gst_buffer_unref(frame);
+    gst_harness_teardown(json_harness);
+    gst_harness_teardown(cbor_harness);
+}
+
+// Micro-benchmark, run with --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*
+TEST(MetaConvertBenchmark, DISABLED_HundredObjectsPerFrame) {
+    constexpr int objects = 100;
+    constexpr int frames = 2000;
+
+    for (const char *format : {"json", "cbor"}) {
+        GstHarness *harness = make_harness(format);
+        ASSERT_NE(harness, nullptr);
+        GstBuffer *frame = make_frame(objects);
+
+        // Warm up converter state, check message is produced
+        GstBuffer *out = gst_harness_push_and_pull(harness, gst_buffer_copy(frame));
+        GstGVAJSONMeta *meta = GST_GVA_JSON_META_GET(out);
+        ASSERT_NE(meta, nullptr);
+        const size_t message_size = meta->size ? meta->size : strlen(meta->message);
+        gst_buffer_unref(out);
+
+        std::vector<GstBuffer *> buffers(frames);
+        for (auto &buffer : buffers)
+            buffer = gst_buffer_copy(frame);
+
+        auto start = std::chrono::steady_clock::now();
+        for (GstBuffer *buffer : buffers)
+            gst_buffer_unref(gst_harness_push_and_pull(harness, buffer));
+        auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << "gvametaconvert format=" << format << ", " << objects << " objects with tensor data: "
+                  << elapsed / frames << " us per frame, " << message_size << " bytes per message" << std::endl;
+
+        gst_buffer_unref(frame);
+        gst_harness_teardown(harness);
+    }
+}
+
+GTEST_API_ int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    gst_init(&argc, &argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,268 @@
+/*******************************************************************************
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <file/file_writer.hpp>
+
+#include <gst/gst.h>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using json = nlohmann::json;
+namespace fs = std::filesystem;
+
+namespace {
+
+std::string read_file(const fs::path &path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+std::string record(int index) {
+    return "{\"index\":" + std::to_string(index) + "}";
+}
+
+class FileWriterTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        const auto *test = ::testing::UnitTest::GetInstance()->current_test_info();
+        _dir = fs::temp_directory_path() / (std::string("file_writer_") + test->name());
+        fs::remove_all(_dir);
+        fs::create_directories(_dir);
+        _path = _dir / "output.json";
+    }
+
+    void TearDown() override {
+        fs::remove_all(_dir);
+    }
+
+    FileWriterSettings settings(FileFormat format) const {
+        FileWriterSettings settings;
+        settings.file_path = _path.string();
+        settings.file_format = format;
+        return settings;
+    }
+
+    // Pushes records with increasing index and stops the writer
+    FileWriterStats write(const FileWriterSettings &settings, int count) {
+        FileWriter writer(nullptr);
+        EXPECT_TRUE(writer.open(settings));
+        for (int i = 0; i < count; i++) {
+            std::string message = record(i);
+            EXPECT_TRUE(writer.push(message));
+        }
+        EXPECT_TRUE(writer.close());
+        return writer.stats();
+    }
+
+    // Output file followed by rotated files in rotation order
+    std::vector<fs::path> output_files() const {
+        std::vector<fs::path> files;
+        for (int index = 1; fs::exists(_path.string() + "." + std::to_string(index)); index++)
+            files.push_back(_path.string() + "." + std::to_string(index));
+        files.push_back(_path);
+        EXPECT_EQ(static_cast<size_t>(std::distance(fs::directory_iterator(_dir), fs::directory_iterator())),
+                  files.size());
+        return files;
+    }
+
+    fs::path _dir;
+    fs::path _path;
+};
+
+} // namespace
+
+TEST(MessageRingTest, KeepsOrderUpToCapacity) {
+    MessageRing ring(3);
+    EXPECT_TRUE(ring.empty());
+    for (int round = 0; round < 4; round++) {
+        for (int i = 0; i < 3; i++) {
+            std::string message = record(i);
+            EXPECT_TRUE(ring.push(message));
+        }
+        EXPECT_TRUE(ring.full());
+        EXPECT_EQ(ring.size(), 3u);
+
+        // Message is left to the caller when the ring is full
+        std::string rejected = "rejected";
+        EXPECT_FALSE(ring.push(rejected));
+        EXPECT_EQ(rejected, "rejected");
+
+        std::string message;
+        for (int i = 0; i < 3; i++) {
+            EXPECT_TRUE(ring.pop(message));
+            EXPECT_EQ(message, record(i));
+        }
+        EXPECT_FALSE(ring.pop(message));
+        EXPECT_TRUE(ring.empty());
+        EXPECT_EQ(ring.size(), 0u);
+    }
+}
+
+TEST(MessageRingTest, PassesMessagesBetweenThreads) {
+    constexpr int count = 100000;
+    MessageRing ring(16);
+    std::thread producer([&] {
+        for (int i = 0; i < count; i++) {
+            std::string message = record(i);
+            while (!ring.push(message))
+                std::this_thread::yield();
+        }
+    });
+
+    std::string message;
+    for (int i = 0; i < count; i++) {
+        while (!ring.pop(message))
+            std::this_thread::yield();
+        ASSERT_EQ(message, record(i));
+    }
+    producer.join();
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST_F(FileWriterTest, WritesJsonArray) {
+    const FileWriterStats stats = write(settings(GVA_META_PUBLISH_JSON), 100);
+    EXPECT_EQ(stats.written_messages, 100u);
+    EXPECT_EQ(stats.dropped_messages, 0u);
+
+    const json document = json::parse(read_file(_path));
+    ASSERT_TRUE(document.is_array());
+    ASSERT_EQ(document.size(), 100u);
+    for (int i = 0; i < 100; i++)
+        EXPECT_EQ(document[i]["index"], i);
+}
+
+TEST_F(FileWriterTest, RotatedJsonFilesAreValidArrays) {
+    for (FileIoMode io_mode : {GVA_META_PUBLISH_IO_BUFFERED, GVA_META_PUBLISH_IO_MMAP}) {
+        SetUp();
+        FileWriterSettings file_settings = settings(GVA_META_PUBLISH_JSON);
+        file_settings.io_mode = io_mode;
+        file_settings.flush_count = 1;
+        file_settings.flush_interval = 0;
+        file_settings.max_file_size = 64;
+        write(file_settings, 50);
+
+        // Every file is a complete array, records keep their order across files
+        const std::vector<fs::path> files = output_files();
+        EXPECT_GT(files.size(), 2u);
+        int next = 0;
+        for (const fs::path &file : files) {
+            const json document = json::parse(read_file(file));
+            ASSERT_TRUE(document.is_array()) << file;
+            if (file != _path)
+                EXPECT_FALSE(document.empty()) << file;
+            for (const json &item : document)
+                EXPECT_EQ(item["index"], next++);
+        }
+        EXPECT_EQ(next, 50) << "io mode " << io_mode;
+    }
+}
+
+TEST_F(FileWriterTest, FileWithoutRecordsIsNotRotated) {
+    FileWriterSettings file_settings = settings(GVA_META_PUBLISH_JSON);
+    file_settings.flush_interval = 0;
+    file_settings.max_file_size = 1;
+
+    FileWriter writer(nullptr);
+    ASSERT_TRUE(writer.open(file_settings));
+    std::string message = record(0);
+    ASSERT_TRUE(writer.push(message));
+    // Writer wakes up a few times while idle
+    std::this_thread::sleep_for(std::chrono::milliseconds(350));
+    ASSERT_TRUE(writer.close());
+
+    const std::vector<fs::path> files = output_files();
+    ASSERT_EQ(files.size(), 2u);
+    EXPECT_EQ(json::parse(read_file(files[0])), json::array({json::parse(record(0))}));
+    EXPECT_EQ(json::parse(read_file(files[1])), json::array());
+}
+
+TEST_F(FileWriterTest, RotatesByTime) {
+    FileWriterSettings file_settings = settings(GVA_META_PUBLISH_JSON_LINES);
+    file_settings.flush_interval = 0;
+    file_settings.rotation_interval = 1;
+
+    FileWriter writer(nullptr);
+    ASSERT_TRUE(writer.open(file_settings));
+    std::string message = record(0);
+    ASSERT_TRUE(writer.push(message));
+    std::this_thread::sleep_for(std::chrono::milliseconds(1300));
+    message = record(1);
+    ASSERT_TRUE(writer.push(message));
+    ASSERT_TRUE(writer.close());
+
+    const std::vector<fs::path> files = output_files();
+    ASSERT_EQ(files.size(), 2u);
+    EXPECT_EQ(read_file(files[0]), record(0) + "\n\n");
+    EXPECT_EQ(read_file(files[1]), record(1) + "\n\n");
+}
+
+TEST_F(FileWriterTest, DropNewestKeepsWrittenRecordsInOrder) {
+    constexpr int count = 20000;
+    FileWriterSettings file_settings = settings(GVA_META_PUBLISH_JSON_LINES);
+    file_settings.queue_size = 1;
+    file_settings.flush_count = 1;
+    file_settings.drop_policy = GVA_META_PUBLISH_DROP_NEWEST;
+    const FileWriterStats stats = write(file_settings, count);
+    EXPECT_EQ(stats.written_messages + stats.dropped_messages, static_cast<uint64_t>(count));
+
+    std::istringstream lines(read_file(_path));
+    std::string line;
+    uint64_t written = 0;
+    int previous = -1;
+    while (std::getline(lines, line)) {
+        if (line.empty())
+            continue;
+        const int index = json::parse(line)["index"];
+        EXPECT_GT(index, previous);
+        previous = index;
+        written++;
+    }
+    EXPECT_EQ(written, stats.written_messages);
+}
+
+TEST_F(FileWriterTest, BlockPolicyWritesAllRecords) {
+    constexpr int count = 20000;
+    FileWriterSettings file_settings = settings(GVA_META_PUBLISH_JSON_LINES);
+    file_settings.queue_size = 1;
+    file_settings.flush_count = 1;
+    const FileWriterStats stats = write(file_settings, count);
+    EXPECT_EQ(stats.written_messages, static_cast<uint64_t>(count));
+    EXPECT_EQ(stats.dropped_messages, 0u);
+    EXPECT_LE(stats.max_queue_depth, 1u);
+}
+
+TEST_F(FileWriterTest, MemoryMappedFileHasWrittenSize) {
+    FileWriterSettings file_settings = settings(GVA_META_PUBLISH_JSON_LINES);
+    file_settings.io_mode = GVA_META_PUBLISH_IO_MMAP;
+    file_settings.flush_count = 7;
+
+    // JSON Lines are appended to the existing file
+    std::string expected;
+    for (int run = 0; run < 2; run++) {
+        const FileWriterStats stats = write(file_settings, 1000);
+        EXPECT_EQ(stats.written_messages, 1000u);
+        for (int i = 0; i < 1000; i++)
+            expected += record(i) + "\n";
+        expected += "\n";
+    }
+    // Mapped file is grown in chunks and truncated on close
+    EXPECT_EQ(fs::file_size(_path), expected.size());
+    EXPECT_EQ(read_file(_path), expected);
+}
+
+GTEST_API_ int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    gst_init(&argc, &argv);
+    return RUN_ALL_TESTS();
+}
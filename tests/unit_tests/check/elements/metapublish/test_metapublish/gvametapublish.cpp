@@ -14,6 +14,7 @@
 #ifdef PAHO_INC
 #pragma message "gvametapublish test prepared with MQTT support"
 #include <MQTTAsync.h>
+#include <mutex>
 #include <uuid/uuid.h>
 #endif
 
@@ -35,6 +36,7 @@ FAKE_VALUE_FUNC(int, MQTTAsync_setCallbacks, MQTTAsync, void *, MQTTAsync_connec
                 MQTTAsync_deliveryComplete *);
 #endif
 
+#include <glib/gstdio.h>
 #include <gst/video/video.h>
 
 static GstStaticPadTemplate srctemplate =
@@ -60,6 +62,7 @@ struct TestData {
     std::string method;
     bool metaadd;
     std::string message_payload;
+    std::string binary_payload;
 };
 
 char *topic = NULL;
@@ -84,6 +87,18 @@ int sendMessage_fake(MQTTAsync client, const char *msg_topic, const MQTTAsync_me
     mqtt_send_message_on_failure = response_options->onFailure;
     return 0;
 }
+// Payloads of batches, sent by the streaming thread or by the thread sending due batches
+std::mutex batch_payloads_mutex;
+std::vector<std::string> batch_payloads;
+
+int batch_sendMessage_fake(MQTTAsync client, const char *msg_topic, const MQTTAsync_message *msg,
+                           MQTTAsync_responseOptions *response_options) {
+    std::lock_guard<std::mutex> lock(batch_payloads_mutex);
+    // Batch payload is not null-terminated and binary messages may contain zero bytes
+    batch_payloads.emplace_back(static_cast<const char *>(msg->payload), msg->payloadlen);
+    return 0;
+}
+
 int mqtt_connect_fake(MQTTAsync client, const MQTTAsync_connectOptions *conn_opts) {
     (void)client;
     if (conn_opts->onSuccess)
@@ -139,6 +154,8 @@ void setup_inbuffer(GstBuffer *inbuffer, gpointer user_data) {
         GstGVAJSONMeta *meta2 = GST_GVA_JSON_META_ADD(inbuffer);
         if (test_data->message_payload != "") {
             meta2->message = strdup(test_data->message_payload.c_str());
+        } else if (!test_data->binary_payload.empty()) {
+            set_binary_message(meta2, test_data->binary_payload.data(), test_data->binary_payload.size());
         } else {
             meta2->message = nullptr;
         }
@@ -167,6 +184,7 @@ void reset_mock_functions() {
     RESET_FAKE(MQTTAsync_disconnect);
     RESET_FAKE(MQTTAsync_destroy);
     RESET_FAKE(MQTTAsync_setCallbacks);
+    batch_payloads.clear();
 #endif
 
     FFF_RESET_HISTORY();
@@ -208,6 +226,29 @@ GST_START_TEST(test_metapublish_file_no_message) {
 }
 GST_END_TEST;
 
+GST_START_TEST(test_metapublish_file_batched_writer) {
+    g_print("Starting test: %s", "test_metapublish_file_batched_writer\n");
+    const gchar *file_path = "metapublish_test_files/metapublish_batched_test.jsonl";
+    for (int i = 0; i < G_N_ELEMENTS(test_data); i++) {
+        g_remove(file_path);
+        test_data[i].method = "all";
+        test_data[i].metaadd = true;
+        test_data[i].message_payload = "FakeFileMessage";
+        run_test("gvametapublish", VIDEO_CAPS_TEMPLATE_STRING, test_data[i].resolution, &srctemplate, &sinktemplate,
+                 setup_inbuffer, NULL, &test_data[i], "method", GVA_META_PUBLISH_FILE, "file-format",
+                 GVA_META_PUBLISH_JSON_LINES, "file-path", file_path, "queue-size", 1, "flush-count", 2,
+                 "flush-interval", 0, "max-file-size", G_GUINT64_CONSTANT(4096), "drop-policy",
+                 GVA_META_PUBLISH_DROP_BLOCK, NULL);
+
+        // Messages queued before the element stops are written by the time it reaches NULL state
+        gchar *contents = nullptr;
+        ck_assert(g_file_get_contents(file_path, &contents, nullptr, nullptr));
+        ck_assert_msg(g_str_has_prefix(contents, "FakeFileMessage\n"), "Unexpected file contents: %s", contents);
+        g_free(contents);
+    }
+}
+GST_END_TEST;
+
 #ifdef PAHO_INC
 
 GST_START_TEST(test_metapublish_mqtt) {
@@ -491,6 +532,61 @@ GST_START_TEST(test_metapublish_mqtt_no_client_id) {
 
 GST_END_TEST;
 
+GST_START_TEST(test_metapublish_mqtt_batch) {
+    reset_mock_functions();
+
+    MQTTAsync_connect_fake.return_val = 0;
+    MQTTAsync_isConnected_fake.return_val = 1;
+    MQTTAsync_sendMessage_fake.custom_fake = batch_sendMessage_fake;
+    g_print("Starting test: %s", "test_metapublish_mqtt_batch\n");
+    for (int i = 0; i < G_N_ELEMENTS(test_data); i++) {
+        test_data[i].method = "all";
+        test_data[i].metaadd = true;
+        test_data[i].message_payload = "FakeMQTTMsg1";
+        run_test("gvametapublish", VIDEO_CAPS_TEMPLATE_STRING, test_data[i].resolution, &srctemplate, &sinktemplate,
+                 setup_inbuffer, NULL, &test_data[i], "method", GVA_META_PUBLISH_MQTT, "address", "172.0.0.1:1883",
+                 "mqtt-client-id", "4", "topic", "MQTTtest", "batch-size", 3, "batch-interval", 60000, "batch-format",
+                 GVA_META_PUBLISH_JSON, NULL);
+        test_data[i].message_payload = "";
+    }
+    // Incomplete batch is sent when the element stops
+    ck_assert_msg(MQTTAsync_sendMessage_fake.call_count == 1,
+                  "Expected sendMessage to be called 1 time. It was called %d times.\n",
+                  MQTTAsync_sendMessage_fake.call_count);
+    ck_assert_msg(batch_payloads.size() == 1 && batch_payloads[0] == "[FakeMQTTMsg1]",
+                  "Batch that was sent to MQTT is not JSON array of the message.\n");
+}
+
+GST_END_TEST;
+
+GST_START_TEST(test_metapublish_mqtt_batch_binary) {
+    reset_mock_functions();
+
+    // CBOR message with zero byte and bytes of JSON framing, it is sent as is in CBOR sequence
+    const std::string cbor_message("\xa1\x61\x61\x00\x0a\x2c\x5b", 7);
+    MQTTAsync_connect_fake.return_val = 0;
+    MQTTAsync_isConnected_fake.return_val = 1;
+    MQTTAsync_sendMessage_fake.custom_fake = batch_sendMessage_fake;
+    g_print("Starting test: %s", "test_metapublish_mqtt_batch_binary\n");
+    for (int i = 0; i < G_N_ELEMENTS(test_data); i++) {
+        test_data[i].method = "all";
+        test_data[i].metaadd = true;
+        test_data[i].binary_payload = cbor_message;
+        run_test("gvametapublish", VIDEO_CAPS_TEMPLATE_STRING, test_data[i].resolution, &srctemplate, &sinktemplate,
+                 setup_inbuffer, NULL, &test_data[i], "method", GVA_META_PUBLISH_MQTT, "address", "172.0.0.1:1883",
+                 "mqtt-client-id", "4", "topic", "MQTTtest", "batch-size", 2, "batch-format",
+                 GVA_META_PUBLISH_JSON_LINES, NULL);
+        test_data[i].binary_payload.clear();
+    }
+    ck_assert_msg(MQTTAsync_sendMessage_fake.call_count == 1,
+                  "Expected sendMessage to be called 1 time. It was called %d times.\n",
+                  MQTTAsync_sendMessage_fake.call_count);
+    ck_assert_msg(batch_payloads.size() == 1 && batch_payloads[0] == cbor_message,
+                  "Binary message was not sent to MQTT unframed.\n");
+}
+
+GST_END_TEST;
+
 #endif
 
 static Suite *metapublish_suite(void) {
@@ -500,6 +596,7 @@ static Suite *metapublish_suite(void) {
     suite_add_tcase(s, tc_chain);
     tcase_add_test(tc_chain, test_metapublish_file_format_json);
     tcase_add_test(tc_chain, test_metapublish_file_no_message);
+    tcase_add_test(tc_chain, test_metapublish_file_batched_writer);
 
 #ifdef PAHO_INC
     tcase_add_test(tc_chain, test_metapublish_mqtt);
@@ -507,6 +604,8 @@ static Suite *metapublish_suite(void) {
     tcase_add_test(tc_chain, test_metapublish_mqtt_bad_msg_published);
     tcase_add_test(tc_chain, test_metapublish_mqtt_no_meta);
     tcase_add_test(tc_chain, test_metapublish_mqtt_no_client_id);
+    tcase_add_test(tc_chain, test_metapublish_mqtt_batch);
+    tcase_add_test(tc_chain, test_metapublish_mqtt_batch_binary);
 #endif
 
     return s;
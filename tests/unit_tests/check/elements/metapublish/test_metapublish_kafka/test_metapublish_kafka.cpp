@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <common.hpp>
 #include <gvametapublishkafka.hpp>
 #include <gvametapublishkafkaimpl.hpp>
 
@@ -186,8 +187,35 @@ class GvaMetaPublishKafkaImplMocked : public GvaMetaPublishKafkaImpl<MockProduce
     uint32_t get_connection_attempt() const {
         return _connection_attempt;
     }
+    void set_batching(uint32_t batch_size, FileFormat batch_format) {
+        GValue value = G_VALUE_INIT;
+        g_value_init(&value, G_TYPE_UINT);
+        g_value_set_uint(&value, batch_size);
+        set_property(PROP_BATCH_SIZE, &value);
+        g_value_unset(&value);
+        g_value_init(&value, GST_TYPE_GVA_METAPUBLISH_FILE_FORMAT);
+        g_value_set_enum(&value, batch_format);
+        set_property(PROP_BATCH_FORMAT, &value);
+        g_value_unset(&value);
+    }
+    uint64_t get_counter(guint prop_id) {
+        GValue value = G_VALUE_INIT;
+        g_value_init(&value, G_TYPE_UINT64);
+        get_property(prop_id, &value);
+        return g_value_get_uint64(&value);
+    }
 };
 
+// Takes ownership of payload produced with MSG_FREE, as producer does
+ErrorCode produce_and_free(std::vector<std::string> &payloads, std::vector<void *> &opaques, int msgflags,
+                           void *payload, size_t len, void *msg_opaque) {
+    EXPECT_EQ(msgflags, Producer::MSG_FREE) << "Expected payload ownership handed over to producer";
+    payloads.emplace_back(static_cast<char *>(payload), len);
+    opaques.push_back(msg_opaque);
+    free(payload);
+    return ErrorCode::ERR_NO_ERROR;
+}
+
 class GvaMetaPublishKafkaImplFixture : public ::testing::Test {
   protected:
     void SetUp() final {
@@ -229,8 +257,16 @@ TEST_F(GvaMetaPublishKafkaImplFixture, test_start_fail) {
 TEST_F(GvaMetaPublishKafkaImplFixture, test_produce) {
     ASSERT_TRUE(inst->start());
     auto mock = inst->get_mock_producer();
-    EXPECT_CALL(*mock, produce).Times(1).WillOnce(::testing::Return(ErrorCode::ERR_NO_ERROR));
+    std::vector<std::string> payloads;
+    std::vector<void *> opaques;
+    EXPECT_CALL(*mock, produce)
+        .Times(1)
+        .WillOnce([&](Topic *, int32_t, int msgflags, void *payload, size_t len, const std::string *, void *opaque) {
+            return produce_and_free(payloads, opaques, msgflags, payload, len, opaque);
+        });
     EXPECT_TRUE(inst->publish("TEST MESSAGE"));
+    ASSERT_EQ(payloads.size(), 1u);
+    EXPECT_EQ(payloads[0], "TEST MESSAGE") << "Expected single message published as is";
     EXPECT_CALL(*mock, flush).Times(1).WillOnce(::testing::Return(ErrorCode::ERR_NO_ERROR));
     EXPECT_TRUE(inst->stop());
 }
@@ -248,6 +284,61 @@ TEST_F(GvaMetaPublishKafkaImplFixture, test_produce_fail) {
     EXPECT_TRUE(inst->stop());
 }
 
+TEST_F(GvaMetaPublishKafkaImplFixture, test_produce_batch) {
+    inst->set_batching(3, GVA_META_PUBLISH_JSON_LINES);
+    ASSERT_TRUE(inst->start());
+    auto mock = inst->get_mock_producer();
+    std::vector<std::string> payloads;
+    std::vector<void *> opaques;
+    EXPECT_CALL(*mock, produce)
+        .Times(2)
+        .WillRepeatedly([&](Topic *, int32_t, int msgflags, void *payload, size_t len, const std::string *,
+                            void *opaque) {
+            return produce_and_free(payloads, opaques, msgflags, payload, len, opaque);
+        });
+    for (int i = 0; i < 4; i++)
+        EXPECT_TRUE(inst->publish("{\"frame\":" + std::to_string(i) + "}"));
+    ASSERT_EQ(payloads.size(), 1u) << "Expected one payload for three messages";
+    EXPECT_EQ(payloads[0], "{\"frame\":0}\n{\"frame\":1}\n{\"frame\":2}\n");
+
+    // Incomplete batch is sent on stop
+    EXPECT_CALL(*mock, flush).Times(1).WillOnce(::testing::Return(ErrorCode::ERR_NO_ERROR));
+    EXPECT_TRUE(inst->stop());
+    ASSERT_EQ(payloads.size(), 2u);
+    EXPECT_EQ(payloads[1], "{\"frame\":3}\n");
+
+    // Delivery reports count messages coalesced into payloads
+    MockMessage message;
+    EXPECT_CALL(message, err)
+        .WillOnce(::testing::Return(ErrorCode::ERR_NO_ERROR))
+        .WillOnce(::testing::Return(ErrorCode::ERR__MSG_TIMED_OUT));
+    EXPECT_CALL(message, msg_opaque).WillOnce(::testing::Return(opaques[0])).WillOnce(::testing::Return(opaques[1]));
+    EXPECT_CALL(message, errstr).WillRepeatedly(::testing::Return("Failed by test"));
+    mock->dr_msg_cb->dr_cb(message);
+    mock->dr_msg_cb->dr_cb(message);
+    EXPECT_EQ(inst->get_counter(PROP_DELIVERED_MESSAGES), 3u);
+    EXPECT_EQ(inst->get_counter(PROP_FAILED_MESSAGES), 1u);
+}
+
+TEST_F(GvaMetaPublishKafkaImplFixture, test_produce_batch_json_array) {
+    inst->set_batching(2, GVA_META_PUBLISH_JSON);
+    ASSERT_TRUE(inst->start());
+    auto mock = inst->get_mock_producer();
+    std::vector<std::string> payloads;
+    std::vector<void *> opaques;
+    EXPECT_CALL(*mock, produce)
+        .Times(1)
+        .WillOnce([&](Topic *, int32_t, int msgflags, void *payload, size_t len, const std::string *, void *opaque) {
+            return produce_and_free(payloads, opaques, msgflags, payload, len, opaque);
+        });
+    EXPECT_TRUE(inst->publish("{\"a\":1}"));
+    EXPECT_TRUE(inst->publish("{\"b\":2}"));
+    ASSERT_EQ(payloads.size(), 1u);
+    EXPECT_EQ(payloads[0], "[{\"a\":1},{\"b\":2}]");
+    EXPECT_CALL(*mock, flush).Times(1).WillOnce(::testing::Return(ErrorCode::ERR_NO_ERROR));
+    EXPECT_TRUE(inst->stop());
+}
+
 TEST_F(GvaMetaPublishKafkaImplFixture, test_flush_fail) {
     ASSERT_TRUE(inst->start()) << "Expected successful start";
     auto mock = inst->get_mock_producer();
@@ -11,6 +11,7 @@ import test_region_of_interest
 import test_video_frame
 import test_audio_event
 import test_audio_frame
+import test_cbor_metadata
 
 import test_pipeline_color_formats
 
@@ -54,6 +55,8 @@ if __name__ == '__main__':
         test_audio_event))
     suite_gstgva.addTests(loader.loadTestsFromModule(
         test_audio_frame))
+    suite_gstgva.addTests(loader.loadTestsFromModule(
+        test_cbor_metadata))
     suite_gstgva.addTests(loader.loadTestsFromModule(
         test_pipeline_gvapython))
     suite_gstgva.addTests(loader.loadTestsFromModule(
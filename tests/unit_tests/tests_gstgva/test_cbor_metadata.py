@@ -0,0 +1,60 @@
+# ==============================================================================
+# Copyright (C) 2026 Intel Corporation
+#
+# SPDX-License-Identifier: MIT
+# ==============================================================================
+
+import struct
+import unittest
+
+from gstgva.cbor_metadata import decode, decode_sequence, tensor_data, to_json_compatible
+
+
+def text(value):
+    encoded = value.encode("utf-8")
+    return bytes([0x60 | len(encoded)]) + encoded
+
+
+class CborMetadataTestCase(unittest.TestCase):
+    # Indefinite-length frame map as written by gvametaconvert format=cbor
+    def frame(self, timestamp):
+        data = struct.pack("<3f", 0.25, -1.5, 3.0)
+        tensor = (b"\xbf" + text("confidence") + b"\xfb" + struct.pack(">d", 0.5) + text("data") +
+                  bytes([0x40 | len(data)]) + data + text("precision") + text("FP32") + b"\xff")
+        roi = (b"\xbf" + text("tensors") + b"\x9f" + tensor + b"\xff" + text("x") + b"\x18\x64" + text("y") +
+               b"\x38\x63" + text("x") + b"\x01" + b"\xff")
+        return (b"\xbf" + text("objects") + b"\x9f" + roi + b"\xff" + text("resolution") + b"\xa2" +
+                text("height") + b"\x19\x04\x38" + text("width") + b"\x19\x07\x80" + text("timestamp") + b"\x1a" +
+                struct.pack(">I", timestamp) + b"\xff")
+
+    def test_decode_frame(self):
+        message = decode(self.frame(1000000))
+        self.assertEqual(message["resolution"], {"height": 1080, "width": 1920})
+        self.assertEqual(message["timestamp"], 1000000)
+
+        roi = message["objects"][0]
+        # The first of duplicated keys is kept, as in JSON message
+        self.assertEqual(roi["x"], 100)
+        self.assertEqual(roi["y"], -100)
+
+        tensor = roi["tensors"][0]
+        self.assertEqual(tensor["confidence"], 0.5)
+        self.assertEqual(tensor_data(tensor, "little").tolist(), [0.25, -1.5, 3.0])
+        self.assertEqual(to_json_compatible(tensor, "little")["data"], [0.25, -1.5, 3.0])
+
+    def test_decode_sequence(self):
+        messages = list(decode_sequence(self.frame(1) + self.frame(2)))
+        self.assertEqual([message["timestamp"] for message in messages], [1, 2])
+
+    def test_tensor_data_precision(self):
+        tensor = {"data": struct.pack("<2q", -5, 1 << 40), "precision": "I64"}
+        self.assertEqual(tensor_data(tensor, "little").tolist(), [-5, 1 << 40])
+        self.assertEqual(tensor_data({"data": b"\x01\xff", "precision": "U8"}).tolist(), [1, 255])
+
+    def test_truncated_message(self):
+        with self.assertRaises(ValueError):
+            decode(self.frame(1)[:-3])
+
+
+if __name__ == '__main__':
+    unittest.main()